@@ -163,6 +163,78 @@ static VectorPtr pyListToVector(
       variantsToFlatVector, dtype.kind(), variants, pool);
 }
 
+template <TypeKind T>
+static VectorPtr numpyToFlatVector(
+    const py::array& array,
+    facebook::velox::memory::MemoryPool* pool) {
+  using NativeType = typename TypeTraits<T>::NativeType;
+  const auto size = static_cast<vector_size_t>(array.size());
+  auto result = BaseVector::create<FlatVector<NativeType>>(
+      fromKindToScalerType(T), size, pool);
+  const auto* values = static_cast<const NativeType*>(array.data());
+  if constexpr (std::is_same_v<NativeType, bool>) {
+    // Velox packs booleans one per bit while numpy stores one per byte.
+    for (vector_size_t i = 0; i < size; i++) {
+      result->set(i, values[i]);
+    }
+  } else {
+    memcpy(result->mutableRawValues(), values, size * sizeof(NativeType));
+  }
+  return result;
+}
+
+static VectorPtr numpyArrayToVector(
+    const py::array& array,
+    facebook::velox::memory::MemoryPool* pool) {
+  if (array.ndim() != 1) {
+    throw py::value_error("Only one-dimensional arrays are supported");
+  }
+  if (array.size() > 0 && array.strides(0) != array.itemsize()) {
+    throw py::value_error("Only contiguous arrays are supported");
+  }
+
+  const auto dtype = array.dtype();
+  TypeKind kind = TypeKind::INVALID;
+  switch (dtype.kind()) {
+    case 'b':
+      kind = TypeKind::BOOLEAN;
+      break;
+    case 'i':
+      switch (dtype.itemsize()) {
+        case 1:
+          kind = TypeKind::TINYINT;
+          break;
+        case 2:
+          kind = TypeKind::SMALLINT;
+          break;
+        case 4:
+          kind = TypeKind::INTEGER;
+          break;
+        case 8:
+          kind = TypeKind::BIGINT;
+          break;
+      }
+      break;
+    case 'f':
+      switch (dtype.itemsize()) {
+        case 4:
+          kind = TypeKind::REAL;
+          break;
+        case 8:
+          kind = TypeKind::DOUBLE;
+          break;
+      }
+      break;
+  }
+  if (kind == TypeKind::INVALID) {
+    throw py::type_error(
+        "Unsupported numpy dtype: " + py::cast<std::string>(py::str(dtype)));
+  }
+
+  return VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+      numpyToFlatVector, kind, array, pool);
+}
+
 template <typename NativeType>
 static py::object getItemFromSimpleVector(
     SimpleVectorPtr<NativeType>& vector,
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
@@ -129,6 +130,15 @@ static inline VectorPtr pyListToVector(
     const Type& dtype,
     facebook::velox::memory::MemoryPool* pool);
 
+template <TypeKind T>
+static VectorPtr numpyToFlatVector(
+    const py::array& array,
+    facebook::velox::memory::MemoryPool* pool);
+
+static inline VectorPtr numpyArrayToVector(
+    const py::array& array,
+    facebook::velox::memory::MemoryPool* pool);
+
 template <TypeKind T>
 static VectorPtr createDictionaryVector(
     BufferPtr baseVector,
@@ -338,18 +348,34 @@ static void registerTypedVectors(
             return v->slice(start, length);
           });
 
-  py::class_<
+  auto flatVectorClass = py::class_<
       FlatVector<NativeType>,
       FlatVectorPtr<NativeType>,
       SimpleVector<NativeType>>(
       m,
       ("FlatVector_" + typeName).c_str(),
-      py::module_local(asModuleLocalDefinitions))
-      .def(
-          "__setitem__",
-          [](FlatVectorPtr<NativeType> v, vector_size_t idx, py::handle& obj) {
-            setItemInFlatVector(v, idx, obj);
-          });
+      py::module_local(asModuleLocalDefinitions),
+      py::buffer_protocol());
+  flatVectorClass.def(
+      "__setitem__",
+      [](FlatVectorPtr<NativeType> v, vector_size_t idx, py::handle& obj) {
+        setItemInFlatVector(v, idx, obj);
+      });
+  // Fixed-width values are laid out one per element, so numpy and memoryview
+  // can view them in place. Booleans are packed one per bit and strings are
+  // variable width; those keep going through __getitem__.
+  if constexpr (
+      std::is_arithmetic_v<NativeType> && !std::is_same_v<NativeType, bool>) {
+    flatVectorClass.def_buffer([](FlatVector<NativeType>& vector) {
+      return py::buffer_info(
+          vector.mutableRawValues(),
+          sizeof(NativeType),
+          py::format_descriptor<NativeType>::format(),
+          1,
+          {static_cast<py::ssize_t>(vector.size())},
+          {static_cast<py::ssize_t>(sizeof(NativeType))});
+    });
+  }
 
   py::class_<
       ConstantVector<NativeType>,
@@ -474,6 +500,13 @@ static void addVectorBindings(
       },
       py::arg("list"),
       py::arg("dtype") = nullptr);
+  m.def(
+      "from_numpy",
+      [](const py::array& array) {
+        return numpyArrayToVector(
+            array, PyVeloxContext::getSingletonInstance().pool());
+      },
+      py::arg("array"));
   m.def(
       "constant_vector",
       [](const py::handle& obj, vector_size_t length, TypePtr type) {
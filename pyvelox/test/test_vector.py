@@ -12,6 +12,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import numpy as np
 import pyarrow as pa
 import pyvelox.pyvelox as pv
 import unittest
@@ -304,6 +305,49 @@ class TestVeloxVector(unittest.TestCase):
         with self.assertRaises(NotImplementedError):
             e = a[3:8:3]
 
+    def test_numpy_view(self):
+        test_cases = [
+            ([1, 2, 3, 4], np.int64),
+            ([1.5, 2.5, 3.5, 4.5], np.float64),
+        ]
+        for data, expected_dtype in test_cases:
+            with self.subTest(data=data):
+                vector = pv.from_list(data)
+                view = np.asarray(vector)
+
+                self.assertEqual(view.dtype, expected_dtype)
+                self.assertListEqual(view.tolist(), data)
+
+                # The view aliases the vector's values buffer; no copy is made.
+                vector[1] = data[0]
+                self.assertEqual(view[1], data[0])
+
+    def test_from_numpy(self):
+        test_cases = [
+            (np.array([1, 2, 3], dtype=np.int8), pv.TinyintType()),
+            (np.array([1, 2, 3], dtype=np.int16), pv.SmallintType()),
+            (np.array([1, 2, 3], dtype=np.int32), pv.IntegerType()),
+            (np.array([1, 2, 3], dtype=np.int64), pv.BigintType()),
+            (np.array([0.5, 1.5], dtype=np.float32), pv.RealType()),
+            (np.array([0.5, 1.5], dtype=np.float64), pv.DoubleType()),
+            (np.array([True, False, True]), pv.BooleanType()),
+        ]
+        for data, expected_type in test_cases:
+            with self.subTest(dtype=data.dtype):
+                vector = pv.from_numpy(data)
+
+                self.assertEqual(vector.dtype(), expected_type)
+                self.assertEqual(len(vector), len(data))
+                for i in range(len(data)):
+                    self.assertEqual(vector[i], data[i])
+
+        with self.assertRaises(ValueError):
+            pv.from_numpy(np.zeros((2, 2)))
+        with self.assertRaises(ValueError):
+            pv.from_numpy(np.arange(10)[::2])
+        with self.assertRaises(TypeError):
+            pv.from_numpy(np.array(["x", "y"], dtype=object))
+
     def test_export_to_arrow(self):
         test_cases = [
             ([1, 2, 3], pa.int64()),
@@ -172,9 +172,10 @@ setup(
         "typing",
         "tabulate",
         "typing-inspect",
+        "numpy",
         "pyarrow",
     ],
-    extras_require={"tests": ["pyarrow"]},
+    extras_require={"tests": ["numpy", "pyarrow"]},
     python_requires=">=3.7",
     classifiers=[
         "Intended Audience :: Developers",
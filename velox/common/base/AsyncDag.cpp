@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/AsyncDag.h"
+
+namespace facebook::velox {
+
+AsyncDag::NodeId AsyncDag::add(
+    std::function<void()> work,
+    const std::vector<NodeId>& dependencies) {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK(!started_, "AsyncDag: add() called after start()");
+  const NodeId id = nodes_.size();
+  Node node;
+  node.work = std::move(work);
+  for (auto dependency : dependencies) {
+    VELOX_CHECK_GE(dependency, 0);
+    VELOX_CHECK_LT(
+        dependency, id, "AsyncDag: node may only depend on earlier nodes");
+    nodes_[dependency].children.push_back(id);
+    ++node.numPendingDependencies;
+  }
+  nodes_.push_back(std::move(node));
+  return id;
+}
+
+void AsyncDag::start() {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK(!started_, "AsyncDag: start() called twice");
+  started_ = true;
+  if (cancelled_) {
+    return;
+  }
+  for (NodeId id = 0; id < nodes_.size(); ++id) {
+    if (nodes_[id].numPendingDependencies == 0) {
+      nodes_[id].state = State::kReady;
+      scheduleLocked(id);
+    }
+  }
+  maybeNotifyLocked();
+}
+
+void AsyncDag::scheduleLocked(NodeId node) {
+  if (executor_ == nullptr) {
+    return;
+  }
+  executor_->add([self = shared_from_this(), node]() { self->runNode(node); });
+}
+
+void AsyncDag::cancel() {
+  std::lock_guard<std::mutex> l(mutex_);
+  cancelLocked();
+  maybeNotifyLocked();
+}
+
+void AsyncDag::cancelLocked() {
+  cancelled_ = true;
+  for (auto& node : nodes_) {
+    if (node.state == State::kPending || node.state == State::kReady) {
+      node.state = State::kCancelled;
+      node.work = nullptr;
+      ++numTerminal_;
+    }
+  }
+}
+
+void AsyncDag::runNode(NodeId node) {
+  std::function<void()> work;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (nodes_[node].state != State::kReady) {
+      // Cancelled or picked up by another thread.
+      return;
+    }
+    nodes_[node].state = State::kRunning;
+    work = std::move(nodes_[node].work);
+  }
+  std::exception_ptr exception;
+  try {
+    work();
+  } catch (const std::exception&) {
+    exception = std::current_exception();
+  }
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    nodes_[node].state = State::kDone;
+    ++numTerminal_;
+    if (exception != nullptr) {
+      if (exception_ == nullptr) {
+        exception_ = exception;
+      }
+      // Dependents of a failed node cannot run meaningfully.
+      cancelLocked();
+    } else if (!cancelled_) {
+      for (auto child : nodes_[node].children) {
+        if (--nodes_[child].numPendingDependencies == 0) {
+          nodes_[child].state = State::kReady;
+          scheduleLocked(child);
+        }
+      }
+    }
+    maybeNotifyLocked();
+  }
+}
+
+void AsyncDag::maybeNotifyLocked() {
+  if (!started_ || numTerminal_ < nodes_.size()) {
+    return;
+  }
+  for (auto& promise : waiters_) {
+    promise.setValue();
+  }
+  waiters_.clear();
+}
+
+bool AsyncDag::wait() {
+  for (;;) {
+    NodeId ready = -1;
+    ContinueFuture future = ContinueFuture::makeEmpty();
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      VELOX_CHECK(started_, "AsyncDag: wait() called before start()");
+      if (numTerminal_ == nodes_.size()) {
+        if (exception_ != nullptr) {
+          std::rethrow_exception(exception_);
+        }
+        return !cancelled_;
+      }
+      for (NodeId id = 0; id < nodes_.size(); ++id) {
+        if (nodes_[id].state == State::kReady) {
+          ready = id;
+          break;
+        }
+      }
+      if (ready == -1) {
+        waiters_.emplace_back("AsyncDag::wait");
+        future = waiters_.back().getSemiFuture();
+      }
+    }
+    if (ready != -1) {
+      // Run the ready node on this thread instead of waiting for the
+      // executor. The executor's later run of the same node is a no-op.
+      runNode(ready);
+    } else {
+      future.wait();
+    }
+  }
+}
+
+} // namespace facebook::velox
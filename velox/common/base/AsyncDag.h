@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/Executor.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/future/VeloxPromise.h"
+
+namespace facebook::velox {
+
+/// Runs a set of interdependent one-shot computations on an executor. Each
+/// node runs after all of its dependencies have completed. Like AsyncSource,
+/// a consumer that needs the results before the executor got to a node runs
+/// that node on its own thread instead of idling.
+///
+/// Intended for operator setup work, e.g. preparing several independent
+/// structures while an upstream stage is still producing, with cancellation
+/// tied to the owning task: the owner calls cancel() when the task
+/// terminates, which prevents nodes that have not started from running;
+/// nodes already running complete normally.
+///
+/// Nodes are added before start() and may only depend on previously added
+/// nodes, so the graph is acyclic by construction. If a node throws, the
+/// remaining nodes are cancelled and the first exception is rethrown from
+/// wait().
+///
+/// Must be owned by std::shared_ptr; work scheduled on the executor keeps the
+/// dag alive, so destruction never races with running nodes.
+class AsyncDag : public std::enable_shared_from_this<AsyncDag> {
+ public:
+  using NodeId = int32_t;
+
+  /// Creates a dag that runs nodes on 'executor'. If 'executor' is nullptr,
+  /// nodes only run on threads that call wait().
+  static std::shared_ptr<AsyncDag> create(
+      folly::Executor* FOLLY_NULLABLE executor) {
+    return std::shared_ptr<AsyncDag>(new AsyncDag(executor));
+  }
+
+  /// Adds a computation that runs after all 'dependencies' have completed.
+  /// Returns the id to use for dependent nodes. May only be called before
+  /// start().
+  NodeId add(
+      std::function<void()> work,
+      const std::vector<NodeId>& dependencies = {});
+
+  /// Schedules the nodes without dependencies on the executor. Call exactly
+  /// once, after all nodes have been added.
+  void start();
+
+  /// Prevents nodes that have not started from running. Nodes already
+  /// running complete normally. Idempotent.
+  void cancel();
+
+  /// Blocks until every node has completed or been cancelled. Nodes that are
+  /// ready but not picked up by the executor run on the caller thread.
+  /// Rethrows the first exception thrown by a node. Returns true if all
+  /// nodes ran, false if any were cancelled.
+  bool wait();
+
+ private:
+  enum class State { kPending, kReady, kRunning, kDone, kCancelled };
+
+  struct Node {
+    std::function<void()> work;
+    std::vector<NodeId> children;
+    int32_t numPendingDependencies{0};
+    State state{State::kPending};
+  };
+
+  explicit AsyncDag(folly::Executor* FOLLY_NULLABLE executor)
+      : executor_(executor) {}
+
+  // Schedules 'node' on 'executor_'. Called under 'mutex_'.
+  void scheduleLocked(NodeId node);
+
+  // Marks all pending and ready nodes cancelled. Called under 'mutex_'.
+  void cancelLocked();
+
+  // Runs 'node' if it is still ready, then makes its dependents ready. The
+  // entry point for both executor threads and waiters stealing work.
+  void runNode(NodeId node);
+
+  // Fulfills waiter promises if no node can make further progress. Called
+  // under 'mutex_'.
+  void maybeNotifyLocked();
+
+  folly::Executor* const FOLLY_NULLABLE executor_;
+
+  std::mutex mutex_;
+  std::vector<Node> nodes_;
+  bool started_{false};
+  bool cancelled_{false};
+  // Number of nodes in State::kDone or State::kCancelled.
+  int32_t numTerminal_{0};
+  std::exception_ptr exception_;
+  std::vector<ContinuePromise> waiters_;
+};
+
+} // namespace facebook::velox
@@ -431,7 +431,10 @@ void forEachBit(
       });
 }
 
-/// Invokes a function for each set bit.
+/// Invokes a function for each set bit. When the callback only gathers the
+/// row numbers into an array, prefer simd::indicesOfSetBits (SimdUtil.h),
+/// which expands whole bytes of the mask at a time instead of paying a
+/// callback per bit.
 template <typename Callable>
 inline void
 forEachSetBit(const uint64_t* bits, int32_t begin, int32_t end, Callable func) {
@@ -16,20 +16,95 @@
 
 #include <folly/ThreadLocal.h>
 
+#include <cmath>
+
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/RuntimeMetrics.h"
 #include "velox/common/base/SuccinctPrinter.h"
 
 namespace facebook::velox {
 
+// static
+int32_t RuntimeHistogram::bucketIndex(int64_t value) {
+  constexpr int32_t kSubBucketCount = 1 << kSubBucketBits;
+  if (value <= 0) {
+    return 0;
+  }
+  if (value < kSubBucketCount) {
+    // Small values get exact buckets.
+    return static_cast<int32_t>(value);
+  }
+  const int32_t magnitude = 63 - __builtin_clzll(value);
+  const auto subBucket = static_cast<int32_t>(
+      (value >> (magnitude - kSubBucketBits)) & (kSubBucketCount - 1));
+  return ((magnitude - kSubBucketBits + 1) << kSubBucketBits) + subBucket;
+}
+
+// static
+int64_t RuntimeHistogram::bucketValue(int32_t index) {
+  constexpr int32_t kSubBucketCount = 1 << kSubBucketBits;
+  if (index < kSubBucketCount) {
+    return index;
+  }
+  const int32_t magnitude = (index >> kSubBucketBits) + kSubBucketBits - 1;
+  const int32_t subBucket = index & (kSubBucketCount - 1);
+  return (static_cast<int64_t>(1) << magnitude) +
+      (static_cast<int64_t>(subBucket) << (magnitude - kSubBucketBits));
+}
+
+void RuntimeHistogram::addValue(int64_t value) {
+  ++buckets[bucketIndex(value)];
+}
+
+void RuntimeHistogram::merge(const RuntimeHistogram& other) {
+  for (const auto& [index, bucketCount] : other.buckets) {
+    buckets[index] += bucketCount;
+  }
+}
+
+int64_t RuntimeHistogram::estimatePercentile(double pct) const {
+  if (buckets.empty()) {
+    return 0;
+  }
+  int64_t total = 0;
+  for (const auto& [index, bucketCount] : buckets) {
+    total += bucketCount;
+  }
+  const auto target = static_cast<int64_t>(std::ceil(total * pct / 100.0));
+  int64_t seen = 0;
+  for (const auto& [index, bucketCount] : buckets) {
+    seen += bucketCount;
+    if (seen >= target) {
+      return bucketValue(index);
+    }
+  }
+  return bucketValue(buckets.rbegin()->first);
+}
+
+std::string RuntimeHistogram::toString() const {
+  return fmt::format(
+      "p50:{}, p90:{}, p99:{}",
+      estimatePercentile(50),
+      estimatePercentile(90),
+      estimatePercentile(99));
+}
+
 void RuntimeMetric::addValue(int64_t value) {
   sum += value;
   count++;
   min = std::min(min, value);
   max = std::max(max, value);
+  histogram.addValue(value);
 }
 
 void RuntimeMetric::aggregate() {
+  // Collapse the distribution to the per-driver total, matching the
+  // aggregation of 'min' and 'max' below. Merging the aggregated metrics
+  // across drivers then yields a per-driver distribution.
+  histogram.buckets.clear();
+  if (count > 0) {
+    histogram.addValue(sum);
+  }
   count = std::min(count, static_cast<int64_t>(1));
   min = max = sum;
 }
@@ -40,6 +115,7 @@ void RuntimeMetric::merge(const RuntimeMetric& other) {
   count += other.count;
   min = std::min(min, other.min);
   max = std::max(max, other.max);
+  histogram.merge(other.histogram);
 }
 
 void RuntimeMetric::printMetric(std::stringstream& stream) const {
@@ -19,6 +19,7 @@
 #include <fmt/format.h>
 #include <folly/CppAttributes.h>
 #include <limits>
+#include <map>
 #include <sstream>
 
 namespace facebook::velox {
@@ -32,6 +33,44 @@ struct RuntimeCounter {
       : value(_value), unit(_unit) {}
 };
 
+/// Sparse HDR-style histogram of non-negative values. Bucket widths grow with
+/// the value magnitude so that the lower bound of a bucket is within 12.5% of
+/// any value in it, while covering the whole int64 range with under 500
+/// buckets. Only non-empty buckets are stored, which keeps the footprint of a
+/// metric with few distinct magnitudes small and makes merging across drivers
+/// and tasks cheap. Exposes bimodal distributions, e.g. a 50/50 mix of 1ms
+/// and 100ms IO waits, that sum/count/min/max alone cannot show.
+struct RuntimeHistogram {
+  /// Number of precision bits kept within each power of two. 3 bits give 8
+  /// sub-buckets per magnitude, i.e. at most 12.5% relative bucket width.
+  static constexpr int32_t kSubBucketBits = 3;
+
+  /// Bucket index to number of recorded values, ordered by value.
+  std::map<int32_t, int64_t> buckets;
+
+  void addValue(int64_t value);
+
+  void merge(const RuntimeHistogram& other);
+
+  bool empty() const {
+    return buckets.empty();
+  }
+
+  /// Returns the index of the bucket 'value' falls in. Negative values are
+  /// clamped to zero.
+  static int32_t bucketIndex(int64_t value);
+
+  /// Returns the inclusive lower bound of the values mapped to 'index'.
+  static int64_t bucketValue(int32_t index);
+
+  /// Returns the lower bound of the bucket holding the given percentile, i.e.
+  /// at least 'pct' percent of the recorded values are below the next bucket.
+  /// 'pct' is in [0, 100]. Returns 0 for an empty histogram.
+  int64_t estimatePercentile(double pct) const;
+
+  std::string toString() const;
+};
+
 struct RuntimeMetric {
   // Sum, min, max have the same unit, count has kNone.
   RuntimeCounter::Unit unit;
@@ -40,6 +79,10 @@ struct RuntimeMetric {
   int64_t min{std::numeric_limits<int64_t>::max()};
   int64_t max{std::numeric_limits<int64_t>::min()};
 
+  // Distribution of the values recorded with addValue(), carried along when
+  // metrics are merged across drivers and tasks.
+  RuntimeHistogram histogram;
+
   explicit RuntimeMetric(
       RuntimeCounter::Unit _unit = RuntimeCounter::Unit::kNone)
       : unit(_unit) {}
@@ -47,7 +90,9 @@ struct RuntimeMetric {
   explicit RuntimeMetric(
       int64_t value,
       RuntimeCounter::Unit _unit = RuntimeCounter::Unit::kNone)
-      : unit(_unit), sum{value}, count{1}, min{value}, max{value} {}
+      : unit(_unit), sum{value}, count{1}, min{value}, max{value} {
+    histogram.addValue(value);
+  }
 
   void addValue(int64_t value);
 
@@ -47,6 +47,14 @@ class SelectivityInfo {
     return numOut_;
   }
 
+  /// Forgets the accumulated history. Used when moving to a section of data
+  /// with a possibly different value distribution, e.g. a new stripe.
+  void reset() {
+    numIn_ = 0;
+    numOut_ = 0;
+    timeClocks_ = 0;
+  }
+
  private:
   uint64_t numIn_ = 0;
   uint64_t numOut_ = 0;
@@ -15,6 +15,7 @@
  */
 
 #include "velox/common/base/SimdUtil.h"
+#include <folly/CpuId.h>
 #include <folly/Preprocessor.h>
 
 namespace facebook::velox::simd {
@@ -74,4 +75,20 @@ bool initializeSimdUtil() {
 
 static bool FB_ANONYMOUS_VARIABLE(g_simdConstants) = initializeSimdUtil();
 
+std::string_view architectureName() {
+  return xsimd::default_arch::name();
+}
+
+bool supportsArchitecture() {
+#if XSIMD_WITH_AVX2
+  return folly::CpuId().avx2();
+#elif XSIMD_WITH_SSE4_2
+  return folly::CpuId().sse42();
+#else
+  // Non-x86 builds (e.g. neon) target the platform baseline, which the
+  // platform guarantees.
+  return true;
+#endif
+}
+
 } // namespace facebook::velox::simd
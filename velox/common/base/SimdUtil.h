@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string_view>
 #include "velox/common/base/BitUtil.h"
 #include "velox/common/base/Exceptions.h"
 
@@ -43,6 +44,21 @@ constexpr int32_t kPadding = std::max(32, batchByteSize());
 // called.
 bool initializeSimdUtil();
 
+// The primitives in this file are compiled for a single architecture
+// (xsimd::default_arch) fixed at build time; there is no load-time dispatch
+// between instruction sets. The helpers below expose which architecture that
+// is and whether the host CPU supports it, so deployment code can fail fast
+// with a clear error instead of SIGILL when a binary lands on a weaker host,
+// or pick between differently built binaries.
+
+// Returns the name of the architecture the SIMD primitives are compiled for,
+// e.g. "avx2", "sse4.2" or "neon".
+std::string_view architectureName();
+
+// Returns true if the host CPU supports all instructions of the architecture
+// the SIMD primitives are compiled for.
+bool supportsArchitecture();
+
 // Returns positions of set bits in 'bits' in 'indices'. Bits from
 // 'begin' to 'end' are considered and the return value is the number
 // of found set bits. For bits 0xff and begin 2 and end 5 we have a return value
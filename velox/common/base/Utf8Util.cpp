@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/Utf8Util.h"
+
+#include <array>
+
+#include <folly/CPortability.h>
+
+#include "velox/common/base/SimdUtil.h"
+
+namespace facebook::velox {
+namespace {
+
+/// Describes the sequences a UTF-8 lead byte can start: the total size in
+/// bytes and the valid range of the first continuation byte. Continuation
+/// bytes after the first are always in [0x80, 0xBF]. Size 0 marks bytes that
+/// cannot start a sequence: continuation bytes, the overlong 2-byte leads
+/// 0xC0 and 0xC1 and bytes above 0xF4.
+struct Utf8Sequence {
+  uint8_t size;
+  uint8_t firstLo;
+  uint8_t firstHi;
+};
+
+constexpr std::array<Utf8Sequence, 256> makeUtf8Table() {
+  std::array<Utf8Sequence, 256> table{};
+  for (int32_t byte = 0; byte < 256; ++byte) {
+    if (byte < 0x80) {
+      table[byte] = {1, 0, 0};
+    } else if (byte < 0xC2) {
+      table[byte] = {0, 0, 0};
+    } else if (byte < 0xE0) {
+      table[byte] = {2, 0x80, 0xBF};
+    } else if (byte < 0xF0) {
+      // 0xE0 with a continuation below 0xA0 would be an overlong encoding;
+      // 0xED with a continuation above 0x9F would be a surrogate.
+      table[byte] = {
+          3,
+          byte == 0xE0 ? uint8_t{0xA0} : uint8_t{0x80},
+          byte == 0xED ? uint8_t{0x9F} : uint8_t{0xBF}};
+    } else if (byte < 0xF5) {
+      // 0xF0 with a continuation below 0x90 would be an overlong encoding;
+      // 0xF4 with a continuation above 0x8F would be above U+10FFFF.
+      table[byte] = {
+          4,
+          byte == 0xF0 ? uint8_t{0x90} : uint8_t{0x80},
+          byte == 0xF4 ? uint8_t{0x8F} : uint8_t{0xBF}};
+    } else {
+      table[byte] = {0, 0, 0};
+    }
+  }
+  return table;
+}
+
+constexpr auto kUtf8Table = makeUtf8Table();
+
+FOLLY_ALWAYS_INLINE bool isContinuation(uint8_t byte) {
+  return (byte & 0xC0) == 0x80;
+}
+
+// Returns the number of leading ASCII bytes in 'data'. A non-ASCII byte has
+// its high bit set, so a batch is all ASCII if its sign mask is zero.
+int64_t asciiRunLength(const uint8_t* data, int64_t size) {
+  constexpr int64_t kBatchBytes = xsimd::batch<int8_t>::size;
+  int64_t i = 0;
+  for (; i + kBatchBytes <= size; i += kBatchBytes) {
+    auto batch = xsimd::batch<int8_t>::load_unaligned(
+        reinterpret_cast<const int8_t*>(data + i));
+    const auto nonAscii =
+        simd::toBitMask(batch < xsimd::broadcast<int8_t>(0));
+    if (nonAscii != 0) {
+      return i + __builtin_ctzll(nonAscii);
+    }
+  }
+  for (; i < size; ++i) {
+    if (data[i] >= 0x80) {
+      break;
+    }
+  }
+  return i;
+}
+
+} // namespace
+
+int64_t tryGetUtf8CharLength(const char* input, int64_t size) {
+  const auto* data = reinterpret_cast<const uint8_t*>(input);
+  int64_t count = 0;
+  int64_t i = 0;
+  while (i < size) {
+    if (data[i] < 0x80) {
+      const auto run = asciiRunLength(data + i, size - i);
+      count += run;
+      i += run;
+      continue;
+    }
+    const auto& sequence = kUtf8Table[data[i]];
+    if (sequence.size == 0 || i + sequence.size > size) {
+      return -1;
+    }
+    if (data[i + 1] < sequence.firstLo || data[i + 1] > sequence.firstHi) {
+      return -1;
+    }
+    for (int32_t byte = 2; byte < sequence.size; ++byte) {
+      if (!isContinuation(data[i + byte])) {
+        return -1;
+      }
+    }
+    i += sequence.size;
+    ++count;
+  }
+  return count;
+}
+
+} // namespace facebook::velox
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::velox {
+
+/// Validates 'input' as UTF-8 and counts its characters in a single pass.
+/// Returns the number of characters if the whole buffer is valid UTF-8, -1
+/// otherwise. Rejects overlong encodings, surrogate code points and code
+/// points above U+10FFFF.
+///
+/// ASCII runs are processed a SIMD batch of bytes at a time; multi-byte
+/// sequences are checked against a 256-entry lookup table indexed by the lead
+/// byte. Callers that must produce a result for invalid buffers, e.g. to
+/// match the forgiving byte-skipping of stringCore::lengthUnicode(), should
+/// fall back to their scalar path on -1.
+int64_t tryGetUtf8CharLength(const char* input, int64_t size);
+
+} // namespace facebook::velox
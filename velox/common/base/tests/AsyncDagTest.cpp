@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/AsyncDag.h"
+#include <folly/Synchronized.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/synchronization/Baton.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include "velox/common/base/Exceptions.h"
+
+using namespace facebook::velox;
+
+class AsyncDagTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    executor_ = std::make_unique<folly::CPUThreadPoolExecutor>(4);
+  }
+
+  std::unique_ptr<folly::CPUThreadPoolExecutor> executor_;
+};
+
+TEST_F(AsyncDagTest, dependencyOrder) {
+  // A diamond: 'root' runs first, 'left' and 'right' after it, 'last' after
+  // both. Each node records its position in the completion order.
+  folly::Synchronized<std::vector<int32_t>> order;
+  auto record = [&](int32_t id) {
+    return [&order, id]() {
+      order.withWLock([&](auto& completed) { completed.push_back(id); });
+    };
+  };
+  auto dag = AsyncDag::create(executor_.get());
+  auto root = dag->add(record(0));
+  auto left = dag->add(record(1), {root});
+  auto right = dag->add(record(2), {root});
+  dag->add(record(3), {left, right});
+  dag->start();
+  ASSERT_TRUE(dag->wait());
+
+  auto completed = order.copy();
+  ASSERT_EQ(completed.size(), 4);
+  EXPECT_EQ(completed.front(), 0);
+  EXPECT_EQ(completed.back(), 3);
+}
+
+TEST_F(AsyncDagTest, waitRunsInline) {
+  // With no executor, the nodes only run on the thread that calls wait(),
+  // still in dependency order.
+  std::vector<int32_t> order;
+  auto dag = AsyncDag::create(nullptr);
+  auto first = dag->add([&]() { order.push_back(0); });
+  dag->add([&]() { order.push_back(1); }, {first});
+  dag->start();
+  ASSERT_TRUE(dag->wait());
+  EXPECT_EQ(order, (std::vector<int32_t>{0, 1}));
+}
+
+TEST_F(AsyncDagTest, error) {
+  // A failed node cancels its dependents and wait() rethrows the error.
+  std::atomic<bool> ranDependent{false};
+  auto dag = AsyncDag::create(executor_.get());
+  auto failing = dag->add(
+      []() -> void { VELOX_USER_FAIL("Testing error"); }, {});
+  dag->add([&]() { ranDependent = true; }, {failing});
+  dag->start();
+  EXPECT_THROW(dag->wait(), VeloxException);
+  EXPECT_FALSE(ranDependent);
+}
+
+TEST_F(AsyncDagTest, cancel) {
+  // Cancel before start: nothing runs. Cancel mid-run: the running node
+  // completes but nodes that have not started do not run.
+  {
+    std::atomic<int32_t> numRan{0};
+    auto dag = AsyncDag::create(executor_.get());
+    dag->add([&]() { ++numRan; });
+    dag->cancel();
+    dag->start();
+    ASSERT_FALSE(dag->wait());
+    EXPECT_EQ(numRan, 0);
+  }
+
+  {
+    std::atomic<int32_t> numRan{0};
+    folly::Baton<> started;
+    folly::Baton<> resume;
+    auto dag = AsyncDag::create(executor_.get());
+    auto blocking = dag->add([&]() {
+      started.post();
+      resume.wait();
+      ++numRan;
+    });
+    dag->add([&]() { ++numRan; }, {blocking});
+    dag->start();
+    started.wait();
+    dag->cancel();
+    resume.post();
+    ASSERT_FALSE(dag->wait());
+    EXPECT_EQ(numRan, 1);
+  }
+}
+
+TEST_F(AsyncDagTest, manyNodes) {
+  // A wide dag with a final node depending on all others, run and waited on
+  // from multiple threads.
+  constexpr int32_t kNumNodes = 100;
+  std::atomic<int32_t> numRan{0};
+  std::atomic<bool> lastRan{false};
+  auto dag = AsyncDag::create(executor_.get());
+  std::vector<AsyncDag::NodeId> all;
+  for (auto i = 0; i < kNumNodes; ++i) {
+    all.push_back(dag->add([&]() { ++numRan; }));
+  }
+  dag->add(
+      [&]() {
+        EXPECT_EQ(numRan, kNumNodes);
+        lastRan = true;
+      },
+      all);
+  dag->start();
+
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < 4; ++i) {
+    threads.push_back(std::thread([&]() { ASSERT_TRUE(dag->wait()); }));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_TRUE(lastRan);
+}
@@ -73,4 +73,64 @@ TEST_F(RuntimeMetricsTest, basic) {
   testMetric(rm3, 0, 0, 0, 0);
 };
 
+TEST_F(RuntimeMetricsTest, histogram) {
+  RuntimeHistogram h;
+  EXPECT_TRUE(h.empty());
+  EXPECT_EQ(0, h.estimatePercentile(50));
+
+  // Small values get exact buckets.
+  for (int64_t value : {0, 1, 3, 7}) {
+    EXPECT_EQ(
+        value,
+        RuntimeHistogram::bucketValue(RuntimeHistogram::bucketIndex(value)));
+  }
+
+  // Bucket lower bounds are within 12.5% of the recorded value.
+  for (int64_t value = 8; value < (1LL << 40); value = value * 3 + 1) {
+    const auto lowerBound =
+        RuntimeHistogram::bucketValue(RuntimeHistogram::bucketIndex(value));
+    EXPECT_LE(lowerBound, value);
+    EXPECT_GT(lowerBound * 8, value * 7);
+  }
+
+  // A 50/50 mix of 1ms and 100ms latencies shows up in the percentiles.
+  for (auto i = 0; i < 500; ++i) {
+    h.addValue(1'000'000);
+    h.addValue(100'000'000);
+  }
+  const auto p50 = h.estimatePercentile(50);
+  EXPECT_GT(p50, 800'000);
+  EXPECT_LE(p50, 1'000'000);
+  const auto p99 = h.estimatePercentile(99);
+  EXPECT_GT(p99, 80'000'000);
+  EXPECT_LE(p99, 100'000'000);
+
+  // Merging adds up bucket counts.
+  RuntimeHistogram other;
+  other.addValue(1'000'000);
+  other.merge(h);
+  EXPECT_EQ(2, other.buckets.size());
+  EXPECT_EQ(501, other.buckets.begin()->second);
+  EXPECT_EQ(500, other.buckets.rbegin()->second);
+}
+
+TEST_F(RuntimeMetricsTest, metricHistogram) {
+  RuntimeMetric rm1{RuntimeCounter::Unit::kNanos};
+  rm1.addValue(100);
+  rm1.addValue(200);
+
+  RuntimeMetric rm2{RuntimeCounter::Unit::kNanos};
+  rm2.addValue(300);
+  rm1.merge(rm2);
+  EXPECT_EQ(3, rm1.histogram.buckets.size());
+
+  // Aggregation collapses the distribution to the per-metric total, so
+  // merging aggregated metrics yields a per-driver distribution.
+  rm1.aggregate();
+  EXPECT_EQ(1, rm1.histogram.buckets.size());
+  EXPECT_EQ(
+      RuntimeHistogram::bucketIndex(600),
+      rm1.histogram.buckets.begin()->first);
+}
+
 } // namespace facebook::velox
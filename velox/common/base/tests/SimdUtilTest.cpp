@@ -312,6 +312,13 @@ TEST_F(SimdUtilTest, memory) {
   }
 }
 
+TEST_F(SimdUtilTest, architecture) {
+  EXPECT_FALSE(simd::architectureName().empty());
+  // This process is running the compiled-in SIMD code, so the host must
+  // support it.
+  EXPECT_TRUE(simd::supportsArchitecture());
+}
+
 TEST_F(SimdUtilTest, crc32) {
   uint32_t checksum = 0;
   checksum = simd::crc32U64(0, 123456789);
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/Utf8Util.h"
+
+#include <gtest/gtest.h>
+
+namespace facebook::velox {
+namespace {
+
+int64_t charLength(const std::string& input) {
+  return tryGetUtf8CharLength(input.data(), input.size());
+}
+
+TEST(Utf8UtilTest, ascii) {
+  EXPECT_EQ(charLength(""), 0);
+  EXPECT_EQ(charLength("a"), 1);
+  EXPECT_EQ(charLength("hello, world"), 12);
+
+  // Longer than any SIMD batch.
+  std::string longAscii(1'000, 'x');
+  EXPECT_EQ(charLength(longAscii), 1'000);
+
+  // A 2-byte character in every position of a long string.
+  for (size_t i = 0; i < longAscii.size(); ++i) {
+    auto copy = longAscii;
+    copy[i] = '\xC3';
+    copy.insert(i + 1, 1, '\xA9');
+    EXPECT_EQ(charLength(copy), 1'000) << "at " << i;
+  }
+}
+
+TEST(Utf8UtilTest, multiByte) {
+  // 2, 3 and 4 byte characters.
+  EXPECT_EQ(charLength("\xC3\xA9"), 1);
+  EXPECT_EQ(charLength("\xE4\xBF\xA1"), 1);
+  EXPECT_EQ(charLength("\xF0\x9F\x98\x80"), 1);
+  EXPECT_EQ(charLength("a\xC3\xA9b\xE4\xBF\xA1c\xF0\x9F\x98\x80"), 6);
+
+  // Boundary code points of each sequence size: U+0080, U+07FF, U+0800,
+  // U+FFFF, U+10000 and U+10FFFF.
+  EXPECT_EQ(charLength("\xC2\x80"), 1);
+  EXPECT_EQ(charLength("\xDF\xBF"), 1);
+  EXPECT_EQ(charLength("\xE0\xA0\x80"), 1);
+  EXPECT_EQ(charLength("\xEF\xBF\xBF"), 1);
+  EXPECT_EQ(charLength("\xF0\x90\x80\x80"), 1);
+  EXPECT_EQ(charLength("\xF4\x8F\xBF\xBF"), 1);
+}
+
+TEST(Utf8UtilTest, invalid) {
+  // Stray continuation byte.
+  EXPECT_EQ(charLength("\x80"), -1);
+  EXPECT_EQ(charLength("abc\xBF"), -1);
+
+  // Truncated sequences.
+  EXPECT_EQ(charLength("\xC3"), -1);
+  EXPECT_EQ(charLength("\xE4\xBF"), -1);
+  EXPECT_EQ(charLength("\xF0\x9F\x98"), -1);
+
+  // Lead byte followed by a non-continuation byte.
+  EXPECT_EQ(charLength("\xC3("), -1);
+  EXPECT_EQ(charLength("\xE4\xBF("), -1);
+
+  // Overlong encodings.
+  EXPECT_EQ(charLength("\xC0\xAF"), -1);
+  EXPECT_EQ(charLength("\xC1\xBF"), -1);
+  EXPECT_EQ(charLength("\xE0\x9F\xBF"), -1);
+  EXPECT_EQ(charLength("\xF0\x8F\xBF\xBF"), -1);
+
+  // Surrogates.
+  EXPECT_EQ(charLength("\xED\xA0\x80"), -1);
+  EXPECT_EQ(charLength("\xED\xBF\xBF"), -1);
+
+  // Above U+10FFFF.
+  EXPECT_EQ(charLength("\xF4\x90\x80\x80"), -1);
+  EXPECT_EQ(charLength("\xF5\x80\x80\x80"), -1);
+
+  // Invalid byte after a long ASCII run that is scanned in batches.
+  std::string longAscii(100, 'x');
+  EXPECT_EQ(charLength(longAscii + "\x80"), -1);
+}
+
+} // namespace
+} // namespace facebook::velox
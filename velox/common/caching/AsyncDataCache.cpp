@@ -343,6 +343,8 @@ void CacheShard::evict(
   bool skipSsdSaveable = ssdCache && ssdCache->writeInProgress();
   auto now = accessTime();
   std::vector<memory::Allocation> toFree;
+  // Tiny data of evicted entries, freed outside of 'mutex_' like 'toFree'.
+  std::vector<std::string> tinyToFree;
   {
     std::lock_guard<std::mutex> l(mutex_);
     int size = entries_.size();
@@ -397,6 +399,9 @@ void CacheShard::evict(
         removeEntryLocked(candidate);
         emptySlots_.push_back(entryIndex);
         tinyFreed += candidate->tinyData_.size();
+        if (!candidate->tinyData_.empty()) {
+          tinyToFree.push_back(std::move(candidate->tinyData_));
+        }
         candidate->tinyData_.clear();
         candidate->tinyData_.shrink_to_fit();
         candidate->size_ = 0;
@@ -88,6 +88,16 @@ class CachedFactory {
     return cache_->getStats();
   }
 
+  // Removes the cached value for 'key', if any. The next generate() call on
+  // the key runs the Generator again. Use to invalidate entries known to be
+  // stale, e.g. a file handle after the file is rewritten by compaction.
+  // Values currently shared with users of the cache stay alive until released
+  // by them. Returns true if an entry was removed.
+  bool invalidate(const Key& key) {
+    std::lock_guard l(cacheMu_);
+    return cache_->erase(key);
+  }
+
   // Clear the cache and return the current cache status
   SimpleLRUCacheStats clearCache() {
     std::lock_guard l(cacheMu_);
@@ -100,6 +100,10 @@ class SimpleLRUCache {
   /// returns the cached value, when the key is present.
   std::optional<Value> get(const Key& key);
 
+  /// Removes the entry for 'key' if present. Returns true if an entry was
+  /// removed.
+  bool erase(const Key& key);
+
   void clear();
 
   /// Total size of elements in the cache (NOT the maximum size/limit).
@@ -157,6 +161,11 @@ inline std::optional<Value> SimpleLRUCache<Key, Value>::get(const Key& key) {
   return it->second;
 }
 
+template <typename Key, typename Value>
+inline bool SimpleLRUCache<Key, Value>::erase(const Key& key) {
+  return lru_.erase(key) > 0;
+}
+
 template <typename Key, typename Value>
 inline void SimpleLRUCache<Key, Value>::clear() {
   lru_.clear();
@@ -15,6 +15,7 @@
  */
 #include "velox/common/caching/SsdCache.h"
 #include <folly/Executor.h>
+#include <folly/futures/Future.h>
 #include <folly/portability/SysUio.h>
 #include "velox/common/caching/FileIds.h"
 #include "velox/common/file/FileSystems.h"
@@ -45,18 +46,46 @@ SsdCache::SsdCache(
   filesystems::getFileSystem(filePrefix_, nullptr)
       ->mkdir(std::filesystem::path(filePrefix).parent_path().string());
 
-  files_.reserve(numShards_);
+  files_.resize(numShards_);
   // Cache size must be a multiple of this so that each shard has the same max
   // size.
   uint64_t sizeQuantum = numShards_ * SsdFile::kRegionSize;
   int32_t fileMaxRegions = bits::roundUp(maxBytes, sizeQuantum) / sizeQuantum;
-  for (auto i = 0; i < numShards_; ++i) {
-    files_.push_back(std::make_unique<SsdFile>(
+  auto makeFile = [&](int32_t i) {
+    files_[i] = std::make_unique<SsdFile>(
         fmt::format("{}{}", filePrefix_, i),
         i,
         fileMaxRegions,
         checkpointIntervalBytes / numShards,
-        disableFileCow));
+        disableFileCow);
+  };
+  if (executor_ != nullptr) {
+    // Constructing a shard recovers its checkpoint, which can take a long
+    // time for a large cache. Recover all shards in parallel.
+    std::vector<folly::SemiFuture<bool>> futures;
+    futures.reserve(numShards_);
+    for (auto i = 0; i < numShards_; ++i) {
+      auto [promise, future] = folly::makePromiseContract<bool>();
+      futures.push_back(std::move(future));
+      executor_->add([i, &makeFile, _promise = std::move(promise)]() mutable {
+        _promise.setTry(folly::makeTryWith([&] {
+          makeFile(i);
+          return true;
+        }));
+      });
+    }
+    // Wait for all the tasks to finish before leaving the constructor, even
+    // when one of them fails: the tasks reference 'makeFile' and through it
+    // this partially constructed object, so none may outlive this frame.
+    auto tries = folly::collectAll(std::move(futures)).get();
+    for (auto& t : tries) {
+      // Rethrows if the recovery of the corresponding shard failed.
+      t.throwUnlessValue();
+    }
+  } else {
+    for (auto i = 0; i < numShards_; ++i) {
+      makeFile(i);
+    }
   }
 }
 
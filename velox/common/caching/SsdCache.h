@@ -34,7 +34,8 @@ class SsdCache {
   /// rounds up to 256M with 2 shards each of 128M (2 regions).
   /// If 'checkpointIntervalBytes' is non-0, the cache makes a durable
   /// checkpointed state that survives restart after each
-  /// 'checkpointIntervalBytes' written.
+  /// 'checkpointIntervalBytes' written. On construction, shards recover
+  /// their checkpoints in parallel on 'executor'.
   /// If 'setNoCowFlagForSsdFiles' is true, the cache sets 'no copy on write'
   /// flag to each file. This prevents the cache to go over the 'maxBytes',
   /// eventually use up all disk space and stop working. Should be set to true
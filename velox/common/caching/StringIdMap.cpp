@@ -19,35 +19,47 @@
 namespace facebook::velox {
 
 uint64_t StringIdMap::id(std::string_view string) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = stringToId_.find(string);
-  if (it != stringToId_.end()) {
+  auto& shard = shards_[shardIndex(string)];
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.stringToId.find(string);
+  if (it != shard.stringToId.end()) {
     return it->second;
   }
   return kNoId;
 }
 
+int64_t StringIdMap::pinnedSize() const {
+  int64_t size = 0;
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> l(shard.mutex);
+    size += shard.pinnedSize;
+  }
+  return size;
+}
+
 void StringIdMap::release(uint64_t id) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = idToString_.find(id);
-  if (it != idToString_.end()) {
+  auto& shard = shardForId(id);
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.idToString.find(id);
+  if (it != shard.idToString.end()) {
     VELOX_CHECK_LT(
         0, it->second.numInUse, "Extra release of id in StringIdMap");
     if (--it->second.numInUse == 0) {
-      pinnedSize_ -= it->second.string.size();
-      auto strIter = stringToId_.find(it->second.string);
-      assert(strIter != stringToId_.end());
-      stringToId_.erase(strIter);
-      idToString_.erase(it);
+      shard.pinnedSize -= it->second.string.size();
+      auto strIter = shard.stringToId.find(it->second.string);
+      assert(strIter != shard.stringToId.end());
+      shard.stringToId.erase(strIter);
+      shard.idToString.erase(it);
     }
   }
 }
 
 void StringIdMap::addReference(uint64_t id) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = idToString_.find(id);
+  auto& shard = shardForId(id);
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.idToString.find(id);
   VELOX_CHECK(
-      it != idToString_.end(),
+      it != shard.idToString.end(),
       "Trying to add a reference to id {} that is not in StringIdMap",
       id);
 
@@ -55,13 +67,47 @@ void StringIdMap::addReference(uint64_t id) {
 }
 
 uint64_t StringIdMap::makeId(std::string_view string) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = stringToId_.find(string);
-  if (it != stringToId_.end()) {
-    auto entry = idToString_.find(it->second);
-    VELOX_CHECK(entry != idToString_.end());
+  const auto index = shardIndex(string);
+  auto& shard = shards_[index];
+  std::lock_guard<std::mutex> l(shard.mutex);
+  return makeIdLocked(shard, index, string);
+}
+
+std::vector<StringIdLease> StringIdMap::makeLeases(
+    const std::vector<std::string_view>& strings) {
+  std::vector<StringIdLease> leases(strings.size());
+
+  // Group the strings by shard so each shard's mutex is taken at most once.
+  std::array<std::vector<int32_t>, kNumShards> rowsPerShard;
+  for (auto i = 0; i < strings.size(); ++i) {
+    rowsPerShard[shardIndex(strings[i])].push_back(i);
+  }
+
+  for (uint32_t index = 0; index < kNumShards; ++index) {
+    const auto& rows = rowsPerShard[index];
+    if (rows.empty()) {
+      continue;
+    }
+    auto& shard = shards_[index];
+    std::lock_guard<std::mutex> l(shard.mutex);
+    for (auto row : rows) {
+      leases[row].ids_ = this;
+      leases[row].id_ = makeIdLocked(shard, index, strings[row]);
+    }
+  }
+  return leases;
+}
+
+uint64_t StringIdMap::makeIdLocked(
+    Shard& shard,
+    uint32_t index,
+    std::string_view string) {
+  auto it = shard.stringToId.find(string);
+  if (it != shard.stringToId.end()) {
+    auto entry = shard.idToString.find(it->second);
+    VELOX_CHECK(entry != shard.idToString.end());
     if (++entry->second.numInUse == 1) {
-      pinnedSize_ += entry->second.string.size();
+      shard.pinnedSize += entry->second.string.size();
     }
 
     return it->second;
@@ -72,16 +118,19 @@ uint64_t StringIdMap::makeId(std::string_view string) {
   // happens because the int64 counter would have to wrap around for
   // this. Even if this happened, the time spent in the loop would
   // have a low cap since the number of mappings would in practice
-  // be in the 100K range.
+  // be in the 100K range. The shard index lives in the low bits so the
+  // owning shard can be found from the id alone.
   do {
-    entry.id = ++lastId_;
-  } while (idToString_.find(entry.id) != idToString_.end());
+    entry.id = (++shard.lastId << kShardBits) | index;
+  } while (
+      entry.id == kNoId ||
+      shard.idToString.find(entry.id) != shard.idToString.end());
   entry.numInUse = 1;
-  pinnedSize_ += entry.string.size();
+  shard.pinnedSize += entry.string.size();
   auto id = entry.id;
-  auto& entryInTable = idToString_[id] = std::move(entry);
-  stringToId_[entryInTable.string] = entry.id;
-  return lastId_;
+  auto& entryInTable = shard.idToString[id] = std::move(entry);
+  shard.stringToId[entryInTable.string] = id;
+  return id;
 }
 
 } // namespace facebook::velox
@@ -16,14 +16,23 @@
 
 #pragma once
 
+#include <array>
 #include <string_view>
 
 #include <folly/container/F14Map.h>
+#include <folly/hash/Hash.h>
 
 #include "velox/common/base/Exceptions.h"
 
 namespace facebook::velox {
 
+class StringIdLease;
+
+/// Maps strings to unique ids with reference counting, e.g. file paths to
+/// file ids. The map is sharded internally: strings are assigned to shards
+/// by hash and the shard index is stored in the low bits of the id, so
+/// concurrent lookups of different strings do not serialize on a single
+/// mutex.
 class StringIdMap {
  public:
   static constexpr uint64_t kNoId = ~0UL;
@@ -40,14 +49,18 @@ class StringIdMap {
 
   // Returns the total length of strings involved in currently referenced
   // mappings.
-  int64_t pinnedSize() const {
-    return pinnedSize_;
-  }
+  int64_t pinnedSize() const;
 
   // Returns the id for 'string' and increments its use count. Assigns a
   // new id if none exists. must be released with release() when no longer used.
   uint64_t makeId(std::string_view string);
 
+  // Returns leases for all of 'strings', assigning ids where none exist.
+  // Groups the strings by shard so that each shard's mutex is taken at most
+  // once, unlike a loop over makeId().
+  std::vector<StringIdLease> makeLeases(
+      const std::vector<std::string_view>& strings);
+
   // Decrements the use count of id and may free the associated memory if no
   // uses remain.
   void release(uint64_t id);
@@ -58,9 +71,10 @@ class StringIdMap {
   // Returns a copy of the string associated with id or empty string if id has
   // no string.
   std::string string(uint64_t id) {
-    std::lock_guard<std::mutex> l(mutex_);
-    auto it = idToString_.find(id);
-    return it == idToString_.end() ? "" : it->second.string;
+    auto& shard = shardForId(id);
+    std::lock_guard<std::mutex> l(shard.mutex);
+    auto it = shard.idToString.find(id);
+    return it == shard.idToString.end() ? "" : it->second.string;
   }
 
  private:
@@ -70,11 +84,34 @@ class StringIdMap {
     uint32_t numInUse{};
   };
 
-  std::mutex mutex_;
-  folly::F14FastMap<std::string, uint64_t> stringToId_;
-  folly::F14FastMap<uint64_t, Entry> idToString_;
-  uint64_t lastId_{};
-  uint64_t pinnedSize_{};
+  // Number of independently locked shards. Must be a power of two. The shard
+  // index occupies the low kShardBits bits of each id so that release() and
+  // addReference() find the shard without knowing the string.
+  static constexpr uint32_t kShardBits = 4;
+  static constexpr uint32_t kNumShards = 1 << kShardBits;
+  static constexpr uint64_t kShardMask = kNumShards - 1;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    folly::F14FastMap<std::string, uint64_t> stringToId;
+    folly::F14FastMap<uint64_t, Entry> idToString;
+    uint64_t lastId{};
+    uint64_t pinnedSize{};
+  };
+
+  static uint32_t shardIndex(std::string_view string) {
+    return folly::hasher<std::string_view>()(string) & kShardMask;
+  }
+
+  Shard& shardForId(uint64_t id) {
+    return shards_[id & kShardMask];
+  }
+
+  // Returns the id for 'string' in the shard at 'index', assigning a new id
+  // if none exists. The caller holds the shard's mutex.
+  uint64_t makeIdLocked(Shard& shard, uint32_t index, std::string_view string);
+
+  std::array<Shard, kNumShards> shards_;
 };
 
 // Keeps a string-id association live for the duration of this.
@@ -144,6 +181,9 @@ class StringIdLease {
   }
 
  private:
+  // StringIdMap::makeLeases adopts already acquired references directly.
+  friend class StringIdMap;
+
   StringIdMap* ids_{nullptr};
   uint64_t id_{StringIdMap::kNoId};
 };
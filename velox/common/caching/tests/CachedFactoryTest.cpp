@@ -125,6 +125,26 @@ TEST(CachedFactoryTest, clearCache) {
   EXPECT_EQ(factory.generate(1), cacheMiss(2));
 }
 
+TEST(CachedFactoryTest, invalidate) {
+  auto generator = std::make_unique<DoublerGenerator>();
+  auto* generated = &generator->generated_;
+  CachedFactory<int, int, DoublerGenerator> factory(
+      std::make_unique<SimpleLRUCache<int, int>>(1000), std::move(generator));
+  EXPECT_EQ(factory.generate(1), cacheMiss(2));
+  EXPECT_EQ(factory.generate(2), cacheMiss(4));
+  EXPECT_EQ(*generated, 2);
+
+  EXPECT_TRUE(factory.invalidate(1));
+  EXPECT_FALSE(factory.invalidate(1));
+  EXPECT_EQ(factory.currentSize(), 1);
+
+  // The invalidated key is regenerated; the other stays cached.
+  EXPECT_EQ(factory.generate(1), cacheMiss(2));
+  EXPECT_EQ(*generated, 3);
+  EXPECT_EQ(factory.generate(2), cacheHit(4));
+  EXPECT_EQ(*generated, 3);
+}
+
 TEST(CachedFactoryTest, basicExceptionHandling) {
   auto generator = std::make_unique<DoublerWithExceptionsGenerator>();
   int* generated = &generator->generated_;
@@ -71,6 +71,25 @@ TEST(SimpleLRUCache, basicCaching) {
   EXPECT_FALSE(cache.get(2).has_value());
 }
 
+TEST(SimpleLRUCache, erase) {
+  SimpleLRUCache<int, int> cache(1000);
+
+  ASSERT_TRUE(cache.add(1, 11));
+  ASSERT_TRUE(cache.add(2, 22));
+
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_FALSE(cache.get(1).has_value());
+  ASSERT_EQ(cache.get(2), std::make_optional(22));
+  EXPECT_EQ(cache.currentSize(), 1);
+
+  // Erasing a missing key is a no-op.
+  EXPECT_FALSE(cache.erase(1));
+
+  // An erased key can be re-added.
+  ASSERT_TRUE(cache.add(1, 111));
+  ASSERT_EQ(cache.get(1), std::make_optional(111));
+}
+
 TEST(SimpleLRUCache, eviction) {
   SimpleLRUCache<int, int> cache(1000);
 
@@ -16,6 +16,8 @@
 
 #include "velox/common/caching/StringIdMap.h"
 
+#include <folly/Synchronized.h>
+#include <thread>
 #include "gtest/gtest.h"
 
 using namespace facebook::velox;
@@ -40,6 +42,63 @@ TEST(StringIdMapTest, basic) {
   EXPECT_EQ(0, map.pinnedSize());
 }
 
+TEST(StringIdMapTest, makeLeases) {
+  constexpr int32_t kCount = 1000;
+  StringIdMap map;
+  std::vector<std::string> names;
+  for (auto i = 0; i < kCount; ++i) {
+    names.push_back(fmt::format("filename_{}", i));
+  }
+  std::vector<std::string_view> views(names.begin(), names.end());
+
+  auto leases = map.makeLeases(views);
+  ASSERT_EQ(leases.size(), kCount);
+  int64_t totalSize = 0;
+  for (auto i = 0; i < kCount; ++i) {
+    EXPECT_TRUE(leases[i].hasValue());
+    EXPECT_EQ(leases[i].id(), map.id(names[i]));
+    totalSize += names[i].size();
+  }
+  EXPECT_EQ(map.pinnedSize(), totalSize);
+
+  // Bulk leases pin the same ids as one-at-a-time leases.
+  for (auto i = 0; i < kCount; ++i) {
+    EXPECT_EQ(leases[i].id(), StringIdLease(map, names[i]).id());
+  }
+
+  leases.clear();
+  EXPECT_EQ(map.pinnedSize(), 0);
+}
+
+TEST(StringIdMapTest, concurrent) {
+  constexpr int32_t kNumThreads = 8;
+  constexpr int32_t kNumNames = 2000;
+  StringIdMap map;
+  std::vector<std::thread> threads;
+  folly::Synchronized<std::vector<std::vector<uint64_t>>> allIds;
+  for (auto t = 0; t < kNumThreads; ++t) {
+    threads.push_back(std::thread([&]() {
+      std::vector<StringIdLease> leases;
+      std::vector<uint64_t> ids;
+      for (auto i = 0; i < kNumNames; ++i) {
+        leases.push_back(StringIdLease(map, fmt::format("filename_{}", i)));
+        ids.push_back(leases.back().id());
+      }
+      allIds.withWLock([&](auto& list) { list.push_back(std::move(ids)); });
+    }));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // All threads must have seen the same id for each name.
+  auto ids = allIds.copy();
+  for (auto t = 1; t < kNumThreads; ++t) {
+    EXPECT_EQ(ids[0], ids[t]);
+  }
+  EXPECT_EQ(map.pinnedSize(), 0);
+}
+
 TEST(StringIdMapTest, rehash) {
   constexpr int32_t kCount = 10000;
   StringIdMap map;
@@ -94,7 +94,8 @@ uint64_t InMemoryWriteFile::size() const {
   return file_->size();
 }
 
-LocalReadFile::LocalReadFile(std::string_view path) : path_(path) {
+LocalReadFile::LocalReadFile(std::string_view path, folly::Executor* executor)
+    : executor_(executor), path_(path) {
   fd_ = open(path_.c_str(), O_RDONLY);
   VELOX_CHECK_GE(
       fd_,
@@ -114,7 +115,8 @@ LocalReadFile::LocalReadFile(std::string_view path) : path_(path) {
   size_ = rc;
 }
 
-LocalReadFile::LocalReadFile(int32_t fd) : fd_(fd) {}
+LocalReadFile::LocalReadFile(int32_t fd, folly::Executor* executor)
+    : executor_(executor), fd_(fd) {}
 
 LocalReadFile::~LocalReadFile() {
   const int ret = close(fd_);
@@ -198,6 +200,24 @@ uint64_t LocalReadFile::preadv(
   return totalBytesRead;
 }
 
+folly::SemiFuture<uint64_t> LocalReadFile::preadvAsync(
+    uint64_t offset,
+    const std::vector<folly::Range<char*>>& buffers) const {
+  if (executor_ == nullptr) {
+    return ReadFile::preadvAsync(offset, buffers);
+  }
+  auto [promise, future] = folly::makePromiseContract<uint64_t>();
+  executor_->add([this,
+                  _promise = std::move(promise),
+                  _offset = offset,
+                  _buffers = buffers]() mutable {
+    auto delegateFuture =
+        folly::makeSemiFutureWith([&] { return preadv(_offset, _buffers); });
+    _promise.setTry(std::move(delegateFuture).getTry());
+  });
+  return std::move(future);
+}
+
 uint64_t LocalReadFile::size() const {
   return size_;
 }
@@ -213,7 +233,9 @@ uint64_t LocalReadFile::memoryUsage() const {
 LocalWriteFile::LocalWriteFile(
     std::string_view path,
     bool shouldCreateParentDirectories,
-    bool shouldThrowOnFileAlreadyExists) {
+    bool shouldThrowOnFileAlreadyExists,
+    bool dropCacheOnWrite)
+    : dropCacheOnWrite_{dropCacheOnWrite} {
   auto dir = fs::path(path).parent_path();
   if (shouldCreateParentDirectories && !fs::exists(dir)) {
     VELOX_CHECK(
@@ -252,6 +274,13 @@ LocalWriteFile::~LocalWriteFile() {
   }
 }
 
+namespace {
+// Amount of newly appended data after which a file opened with
+// 'dropCacheOnWrite' starts writeback and drops the written pages from the OS
+// page cache.
+constexpr uint64_t kDropCacheThreshold = 8 << 20;
+} // namespace
+
 void LocalWriteFile::append(std::string_view data) {
   VELOX_CHECK(!closed_, "file is closed");
   const uint64_t bytes_written = fwrite(data.data(), 1, data.size(), file_);
@@ -262,6 +291,41 @@ void LocalWriteFile::append(std::string_view data) {
       bytes_written,
       data.size(),
       folly::errnoStr(errno));
+  writtenBytes_ += bytes_written;
+  if (dropCacheOnWrite_ &&
+      writtenBytes_ - writebackOffset_ >= kDropCacheThreshold) {
+    dropWrittenPagesFromCache(false);
+  }
+}
+
+void LocalWriteFile::dropWrittenPagesFromCache(bool all) {
+#ifdef __linux__
+  // Make sure the appended data is in the page cache before starting
+  // writeback.
+  if (::fflush(file_) != 0) {
+    return;
+  }
+  const auto fd = ::fileno(file_);
+  // Start asynchronous writeback of the pages appended since the last call.
+  // Never wait for it: the caller needs no durability, only that the pages
+  // become clean so a later POSIX_FADV_DONTNEED can discard them.
+  ::sync_file_range(
+      fd,
+      writebackOffset_,
+      writtenBytes_ - writebackOffset_,
+      SYNC_FILE_RANGE_WRITE);
+  // Drop the region whose writeback was started by the previous call; by now
+  // those pages are clean with high probability. On close, drop everything.
+  const uint64_t dropEnd = all ? writtenBytes_ : writebackOffset_;
+  if (dropEnd > droppedOffset_) {
+    ::posix_fadvise(
+        fd, droppedOffset_, dropEnd - droppedOffset_, POSIX_FADV_DONTNEED);
+    droppedOffset_ = dropEnd;
+  }
+  writebackOffset_ = writtenBytes_;
+#else
+  (void)all;
+#endif
 }
 
 void LocalWriteFile::flush() {
@@ -276,6 +340,9 @@ void LocalWriteFile::flush() {
 
 void LocalWriteFile::close() {
   if (!closed_) {
+    if (dropCacheOnWrite_) {
+      dropWrittenPagesFromCache(true);
+    }
     auto ret = fclose(file_);
     VELOX_CHECK_EQ(
         ret,
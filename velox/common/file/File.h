@@ -225,9 +225,16 @@ class InMemoryWriteFile final : public WriteFile {
 
 class LocalReadFile final : public ReadFile {
  public:
-  explicit LocalReadFile(std::string_view path);
+  /// If 'executor' is non-null, preadvAsync runs on it so that prefetches
+  /// overlap with decoding on the driver thread; otherwise preadvAsync falls
+  /// back to the synchronous default.
+  explicit LocalReadFile(
+      std::string_view path,
+      folly::Executor* FOLLY_NULLABLE executor = nullptr);
 
-  explicit LocalReadFile(int32_t fd);
+  explicit LocalReadFile(
+      int32_t fd,
+      folly::Executor* FOLLY_NULLABLE executor = nullptr);
 
   ~LocalReadFile();
 
@@ -240,6 +247,14 @@ class LocalReadFile final : public ReadFile {
       uint64_t offset,
       const std::vector<folly::Range<char*>>& buffers) const final;
 
+  folly::SemiFuture<uint64_t> preadvAsync(
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers) const final;
+
+  bool hasPreadvAsync() const final {
+    return executor_ != nullptr;
+  }
+
   uint64_t memoryUsage() const final;
 
   bool shouldCoalesce() const final {
@@ -261,6 +276,7 @@ class LocalReadFile final : public ReadFile {
   void preadInternal(uint64_t offset, uint64_t length, char* FOLLY_NONNULL pos)
       const;
 
+  folly::Executor* FOLLY_NULLABLE const executor_;
   std::string path_;
   int32_t fd_;
   long size_;
@@ -269,11 +285,15 @@ class LocalReadFile final : public ReadFile {
 class LocalWriteFile final : public WriteFile {
  public:
   // An error is thrown is a file already exists at |path|,
-  // unless flag shouldThrowOnFileAlreadyExists is false
+  // unless flag shouldThrowOnFileAlreadyExists is false.
+  // If 'dropCacheOnWrite' is true, the written data is flushed out of the OS
+  // page cache as the file grows. Use for data that will be read back at most
+  // once, e.g. spill files, so it does not evict warmer cached data.
   explicit LocalWriteFile(
       std::string_view path,
       bool shouldCreateParentDirectories = false,
-      bool shouldThrowOnFileAlreadyExists = true);
+      bool shouldThrowOnFileAlreadyExists = true,
+      bool dropCacheOnWrite = false);
   ~LocalWriteFile();
 
   void append(std::string_view data) final;
@@ -282,9 +302,22 @@ class LocalWriteFile final : public WriteFile {
   uint64_t size() const final;
 
  private:
+  // Starts kernel writeback of the data appended since the last call and
+  // drops the previously written-back region from the OS page cache. Drops
+  // everything written so far if 'all' is true. Best effort; only implemented
+  // on Linux.
+  void dropWrittenPagesFromCache(bool all);
+
   FILE* FOLLY_NONNULL file_;
   mutable long size_;
   bool closed_{false};
+  const bool dropCacheOnWrite_{false};
+  // Number of bytes appended so far.
+  uint64_t writtenBytes_{0};
+  // End of the region whose writeback has been started.
+  uint64_t writebackOffset_{0};
+  // End of the region already advised out of the page cache.
+  uint64_t droppedOffset_{0};
 };
 
 } // namespace facebook::velox
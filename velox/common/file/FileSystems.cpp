@@ -92,8 +92,14 @@ class LocalFileSystem : public FileSystem {
 
   std::unique_ptr<WriteFile> openFileForWrite(
       std::string_view path,
-      const FileOptions& /*unused*/) override {
-    return std::make_unique<LocalWriteFile>(extractPath(path));
+      const FileOptions& options) override {
+    bool dropCacheOnWrite = false;
+    auto it = options.values.find(FileOptions::kDropCacheOnWrite);
+    if (it != options.values.end()) {
+      dropCacheOnWrite = it->second == "true";
+    }
+    return std::make_unique<LocalWriteFile>(
+        extractPath(path), false, true, dropCacheOnWrite);
   }
 
   void remove(std::string_view path) override {
@@ -35,6 +35,12 @@ namespace facebook::velox::filesystems {
 /// MemoryPool to allocate buffers needed to read/write files on FileSystems
 /// such as S3.
 struct FileOptions {
+  /// Hints that the file's contents are written once and read back at most
+  /// once, e.g. spill data. When set to "true", local files get their written
+  /// pages flushed and dropped from the OS page cache as the file grows so
+  /// they do not evict warmer cached data. Other file systems ignore it.
+  static constexpr const char* kDropCacheOnWrite = "drop-cache-on-write";
+
   std::unordered_map<std::string, std::string> values;
   memory::MemoryPool* pool{nullptr};
 };
@@ -16,6 +16,8 @@
 
 #include <fcntl.h>
 
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
 #include "velox/common/file/File.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/exec/tests/utils/TempDirectoryPath.h"
@@ -126,6 +128,55 @@ TEST(LocalFile, writeAndRead) {
   readData(&readFile);
 }
 
+TEST(LocalFile, preadvAsync) {
+  auto tempFile = ::exec::test::TempFilePath::create();
+  const auto& filename = tempFile->path;
+  remove(filename.c_str());
+  {
+    LocalWriteFile writeFile(filename);
+    writeData(&writeFile);
+  }
+
+  folly::CPUThreadPoolExecutor executor(2);
+  LocalReadFile readFile(filename, &executor);
+  ASSERT_TRUE(readFile.hasPreadvAsync());
+
+  char head[12];
+  char tail[3 + kOneMB];
+  std::vector<folly::Range<char*>> buffers = {
+      folly::Range<char*>(head, sizeof(head)),
+      folly::Range<char*>(tail, sizeof(tail))};
+  ASSERT_EQ(15 + kOneMB, readFile.preadvAsync(0, buffers).get());
+  ASSERT_EQ(std::string_view(head, sizeof(head)), "aaaaabbbbbcc");
+}
+
+TEST(LocalFile, dropCacheOnWrite) {
+  filesystems::registerLocalFileSystem();
+  auto tempFile = ::exec::test::TempFilePath::create();
+  const auto& filename = tempFile->path.c_str();
+  remove(filename);
+  auto lfs = filesystems::getFileSystem(filename, nullptr);
+  filesystems::FileOptions options;
+  options.values[filesystems::FileOptions::kDropCacheOnWrite] = "true";
+  {
+    // Write past the writeback threshold to exercise the page cache drop
+    // path. The cache advice is invisible to readers, so only verify that the
+    // data reads back intact.
+    auto writeFile = lfs->openFileForWrite(filename, options);
+    for (auto i = 0; i < 10; ++i) {
+      writeFile->append(std::string(kOneMB, 'a' + i));
+    }
+    ASSERT_EQ(writeFile->size(), 10 * kOneMB);
+    writeFile->close();
+  }
+  auto readFile = lfs->openFileForRead(filename);
+  ASSERT_EQ(readFile->size(), 10 * kOneMB);
+  char buffer[5];
+  ASSERT_EQ(readFile->pread(3 * kOneMB, 5, &buffer), "ddddd");
+  ASSERT_EQ(readFile->pread(10 * kOneMB - 5, 5, &buffer), "jjjjj");
+  lfs->remove(filename);
+}
+
 TEST(LocalFile, viaRegistry) {
   filesystems::registerLocalFileSystem();
   auto tempFile = ::exec::test::TempFilePath::create();
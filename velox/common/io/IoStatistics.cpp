@@ -103,6 +103,7 @@ void IoStatistics::merge(const IoStatistics& other) {
   prefetch_.merge(other.prefetch_);
   read_.merge(other.read_);
   ramHit_.merge(other.ramHit_);
+  prefetchHit_.merge(other.prefetchHit_);
   ssdRead_.merge(other.ssdRead_);
   queryThreadIoLatency_.merge(other.queryThreadIoLatency_);
   std::lock_guard<std::mutex> l(operationStatsMutex_);
@@ -95,6 +95,10 @@ class IoStatistics {
     return ramHit_;
   }
 
+  IoCounter& prefetchHit() {
+    return prefetchHit_;
+  }
+
   IoCounter& queryThreadIoLatency() {
     return queryThreadIoLatency_;
   }
@@ -131,6 +135,10 @@ class IoStatistics {
   // Hits from RAM cache. Does not include first use of prefetched data.
   IoCounter ramHit_;
 
+  // First use of prefetched data. The ratio of this to 'prefetch_' tells how
+  // much of the prefetched data was actually used.
+  IoCounter prefetchHit_;
+
   // Read from SSD cache instead of storage. Includes both random and planned
   // reads.
   IoCounter ssdRead_;
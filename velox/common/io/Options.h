@@ -56,6 +56,31 @@ enum class PrefetchMode {
                 // actual reads.
 };
 
+/// IO scheduling class of a query. Speculative IO, e.g. read-ahead, issued on
+/// behalf of lower classes runs at lower priority on the IO executor when the
+/// executor supports priorities, so interactive scans are not queued behind
+/// batch or background reads.
+enum class IoSchedulingClass : int8_t {
+  kInteractive = 0,
+  kBatch = 1,
+  kBackground = 2,
+};
+
+/// Returns the scheduling class named by 'name': 'interactive', 'batch' or
+/// 'background'. Throws a user error for unknown names.
+inline IoSchedulingClass ioSchedulingClassFromName(const std::string& name) {
+  if (name == "interactive") {
+    return IoSchedulingClass::kInteractive;
+  }
+  if (name == "batch") {
+    return IoSchedulingClass::kBatch;
+  }
+  if (name == "background") {
+    return IoSchedulingClass::kBackground;
+  }
+  VELOX_USER_FAIL("Unknown IO scheduling class: '{}'", name);
+}
+
 class ReaderOptions {
  protected:
   velox::memory::MemoryPool* memoryPool;
@@ -65,6 +90,7 @@ class ReaderOptions {
   int32_t maxCoalesceDistance_{kDefaultCoalesceDistance};
   int64_t maxCoalesceBytes_{kDefaultCoalesceBytes};
   int32_t prefetchRowGroups_{kDefaultPrefetchRowGroups};
+  IoSchedulingClass ioSchedulingClass_{IoSchedulingClass::kInteractive};
 
  public:
   static constexpr int32_t kDefaultLoadQuantum = 8 << 20; // 8MB
@@ -84,6 +110,7 @@ class ReaderOptions {
     maxCoalesceDistance_ = other.maxCoalesceDistance_;
     maxCoalesceBytes_ = other.maxCoalesceBytes_;
     prefetchRowGroups_ = other.prefetchRowGroups_;
+    ioSchedulingClass_ = other.ioSchedulingClass_;
     return *this;
   }
 
@@ -137,6 +164,14 @@ class ReaderOptions {
     return *this;
   }
 
+  /**
+   * Modify the IO scheduling class.
+   */
+  ReaderOptions& setIoSchedulingClass(IoSchedulingClass ioSchedulingClass) {
+    ioSchedulingClass_ = ioSchedulingClass;
+    return *this;
+  }
+
   /**
    * Modify the number of row groups to prefetch.
    */
@@ -175,5 +210,9 @@ class ReaderOptions {
   int64_t prefetchRowGroups() const {
     return prefetchRowGroups_;
   }
+
+  IoSchedulingClass ioSchedulingClass() const {
+    return ioSchedulingClass_;
+  }
 };
 } // namespace facebook::velox::io
@@ -48,6 +48,32 @@ void AllocationPool::clear() {
   usedBytes_ = 0;
 }
 
+int64_t AllocationPool::freeRangesFrom(int32_t firstRangeIndex) {
+  VELOX_CHECK_GE(firstRangeIndex, 0);
+  int64_t freedBytes = 0;
+  while (numRanges() > firstRangeIndex) {
+    // Ranges are ordered with 'allocations_' first, so working from the back
+    // frees large allocations before small ones.
+    if (!largeAllocations_.empty()) {
+      freedBytes += largeAllocations_.back().size();
+      largeAllocations_.pop_back();
+    } else {
+      freedBytes += allocations_.back().byteSize();
+      allocations_.pop_back();
+    }
+  }
+  if (freedBytes == 0) {
+    return 0;
+  }
+  // The run allocations were made from is freed. The next allocation starts a
+  // new run.
+  startOfRun_ = nullptr;
+  bytesInRun_ = 0;
+  currentOffset_ = 0;
+  usedBytes_ -= freedBytes;
+  return freedBytes;
+}
+
 char* AllocationPool::allocateFixed(uint64_t bytes, int32_t alignment) {
   VELOX_CHECK_GT(bytes, 0, "Cannot allocate zero bytes");
   if (freeAddressableBytes() >= bytes && alignment == 1) {
@@ -37,6 +37,12 @@ class AllocationPool {
 
   void clear();
 
+  /// Frees the range at 'firstRangeIndex' and all ranges after it. The freed
+  /// ranges must no longer contain live data. The run allocations are made
+  /// from is always among the freed ranges, so the next allocation starts a
+  /// new run. Returns the number of bytes freed.
+  int64_t freeRangesFrom(int32_t firstRangeIndex);
+
   // Allocate a buffer from this pool, optionally aligned.  The alignment can
   // only be power of 2.
   char* allocateFixed(uint64_t bytes, int32_t alignment = 1);
@@ -65,6 +71,11 @@ class AllocationPool {
 
   /// Returns the number of bytes allocatable without growing 'this'.
   int64_t freeBytes() const {
+    if (startOfRun_ == nullptr) {
+      // No current run, e.g. after freeRangesFrom(). Any remaining ranges are
+      // full.
+      return 0;
+    }
     if (largeAllocations_.empty()) {
       return freeAddressableBytes();
     }
@@ -175,6 +175,25 @@ void ByteStream::appendStringPiece(folly::StringPiece value) {
   }
 }
 
+uint8_t* ByteStream::appendWindow(int32_t bytes) {
+  VELOX_DCHECK(!isBits_);
+  while (current_ == nullptr || current_->size - current_->position < bytes) {
+    if (current_ != nullptr && current_ == &ranges_.back()) {
+      // extend() expects the current range to be full. Surrender the
+      // tail of the last range that cannot fit a contiguous window.
+      // The range keeps all written content and counts as full from
+      // here on.
+      updateEnd();
+      current_->size = lastRangeEnd_;
+      current_->position = current_->size;
+    }
+    extend(bytes);
+  }
+  auto* window = current_->buffer + current_->position;
+  current_->position += bytes;
+  return window;
+}
+
 std::streampos ByteStream::tellp() const {
   if (ranges_.empty()) {
     return 0;
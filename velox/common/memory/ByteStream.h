@@ -205,14 +205,10 @@ class ByteStream {
           values.size() * sizeof(T)));
       return;
     }
-    auto target = reinterpret_cast<T*>(current_->buffer + current_->position);
-    auto end = target + values.size();
-    auto valuePtr = &values[0];
-    while (target != end) {
-      *target = *valuePtr;
-      ++target;
-      ++valuePtr;
-    }
+    ::memcpy(
+        current_->buffer + current_->position,
+        &values[0],
+        sizeof(T) * values.size());
     current_->position += sizeof(T) * values.size();
   }
 
@@ -225,6 +221,15 @@ class ByteStream {
     append(folly::Range(&value, 1));
   }
 
+  /// Returns a pointer to 'bytes' of contiguous writable space and
+  /// advances the write position past it. The caller must fill the
+  /// whole window before the next append or flush. This replaces a
+  /// size check per appended value with one check per run when a
+  /// serializer produces values one at a time. If the current range
+  /// cannot fit 'bytes' contiguously, its unwritten tail is given up
+  /// and a new range is allocated. Not for use on a bits stream.
+  uint8_t* appendWindow(int32_t bytes);
+
   void flush(OutputStream* stream);
 
   /// Returns the next byte that would be written to by a write. This
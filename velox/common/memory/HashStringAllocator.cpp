@@ -579,6 +579,16 @@ void HashStringAllocator::copyMultipartNoInline(
   if (storeStringFast(string->data(), numBytes, group + offset)) {
     return;
   }
+  // The free lists cannot serve the string in one piece. If it fits in a new
+  // slab, start one and retry the fast path so that append-only phases keep
+  // writing contiguous strings with a single header each instead of chaining
+  // multipart chunks that have to be reassembled at read time.
+  if (numBytes < static_cast<size_t>(kUnitSize / 2)) {
+    newSlab();
+    if (storeStringFast(string->data(), numBytes, group + offset)) {
+      return;
+    }
+  }
   // Write the string as non-contiguous chunks.
   ByteStream stream(this, false, false);
   auto position = newWrite(stream, numBytes);
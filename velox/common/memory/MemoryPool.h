@@ -489,6 +489,15 @@ class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
   /// Returns the next higher quantized size for the internal memory reservation
   /// propagation. Small sizes are at MB granularity, larger ones at coarser
   /// granularity.
+  ///
+  /// This is what keeps small hot-path allocations off the shared state above
+  /// the leaf: a leaf pool reserves from its parents in these quanta, so the
+  /// parent and root mutexes are only taken when the leaf's usage crosses a
+  /// quantum boundary, not per allocation. Per-allocation accounting stays in
+  /// the leaf, where single-writer pools can opt out of locking entirely via
+  /// 'threadSafe_' = false. Any cache in front of the leaf (e.g. a
+  /// thread-local freelist) would hide bytes from memory arbitration, which
+  /// must be able to attribute and reclaim all usage by pool.
   FOLLY_ALWAYS_INLINE static uint64_t quantizedSize(uint64_t size) {
     if (size < 16 * kMB) {
       return bits::roundUp(size, kMB);
@@ -636,7 +636,10 @@ std::string MmapAllocator::SizeClass::toString() const {
     }
     auto mb = (AllocationTraits::pageBytes(count * unitSize_)) >> 20;
     out << "[size " << unitSize_ << ": " << count << "(" << mb
-        << "MB) allocated " << mappedCount << " mapped";
+        << "MB) allocated " << mappedCount << " mapped"
+        << " cumulative: " << numAllocatedMapped_ << " recycled mapped, "
+        << numAllocatedUnmapped_ << " fresh mapped, " << numAdvisedAway_
+        << " advised away";
     if (mappedFreeCount != numMappedFreePages_) {
       out << "Mismatched count of mapped free pages "
           << ". Actual= " << mappedFreeCount
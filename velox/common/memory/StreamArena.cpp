@@ -62,6 +62,16 @@ void StreamArena::newRange(int32_t bytes, ByteRange* range) {
   }
 }
 
+void StreamArena::clear() {
+  allocations_.clear();
+  largeAllocations_.clear();
+  tinyRanges_.clear();
+  // Keep 'allocation_' and hand its pages out again from the start.
+  currentRun_ = 0;
+  currentOffset_ = 0;
+  size_ = allocation_.byteSize();
+}
+
 void StreamArena::newTinyRange(int32_t bytes, ByteRange* range) {
   VELOX_CHECK_GT(bytes, 0, "StreamArena::newTinyRange can't be zero length");
   tinyRanges_.emplace_back();
@@ -46,6 +46,12 @@ class StreamArena {
     return size_;
   }
 
+  /// Returns the arena to a newly constructed state, keeping the current
+  /// non-contiguous allocation for reuse by subsequent newRange() calls. All
+  /// ranges previously handed out become invalid. Used to serialize many
+  /// consecutive pages without paying the allocation cost for each.
+  virtual void clear();
+
   memory::MemoryPool* pool() const {
     return pool_;
   }
@@ -145,6 +145,36 @@ TEST_F(ByteStreamTest, remainingSize) {
   pool_->free(tempBuffer, kReadBytes);
 }
 
+TEST_F(ByteStreamTest, appendWindow) {
+  auto arena = newArena();
+  ByteStream stream(arena.get());
+  stream.startWrite(1);
+  std::vector<int64_t> reference;
+  // Alternate single-value appends with windows of varying sizes so
+  // that windows repeatedly straddle range boundaries and the stream
+  // has to give up range tails.
+  int64_t counter = 0;
+  for (auto i = 0; i < 100; ++i) {
+    const int32_t numValues = 1 + (i % 17);
+    auto* window = reinterpret_cast<int64_t*>(
+        stream.appendWindow(numValues * sizeof(int64_t)));
+    for (auto j = 0; j < numValues; ++j) {
+      window[j] = counter;
+      reference.push_back(counter++);
+    }
+    stream.appendOne<int64_t>(counter);
+    reference.push_back(counter++);
+  }
+  // The given up tails do not count into the size.
+  ASSERT_EQ(stream.size(), reference.size() * sizeof(int64_t));
+  std::stringstream referenceSStream;
+  OStreamOutputStream out(&referenceSStream);
+  stream.flush(&out);
+  auto str = referenceSStream.str();
+  ASSERT_EQ(str.size(), reference.size() * sizeof(int64_t));
+  ASSERT_EQ(0, ::memcmp(str.data(), reference.data(), str.size()));
+}
+
 TEST_F(ByteStreamTest, toString) {
   const int32_t kSize = 10;
   const int32_t kBufferSize = 4096;
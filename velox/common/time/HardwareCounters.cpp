@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/time/HardwareCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace facebook::velox {
+
+#ifdef __linux__
+namespace {
+int openPerfEvent(uint64_t config, int groupFd) {
+  struct perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  // Count user space only; kernel counting is often disallowed by
+  // perf_event_paranoid and the operators being profiled run in user space.
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return syscall(
+      __NR_perf_event_open, &attr, 0 /*pid: self*/, -1 /*cpu: any*/, groupFd, 0);
+}
+} // namespace
+
+ThreadHardwareCounters::ThreadHardwareCounters() {
+  static const uint64_t kConfigs[] = {
+      PERF_COUNT_HW_CPU_CYCLES,
+      PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES,
+      PERF_COUNT_HW_BRANCH_MISSES};
+  for (size_t i = 0; i < fds_.size(); ++i) {
+    // Schedule all events as one group (led by the cycle counter) so that they
+    // are counted over the same intervals and ratios like IPC are meaningful.
+    fds_[i] = openPerfEvent(kConfigs[i], i == 0 ? -1 : fds_[0]);
+    // Some events, e.g. LLC misses on some virtualized hosts, may be
+    // unavailable while the rest of the group works. Only the first two are
+    // required.
+    if (fds_[i] < 0 && i < 2) {
+      enabled_ = false;
+      return;
+    }
+  }
+  enabled_ = true;
+}
+
+ThreadHardwareCounters::~ThreadHardwareCounters() {
+  for (auto fd : fds_) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+}
+
+HardwareCounterValues ThreadHardwareCounters::read() const {
+  HardwareCounterValues values;
+  uint64_t* const counters[] = {
+      &values.cpuCycles,
+      &values.instructions,
+      &values.llcMisses,
+      &values.branchMisses};
+  for (size_t i = 0; i < fds_.size(); ++i) {
+    if (fds_[i] >= 0) {
+      uint64_t value;
+      if (::read(fds_[i], &value, sizeof(value)) == sizeof(value)) {
+        *counters[i] = value;
+      }
+    }
+  }
+  return values;
+}
+#else
+ThreadHardwareCounters::ThreadHardwareCounters() {}
+
+ThreadHardwareCounters::~ThreadHardwareCounters() {}
+
+HardwareCounterValues ThreadHardwareCounters::read() const {
+  return {};
+}
+#endif
+
+// static
+ThreadHardwareCounters& ThreadHardwareCounters::forCurrentThread() {
+  thread_local ThreadHardwareCounters counters;
+  return counters;
+}
+
+} // namespace facebook::velox
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace facebook::velox {
+
+/// Hardware event counts accrued by an operation on the calling thread.
+/// Cycles together with instructions give IPC; LLC and branch misses tell
+/// whether the operation is memory or branch bound.
+struct HardwareCounterValues {
+  uint64_t cpuCycles = 0;
+  uint64_t instructions = 0;
+  uint64_t llcMisses = 0;
+  uint64_t branchMisses = 0;
+
+  void add(const HardwareCounterValues& other) {
+    cpuCycles += other.cpuCycles;
+    instructions += other.instructions;
+    llcMisses += other.llcMisses;
+    branchMisses += other.branchMisses;
+  }
+};
+
+/// A group of hardware performance counters (cycles, instructions, LLC misses,
+/// branch misses) for the calling thread, backed by Linux perf events. The
+/// counters are opened on first use and count continuously for the lifetime of
+/// the thread; callers read them at two points and work with the delta, so the
+/// counters never need to be paused or reset. On platforms without perf events
+/// or when perf_event_open is not permitted (e.g. a restricted container),
+/// isEnabled() returns false and read() reports zeros.
+class ThreadHardwareCounters {
+ public:
+  /// Returns the calling thread's counter group, opening the counters on the
+  /// first call from the thread.
+  static ThreadHardwareCounters& forCurrentThread();
+
+  ~ThreadHardwareCounters();
+
+  /// True if at least the cycle and instruction counters could be opened.
+  bool isEnabled() const {
+    return enabled_;
+  }
+
+  /// Reads the cumulative counter values of the thread. Events whose counter
+  /// failed to open read as zero.
+  HardwareCounterValues read() const;
+
+ private:
+  ThreadHardwareCounters();
+
+  ThreadHardwareCounters(const ThreadHardwareCounters&) = delete;
+  ThreadHardwareCounters& operator=(const ThreadHardwareCounters&) = delete;
+
+  // File descriptors of the perf events in the order of the members of
+  // HardwareCounterValues. -1 if the event could not be opened.
+  std::array<int, 4> fds_{{-1, -1, -1, -1}};
+  bool enabled_{false};
+};
+
+/// Reads the thread's hardware counters at construction and destruction and
+/// passes the delta to 'func' upon destruction, where it can be added to a
+/// HardwareCounterValues using HardwareCounterValues::add(). Mirrors
+/// DeltaCpuWallTimer. Must only be created when hardware counters are
+/// available, see ThreadHardwareCounters::isEnabled().
+template <typename F>
+class DeltaHardwareCounterSampler {
+ public:
+  explicit DeltaHardwareCounterSampler(F&& func)
+      : start_(ThreadHardwareCounters::forCurrentThread().read()),
+        func_(std::move(func)) {}
+
+  ~DeltaHardwareCounterSampler() {
+    const auto end = ThreadHardwareCounters::forCurrentThread().read();
+    func_(HardwareCounterValues{
+        end.cpuCycles - start_.cpuCycles,
+        end.instructions - start_.instructions,
+        end.llcMisses - start_.llcMisses,
+        end.branchMisses - start_.branchMisses});
+  }
+
+ private:
+  const HardwareCounterValues start_;
+  F func_;
+};
+
+} // namespace facebook::velox
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "velox/common/time/HardwareCounters.h"
+
+using namespace facebook::velox;
+
+namespace facebook::velox::test {
+
+TEST(HardwareCountersTest, delta) {
+  auto& counters = ThreadHardwareCounters::forCurrentThread();
+  if (!counters.isEnabled()) {
+    // Perf events are not available, e.g. non-Linux or a restricted container.
+    LOG(WARNING) << "Hardware counters not available; skipping.";
+    EXPECT_EQ(counters.read().cpuCycles, 0);
+    return;
+  }
+
+  HardwareCounterValues delta;
+  auto callback = [&](const HardwareCounterValues& values) { delta = values; };
+  size_t n = 0;
+  {
+    DeltaHardwareCounterSampler<decltype(callback)> sampler(
+        std::move(callback));
+
+    // Burn some cycles.
+    for (size_t i = 0; i < 100'000; ++i) {
+      n += 5 + i * 10;
+    }
+  }
+
+  // Use 'n' so the compiler cannot drop the loop above.
+  EXPECT_GT(n, 0);
+  EXPECT_GT(delta.cpuCycles, 0);
+  EXPECT_GT(delta.instructions, 0);
+}
+
+TEST(HardwareCountersTest, add) {
+  HardwareCounterValues total;
+  total.add({1, 2, 3, 4});
+  total.add({10, 20, 30, 40});
+  EXPECT_EQ(total.cpuCycles, 11);
+  EXPECT_EQ(total.instructions, 22);
+  EXPECT_EQ(total.llcMisses, 33);
+  EXPECT_EQ(total.branchMisses, 44);
+}
+
+} // namespace facebook::velox::test
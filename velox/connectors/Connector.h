@@ -21,6 +21,7 @@
 #include "velox/common/caching/ScanTracker.h"
 #include "velox/common/config/SpillConfig.h"
 #include "velox/common/future/VeloxPromise.h"
+#include "velox/common/io/Options.h"
 #include "velox/core/ExpressionEvaluator.h"
 #include "velox/vector/ComplexVector.h"
 
@@ -50,6 +51,15 @@ struct ConnectorSplit {
 
   virtual ~ConnectorSplit() {}
 
+  // Returns a stable key identifying the cached data this split reads, e.g.
+  // a hash of the file path, or std::nullopt if the split has no cache
+  // affinity. Splits with equal keys benefit from being processed by the same
+  // driver across scans, since they hit the data cache entries and tracking
+  // state warmed by the earlier scan.
+  virtual std::optional<uint64_t> cacheAffinityKey() const {
+    return std::nullopt;
+  }
+
   virtual std::string toString() const {
     return fmt::format("[split: {}]", connectorId);
   }
@@ -239,7 +249,9 @@ class ConnectorQueryCtx {
       const std::string& queryId,
       const std::string& taskId,
       const std::string& planNodeId,
-      int driverId)
+      int driverId,
+      io::IoSchedulingClass ioSchedulingClass =
+          io::IoSchedulingClass::kInteractive)
       : operatorPool_(operatorPool),
         connectorPool_(connectorPool),
         config_(connectorConfig),
@@ -250,7 +262,8 @@ class ConnectorQueryCtx {
         queryId_(queryId),
         taskId_(taskId),
         driverId_(driverId),
-        planNodeId_(planNodeId) {
+        planNodeId_(planNodeId),
+        ioSchedulingClass_(ioSchedulingClass) {
     VELOX_CHECK_NOT_NULL(connectorConfig);
   }
 
@@ -307,6 +320,13 @@ class ConnectorQueryCtx {
     return planNodeId_;
   }
 
+  /// IO scheduling class of the query this scan or write belongs to. Data
+  /// sources pass this to their readers so speculative IO of batch and
+  /// background queries yields to interactive ones.
+  io::IoSchedulingClass ioSchedulingClass() const {
+    return ioSchedulingClass_;
+  }
+
  private:
   memory::MemoryPool* const operatorPool_;
   memory::MemoryPool* const connectorPool_;
@@ -319,6 +339,7 @@ class ConnectorQueryCtx {
   const std::string taskId_;
   const int driverId_;
   const std::string planNodeId_;
+  const io::IoSchedulingClass ioSchedulingClass_;
 };
 
 class Connector {
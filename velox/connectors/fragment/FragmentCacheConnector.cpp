@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/connectors/fragment/FragmentCacheConnector.h"
+
+namespace facebook::velox::connector::fragment {
+
+bool FragmentCache::put(
+    const std::string& key,
+    const RowTypePtr& rowType,
+    const std::vector<RowVectorPtr>& vectors) {
+  VELOX_CHECK_NOT_NULL(rowType);
+
+  // Deep-copy into the cache's pool outside of the mutex; copying can be
+  // slow for large fragments and may throw on budget overflow in 'pool_'.
+  auto fragment = std::make_shared<Fragment>();
+  fragment->rowType = rowType;
+  fragment->vectors.reserve(vectors.size());
+  int64_t bytes = 0;
+  for (const auto& vector : vectors) {
+    VELOX_CHECK_NOT_NULL(vector);
+    VELOX_CHECK(
+        vector->type()->equivalent(*rowType),
+        "Fragment vector type {} does not match fragment row type {}",
+        vector->type()->toString(),
+        rowType->toString());
+    auto copy = std::static_pointer_cast<RowVector>(
+        BaseVector::create(rowType, vector->size(), pool_));
+    copy->copy(vector.get(), 0, 0, vector->size());
+    bytes += copy->retainedSize();
+    fragment->vectors.emplace_back(std::move(copy));
+  }
+
+  if (bytes > maxBytes_) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    cachedBytes_ -= it->second.bytes;
+    entries_.erase(it);
+  }
+  evictLocked(bytes);
+  entries_[key] = Entry{std::move(fragment), bytes, ++accessClock_};
+  cachedBytes_ += bytes;
+  return true;
+}
+
+FragmentCache::FragmentPtr FragmentCache::find(const std::string& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    ++numMisses_;
+    return nullptr;
+  }
+  ++numHits_;
+  it->second.lastAccess = ++accessClock_;
+  return it->second.fragment;
+}
+
+void FragmentCache::clear() {
+  std::lock_guard<std::mutex> l(mutex_);
+  entries_.clear();
+  cachedBytes_ = 0;
+}
+
+FragmentCache::Stats FragmentCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  Stats stats;
+  stats.numEntries = entries_.size();
+  stats.cachedBytes = cachedBytes_;
+  stats.numHits = numHits_;
+  stats.numMisses = numMisses_;
+  stats.numEvicted = numEvicted_;
+  return stats;
+}
+
+void FragmentCache::evictLocked(int64_t bytes) {
+  while (!entries_.empty() && cachedBytes_ + bytes > maxBytes_) {
+    auto candidate = entries_.begin();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->second.lastAccess < candidate->second.lastAccess) {
+        candidate = it;
+      }
+    }
+    cachedBytes_ -= candidate->second.bytes;
+    entries_.erase(candidate);
+    ++numEvicted_;
+  }
+}
+
+std::string FragmentCacheTableHandle::toString() const {
+  return fmt::format("fragment key: {}", fragmentKey_);
+}
+
+FragmentCacheDataSource::FragmentCacheDataSource(
+    const std::shared_ptr<const RowType>& outputType,
+    const std::shared_ptr<connector::ConnectorTableHandle>& tableHandle,
+    const std::unordered_map<
+        std::string,
+        std::shared_ptr<connector::ColumnHandle>>& columnHandles,
+    FragmentCache* FOLLY_NONNULL cache,
+    velox::memory::MemoryPool* FOLLY_NONNULL pool)
+    : pool_(pool) {
+  auto fragmentTableHandle =
+      std::dynamic_pointer_cast<FragmentCacheTableHandle>(tableHandle);
+  VELOX_CHECK_NOT_NULL(
+      fragmentTableHandle,
+      "TableHandle must be an instance of FragmentCacheTableHandle");
+  const auto& key = fragmentTableHandle->fragmentKey();
+
+  fragment_ = cache->find(key);
+  if (fragment_ == nullptr) {
+    VELOX_USER_FAIL(
+        "Fragment cache miss for key '{}'. The fragment was never cached or "
+        "has been evicted; re-run the producing plan subtree and cache its "
+        "results again.",
+        key);
+  }
+
+  outputColumnMappings_.reserve(outputType->size());
+
+  for (const auto& outputName : outputType->names()) {
+    auto it = columnHandles.find(outputName);
+    VELOX_CHECK(
+        it != columnHandles.end(),
+        "ColumnHandle is missing for output column '{}' on fragment '{}'",
+        outputName,
+        key);
+
+    auto handle =
+        std::dynamic_pointer_cast<FragmentCacheColumnHandle>(it->second);
+    VELOX_CHECK_NOT_NULL(
+        handle,
+        "ColumnHandle must be an instance of FragmentCacheColumnHandle "
+        "for '{}' on fragment '{}'",
+        outputName,
+        key);
+
+    auto idx = fragment_->rowType->getChildIdxIfExists(handle->name());
+    VELOX_CHECK(
+        idx != std::nullopt,
+        "Column '{}' not found on cached fragment '{}'.",
+        handle->name(),
+        key);
+    outputColumnMappings_.emplace_back(*idx);
+  }
+  outputType_ = outputType;
+}
+
+RowVectorPtr FragmentCacheDataSource::projectOutputColumns(
+    const RowVectorPtr& inputVector) {
+  std::vector<VectorPtr> children;
+  children.reserve(outputColumnMappings_.size());
+
+  for (const auto channel : outputColumnMappings_) {
+    children.emplace_back(inputVector->childAt(channel));
+  }
+
+  return std::make_shared<RowVector>(
+      pool_,
+      outputType_,
+      BufferPtr(),
+      inputVector->size(),
+      std::move(children));
+}
+
+void FragmentCacheDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
+  VELOX_CHECK_EQ(
+      currentSplit_,
+      nullptr,
+      "Previous split has not been processed yet. Call next() to process the split.");
+  currentSplit_ = std::dynamic_pointer_cast<FragmentCacheConnectorSplit>(split);
+  VELOX_CHECK(currentSplit_, "Wrong type of split for FragmentCacheDataSource.");
+  batchIndex_ = 0;
+}
+
+std::optional<RowVectorPtr> FragmentCacheDataSource::next(
+    uint64_t /*size*/,
+    velox::ContinueFuture& /*future*/) {
+  VELOX_CHECK_NOT_NULL(
+      currentSplit_, "No split to process. Call addSplit() first.");
+
+  // Batches are served as cached, so the 'size' hint is ignored. Skip batches
+  // belonging to other parts of the fragment.
+  while (batchIndex_ < fragment_->vectors.size() &&
+         batchIndex_ % currentSplit_->totalParts != currentSplit_->partNumber) {
+    ++batchIndex_;
+  }
+
+  if (batchIndex_ >= fragment_->vectors.size()) {
+    currentSplit_ = nullptr;
+    return nullptr;
+  }
+
+  const auto& batch = fragment_->vectors[batchIndex_++];
+  completedRows_ += batch->size();
+  completedBytes_ += batch->retainedSize();
+
+  return projectOutputColumns(batch);
+}
+
+VELOX_REGISTER_CONNECTOR_FACTORY(
+    std::make_shared<FragmentCacheConnectorFactory>())
+
+} // namespace facebook::velox::connector::fragment
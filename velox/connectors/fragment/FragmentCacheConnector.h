@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <mutex>
+
+#include "velox/common/memory/Memory.h"
+#include "velox/connectors/Connector.h"
+#include "velox/connectors/fragment/FragmentCacheConnectorSplit.h"
+
+namespace facebook::velox::connector::fragment {
+
+/// In-memory cache of materialized query fragment results.
+///
+/// Embedders that repeatedly execute the same plan subtree (common in
+/// dashboard-style workloads that re-run identical CTEs and dimension scans)
+/// can materialize the subtree's output once, store it here under a
+/// fingerprint of the subtree and serve subsequent executions from memory via
+/// FragmentCacheConnector. The fingerprint is opaque to the cache; embedders
+/// typically use a hash of the serialized plan subtree.
+///
+/// Vectors are deep-copied into the cache's memory pool on insertion, so
+/// cached fragments stay valid after the producing query's pools are
+/// destroyed, and are served to readers as shared, read-only vectors. The
+/// cache is bounded by a byte budget and evicts least recently used entries
+/// to stay within it; fragments being read when evicted stay alive until the
+/// reading data sources release them.
+class FragmentCache {
+ public:
+  /// A cached fragment: the row type of the materialized subtree output and
+  /// its batches, in production order.
+  struct Fragment {
+    RowTypePtr rowType;
+    std::vector<RowVectorPtr> vectors;
+  };
+
+  using FragmentPtr = std::shared_ptr<const Fragment>;
+
+  static constexpr int64_t kDefaultMaxBytes = 256 << 20; // 256 MB.
+
+  FragmentCache(
+      memory::MemoryPool* FOLLY_NONNULL pool,
+      int64_t maxBytes = kDefaultMaxBytes)
+      : pool_(pool), maxBytes_(maxBytes) {
+    VELOX_CHECK_GT(maxBytes_, 0, "Fragment cache byte budget must be positive");
+  }
+
+  /// Deep-copies 'vectors' into the cache under 'key', replacing any previous
+  /// entry for the same key. Evicts least recently used entries as needed to
+  /// stay within the byte budget. Returns false without caching anything if
+  /// the fragment alone exceeds the budget. All vectors must match 'rowType'.
+  bool put(
+      const std::string& key,
+      const RowTypePtr& rowType,
+      const std::vector<RowVectorPtr>& vectors);
+
+  /// Returns the cached fragment for 'key', or nullptr if it was never cached
+  /// or has been evicted. The returned fragment is shared and must not be
+  /// modified.
+  FragmentPtr find(const std::string& key);
+
+  /// Drops all cached fragments.
+  void clear();
+
+  struct Stats {
+    int64_t numEntries{0};
+    int64_t cachedBytes{0};
+    int64_t numHits{0};
+    int64_t numMisses{0};
+    int64_t numEvicted{0};
+  };
+
+  Stats stats() const;
+
+ private:
+  struct Entry {
+    FragmentPtr fragment;
+    int64_t bytes{0};
+    uint64_t lastAccess{0};
+  };
+
+  // Evicts least recently used entries until 'bytes' more fit within
+  // 'maxBytes_'. Linear in the number of entries, which is small (one per
+  // distinct cached plan subtree).
+  void evictLocked(int64_t bytes);
+
+  memory::MemoryPool* FOLLY_NONNULL const pool_;
+  const int64_t maxBytes_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  int64_t cachedBytes_{0};
+  uint64_t accessClock_{0};
+  int64_t numHits_{0};
+  int64_t numMisses_{0};
+  int64_t numEvicted_{0};
+};
+
+// Fragment cache column handle only needs the column name in the cached
+// fragment's row type.
+class FragmentCacheColumnHandle : public ColumnHandle {
+ public:
+  explicit FragmentCacheColumnHandle(const std::string& name) : name_(name) {}
+
+  const std::string& name() const {
+    return name_;
+  }
+
+ private:
+  const std::string name_;
+};
+
+// Fragment cache table handle identifies the cached fragment by the plan
+// subtree fingerprint it was stored under.
+class FragmentCacheTableHandle : public ConnectorTableHandle {
+ public:
+  FragmentCacheTableHandle(std::string connectorId, std::string fragmentKey)
+      : ConnectorTableHandle(std::move(connectorId)),
+        fragmentKey_(std::move(fragmentKey)) {}
+
+  ~FragmentCacheTableHandle() override {}
+
+  std::string toString() const override;
+
+  const std::string& fragmentKey() const {
+    return fragmentKey_;
+  }
+
+ private:
+  const std::string fragmentKey_;
+};
+
+class FragmentCacheDataSource : public DataSource {
+ public:
+  FragmentCacheDataSource(
+      const std::shared_ptr<const RowType>& outputType,
+      const std::shared_ptr<connector::ConnectorTableHandle>& tableHandle,
+      const std::unordered_map<
+          std::string,
+          std::shared_ptr<connector::ColumnHandle>>& columnHandles,
+      FragmentCache* FOLLY_NONNULL cache,
+      velox::memory::MemoryPool* FOLLY_NONNULL pool);
+
+  void addSplit(std::shared_ptr<ConnectorSplit> split) override;
+
+  void addDynamicFilter(
+      column_index_t /*outputChannel*/,
+      const std::shared_ptr<common::Filter>& /*filter*/) override {
+    VELOX_NYI("Dynamic filters not supported by FragmentCacheConnector.");
+  }
+
+  std::optional<RowVectorPtr> next(uint64_t size, velox::ContinueFuture& future)
+      override;
+
+  uint64_t getCompletedRows() override {
+    return completedRows_;
+  }
+
+  uint64_t getCompletedBytes() override {
+    return completedBytes_;
+  }
+
+  std::unordered_map<std::string, RuntimeCounter> runtimeStats() override {
+    return {};
+  }
+
+ private:
+  RowVectorPtr projectOutputColumns(const RowVectorPtr& vector);
+
+  // Keeps the fragment alive even if it gets evicted mid-scan.
+  FragmentCache::FragmentPtr fragment_;
+  RowTypePtr outputType_;
+
+  // Mapping between output columns and their indices in the cached fragment's
+  // row type.
+  std::vector<column_index_t> outputColumnMappings_;
+
+  std::shared_ptr<FragmentCacheConnectorSplit> currentSplit_;
+
+  // Index of the next cached batch to consider for the current split.
+  size_t batchIndex_{0};
+
+  size_t completedRows_{0};
+  size_t completedBytes_{0};
+
+  memory::MemoryPool* FOLLY_NONNULL pool_;
+};
+
+class FragmentCacheConnector final : public Connector {
+ public:
+  /// Connector property controlling the cache byte budget.
+  static constexpr const char* FOLLY_NONNULL kMaxBytes{
+      "fragment-cache.max-bytes"};
+
+  FragmentCacheConnector(
+      const std::string& id,
+      std::shared_ptr<const Config> properties,
+      folly::Executor* FOLLY_NULLABLE /*executor*/)
+      : Connector(id, properties),
+        cachePool_(memory::addDefaultLeafMemoryPool("fragment_cache." + id)),
+        cache_(std::make_unique<FragmentCache>(
+            cachePool_.get(),
+            properties == nullptr
+                ? FragmentCache::kDefaultMaxBytes
+                : properties->get<int64_t>(
+                      kMaxBytes,
+                      FragmentCache::kDefaultMaxBytes))) {}
+
+  /// The cache backing this connector. Embedders use this to insert
+  /// materialized fragments and to check for cached ones before planning a
+  /// scan against this connector.
+  FragmentCache* FOLLY_NONNULL cache() const {
+    return cache_.get();
+  }
+
+  std::unique_ptr<DataSource> createDataSource(
+      const std::shared_ptr<const RowType>& outputType,
+      const std::shared_ptr<ConnectorTableHandle>& tableHandle,
+      const std::unordered_map<
+          std::string,
+          std::shared_ptr<connector::ColumnHandle>>& columnHandles,
+      ConnectorQueryCtx* FOLLY_NONNULL connectorQueryCtx) override final {
+    return std::make_unique<FragmentCacheDataSource>(
+        outputType,
+        tableHandle,
+        columnHandles,
+        cache_.get(),
+        connectorQueryCtx->memoryPool());
+  }
+
+  std::unique_ptr<DataSink> createDataSink(
+      RowTypePtr /*inputType*/,
+      std::shared_ptr<
+          ConnectorInsertTableHandle> /*connectorInsertTableHandle*/,
+      ConnectorQueryCtx* /*connectorQueryCtx*/,
+      CommitStrategy /*commitStrategy*/) override final {
+    VELOX_NYI("FragmentCacheConnector does not support data sink.");
+  }
+
+ private:
+  // Owns the memory backing cached fragments; must outlive 'cache_'.
+  const std::shared_ptr<memory::MemoryPool> cachePool_;
+  const std::unique_ptr<FragmentCache> cache_;
+};
+
+class FragmentCacheConnectorFactory : public ConnectorFactory {
+ public:
+  static constexpr const char* FOLLY_NONNULL kFragmentCacheConnectorName{
+      "fragment_cache"};
+
+  FragmentCacheConnectorFactory()
+      : ConnectorFactory(kFragmentCacheConnectorName) {}
+
+  explicit FragmentCacheConnectorFactory(
+      const char* FOLLY_NONNULL connectorName)
+      : ConnectorFactory(connectorName) {}
+
+  std::shared_ptr<Connector> newConnector(
+      const std::string& id,
+      std::shared_ptr<const Config> properties,
+      folly::Executor* FOLLY_NULLABLE executor = nullptr) override {
+    return std::make_shared<FragmentCacheConnector>(id, properties, executor);
+  }
+};
+
+} // namespace facebook::velox::connector::fragment
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/connectors/fragment/FragmentCacheConnector.h"
+#include "gtest/gtest.h"
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+
+namespace {
+
+using namespace facebook::velox;
+using namespace facebook::velox::connector::fragment;
+
+using facebook::velox::exec::test::PlanBuilder;
+
+class FragmentCacheConnectorTest : public exec::test::OperatorTestBase {
+ public:
+  const std::string kConnectorId = "test-fragment-cache";
+
+  void SetUp() override {
+    OperatorTestBase::SetUp();
+    connector_ = std::dynamic_pointer_cast<FragmentCacheConnector>(
+        connector::getConnectorFactory(
+            FragmentCacheConnectorFactory::kFragmentCacheConnectorName)
+            ->newConnector(kConnectorId, nullptr));
+    connector::registerConnector(connector_);
+  }
+
+  void TearDown() override {
+    connector::unregisterConnector(kConnectorId);
+    connector_.reset();
+    OperatorTestBase::TearDown();
+  }
+
+  exec::Split makeFragmentSplit(size_t totalParts = 1, size_t partNumber = 0)
+      const {
+    return exec::Split(std::make_shared<FragmentCacheConnectorSplit>(
+        kConnectorId, totalParts, partNumber));
+  }
+
+  // Builds a table scan over the cached fragment 'key' returning 'outputType'
+  // columns, looked up by name in the cached fragment's row type.
+  core::PlanNodePtr makeScanPlan(
+      const std::string& key,
+      const RowTypePtr& outputType) {
+    std::unordered_map<std::string, std::shared_ptr<connector::ColumnHandle>>
+        assignments;
+    for (const auto& name : outputType->names()) {
+      assignments[name] = std::make_shared<FragmentCacheColumnHandle>(name);
+    }
+    return PlanBuilder()
+        .tableScan(
+            outputType,
+            std::make_shared<FragmentCacheTableHandle>(kConnectorId, key),
+            assignments)
+        .planNode();
+  }
+
+  std::vector<RowVectorPtr> makeTestBatches(int32_t numBatches) {
+    std::vector<RowVectorPtr> batches;
+    for (auto i = 0; i < numBatches; ++i) {
+      batches.push_back(makeRowVector(
+          {"a", "b"},
+          {
+              makeFlatVector<int64_t>(
+                  100, [&](auto row) { return i * 100 + row; }),
+              makeFlatVector<StringView>(
+                  100,
+                  [&](auto row) {
+                    return StringView::makeInline(
+                        fmt::format("s-{}-{}", i, row));
+                  }),
+          }));
+    }
+    return batches;
+  }
+
+  std::shared_ptr<FragmentCacheConnector> connector_;
+};
+
+TEST_F(FragmentCacheConnectorTest, simple) {
+  auto batches = makeTestBatches(3);
+  auto rowType = asRowType(batches[0]->type());
+  ASSERT_TRUE(connector_->cache()->put("q1", rowType, batches));
+
+  exec::test::AssertQueryBuilder(makeScanPlan("q1", rowType))
+      .split(makeFragmentSplit())
+      .assertResults(batches);
+
+  // Cached batches are deep copies: mutating the original vectors after put()
+  // does not change what the scan returns.
+  batches[0]->childAt(0)->asFlatVector<int64_t>()->set(0, -1);
+  auto expected = makeTestBatches(3);
+  exec::test::AssertQueryBuilder(makeScanPlan("q1", rowType))
+      .split(makeFragmentSplit())
+      .assertResults(expected);
+}
+
+TEST_F(FragmentCacheConnectorTest, columnSubsetAndReorder) {
+  auto batches = makeTestBatches(2);
+  auto rowType = asRowType(batches[0]->type());
+  ASSERT_TRUE(connector_->cache()->put("q2", rowType, batches));
+
+  std::vector<RowVectorPtr> expected;
+  for (const auto& batch : batches) {
+    expected.push_back(
+        makeRowVector({"b", "a"}, {batch->childAt(1), batch->childAt(0)}));
+  }
+
+  exec::test::AssertQueryBuilder(
+      makeScanPlan("q2", ROW({"b", "a"}, {VARCHAR(), BIGINT()})))
+      .split(makeFragmentSplit())
+      .assertResults(expected);
+}
+
+TEST_F(FragmentCacheConnectorTest, multipleSplits) {
+  auto batches = makeTestBatches(5);
+  auto rowType = asRowType(batches[0]->type());
+  ASSERT_TRUE(connector_->cache()->put("q3", rowType, batches));
+
+  // Two splits together cover all batches exactly once.
+  exec::test::AssertQueryBuilder(makeScanPlan("q3", rowType))
+      .splits({makeFragmentSplit(2, 0), makeFragmentSplit(2, 1)})
+      .assertResults(batches);
+}
+
+TEST_F(FragmentCacheConnectorTest, miss) {
+  VELOX_ASSERT_THROW(
+      exec::test::AssertQueryBuilder(
+          makeScanPlan("no-such-key", ROW({"a"}, {BIGINT()})))
+          .split(makeFragmentSplit())
+          .copyResults(pool()),
+      "Fragment cache miss for key 'no-such-key'");
+}
+
+TEST_F(FragmentCacheConnectorTest, replace) {
+  auto batches = makeTestBatches(2);
+  auto rowType = asRowType(batches[0]->type());
+  ASSERT_TRUE(connector_->cache()->put("q4", rowType, batches));
+
+  // Second put for the same key replaces the cached data.
+  std::vector<RowVectorPtr> replacement = {makeRowVector(
+      {"a", "b"},
+      {
+          makeFlatVector<int64_t>({1, 2, 3}),
+          makeFlatVector<StringView>({"x", "y", "z"}),
+      })};
+  ASSERT_TRUE(connector_->cache()->put("q4", rowType, replacement));
+
+  exec::test::AssertQueryBuilder(makeScanPlan("q4", rowType))
+      .split(makeFragmentSplit())
+      .assertResults(replacement);
+  EXPECT_EQ(1, connector_->cache()->stats().numEntries);
+}
+
+TEST_F(FragmentCacheConnectorTest, eviction) {
+  auto batches = makeTestBatches(1);
+  auto rowType = asRowType(batches[0]->type());
+  const auto fragmentBytes = [&] {
+    FragmentCache sizer(pool());
+    EXPECT_TRUE(sizer.put("probe", rowType, batches));
+    return sizer.stats().cachedBytes;
+  }();
+
+  // Budget fits two fragments but not three.
+  FragmentCache cache(pool(), fragmentBytes * 2 + fragmentBytes / 2);
+  ASSERT_TRUE(cache.put("f1", rowType, batches));
+  ASSERT_TRUE(cache.put("f2", rowType, batches));
+
+  // Touch 'f1' so that 'f2' is the least recently used entry.
+  ASSERT_NE(cache.find("f1"), nullptr);
+  ASSERT_TRUE(cache.put("f3", rowType, batches));
+
+  EXPECT_EQ(cache.find("f2"), nullptr);
+  EXPECT_NE(cache.find("f1"), nullptr);
+  EXPECT_NE(cache.find("f3"), nullptr);
+
+  auto stats = cache.stats();
+  EXPECT_EQ(2, stats.numEntries);
+  EXPECT_EQ(1, stats.numEvicted);
+  EXPECT_EQ(1, stats.numMisses);
+  EXPECT_LE(stats.cachedBytes, fragmentBytes * 2 + fragmentBytes / 2);
+
+  // A fragment larger than the whole budget is rejected without evicting
+  // anything.
+  FragmentCache tiny(pool(), 16);
+  EXPECT_FALSE(tiny.put("f4", rowType, batches));
+  EXPECT_EQ(0, tiny.stats().numEntries);
+}
+
+TEST_F(FragmentCacheConnectorTest, evictedFragmentStaysAliveForReaders) {
+  auto batches = makeTestBatches(1);
+  auto rowType = asRowType(batches[0]->type());
+
+  FragmentCache cache(pool());
+  ASSERT_TRUE(cache.put("f1", rowType, batches));
+  auto fragment = cache.find("f1");
+  ASSERT_NE(fragment, nullptr);
+
+  cache.clear();
+  EXPECT_EQ(cache.find("f1"), nullptr);
+
+  // The shared fragment remains readable after eviction.
+  ASSERT_EQ(1, fragment->vectors.size());
+  test::assertEqualVectors(batches[0], fragment->vectors[0]);
+}
+
+} // namespace
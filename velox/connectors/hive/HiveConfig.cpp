@@ -126,6 +126,12 @@ std::string HiveConfig::s3IAMRoleSessionName(const Config* config) {
   return config->get(kS3IamRoleSessionName, std::string("velox-session"));
 }
 
+// static
+int32_t HiveConfig::s3MaxConnections(const Config* config) {
+  // Matches the AWS SDK default.
+  return config->get(kS3MaxConnections, 25);
+}
+
 // static
 std::string HiveConfig::gcsEndpoint(const Config* config) {
   return config->get<std::string>(kGCSEndpoint, std::string(""));
@@ -166,6 +172,11 @@ int32_t HiveConfig::numCacheFileHandles(const Config* config) {
   return config->get<int32_t>(kNumCacheFileHandles, 20'000);
 }
 
+// static.
+uint64_t HiveConfig::fileWriterFlushThresholdBytes(const Config* config) {
+  return config->get<uint64_t>(kFileWriterFlushThresholdBytes, 96L << 20);
+}
+
 uint64_t HiveConfig::getOrcWriterMaxStripeSize(
     const Config* connectorQueryCtxConfig,
     const Config* connectorPropertiesConfig) {
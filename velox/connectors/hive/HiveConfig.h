@@ -81,6 +81,11 @@ class HiveConfig {
   static constexpr const char* kS3IamRoleSessionName =
       "hive.s3.iam-role-session-name";
 
+  /// Maximum number of concurrent connections to S3. This bounds the
+  /// connection pool shared by all requests issued through one S3 client,
+  /// including the concurrent ranged GETs of large reads.
+  static constexpr const char* kS3MaxConnections = "hive.s3.max-connections";
+
   /// The GCS storage endpoint server.
   static constexpr const char* kGCSEndpoint = "hive.gcs.endpoint";
 
@@ -107,6 +112,12 @@ class HiveConfig {
   /// Maximum number of entries in the file handle cache.
   static constexpr const char* kNumCacheFileHandles = "num_cached_file_handles";
 
+  /// Maximum number of bytes a data sink's file writers may hold buffered in
+  /// total before the writers holding the most memory are flushed to their
+  /// files. Zero disables the threshold.
+  static constexpr const char* kFileWriterFlushThresholdBytes =
+      "file_writer_flush_threshold_bytes";
+
   // TODO: Refactor and merge config and session property.
   static constexpr const char* kOrcWriterMaxStripeSize =
       "orc_optimized_writer_max_stripe_size";
@@ -143,6 +154,8 @@ class HiveConfig {
 
   static std::string s3IAMRoleSessionName(const Config* config);
 
+  static int32_t s3MaxConnections(const Config* config);
+
   static std::string gcsEndpoint(const Config* config);
 
   static std::string gcsScheme(const Config* config);
@@ -85,6 +85,7 @@ std::unique_ptr<DataSource> HiveConnector::createDataSource(
           connectorQueryCtx->config()));
   options.setUseColumnNamesForColumnMapping(
       HiveConfig::isOrcUseColumnNames(connectorQueryCtx->config()));
+  options.setIoSchedulingClass(connectorQueryCtx->ioSchedulingClass());
 
   return std::make_unique<HiveDataSource>(
       outputType,
@@ -69,6 +69,14 @@ class HiveConnector : public Connector {
     return fileHandleFactory_.clearCache();
   }
 
+  // Drops the cached file handle for 'filename', if any, so the next split
+  // on the file re-opens it. Use when a file is known to have been replaced,
+  // e.g. by compaction, while the server keeps running. Returns true if a
+  // handle was dropped.
+  bool invalidateFileHandle(const std::string& filename) {
+    return fileHandleFactory_.invalidate(filename);
+  }
+
  protected:
   FileHandleFactory fileHandleFactory_;
   folly::Executor* FOLLY_NULLABLE executor_;
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <optional>
 #include <unordered_map>
 #include "velox/connectors/Connector.h"
@@ -57,6 +58,12 @@ struct HiveConnectorSplit : public connector::ConnectorSplit {
         extraFileInfo(_extraFileInfo),
         serdeParameters(_serdeParameters) {}
 
+  // All splits of a file share the affinity key so that re-scans of the file
+  // land on the driver that warmed the cache for it.
+  std::optional<uint64_t> cacheAffinityKey() const override {
+    return std::hash<std::string>()(filePath);
+  }
+
   std::string toString() const override {
     if (tableBucketNumber.has_value()) {
       return fmt::format(
@@ -73,6 +80,38 @@ struct HiveConnectorSplit : public connector::ConnectorSplit {
     auto i = filePath.rfind('/');
     return i == std::string::npos ? filePath : filePath.substr(i + 1);
   }
+
+  /// Subdivides this split into byte-range pieces of roughly 'targetBytes'
+  /// each so that a single large file can be scanned by many drivers
+  /// concurrently. The reader processes a stripe (row group) if its first
+  /// byte falls inside the split's range, so pieces resolve to whole stripes
+  /// at read time. 'fileSize' caps this split's length, which may be
+  /// unbounded.
+  std::vector<std::shared_ptr<HiveConnectorSplit>> subdivide(
+      uint64_t fileSize,
+      uint64_t targetBytes) const {
+    VELOX_CHECK_GT(targetBytes, 0);
+    if (start >= fileSize) {
+      return {};
+    }
+    const uint64_t end =
+        length > fileSize - start ? fileSize : start + length;
+    std::vector<std::shared_ptr<HiveConnectorSplit>> pieces;
+    for (uint64_t offset = start; offset < end; offset += targetBytes) {
+      pieces.push_back(std::make_shared<HiveConnectorSplit>(
+          connectorId,
+          filePath,
+          fileFormat,
+          offset,
+          std::min(targetBytes, end - offset),
+          partitionKeys,
+          tableBucketNumber,
+          customSplitInfo,
+          extraFileInfo,
+          serdeParameters));
+    }
+    return pieces;
+  }
 };
 
 } // namespace facebook::velox::connector::hive
@@ -16,6 +16,7 @@
 
 #include "velox/connectors/hive/HiveDataSink.h"
 
+#include "velox/common/base/AsyncSource.h"
 #include "velox/common/base/Fs.h"
 #include "velox/common/testutil/TestValue.h"
 #include "velox/connectors/hive/HiveConfig.h"
@@ -30,6 +31,9 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <folly/ScopeGuard.h>
+
+#include <numeric>
 
 using facebook::velox::common::testutil::TestValue;
 
@@ -317,7 +321,9 @@ HiveDataSink::HiveDataSink(
                        : nullptr),
       writerFactory_(dwio::common::getWriterFactory(
           insertTableHandle_->tableStorageFormat())),
-      spillConfig_(connectorQueryCtx->spillConfig()) {
+      spillConfig_(connectorQueryCtx->spillConfig()),
+      writerFlushThresholdBytes_(HiveConfig::fileWriterFlushThresholdBytes(
+          connectorQueryCtx_->config())) {
   VELOX_USER_CHECK(
       !isBucketed() || isPartitioned(), "A bucket table must be partitioned");
   if (isBucketed()) {
@@ -396,6 +402,39 @@ void HiveDataSink::appendData(RowVectorPtr input) {
         : exec::wrap(partitionSize, partitionRows_[index], input);
     write(index, writerInput);
   }
+
+  maybeFlushLargestWriters();
+}
+
+void HiveDataSink::maybeFlushLargestWriters() {
+  if (writerFlushThresholdBytes_ == 0 || writers_.size() <= 1) {
+    return;
+  }
+  const auto* connectorPool = connectorQueryCtx_->connectorMemoryPool();
+  if (connectorPool->currentBytes() <=
+      static_cast<int64_t>(writerFlushThresholdBytes_)) {
+    return;
+  }
+
+  // Many open writers growing together would otherwise hold on to their
+  // buffered stripes until memory arbitration kicks in. Flush the writers
+  // holding the most memory first until usage drops below half the
+  // threshold, so the flushes produce the largest possible stripes.
+  std::vector<uint32_t> indices(writers_.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  std::sort(indices.begin(), indices.end(), [&](uint32_t lhs, uint32_t rhs) {
+    return writerInfo_[lhs]->writerPool->currentBytes() >
+        writerInfo_[rhs]->writerPool->currentBytes();
+  });
+
+  for (auto index : indices) {
+    if (connectorPool->currentBytes() <=
+        static_cast<int64_t>(writerFlushThresholdBytes_ / 2)) {
+      break;
+    }
+    WRITER_NON_RECLAIMABLE_SECTION_GUARD(index);
+    writers_[index]->flush();
+  }
 }
 
 void HiveDataSink::write(size_t index, const VectorPtr& input) {
@@ -501,10 +540,7 @@ void HiveDataSink::closeInternal(bool abort) {
 
   if (!abort) {
     closed_ = true;
-    for (int i = 0; i < writers_.size(); ++i) {
-      WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
-      writers_[i]->close();
-    }
+    closeWriters();
   } else {
     aborted_ = true;
     for (int i = 0; i < writers_.size(); ++i) {
@@ -514,6 +550,47 @@ void HiveDataSink::closeInternal(bool abort) {
   }
 }
 
+void HiveDataSink::closeWriters() {
+  auto* executor = spillConfig_ == nullptr ? nullptr : spillConfig_->executor;
+  if (executor == nullptr || writers_.size() <= 1) {
+    for (int i = 0; i < writers_.size(); ++i) {
+      WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
+      writers_[i]->close();
+    }
+    return;
+  }
+
+  // Each close flushes the writer's remaining buffered data to its file.
+  // With one file per (bucketed) partition this is the bulk of the finish
+  // work, so run the closes in parallel on the executor.
+  std::vector<std::shared_ptr<AsyncSource<bool>>> closes;
+  closes.reserve(writers_.size());
+  for (int i = 0; i < writers_.size(); ++i) {
+    closes.push_back(std::make_shared<AsyncSource<bool>>([this, i]() {
+      WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
+      writers_[i]->close();
+      return std::make_unique<bool>(true);
+    }));
+    executor->add([source = closes.back()]() { source->prepare(); });
+  }
+
+  auto sync = folly::makeGuard([&]() {
+    // Wait for all pending closes before unwinding on error. This runs in
+    // the cleanup guard and must not throw; the first error is rethrown
+    // below.
+    for (auto& close : closes) {
+      try {
+        close->move();
+      } catch (const std::exception&) {
+      }
+    }
+  });
+
+  for (auto& close : closes) {
+    close->move();
+  }
+}
+
 uint32_t HiveDataSink::ensureWriter(const HiveWriterId& id) {
   auto it = writerIndexMap_.find(id);
   if (it != writerIndexMap_.end()) {
@@ -603,8 +680,6 @@ HiveDataSink::maybeCreateBucketSortWriter(
       inputType_,
       sortColumnIndices_,
       sortCompareFlags_,
-      // TODO: set batch size based on the query configs.
-      1000,
       sortPool,
       writerInfo_.back()->nonReclaimableSectionHolder.get(),
       &numSpillRuns_,
@@ -533,8 +533,18 @@ class HiveDataSink : public DataSink {
   // Invoked to write 'input' to the specified file writer.
   void write(size_t index, const VectorPtr& input);
 
+  // If the writers hold more buffered data than the configured flush
+  // threshold in total, flushes the writers holding the most memory until
+  // usage drops below half the threshold. This bounds the sink's memory use
+  // without waiting for memory arbitration.
+  void maybeFlushLargestWriters();
+
   void closeInternal(bool abort);
 
+  // Closes all the writers, in parallel on the spill executor when one is
+  // available.
+  void closeWriters();
+
   const RowTypePtr inputType_;
   const std::shared_ptr<const HiveInsertTableHandle> insertTableHandle_;
   const ConnectorQueryCtx* const connectorQueryCtx_;
@@ -547,6 +557,7 @@ class HiveDataSink : public DataSink {
   const std::unique_ptr<core::PartitionFunction> bucketFunction_;
   const std::shared_ptr<dwio::common::WriterFactory> writerFactory_;
   const common::SpillConfig* const spillConfig_;
+  const uint64_t writerFlushThresholdBytes_;
 
   std::vector<column_index_t> sortColumnIndices_;
   std::vector<CompareFlags> sortCompareFlags_;
@@ -671,6 +671,10 @@ std::unordered_map<std::string, RuntimeCounter> HiveDataSource::runtimeStats() {
        {"numRamRead", RuntimeCounter(ioStats_->ramHit().count())},
        {"ramReadBytes",
         RuntimeCounter(ioStats_->ramHit().sum(), RuntimeCounter::Unit::kBytes)},
+       {"numPrefetchHit", RuntimeCounter(ioStats_->prefetchHit().count())},
+       {"prefetchHitBytes",
+        RuntimeCounter(
+            ioStats_->prefetchHit().sum(), RuntimeCounter::Unit::kBytes)},
        {"totalScanTime",
         RuntimeCounter(
             ioStats_->totalScanTime(), RuntimeCounter::Unit::kNanos)},
@@ -811,7 +815,13 @@ HiveDataSource::createBufferedInput(
 }
 
 vector_size_t HiveDataSource::evaluateRemainingFilter(RowVectorPtr& rowVector) {
-  filterRows_.resize(output_->size());
+  // The reader compacts rows that survive the pushed down filters, so the
+  // remaining filter always applies to all rows of 'output_'. 'filterRows_'
+  // stays fully selected between batches; only refill it when the batch size
+  // changes.
+  if (filterRows_.size() != output_->size()) {
+    filterRows_.resizeFill(output_->size());
+  }
 
   expressionEvaluator_->evaluate(
       remainingFilterExprSet_.get(), filterRows_, *rowVector, filterResult_);
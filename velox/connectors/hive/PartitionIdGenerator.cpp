@@ -75,8 +75,19 @@ void PartitionIdGenerator::run(
   // TODO Optimize common use case where all records belong to the same
   // partition. VectorHashers keep track of the number of unique values, hence,
   // we can find out if there is only one unique value for each partition key.
+
+  // Rows from the same partition typically come in runs, e.g. when the input
+  // is clustered on the partition keys. Remember the last mapping to skip the
+  // hash table lookup for such runs.
+  uint64_t lastValueId = 0;
+  uint64_t lastPartitionId = 0;
+  bool hasLast = false;
   for (auto i = 0; i < numRows; ++i) {
     auto valueId = result[i];
+    if (hasLast && valueId == lastValueId) {
+      result[i] = lastPartitionId;
+      continue;
+    }
     auto it = partitionIds_.find(valueId);
     if (it != partitionIds_.end()) {
       result[i] = it->second;
@@ -93,12 +104,15 @@ void PartitionIdGenerator::run(
 
       result[i] = nextPartitionId;
     }
+    lastValueId = valueId;
+    lastPartitionId = result[i];
+    hasLast = true;
   }
 }
 
 std::string PartitionIdGenerator::partitionName(uint64_t partitionId) const {
-  return FileUtils::makePartName(
-      extractPartitionKeyValues(partitionValues_, partitionId));
+  VELOX_CHECK_LT(partitionId, partitionNames_.size());
+  return partitionNames_[partitionId];
 }
 
 void PartitionIdGenerator::computeValueIds(
@@ -172,6 +186,12 @@ void PartitionIdGenerator::savePartitionValues(
     partitionValues_->childAt(i)->copy(
         input->childAt(channel).get(), partitionId, row, 1);
   }
+
+  // Format the partition name once per distinct partition. Writers created
+  // for different buckets of the same partition reuse the cached name.
+  VELOX_CHECK_EQ(partitionId, partitionNames_.size());
+  partitionNames_.push_back(FileUtils::makePartName(
+      extractPartitionKeyValues(partitionValues_, partitionId)));
 }
 
 } // namespace facebook::velox::connector::hive
@@ -47,9 +47,9 @@ class PartitionIdGenerator {
   }
 
   /// Return partition name for the given partition id in the typical Hive
-  /// style. It is derived from the partitionValues_ at index partitionId.
-  /// Partition keys appear in the order of partition columns in the table
-  /// schema.
+  /// style. Partition keys appear in the order of partition columns in the
+  /// table schema. The name is formatted once, when the partition is first
+  /// seen in run(); this returns the cached copy.
   std::string partitionName(uint64_t partitionId) const;
 
  private:
@@ -86,6 +86,10 @@ class PartitionIdGenerator {
   // numbers match partition IDs.
   RowVectorPtr partitionValues_;
 
+  // Hive-style partition names indexed by partition ID. Each name is
+  // formatted once, when the partition is first seen.
+  std::vector<std::string> partitionNames_;
+
   // All rows are set valid to compute partition IDs for all input rows.
   SelectivityVector allRows_;
 };
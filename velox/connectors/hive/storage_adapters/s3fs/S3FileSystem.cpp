@@ -158,13 +158,41 @@ class S3ReadFile final : public ReadFile {
   }
 
  private:
+  // Reads larger than this are split into part sized ranged GETs issued
+  // concurrently through the SDK's executor. S3 serves ranged GETs
+  // independently, so one slow stream no longer bounds the whole read.
+  static constexpr uint64_t kParallelPreadPartSize = 8 << 20; // 8MB
+
   // The assumption here is that "position" has space for at least "length"
   // bytes.
   void preadInternal(uint64_t offset, uint64_t length, char* position) const {
-    // Read the desired range of bytes.
-    Aws::S3::Model::GetObjectRequest request;
-    Aws::S3::Model::GetObjectResult result;
+    if (length <= kParallelPreadPartSize) {
+      auto outcome =
+          client_->GetObject(makeGetObjectRequest(offset, length, position));
+      VELOX_CHECK_AWS_OUTCOME(
+          outcome, "Failed to get S3 object", bucket_, key_);
+      return;
+    }
+    std::vector<Aws::S3::Model::GetObjectOutcomeCallable> parts;
+    parts.reserve(
+        (length + kParallelPreadPartSize - 1) / kParallelPreadPartSize);
+    for (uint64_t partOffset = 0; partOffset < length;
+         partOffset += kParallelPreadPartSize) {
+      const auto partLength =
+          std::min(kParallelPreadPartSize, length - partOffset);
+      parts.push_back(client_->GetObjectCallable(makeGetObjectRequest(
+          offset + partOffset, partLength, position + partOffset)));
+    }
+    for (auto& part : parts) {
+      auto outcome = part.get();
+      VELOX_CHECK_AWS_OUTCOME(
+          outcome, "Failed to get S3 object", bucket_, key_);
+    }
+  }
 
+  Aws::S3::Model::GetObjectRequest
+  makeGetObjectRequest(uint64_t offset, uint64_t length, char* position) const {
+    Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(awsString(bucket_));
     request.SetKey(awsString(key_));
     std::stringstream ss;
@@ -172,8 +200,7 @@ class S3ReadFile final : public ReadFile {
     request.SetRange(awsString(ss.str()));
     request.SetResponseStreamFactory(
         AwsWriteableStreamFactory(position, length));
-    auto outcome = client_->GetObject(request);
-    VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to get S3 object", bucket_, key_);
+    return request;
   }
 
   Aws::S3::S3Client* client_;
@@ -510,6 +537,7 @@ class S3FileSystem::Impl {
     VELOX_CHECK(getAwsInstance()->isInitialized(), "S3 is not initialized");
     Aws::Client::ClientConfiguration clientConfig;
     clientConfig.endpointOverride = HiveConfig::s3Endpoint(config_);
+    clientConfig.maxConnections = HiveConfig::s3MaxConnections(config_);
 
     if (HiveConfig::s3UseSSL(config_)) {
       clientConfig.scheme = Aws::Http::Scheme::HTTPS;
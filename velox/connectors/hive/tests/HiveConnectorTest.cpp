@@ -78,6 +78,33 @@ TEST_F(HiveConnectorTest, hiveConfig) {
       "UNKNOWN BEHAVIOR 100");
 }
 
+TEST_F(HiveConnectorTest, subdivideSplit) {
+  auto split = std::make_shared<HiveConnectorSplit>(
+      "test-hive",
+      "/path/file.orc",
+      dwio::common::FileFormat::DWRF,
+      0,
+      std::numeric_limits<uint64_t>::max(),
+      std::unordered_map<std::string, std::optional<std::string>>{
+          {"ds", "2023-10-01"}});
+
+  auto pieces = split->subdivide(10 << 20, 4 << 20);
+  ASSERT_EQ(pieces.size(), 3);
+  EXPECT_EQ(pieces[0]->start, 0);
+  EXPECT_EQ(pieces[0]->length, 4 << 20);
+  EXPECT_EQ(pieces[1]->start, 4 << 20);
+  EXPECT_EQ(pieces[1]->length, 4 << 20);
+  EXPECT_EQ(pieces[2]->start, 8 << 20);
+  EXPECT_EQ(pieces[2]->length, 2 << 20);
+  for (const auto& piece : pieces) {
+    EXPECT_EQ(piece->filePath, split->filePath);
+    EXPECT_EQ(piece->partitionKeys, split->partitionKeys);
+  }
+
+  // A split whose range starts past the end of the file has no pieces.
+  ASSERT_TRUE(pieces[2]->subdivide(1 << 20, 4 << 20).empty());
+}
+
 TEST_F(HiveConnectorTest, makeScanSpec_requiredSubfields_multilevel) {
   auto columnType = ROW(
       {{"c0c0", BIGINT()},
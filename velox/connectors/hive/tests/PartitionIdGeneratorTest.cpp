@@ -172,6 +172,40 @@ TEST_F(PartitionIdGeneratorTest, numPartitions) {
   EXPECT_EQ(idGenerator.numPartitions(), 20);
 }
 
+TEST_F(PartitionIdGeneratorTest, partitionName) {
+  PartitionIdGenerator idGenerator(
+      ROW({"c0", "c1"}, {VARCHAR(), INTEGER()}), {0, 1}, 200, pool());
+
+  auto input = makeRowVector({
+      makeFlatVector<StringView>({"a", "b", "a"}),
+      makeFlatVector<int32_t>({1, 2, 1}),
+  });
+
+  raw_vector<uint64_t> ids;
+  idGenerator.run(input, ids);
+
+  EXPECT_EQ(ids[0], ids[2]);
+  EXPECT_EQ(idGenerator.partitionName(ids[0]), "c0=a/c1=1");
+  EXPECT_EQ(idGenerator.partitionName(ids[1]), "c0=b/c1=2");
+
+  // Names stay stable after more partitions arrive and the hashers rehash.
+  auto moreInput = makeRowVector({
+      makeFlatVector<StringView>(
+          100,
+          [](auto row) {
+            return StringView::makeInline(fmt::format("s{}", row));
+          }),
+      makeFlatVector<int32_t>(100, [](auto row) { return row; }),
+  });
+
+  raw_vector<uint64_t> moreIds;
+  idGenerator.run(moreInput, moreIds);
+
+  EXPECT_EQ(idGenerator.partitionName(ids[0]), "c0=a/c1=1");
+  EXPECT_EQ(idGenerator.partitionName(ids[1]), "c0=b/c1=2");
+  EXPECT_EQ(idGenerator.partitionName(moreIds[0]), "c0=s0/c1=0");
+}
+
 TEST_F(PartitionIdGeneratorTest, limitOfPartitionNumber) {
   auto maxPartitions = 100;
 
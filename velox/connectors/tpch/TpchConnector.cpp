@@ -21,37 +21,6 @@ namespace facebook::velox::connector::tpch {
 
 using facebook::velox::tpch::Table;
 
-namespace {
-
-RowVectorPtr getTpchData(
-    Table table,
-    size_t maxRows,
-    size_t offset,
-    double scaleFactor,
-    memory::MemoryPool* pool) {
-  switch (table) {
-    case Table::TBL_PART:
-      return velox::tpch::genTpchPart(pool, maxRows, offset, scaleFactor);
-    case Table::TBL_SUPPLIER:
-      return velox::tpch::genTpchSupplier(pool, maxRows, offset, scaleFactor);
-    case Table::TBL_PARTSUPP:
-      return velox::tpch::genTpchPartSupp(pool, maxRows, offset, scaleFactor);
-    case Table::TBL_CUSTOMER:
-      return velox::tpch::genTpchCustomer(pool, maxRows, offset, scaleFactor);
-    case Table::TBL_ORDERS:
-      return velox::tpch::genTpchOrders(pool, maxRows, offset, scaleFactor);
-    case Table::TBL_LINEITEM:
-      return velox::tpch::genTpchLineItem(pool, maxRows, offset, scaleFactor);
-    case Table::TBL_NATION:
-      return velox::tpch::genTpchNation(pool, maxRows, offset, scaleFactor);
-    case Table::TBL_REGION:
-      return velox::tpch::genTpchRegion(pool, maxRows, offset, scaleFactor);
-  }
-  return nullptr;
-}
-
-} // namespace
-
 std::string TpchTableHandle::toString() const {
   return fmt::format(
       "table: {}, scale factor: {}", toTableName(table_), scaleFactor_);
@@ -63,8 +32,9 @@ TpchDataSource::TpchDataSource(
     const std::unordered_map<
         std::string,
         std::shared_ptr<connector::ColumnHandle>>& columnHandles,
-    velox::memory::MemoryPool* FOLLY_NONNULL pool)
-    : pool_(pool) {
+    velox::memory::MemoryPool* FOLLY_NONNULL pool,
+    folly::Executor* FOLLY_NULLABLE executor)
+    : pool_(pool), executor_(executor) {
   auto tpchTableHandle =
       std::dynamic_pointer_cast<TpchTableHandle>(tableHandle);
   VELOX_CHECK_NOT_NULL(
@@ -105,6 +75,20 @@ TpchDataSource::TpchDataSource(
   outputType_ = outputType;
 }
 
+TpchDataSource::~TpchDataSource() {
+  if (prefetch_ != nullptr) {
+    // Wait for an in-flight prefetch so it does not outlive 'pool_'. If the
+    // prefetch has not started yet this generates the batch on this thread,
+    // which is wasted work, but being destroyed with a pending prefetch is
+    // rare.
+    try {
+      prefetch_->move();
+    } catch (...) {
+      // Ignore errors from a batch nobody will consume.
+    }
+  }
+}
+
 RowVectorPtr TpchDataSource::projectOutputColumns(RowVectorPtr inputVector) {
   std::vector<VectorPtr> children;
   children.reserve(outputColumnMappings_.size());
@@ -143,8 +127,23 @@ std::optional<RowVectorPtr> TpchDataSource::next(
       currentSplit_, "No split to process. Call addSplit() first.");
 
   size_t maxRows = std::min(size, (splitEnd_ - splitOffset_));
-  auto outputVector =
-      getTpchData(tpchTable_, maxRows, splitOffset_, scaleFactor_, pool_);
+
+  RowVectorPtr outputVector;
+  if (prefetch_ != nullptr) {
+    // Use the prefetched batch if it covers exactly the rows requested now;
+    // otherwise wait for it and discard, so it doesn't outlive 'pool_'.
+    auto batch = prefetch_->move();
+    prefetch_ = nullptr;
+    if (batch != nullptr && prefetchOffset_ == splitOffset_ &&
+        prefetchMaxRows_ == maxRows) {
+      outputVector = std::move(*batch);
+    }
+  }
+
+  if (outputVector == nullptr) {
+    outputVector = velox::tpch::genTpchData(
+        tpchTable_, pool_, maxRows, splitOffset_, scaleFactor_);
+  }
 
   // If the split is exhausted.
   if (!outputVector || outputVector->size() == 0) {
@@ -152,13 +151,31 @@ std::optional<RowVectorPtr> TpchDataSource::next(
     return nullptr;
   }
 
-  // splitOffset needs to advance based on maxRows passed to getTpchData(), and
+  // splitOffset needs to advance based on maxRows passed to genTpchData(), and
   // not the actual number of returned rows in the output vector, as they are
   // not the same for lineitem.
   splitOffset_ += maxRows;
   completedRows_ += outputVector->size();
   completedBytes_ += outputVector->retainedSize();
 
+  // Start generating the batch for the next call on the executor while the
+  // driver processes this one, assuming the next call asks for the same number
+  // of rows.
+  if (executor_ != nullptr && splitOffset_ < splitEnd_) {
+    prefetchOffset_ = splitOffset_;
+    prefetchMaxRows_ = std::min(size, splitEnd_ - splitOffset_);
+    prefetch_ = std::make_shared<AsyncSource<RowVectorPtr>>(
+        [table = tpchTable_,
+         pool = pool_,
+         maxRows = prefetchMaxRows_,
+         offset = prefetchOffset_,
+         scaleFactor = scaleFactor_]() {
+          return std::make_unique<RowVectorPtr>(velox::tpch::genTpchData(
+              table, pool, maxRows, offset, scaleFactor));
+        });
+    executor_->add([prefetch = prefetch_]() { prefetch->prepare(); });
+  }
+
   return projectOutputColumns(outputVector);
 }
 
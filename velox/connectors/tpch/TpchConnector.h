@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/common/base/AsyncSource.h"
 #include "velox/connectors/Connector.h"
 #include "velox/connectors/tpch/TpchConnectorSplit.h"
 #include "velox/tpch/gen/TpchGen.h"
@@ -75,7 +76,10 @@ class TpchDataSource : public DataSource {
       const std::unordered_map<
           std::string,
           std::shared_ptr<connector::ColumnHandle>>& columnHandles,
-      velox::memory::MemoryPool* FOLLY_NONNULL pool);
+      velox::memory::MemoryPool* FOLLY_NONNULL pool,
+      folly::Executor* FOLLY_NULLABLE executor = nullptr);
+
+  ~TpchDataSource() override;
 
   void addSplit(std::shared_ptr<ConnectorSplit> split) override;
 
@@ -124,6 +128,16 @@ class TpchDataSource : public DataSource {
   size_t completedBytes_{0};
 
   memory::MemoryPool* FOLLY_NONNULL pool_;
+
+  // If not null, the batch for the next next() call is generated on this
+  // executor while the driver processes the current one.
+  folly::Executor* FOLLY_NULLABLE executor_;
+
+  // In-flight generation of the next batch, along with the offset and row
+  // count it was scheduled for. Only used when 'executor_' is not null.
+  std::shared_ptr<AsyncSource<RowVectorPtr>> prefetch_;
+  uint64_t prefetchOffset_{0};
+  uint64_t prefetchMaxRows_{0};
 };
 
 class TpchConnector final : public Connector {
@@ -131,8 +145,8 @@ class TpchConnector final : public Connector {
   TpchConnector(
       const std::string& id,
       std::shared_ptr<const Config> properties,
-      folly::Executor* FOLLY_NULLABLE /*executor*/)
-      : Connector(id, properties) {}
+      folly::Executor* FOLLY_NULLABLE executor)
+      : Connector(id, properties), executor_(executor) {}
 
   std::unique_ptr<DataSource> createDataSource(
       const std::shared_ptr<const RowType>& outputType,
@@ -145,7 +159,8 @@ class TpchConnector final : public Connector {
         outputType,
         tableHandle,
         columnHandles,
-        connectorQueryCtx->memoryPool());
+        connectorQueryCtx->memoryPool(),
+        executor_);
   }
 
   std::unique_ptr<DataSink> createDataSink(
@@ -156,6 +171,11 @@ class TpchConnector final : public Connector {
       CommitStrategy /*commitStrategy*/) override final {
     VELOX_NYI("TpchConnector does not support data sink.");
   }
+
+ private:
+  // If not null, data sources created by this connector prefetch the next
+  // batch on this executor while the current one is being processed.
+  folly::Executor* FOLLY_NULLABLE executor_;
 };
 
 class TpchConnectorFactory : public ConnectorFactory {
@@ -15,6 +15,8 @@
  */
 
 #include "velox/connectors/tpch/TpchConnector.h"
+#include <folly/ScopeGuard.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/init/Init.h>
 #include "gtest/gtest.h"
 #include "velox/common/base/tests/GTestUtils.h"
@@ -269,6 +271,39 @@ TEST_F(TpchConnectorTest, join) {
   test::assertEqualVectors(expected, output);
 }
 
+// A connector created with an executor prefetches the next batch while the
+// current one is processed. Results must be identical to the plain connector.
+TEST_F(TpchConnectorTest, prefetch) {
+  const std::string kPrefetchConnectorId = "test-tpch-prefetch";
+  folly::CPUThreadPoolExecutor executor(4);
+
+  auto prefetchConnector =
+      connector::getConnectorFactory(
+          connector::tpch::TpchConnectorFactory::kTpchConnectorName)
+          ->newConnector(kPrefetchConnectorId, nullptr, &executor);
+  connector::registerConnector(prefetchConnector);
+  auto guard = folly::makeGuard(
+      [&] { connector::unregisterConnector(kPrefetchConnectorId); });
+
+  auto makePlan = [&](const std::string& connectorId) {
+    return PlanBuilder()
+        .tableScan(
+            ROW({"o_orderkey"}, {BIGINT()}),
+            std::make_shared<TpchTableHandle>(
+                connectorId, Table::TBL_ORDERS, 0.01),
+            {{"o_orderkey", std::make_shared<TpchColumnHandle>("o_orderkey")}})
+        .singleAggregation({}, {"count(1)", "sum(o_orderkey)"})
+        .planNode();
+  };
+
+  auto expected = getResults(makePlan(kTpchConnectorId), {makeTpchSplit()});
+  auto output = getResults(
+      makePlan(kPrefetchConnectorId),
+      {exec::Split(std::make_shared<TpchConnectorSplit>(
+          kPrefetchConnectorId, 1, 0))});
+  test::assertEqualVectors(expected, output);
+}
+
 TEST_F(TpchConnectorTest, orderDateCount) {
   auto plan = PlanBuilder()
                   .tableScan(Table::TBL_ORDERS, {"o_orderdate"}, 0.01)
@@ -1142,6 +1142,11 @@ class PartitionedOutputNode : public PlanNode {
   static std::string kindString(Kind kind);
   static Kind stringToKind(std::string str);
 
+  /// 'outputType' may drop, reorder or duplicate the source's columns. A
+  /// ROW-typed column, including one nested inside another row, array or map,
+  /// may also declare a subset of the source's fields, in which case only the
+  /// declared fields are shuffled. The consuming stage's exchange must declare
+  /// the same pruned type.
   PartitionedOutputNode(
       const PlanNodeId& id,
       Kind kind,
@@ -92,6 +92,18 @@ class QueryConfig {
   static constexpr const char* kOperatorTrackCpuUsage =
       "track_operator_cpu_usage";
 
+  /// Whether to track hardware performance counters (CPU cycles, instructions,
+  /// LLC misses, branch misses) for stages of individual operators using Linux
+  /// perf events. False by default. Has no effect on platforms where perf
+  /// events are unavailable or not permitted.
+  static constexpr const char* kOperatorTrackHardwareCounters =
+      "track_operator_hardware_counters";
+
+  /// Whether drivers record per-operator call and off-thread wait events into
+  /// a bounded in-memory log, retrievable in Chrome trace format via
+  /// Task::traceEventsJson(). False by default.
+  static constexpr const char* kDriverTraceEnabled = "driver_trace_enabled";
+
   /// Flags used to configure the CAST operator:
 
   /// This flag makes the Row conversion to by applied in a way that the casting
@@ -154,6 +166,21 @@ class QueryConfig {
   static constexpr const char* kMaxPartitionedOutputBufferSize =
       "max_page_partitioning_buffer_size";
 
+  /// Name of the vector serde to use for exchange pages, e.g. "CompactRow".
+  /// Consulted by both PartitionedOutput and Exchange so producers and
+  /// consumers of a query agree on the wire format. The serde must have been
+  /// registered with registerNamedVectorSerde(). Empty means the process-wide
+  /// default serde.
+  static constexpr const char* kExchangeVectorSerde = "exchange_vector_serde";
+
+  /// If true, Exchange deserializes incoming pages into vectors on the
+  /// threads that deliver them (exchange source callbacks, typically IO
+  /// executor threads) instead of the consuming driver thread. The
+  /// decode-ahead is bounded by the exchange queue buffer size since decoded
+  /// pages count their retained bytes against it.
+  static constexpr const char* kExchangeDecodeAheadEnabled =
+      "exchange_decode_ahead_enabled";
+
   /// Preferred size of batches in bytes to be returned by operators from
   /// Operator::getOutput. It is used when an estimate of average row size is
   /// known. Otherwise kPreferredOutputBatchRows is used.
@@ -179,6 +206,15 @@ class QueryConfig {
   static constexpr const char* kTableScanGetOutputTimeLimitMs =
       "table_scan_getoutput_time_limit_ms";
 
+  /// If true, each table scan split that has been fully processed is recorded
+  /// in TaskStats::completedScanSplits. An external supervisor can
+  /// periodically persist this list to checkpoint scan progress and re-seed a
+  /// restarted task with only the splits that are not recorded, instead of
+  /// rerunning the whole scan. Off by default since the recorded splits stay
+  /// alive for the lifetime of the task.
+  static constexpr const char* kTableScanRecordCompletedSplits =
+      "table_scan_record_completed_splits";
+
   /// If false, the 'group by' code is forced to use generic hash mode
   /// hashtable.
   static constexpr const char* kHashAdaptivityEnabled =
@@ -255,6 +291,18 @@ class QueryConfig {
   /// spilled files.
   static constexpr const char* kMinSpillRunSize = "min_spill_run_size";
 
+  /// IO scheduling class for table scans of this query: 'interactive'
+  /// (default), 'batch' or 'background'. Read-ahead issued for batch and
+  /// background queries runs at lower priority on the IO executor when the
+  /// executor supports priorities, so it does not queue ahead of interactive
+  /// scans.
+  static constexpr const char* kScanIoSchedulingClass =
+      "scan_io_scheduling_class";
+
+  /// Specifies the compression algorithm to apply to serialized spill data.
+  /// Defaults to lz4 whose compression and decompression cost is small
+  /// relative to the disk write and read it saves. Set to "none" to spill
+  /// uncompressed.
   static constexpr const char* kSpillCompressionKind =
       "spill_compression_codec";
 
@@ -330,9 +378,8 @@ class QueryConfig {
 
   /// If true, enable caches in expression evaluation for performance, including
   /// ExecCtx::vectorPool_, ExecCtx::decodedVectorPool_,
-  /// ExecCtx::selectivityVectorPool_, Expr::baseDictionary_,
-  /// Expr::dictionaryCache_, and Expr::cachedDictionaryIndices_. Otherwise,
-  /// disable the caches.
+  /// ExecCtx::selectivityVectorPool_ and the per-expression dictionary result
+  /// memo (Expr::memoEntries_). Otherwise, disable the caches.
   static constexpr const char* kEnableExpressionEvaluationCache =
       "enable_expression_evaluation_cache";
 
@@ -391,6 +438,14 @@ class QueryConfig {
     return get<uint64_t>(kMaxPartitionedOutputBufferSize, kDefault);
   }
 
+  std::string exchangeVectorSerde() const {
+    return get<std::string>(kExchangeVectorSerde, "");
+  }
+
+  bool exchangeDecodeAheadEnabled() const {
+    return get<bool>(kExchangeDecodeAheadEnabled, false);
+  }
+
   uint64_t maxLocalExchangeBufferSize() const {
     static constexpr uint64_t kDefault = 32UL << 20;
     return get<uint64_t>(kMaxLocalExchangeBufferSize, kDefault);
@@ -423,6 +478,10 @@ class QueryConfig {
     return get<uint64_t>(kTableScanGetOutputTimeLimitMs, 5'000);
   }
 
+  bool tableScanRecordCompletedSplits() const {
+    return get<bool>(kTableScanRecordCompletedSplits, false);
+  }
+
   bool hashAdaptivityEnabled() const {
     return get<bool>(kHashAdaptivityEnabled, true);
   }
@@ -570,7 +629,11 @@ class QueryConfig {
   }
 
   std::string spillCompressionKind() const {
-    return get<std::string>(kSpillCompressionKind, "none");
+    return get<std::string>(kSpillCompressionKind, "lz4");
+  }
+
+  std::string scanIoSchedulingClass() const {
+    return get<std::string>(kScanIoSchedulingClass, "interactive");
   }
 
   uint64_t spillWriteBufferSize() const {
@@ -639,6 +702,14 @@ class QueryConfig {
     return get<bool>(kOperatorTrackCpuUsage, true);
   }
 
+  bool operatorTrackHardwareCounters() const {
+    return get<bool>(kOperatorTrackHardwareCounters, false);
+  }
+
+  bool driverTraceEnabled() const {
+    return get<bool>(kDriverTraceEnabled, false);
+  }
+
   uint32_t taskWriterCount() const {
     return get<uint32_t>(kTaskWriterCount, 4);
   }
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 
 #include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/io/Options.h"
 #include "velox/core/QueryCtx.h"
 #include "velox/expression/EvalCtx.h"
 
@@ -88,6 +89,31 @@ TEST(TestQueryConfig, memConfig) {
   }
 }
 
+TEST(TestQueryConfig, scanIoSchedulingClass) {
+  {
+    std::unordered_map<std::string, std::string> configData;
+    auto queryCtx = std::make_shared<QueryCtx>(nullptr, std::move(configData));
+    ASSERT_EQ(queryCtx->queryConfig().scanIoSchedulingClass(), "interactive");
+  }
+
+  std::unordered_map<std::string, std::string> configData(
+      {{QueryConfig::kScanIoSchedulingClass, "background"}});
+  auto queryCtx = std::make_shared<QueryCtx>(nullptr, std::move(configData));
+  ASSERT_EQ(queryCtx->queryConfig().scanIoSchedulingClass(), "background");
+
+  ASSERT_EQ(
+      io::ioSchedulingClassFromName("interactive"),
+      io::IoSchedulingClass::kInteractive);
+  ASSERT_EQ(
+      io::ioSchedulingClassFromName("batch"), io::IoSchedulingClass::kBatch);
+  ASSERT_EQ(
+      io::ioSchedulingClassFromName("background"),
+      io::IoSchedulingClass::kBackground);
+  VELOX_ASSERT_THROW(
+      io::ioSchedulingClassFromName("realtime"),
+      "Unknown IO scheduling class: 'realtime'");
+}
+
 TEST(TestQueryConfig, taskWriterCountConfig) {
   struct {
     std::optional<int> numWriterCounter;
@@ -36,7 +36,15 @@ auto as4x64(__m256i x) {
 
 template <typename T>
 void store8Ints(__m256i eightInts, int32_t i, T* FOLLY_NONNULL result) {
-  if (sizeof(T) == 4) {
+  if (sizeof(T) == 2) {
+    // Pack the 8x32 bit lanes into the low 8x16 bits and store 16 bytes.
+    auto packed =
+        _mm256_packus_epi32(eightInts, _mm256_setzero_si256());
+    packed = _mm256_permute4x64_epi64(packed, 0xD8);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(result + i),
+        _mm256_castsi256_si128(packed));
+  } else if (sizeof(T) == 4) {
     _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), eightInts);
   } else {
     _mm256_storeu_si256(
@@ -169,9 +177,59 @@ int32_t decode1To24(
   return i;
 }
 
-#define WIDTH_CASE(width)                                                      \
-  case width:                                                                  \
-    i = decode1To24<width>(bits, bitOffset, rows.data(), numSafeRows, result); \
+// Decodes fields of 25-32 bits, 4 at a time, by gathering a 64 bit word
+// per field and shifting it in place. The same 8 byte wide accesses are
+// made as in the scalar tail loop, so the same end of buffer safety
+// margin applies.
+template <uint8_t width, typename T>
+int32_t decode25To32(
+    const uint64_t* bits,
+    int32_t bitOffset,
+    const int32_t* rows,
+    int32_t numRows,
+    T* result) {
+  constexpr uint64_t kMask = bits::lowMask(width);
+  const auto masks = _mm256_set1_epi64x(kMask);
+  int32_t i = 0;
+  for (; i + 4 <= numRows; i += 4) {
+    auto indices = _mm256_cvtepi32_epi64(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + i)));
+    auto bitIndices = _mm256_add_epi64(
+        _mm256_mul_epu32(indices, _mm256_set1_epi64x(width)),
+        _mm256_set1_epi64x(bitOffset));
+    auto byteIndices = _mm256_srli_epi64(bitIndices, 3);
+    auto shifts = _mm256_and_si256(bitIndices, _mm256_set1_epi64x(7));
+    auto data = _mm256_i64gather_epi64(
+        reinterpret_cast<const long long*>(bits), byteIndices, 1);
+    data = _mm256_and_si256(_mm256_srlv_epi64(data, shifts), masks);
+    if (sizeof(T) == 8) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), data);
+    } else {
+      // Take the low 32 bits of each 64 bit lane and store 4x32 bits.
+      auto packed = _mm256_permutevar8x32_epi32(
+          data, _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0));
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(result + i),
+          _mm256_castsi256_si128(packed));
+    }
+  }
+  return i;
+}
+
+#define WIDTH_CASE(width)                                         \
+  case width:                                                     \
+    if constexpr (sizeof(T) <= 8) {                               \
+      i = decode1To24<width>(                                     \
+          bits, bitOffset, rows.data(), numSafeRows, result);     \
+    }                                                             \
+    break;
+
+#define WIDE_WIDTH_CASE(width)                                    \
+  case width:                                                     \
+    if constexpr (sizeof(T) >= 4 && sizeof(T) <= 8) {             \
+      i = decode25To32<width>(                                    \
+          bits, bitOffset, rows.data(), numSafeRows, result);     \
+    }                                                             \
     break;
 
 } // namespace
@@ -238,7 +296,8 @@ void unpack(
   int32_t i = 0;
 
 #if XSIMD_WITH_AVX2
-  // Use AVX2 for specific widths.
+  // Use AVX2 for specific widths. The kernels store 2, 4 or 8 byte
+  // results, so wider result types take the scalar loop below.
   switch (bitWidth) {
     WIDTH_CASE(1);
     WIDTH_CASE(2);
@@ -264,6 +323,14 @@ void unpack(
     WIDTH_CASE(22);
     WIDTH_CASE(23);
     WIDTH_CASE(24);
+    WIDE_WIDTH_CASE(25);
+    WIDE_WIDTH_CASE(26);
+    WIDE_WIDTH_CASE(27);
+    WIDE_WIDTH_CASE(28);
+    WIDE_WIDTH_CASE(29);
+    WIDE_WIDTH_CASE(30);
+    WIDE_WIDTH_CASE(31);
+    WIDE_WIDTH_CASE(32);
     default:
       break;
   }
@@ -33,8 +33,15 @@ void BufferedInput::load(const LogType logType) {
 
   offsets_.clear();
   buffers_.clear();
+  deferredRegions_.clear();
   allocPool_->clear();
 
+  deferUnreadRegions();
+  if (regions_.empty()) {
+    streamIds_.clear();
+    return;
+  }
+
   sortRegions();
   mergeRegions();
 
@@ -75,11 +82,66 @@ void BufferedInput::load(const LogType logType) {
 
   // clear the loaded regions
   regions_.clear();
+  streamIds_.clear();
+}
+
+void BufferedInput::deferUnreadRegions() {
+  size_t numKept = 0;
+  for (size_t i = 0; i < regions_.size(); ++i) {
+    const auto id = streamIds_[i];
+    if (id != kNoStreamId) {
+      // The current enqueue is already counted, so a stream first seen in
+      // this cycle has one reference. Only defer once two full cycles went by
+      // without a read.
+      const auto& usage = streamUsage_[id];
+      if (usage.numReferences > 2 && usage.numReads == 0) {
+        auto& deferred = deferredRegions_[regions_[i].offset];
+        if (deferred.region.length < regions_[i].length) {
+          deferred.region = regions_[i];
+        }
+        continue;
+      }
+    }
+    regions_[numKept] = regions_[i];
+    streamIds_[numKept] = streamIds_[i];
+    ++numKept;
+  }
+  regions_.resize(numKept);
+  streamIds_.resize(numKept);
+}
+
+std::tuple<const char*, uint64_t> BufferedInput::readDeferred(
+    const velox::common::Region& region) {
+  auto it = deferredRegions_.find(region.offset);
+  if (it == deferredRegions_.end() ||
+      region.length > it->second.region.length) {
+    return std::make_tuple(nullptr, MAX_UINT64);
+  }
+  auto& deferred = it->second;
+  if (deferred.buffer.data() == nullptr) {
+    deferred.buffer = folly::Range<char*>(
+        allocPool_->allocateFixed(deferred.region.length),
+        deferred.region.length);
+    uint64_t usec = 0;
+    {
+      MicrosecondTimer timer(&usec);
+      input_->read(
+          deferred.buffer.data(),
+          deferred.buffer.size(),
+          deferred.region.offset,
+          LogType::FILE);
+    }
+    if (auto* stats = input_->getStats()) {
+      stats->read().increment(deferred.region.length);
+      stats->queryThreadIoLatency().increment(usec);
+    }
+  }
+  return std::make_tuple(deferred.buffer.data(), region.length);
 }
 
 std::unique_ptr<SeekableInputStream> BufferedInput::enqueue(
     Region region,
-    const dwio::common::StreamIdentifier* /*si*/) {
+    const dwio::common::StreamIdentifier* si) {
   if (region.length == 0) {
     return std::make_unique<SeekableArrayInputStream>(
         static_cast<const char*>(nullptr), 0);
@@ -91,13 +153,29 @@ std::unique_ptr<SeekableInputStream> BufferedInput::enqueue(
     return ret;
   }
 
+  const int32_t streamId = si != nullptr ? si->getId() : kNoStreamId;
+  if (streamId != kNoStreamId) {
+    ++streamUsage_[streamId].numReferences;
+  }
+
   // push to region pool and give the caller the callback
   regions_.push_back(region);
+  streamIds_.push_back(streamId);
   return std::make_unique<SeekableArrayInputStream>(
       // Save "i", the position in which this region was enqueued. This will
       // help faster lookup using enqueuedToBufferOffset_ later.
-      [region, this, i = regions_.size() - 1]() {
+      [region, this, i = regions_.size() - 1, streamId, recorded = false]()
+          mutable {
+        if (!recorded && streamId != kNoStreamId) {
+          ++streamUsage_[streamId].numReads;
+          recorded = true;
+        }
         auto result = readInternal(region.offset, region.length, i);
+        if (std::get<1>(result) == MAX_UINT64) {
+          // The region may have been excluded from the bulk load; read it on
+          // demand.
+          result = readDeferred(region);
+        }
         VELOX_CHECK(
             std::get<1>(result) != MAX_UINT64,
             "Fail to read region offset={} length={}",
@@ -188,6 +266,10 @@ bool BufferedInput::tryMerge(Region& first, const Region& second) {
   if (gap < 0 || gap <= maxMergeDistance_) {
     // the second region is inside first one if extension is negative
     if (extension > 0) {
+      // Do not grow a merged read past the coalesce size limit.
+      if (static_cast<int64_t>(first.length) + extension > maxCoalesceBytes_) {
+        return false;
+      }
       first.length += extension;
       if ((input_->getStats() != nullptr) && gap > 0) {
         input_->getStats()->incRawOverreadBytes(gap);
@@ -222,47 +304,49 @@ std::tuple<const char*, uint64_t> BufferedInput::readInternal(
     return std::make_tuple(nullptr, 0);
   }
 
-  std::optional<size_t> index;
   if (i.has_value()) {
     auto vi = i.value();
     // There's a possibility that our user enqueued, then tried to read before
     // calling load(). In that case, enqueuedToBufferOffset_ will be empty or
     // have the values from a previous load. So I want to make sure that he ends
     // up in a valid offset, and that this offset is <= offset. Otherwise we
-    // just go for the binary search.
+    // just go for the binary search. The hint can also be stale when some
+    // enqueued regions were deferred, in which case the lookup misses and we
+    // fall through to the binary search as well.
     if (vi < enqueuedToBufferOffset_.size() &&
         enqueuedToBufferOffset_[vi] < offsets_.size() &&
         offsets_[enqueuedToBufferOffset_[vi]] <= offset) {
-      index = enqueuedToBufferOffset_[i.value()];
-    }
-  }
-  if (!index.has_value()) {
-    // Binary search to get the first fileOffset for which: offset < fileOffset
-    auto it = std::upper_bound(offsets_.cbegin(), offsets_.cend(), offset);
-    // If the first element was already greater than the target offset we don't
-    // have it
-    if (it != offsets_.cbegin()) {
-      index = std::distance(offsets_.cbegin(), it) - 1;
+      auto result =
+          readFromBuffer(enqueuedToBufferOffset_[vi], offset, length);
+      if (std::get<1>(result) != MAX_UINT64) {
+        return result;
+      }
     }
   }
 
-  if (index.has_value()) {
-    const uint64_t bufferOffset = offsets_[index.value()];
-    const auto& buffer = buffers_[index.value()];
-    if (bufferOffset + buffer.size() >= offset + length) {
-      DWIO_ENSURE_LE(bufferOffset, offset, "Invalid offset for readInternal");
-      DWIO_ENSURE_LE(
-          (offset - bufferOffset) + length,
-          buffer.size(),
-          "Invalid readOffset for read Internal ",
-          fmt::format(
-              "{} {} {} {}", offset, bufferOffset, length, buffer.size()));
-
-      return std::make_tuple(buffer.data() + (offset - bufferOffset), length);
-    }
+  // Binary search to get the first fileOffset for which: offset < fileOffset
+  auto it = std::upper_bound(offsets_.cbegin(), offsets_.cend(), offset);
+  // If the first element was already greater than the target offset we don't
+  // have it
+  if (it != offsets_.cbegin()) {
+    return readFromBuffer(
+        std::distance(offsets_.cbegin(), it) - 1, offset, length);
   }
 
   return std::make_tuple(nullptr, MAX_UINT64);
 }
 
+std::tuple<const char*, uint64_t> BufferedInput::readFromBuffer(
+    size_t index,
+    uint64_t offset,
+    uint64_t length) const {
+  const uint64_t bufferOffset = offsets_[index];
+  const auto& buffer = buffers_[index];
+  if (bufferOffset > offset || bufferOffset + buffer.size() < offset + length) {
+    return std::make_tuple(nullptr, MAX_UINT64);
+  }
+
+  return std::make_tuple(buffer.data() + (offset - bufferOffset), length);
+}
+
 } // namespace facebook::velox::dwio::common
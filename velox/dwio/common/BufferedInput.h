@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <folly/container/F14Map.h>
+
+#include "velox/common/io/Options.h"
 #include "velox/common/memory/AllocationPool.h"
 #include "velox/dwio/common/SeekableInputStream.h"
 #include "velox/dwio/common/StreamIdentifier.h"
@@ -35,13 +38,15 @@ class BufferedInput {
       const MetricsLogPtr& metricsLog = MetricsLog::voidLog(),
       IoStatistics* FOLLY_NULLABLE stats = nullptr,
       uint64_t maxMergeDistance = kMaxMergeDistance,
-      std::optional<bool> wsVRLoad = std::nullopt)
+      std::optional<bool> wsVRLoad = std::nullopt,
+      int64_t maxCoalesceBytes = io::ReaderOptions::kDefaultCoalesceBytes)
       : input_{std::make_shared<ReadFileInputStream>(
             std::move(readFile),
             metricsLog,
             stats)},
         pool_{pool},
         maxMergeDistance_{maxMergeDistance},
+        maxCoalesceBytes_{maxCoalesceBytes},
         wsVRLoad_{wsVRLoad},
         allocPool_{std::make_unique<memory::AllocationPool>(&pool)} {}
 
@@ -49,10 +54,12 @@ class BufferedInput {
       std::shared_ptr<ReadFileInputStream> input,
       memory::MemoryPool& pool,
       uint64_t maxMergeDistance = kMaxMergeDistance,
-      std::optional<bool> wsVRLoad = std::nullopt)
+      std::optional<bool> wsVRLoad = std::nullopt,
+      int64_t maxCoalesceBytes = io::ReaderOptions::kDefaultCoalesceBytes)
       : input_(std::move(input)),
         pool_(pool),
         maxMergeDistance_{maxMergeDistance},
+        maxCoalesceBytes_{maxCoalesceBytes},
         wsVRLoad_{wsVRLoad},
         allocPool_{std::make_unique<memory::AllocationPool>(&pool)} {}
 
@@ -150,7 +157,29 @@ class BufferedInput {
   memory::MemoryPool& pool_;
 
  private:
+  static constexpr int32_t kNoStreamId = -1;
+
+  // Counts how often a stream was enqueued vs. actually read across the
+  // load() cycles (stripes) of this file. References are counted at enqueue,
+  // reads on first access of the returned stream.
+  struct StreamUsage {
+    int32_t numReferences{0};
+    int32_t numReads{0};
+  };
+
+  // A region excluded from the eager load. 'buffer' is filled on first
+  // access.
+  struct DeferredRegion {
+    velox::common::Region region;
+    folly::Range<char*> buffer;
+  };
+
   uint64_t maxMergeDistance_;
+  // Upper bound on the size of a merged read, shared with the cached read
+  // path through io::ReaderOptions. Merging stops growing a region once it
+  // would exceed this, so a long run of nearby streams does not become one
+  // giant IO.
+  int64_t maxCoalesceBytes_;
   std::optional<bool> wsVRLoad_;
   std::unique_ptr<memory::AllocationPool> allocPool_;
 
@@ -168,6 +197,17 @@ class BufferedInput {
   // enqueued position to its corresponding buffer offset.
   std::vector<size_t> enqueuedToBufferOffset_;
 
+  // Stream id of the corresponding entry in 'regions_'. kNoStreamId if the
+  // region was enqueued without a StreamIdentifier.
+  std::vector<int32_t> streamIds_;
+
+  // Per-stream usage across the load() cycles of this file.
+  folly::F14FastMap<int32_t, StreamUsage> streamUsage_;
+
+  // Regions of the current load() cycle whose eager load was skipped because
+  // their stream was never read in previous cycles, keyed by file offset.
+  folly::F14FastMap<uint64_t, DeferredRegion> deferredRegions_;
+
   std::unique_ptr<SeekableInputStream> readBuffer(
       uint64_t offset,
       uint64_t length) const;
@@ -175,6 +215,17 @@ class BufferedInput {
       uint64_t offset,
       uint64_t length,
       std::optional<size_t> i = std::nullopt) const;
+  std::tuple<const char*, uint64_t>
+  readFromBuffer(size_t index, uint64_t offset, uint64_t length) const;
+
+  // Moves regions whose stream has a history of never being read, e.g. a
+  // column always eliminated by filters before access, from 'regions_' to
+  // 'deferredRegions_' so that load() skips them.
+  void deferUnreadRegions();
+
+  // Reads the data of a deferred region on first access.
+  std::tuple<const char*, uint64_t> readDeferred(
+      const velox::common::Region& region);
 
   folly::Range<char*> allocate(const velox::common::Region& region) {
     // Save the file offset and the buffer to which we'll read it
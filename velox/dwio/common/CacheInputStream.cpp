@@ -20,6 +20,7 @@
 #include "velox/common/time/Timer.h"
 #include "velox/dwio/common/CacheInputStream.h"
 #include "velox/dwio/common/CachedBufferedInput.h"
+#include "velox/dwio/common/PrefetchController.h"
 
 using ::facebook::velox::common::Region;
 
@@ -78,15 +79,31 @@ bool CacheInputStream::Next(const void** buffer, int32_t* size) {
     auto offsetInQuantum = position_ % loadQuantum_;
     auto nextQuantum = position_ - offsetInQuantum + loadQuantum_;
     auto prefetchThreshold = loadQuantum_ * prefetchPct_ / 100;
-    if (!prefetchStarted_ && offsetInQuantum + *size > prefetchThreshold &&
-        position_ - offsetInQuantum + loadQuantum_ < region_.length) {
+    if (offsetInQuantum + *size > prefetchThreshold &&
+        nextQuantum < region_.length) {
       // We read past 'prefetchPct_' % of the current load quantum and the
-      // current load quantum is not the last in the region. Prefetch the next
-      // load quantum.
-      auto prefetchSize =
-          std::min(region_.length, nextQuantum + loadQuantum_) - nextQuantum;
-      prefetchStarted_ = bufferedInput_->prefetch(
-          Region{region_.offset + nextQuantum, prefetchSize});
+      // current load quantum is not the last in the region. Keep the next
+      // load quanta prefetched, several for high latency sources like cloud
+      // storage, one for local reads.
+      const uint64_t prefetchEnd = std::min<uint64_t>(
+          region_.length,
+          nextQuantum +
+              static_cast<uint64_t>(loadQuantum_) *
+                  PrefetchController::instance().numPrefetchQuanta(
+                      input_->getName()));
+      for (auto quantum = std::max<uint64_t>(nextQuantum, prefetchedUntil_);
+           quantum < prefetchEnd;
+           quantum += loadQuantum_) {
+        auto prefetchSize =
+            std::min<uint64_t>(region_.length, quantum + loadQuantum_) -
+            quantum;
+        if (!bufferedInput_->prefetch(
+                Region{region_.offset + quantum, prefetchSize})) {
+          // No memory for read-ahead. Retry from here on the next Next().
+          break;
+        }
+        prefetchedUntil_ = quantum + prefetchSize;
+      }
     }
   }
   position_ += *size;
@@ -180,7 +197,6 @@ void CacheInputStream::loadSync(Region region) {
   // so as not to double count when the individual parts are
   // hit.
   ioStats_->incRawBytesRead(hitSize);
-  prefetchStarted_ = false;
   do {
     folly::SemiFuture<bool> wait(false);
     cache::RawFileCacheKey key{fileNum_, region.offset};
@@ -217,10 +233,17 @@ void CacheInputStream::loadSync(Region region) {
       }
       ioStats_->read().increment(region.length);
       ioStats_->queryThreadIoLatency().increment(usec);
+      // Only reads that went to storage inform the per-source read-ahead
+      // distance.
+      PrefetchController::instance().recordRead(
+          input_->getName(), usec, region.length);
       entry->setExclusiveToShared();
     } else {
       // Hit memory cache.
-      if (!entry->getAndClearFirstUseFlag()) {
+      if (entry->getAndClearFirstUseFlag()) {
+        // First use of data loaded by a prefetch or coalesced load.
+        ioStats_->prefetchHit().increment(hitSize);
+      } else {
         ioStats_->ramHit().increment(hitSize);
       }
       return;
@@ -150,9 +150,10 @@ class CacheInputStream : public SeekableInputStream {
   // Over 100 means no prefetch.
   int32_t prefetchPct_{200};
 
-  // True if prefetch f the next 'loadQuantum_' has been started. Cleared when
-  // moving to the next load quantum.
-  bool prefetchStarted_{false};
+  // End of the prefetched range, relative to 'region_'. Prefetch is issued a
+  // load quantum at a time up to the read-ahead distance the
+  // PrefetchController derives from the source's measured read latency.
+  uint64_t prefetchedUntil_{0};
 
   // True if a pin should be set to lowest retention score after
   // unpinning. This applies to sequential reads where a second access
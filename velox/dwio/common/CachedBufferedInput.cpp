@@ -65,6 +65,13 @@ std::unique_ptr<SeekableInputStream> CachedBufferedInput::enqueue(
       id,
       groupId_,
       options_.loadQuantum());
+  if (si != nullptr && si->getId() == StreamIdentifier::sequentialFile().id_) {
+    // A stream read front to back in a single pass. Make its cache entries
+    // immediately evictable once unpinned so that a large one-off scan
+    // recycles its own space instead of displacing entries with access
+    // history.
+    stream->setNoRetention();
+  }
   requests_.back().stream = stream.get();
   return stream;
 }
@@ -108,6 +115,20 @@ bool isPrefetchPct(int32_t pct) {
   return pct >= FLAGS_cache_prefetch_min_pct;
 }
 
+// Maps an IO scheduling class to a folly executor priority so read-ahead of
+// batch and background queries does not queue ahead of interactive scans.
+int8_t executorPriority(io::IoSchedulingClass ioSchedulingClass) {
+  switch (ioSchedulingClass) {
+    case io::IoSchedulingClass::kInteractive:
+      return folly::Executor::HI_PRI;
+    case io::IoSchedulingClass::kBatch:
+      return folly::Executor::MID_PRI;
+    case io::IoSchedulingClass::kBackground:
+      return folly::Executor::LO_PRI;
+  }
+  VELOX_UNREACHABLE();
+}
+
 std::vector<CacheRequest*> makeRequestParts(
     CacheRequest& request,
     const cache::TrackingData& trackingData,
@@ -267,15 +288,23 @@ void CachedBufferedInput::makeLoads(
         readRegion(ranges, prefetch);
       });
   if (prefetch && executor_) {
+    // Executors without priority support run all loads at the same priority.
+    const bool hasPriorities = executor_->getNumPriorities() > 1;
+    const auto priority = executorPriority(options_.ioSchedulingClass());
     std::vector<int32_t> doneIndices;
     for (auto i = 0; i < allCoalescedLoads_.size(); ++i) {
       auto& load = allCoalescedLoads_[i];
       if (load->state() == CoalescedLoad::State::kPlanned) {
         prefetchSize_ += load->size();
-        executor_->add([pendingLoad = load]() {
+        auto task = [pendingLoad = load]() {
           process::TraceContext trace("Read Ahead");
           pendingLoad->loadOrFuture(nullptr);
-        });
+        };
+        if (hasPriorities) {
+          executor_->addWithPriority(std::move(task), priority);
+        } else {
+          executor_->add(std::move(task));
+        }
       } else {
         doneIndices.push_back(i);
       }
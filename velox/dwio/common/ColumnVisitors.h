@@ -1441,6 +1441,45 @@ class DirectRleColumnVisitor
       int32_t* filterHits,
       T* values,
       int32_t& numValues) {
+    if constexpr (hasFilter && !hasHook) {
+      // An RLE run is an arithmetic sequence, so the filter outcome can often
+      // be decided for the run as a whole instead of testing every value.
+      if (delta == 0) {
+        // All values in the run are identical. Evaluate the filter once and
+        // emit or skip all the selected rows in the run.
+        if (!velox::common::applyFilter(super::filter_, value)) {
+          super::rowIndex_ += numRows;
+          return;
+        }
+        emitRleRows<scatter>(
+            0,
+            numRows,
+            value,
+            delta,
+            currentRow,
+            scatterRows,
+            filterHits,
+            values,
+            numValues);
+        super::rowIndex_ += numRows;
+        return;
+      }
+      if constexpr (std::is_same_v<TFilter, velox::common::BigintRange>) {
+        // The run is monotonic, so the rows passing a range filter form a
+        // contiguous slice of the run whose bounds follow from the filter
+        // bounds arithmetically.
+        processRleRange<scatter>(
+            value,
+            delta,
+            numRows,
+            currentRow,
+            scatterRows,
+            filterHits,
+            values,
+            numValues);
+        return;
+      }
+    }
     if (sizeof(T) == 8) {
       constexpr int32_t kWidth = xsimd::batch<int64_t>::size;
       for (auto i = 0; i < numRows; i += kWidth) {
@@ -1477,6 +1516,101 @@ class DirectRleColumnVisitor
         values,
         numValues);
   }
+
+ private:
+  // Emits rows [begin, end) of the current run: appends the row numbers to
+  // 'filterHits' and, unless only filtering, the values to 'values'.
+  template <bool scatter>
+  void emitRleRows(
+      int32_t begin,
+      int32_t end,
+      T value,
+      T delta,
+      int32_t currentRow,
+      const int32_t* scatterRows,
+      int32_t* filterHits,
+      T* values,
+      int32_t& numValues) {
+    constexpr bool filterOnly =
+        std::is_same_v<typename super::Extract, DropValues>;
+    const auto* sourceRows =
+        (scatter ? scatterRows : super::rows_) + super::rowIndex_;
+    for (auto i = begin; i < end; ++i) {
+      filterHits[numValues] = sourceRows[i];
+      if (!filterOnly) {
+        values[numValues] =
+            (super::rows_[super::rowIndex_ + i] - currentRow) * delta + value;
+      }
+      ++numValues;
+    }
+  }
+
+  // Computes the slice of a monotonic run that falls inside a BigintRange
+  // filter and emits it without testing individual values.
+  template <bool scatter>
+  void processRleRange(
+      T value,
+      T delta,
+      int32_t numRows,
+      int32_t currentRow,
+      const int32_t* scatterRows,
+      int32_t* filterHits,
+      T* values,
+      int32_t& numValues) {
+    auto floorDiv = [](int64_t a, int64_t b) {
+      auto q = a / b;
+      return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+    };
+    auto ceilDiv = [](int64_t a, int64_t b) {
+      auto q = a / b;
+      return (a % b != 0 && (a < 0) == (b < 0)) ? q + 1 : q;
+    };
+
+    // The value at row 'r' is value + (r - currentRow) * delta. Solve the
+    // filter bounds for r - currentRow.
+    const int64_t lower = super::filter_.lower();
+    const int64_t upper = super::filter_.upper();
+    int64_t first;
+    int64_t last;
+    if (delta > 0) {
+      first = ceilDiv(lower - value, delta);
+      last = floorDiv(upper - value, delta);
+    } else {
+      first = ceilDiv(upper - value, delta);
+      last = floorDiv(lower - value, delta);
+    }
+
+    const auto* runRows = super::rows_ + super::rowIndex_;
+    const int64_t firstRow = currentRow + first;
+    const int64_t lastRow = currentRow + last;
+    if (first > last || firstRow > runRows[numRows - 1] ||
+        lastRow < runRows[0]) {
+      super::rowIndex_ += numRows;
+      return;
+    }
+    const int32_t begin = firstRow <= runRows[0]
+        ? 0
+        : std::lower_bound(
+              runRows, runRows + numRows, static_cast<int32_t>(firstRow)) -
+            runRows;
+    const int32_t end = lastRow >= runRows[numRows - 1]
+        ? numRows
+        : std::upper_bound(
+              runRows, runRows + numRows, static_cast<int32_t>(lastRow)) -
+            runRows;
+
+    emitRleRows<scatter>(
+        begin,
+        end,
+        value,
+        delta,
+        currentRow,
+        scatterRows,
+        filterHits,
+        values,
+        numValues);
+    super::rowIndex_ += numRows;
+  }
 };
 
 } // namespace facebook::velox::dwio::common
@@ -29,6 +29,53 @@ int32_t nonNullRowsFromDense(
   nonNullRows.resize(size);
   return size;
 }
+
+int32_t nullRowsFromDense(
+    const uint64_t* nulls,
+    int32_t numRows,
+    raw_vector<int32_t>& nullRows) {
+  nullRows.resize(numRows);
+  int32_t numNulls = 0;
+  bits::forEachUnsetBit(
+      nulls, 0, numRows, [&](int32_t row) { nullRows[numNulls++] = row; });
+  nullRows.resize(numNulls);
+  return numNulls;
+}
+
+int32_t nullRowsFromSparse(
+    const uint64_t* nulls,
+    RowSet rows,
+    raw_vector<int32_t>& nullRows) {
+  nullRows.resize(rows.size());
+  int32_t numNulls = 0;
+  for (auto row : rows) {
+    if (bits::isBitNull(nulls, row)) {
+      nullRows[numNulls++] = row;
+    }
+  }
+  nullRows.resize(numNulls);
+  return numNulls;
+}
+
+int32_t mergeNullHits(
+    const int32_t* nullRows,
+    int32_t numNullRows,
+    int32_t* hits,
+    int32_t numHits) {
+  // Merge from the back so that the hits already in place are not
+  // overwritten before they are read.
+  auto position = numHits + numNullRows;
+  auto hitIndex = numHits;
+  auto nullIndex = numNullRows;
+  while (nullIndex > 0) {
+    if (hitIndex > 0 && hits[hitIndex - 1] > nullRows[nullIndex - 1]) {
+      hits[--position] = hits[--hitIndex];
+    } else {
+      hits[--position] = nullRows[--nullIndex];
+    }
+  }
+  return numHits + numNullRows;
+}
 // Returns 8 bits starting at bit 'index'.
 uint8_t load8Bits(const uint64_t* bits, int32_t index) {
   uint8_t shift = index & 7;
@@ -146,6 +146,7 @@ inline void processFixedFilter(
 }
 
 struct NoHook;
+struct DropValues;
 
 template <
     typename T,
@@ -359,6 +360,32 @@ int32_t nonNullRowsFromDense(
     int32_t numRows,
     raw_vector<int32_t>& nonNullRows);
 
+// Fills 'nullRows' with the row numbers in [0, numRows) that are null in
+// 'nulls'. The complement of nonNullRowsFromDense(). Returns the number of
+// null rows.
+int32_t nullRowsFromDense(
+    const uint64_t* nulls,
+    int32_t numRows,
+    raw_vector<int32_t>& nullRows);
+
+// Fills 'nullRows' with the rows of 'rows' that are null in 'nulls'. Returns
+// the number of null rows.
+int32_t nullRowsFromSparse(
+    const uint64_t* nulls,
+    RowSet rows,
+    raw_vector<int32_t>& nullRows);
+
+// Merges the 'numNullRows' ascending row numbers in 'nullRows' into the
+// 'numHits' ascending row numbers at the start of 'hits'. Used when a filter
+// passes nulls: the null rows are hits regardless of the decoded values, see
+// useFastPathWithNullPassingFilter(). 'hits' must have space for 'numHits +
+// numNullRows' entries. Returns the merged count.
+int32_t mergeNullHits(
+    const int32_t* nullRows,
+    int32_t numNullRows,
+    int32_t* hits,
+    int32_t numHits);
+
 // Translates between row numbers in terms of positions in a nullable
 // column and row numbers in terms of actually stored non-null values.
 //
@@ -401,6 +428,21 @@ bool useFastPath(Visitor& visitor) {
        Visitor::HookType::kSkipNulls);
 }
 
+// Variant of useFastPath() for decoders whose bulk path additionally handles
+// deterministic filters that pass nulls when no values are retained
+// (filter-only reads). The only restriction this waives is the one on
+// 'visitor.allowNulls()': null rows become hits based on the null bitmap
+// alone and are merged with the rows passing on non-null values, see
+// mergeNullHits().
+template <typename Visitor, bool hasNulls>
+bool useFastPathWithNullPassingFilter(Visitor& visitor) {
+  return useFastPath<Visitor, hasNulls>(visitor) ||
+      ((!std::is_same_v<typename Visitor::DataType, int128_t>)&&process::
+           hasAvx2() &&
+       Visitor::FilterType::deterministic && Visitor::kHasBulkPath &&
+       std::is_same_v<typename Visitor::Extract, DropValues>);
+}
+
 // Scatters 'numValues' elements of 'data' starting at data[sourceBegin] to
 // indices given starting with target[targetBegin]. The scatter is done from
 // last to first so as not to overwrite source data when copying from lower to
@@ -72,7 +72,8 @@ class DirectDecoder : public IntDecoder<isSigned> {
       bool useFastPath = true) {
     if constexpr (!std::is_same_v<typename Visitor::DataType, int128_t>) {
       if (useFastPath &&
-          dwio::common::useFastPath<Visitor, hasNulls>(visitor)) {
+          dwio::common::useFastPathWithNullPassingFilter<Visitor, hasNulls>(
+              visitor)) {
         fastPath<hasNulls>(nulls, visitor);
         return;
       }
@@ -176,13 +177,28 @@ class DirectDecoder : public IntDecoder<isSigned> {
       int32_t tailSkip = 0;
       raw_vector<int32_t>* innerVector = nullptr;
       auto outerVector = &visitor.outerNonNullRows();
+      // With a filter that passes nulls and no values to retain, null rows
+      // are hits decided by the null bitmap alone. They are collected here
+      // and merged with the rows passing on non-null values after the scan.
+      const bool nullsPassFilter =
+          hasFilter && filterOnly && visitor.allowNulls();
+      raw_vector<int32_t> nullRows;
       // In non-DWRF formats, it can be the visitor is not dense but
       // this run of rows is dense.
       if (Visitor::dense || rowsAsRange.back() == rowsAsRange.size() - 1) {
         dwio::common::nonNullRowsFromDense(nulls, numRows, *outerVector);
         numNonNull = outerVector->size();
+        if (nullsPassFilter) {
+          dwio::common::nullRowsFromDense(nulls, numRows, nullRows);
+        }
         if (!numNonNull) {
-          visitor.setAllNull(hasFilter ? 0 : numRows);
+          if (nullsPassFilter) {
+            // All rows are null and nulls pass, so all rows are hits.
+            std::copy(rows, rows + numRows, visitor.outputRows(numRows));
+            visitor.setNumValues(numRows);
+          } else {
+            visitor.setAllNull(hasFilter ? 0 : numRows);
+          }
           return;
         }
       } else {
@@ -199,12 +215,22 @@ class DirectDecoder : public IntDecoder<isSigned> {
         if (anyNulls) {
           visitor.setHasNulls();
         }
+        if (nullsPassFilter) {
+          dwio::common::nullRowsFromSparse(nulls, rowsAsRange, nullRows);
+        }
         if (innerVector->empty()) {
           skip<false>(tailSkip, 0, nullptr);
-          visitor.setAllNull(hasFilter ? 0 : numRows);
+          if (nullsPassFilter) {
+            // All selected rows are null and nulls pass, so all are hits.
+            std::copy(rows, rows + numRows, visitor.outputRows(numRows));
+            visitor.setNumValues(numRows);
+          } else {
+            visitor.setAllNull(hasFilter ? 0 : numRows);
+          }
           return;
         }
       }
+      auto filterHits = hasFilter ? visitor.outputRows(numRows) : nullptr;
       if (super::useVInts) {
         if (Visitor::dense) {
           super::bulkRead(numNonNull, data);
@@ -221,7 +247,7 @@ class DirectDecoder : public IntDecoder<isSigned> {
             dataRows.size(),
             outerVector->data(),
             data,
-            hasFilter ? visitor.outputRows(numRows) : nullptr,
+            filterHits,
             numValues,
             visitor.filter(),
             visitor.hook());
@@ -232,7 +258,7 @@ class DirectDecoder : public IntDecoder<isSigned> {
                 : folly::Range<const int32_t*>(rows, outerVector->size()),
             outerVector->data(),
             visitor.rawValues(numRows),
-            hasFilter ? visitor.outputRows(numRows) : nullptr,
+            filterHits,
             numValues,
             *super::inputStream,
             super::bufferStart,
@@ -241,6 +267,10 @@ class DirectDecoder : public IntDecoder<isSigned> {
             visitor.hook());
         skip<false>(tailSkip, 0, nullptr);
       }
+      if (nullsPassFilter && !nullRows.empty()) {
+        numValues = dwio::common::mergeNullHits(
+            nullRows.data(), nullRows.size(), filterHits, numValues);
+      }
     } else {
       if (super::useVInts) {
         if (Visitor::dense) {
@@ -21,7 +21,13 @@
 namespace facebook::velox::dwio::common {
 
 struct Mutation {
-  /// Bit masks for row numbers to be deleted.
+  /// Bit mask of rows to be deleted from the next batch, with bit i
+  /// corresponding to the i-th row relative to the start of the batch. Table
+  /// formats with positional delete files (e.g. Iceberg) translate the delete
+  /// positions falling in the batch into this mask. The mask is applied to the
+  /// row set before any column is decoded, so deleted rows are never
+  /// materialized; a fully deleted batch turns into a skip in the child
+  /// readers.
   const uint64_t* deletedRows = nullptr;
 };
 
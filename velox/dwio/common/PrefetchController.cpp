@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/PrefetchController.h"
+
+#include <algorithm>
+
+namespace facebook::velox::dwio::common {
+namespace {
+// One extra quantum of read-ahead per this many microseconds of average read
+// latency. A local SSD read of a load quantum takes well under this, so local
+// sources stay at the minimum, while a cloud storage read of tens of
+// milliseconds gets several quanta.
+constexpr double kMicrosPerExtraQuantum = 4'000;
+
+// Number of reads of a source before its latency estimate is trusted.
+constexpr int64_t kMinReads = 8;
+
+// Weight of a new measurement in the moving average.
+constexpr double kAlpha = 1.0 / 8;
+} // namespace
+
+// static
+PrefetchController& PrefetchController::instance() {
+  static PrefetchController controller;
+  return controller;
+}
+
+// static
+std::string PrefetchController::sourceOf(std::string_view path) {
+  // The scheme prefix selects the FileSystem; paths without one are local.
+  auto pos = path.find("://");
+  if (pos == std::string_view::npos) {
+    return "local";
+  }
+  return std::string(path.substr(0, pos));
+}
+
+void PrefetchController::recordRead(
+    std::string_view path,
+    uint64_t micros,
+    uint64_t /*bytes*/) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto& stats = sources_[sourceOf(path)];
+  if (stats.numReads == 0) {
+    stats.readMicros = micros;
+  } else {
+    stats.readMicros += kAlpha * (static_cast<double>(micros) - stats.readMicros);
+  }
+  ++stats.numReads;
+}
+
+int32_t PrefetchController::numPrefetchQuanta(std::string_view path) const {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = sources_.find(sourceOf(path));
+  if (it == sources_.end() || it->second.numReads < kMinReads) {
+    return 1;
+  }
+  return std::clamp<int32_t>(
+      1 + it->second.readMicros / kMicrosPerExtraQuantum, 1, kMaxPrefetchQuanta);
+}
+
+} // namespace facebook::velox::dwio::common
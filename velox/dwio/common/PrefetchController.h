@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace facebook::velox::dwio::common {
+
+/// Tracks measured storage read latency per source and derives how many load
+/// quanta a CacheInputStream should keep prefetched ahead of the read
+/// position. A source is the scheme prefix of the file path, i.e. the same
+/// key that selects the FileSystem, so all files on local SSD share one
+/// latency estimate, all files on S3 another and so on. One process can scan
+/// both: low latency sources stay at one quantum of read-ahead while high
+/// latency ones get several. Process-wide, thread safe.
+class PrefetchController {
+ public:
+  /// Upper bound on read-ahead regardless of measured latency.
+  static constexpr int32_t kMaxPrefetchQuanta = 8;
+
+  /// Returns the process-wide instance.
+  static PrefetchController& instance();
+
+  /// Records one storage read of 'bytes' for the file at 'path' that took
+  /// 'micros' microseconds. Reads served from memory or SSD cache should not
+  /// be recorded.
+  void recordRead(std::string_view path, uint64_t micros, uint64_t bytes);
+
+  /// Returns the number of load quanta to keep prefetched ahead of the read
+  /// position of a stream over the file at 'path'. Returns 1 until enough
+  /// reads of the source have been measured.
+  int32_t numPrefetchQuanta(std::string_view path) const;
+
+ private:
+  struct SourceStats {
+    /// Exponential moving average of microseconds per storage read.
+    double readMicros{0};
+    int64_t numReads{0};
+  };
+
+  static std::string sourceOf(std::string_view path);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, SourceStats> sources_;
+};
+
+} // namespace facebook::velox::dwio::common
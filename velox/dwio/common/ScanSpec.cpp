@@ -67,12 +67,16 @@ uint64_t ScanSpec::newRead() {
   if (!numReads_) {
     reorder();
   } else if (enableFilterReorder_) {
+    // Reorder only on a clear inversion so that filters with nearly
+    // equal cost do not swap back and forth as their times fluctuate.
+    constexpr float kReorderHysteresis = 1.2;
     for (auto i = 1; i < children_.size(); ++i) {
       if (!children_[i]->filter_) {
         break;
       }
       if (children_[i - 1]->selectivity_.timeToDropValue() >
-          children_[i]->selectivity_.timeToDropValue()) {
+          kReorderHysteresis *
+              children_[i]->selectivity_.timeToDropValue()) {
         reorder();
         break;
       }
@@ -81,6 +85,13 @@ uint64_t ScanSpec::newRead() {
   return numReads_++;
 }
 
+void ScanSpec::resetSelectivity() {
+  selectivity_.reset();
+  for (auto& child : children_) {
+    child->resetSelectivity();
+  }
+}
+
 void ScanSpec::reorder() {
   if (children_.empty()) {
     return;
@@ -275,6 +275,14 @@ class ScanSpec {
     }
   }
 
+  // Resets the selectivity history of 'this' and its children. Called
+  // at stripe/row group boundaries. Data is often clustered, so a
+  // filter that was selective in one stripe can be pass-through in the
+  // next and the order learned on previous stripes can be wrong for
+  // the new one. The current filter order is kept until the new
+  // stripe's own statistics show a clearly better order, see newRead().
+  void resetSelectivity();
+
   void setEnableFilterReorder(bool enableFilterReorder) {
     enableFilterReorder_ = enableFilterReorder;
   }
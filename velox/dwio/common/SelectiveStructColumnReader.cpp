@@ -85,7 +85,12 @@ void SelectiveStructColumnReaderBase::next(
     std::iota(&rows_[oldSize], &rows_[rows_.size()], oldSize);
   }
   mutation_ = mutation;
-  hasMutation_ = mutation && mutation->deletedRows;
+  // Only take the mutation path when some row of this batch is actually
+  // deleted. Deletes are often clustered in a few row groups, so most batches
+  // of a file with deletes carry an all-zero mask; keeping the dense row set
+  // for them preserves the bulk read paths of the child readers.
+  hasMutation_ = mutation && mutation->deletedRows &&
+      bits::countBits(mutation->deletedRows, 0, numValues) > 0;
   read(readOffset_, rows_, nullptr);
   getValues(outputRows(), &result);
 }
@@ -94,6 +99,13 @@ void SelectiveStructColumnReaderBase::read(
     vector_size_t offset,
     RowSet rows,
     const uint64_t* incomingNulls) {
+  if (isRoot_ && !readStarted_) {
+    // 'this' starts reading a new stripe whose data may be clustered
+    // differently from the previous one. Re-learn the filter order from
+    // this stripe's data.
+    scanSpec_->resetSelectivity();
+    readStarted_ = true;
+  }
   numReads_ = scanSpec_->newRead();
   prepareRead<char>(offset, rows, incomingNulls);
   RowSet activeRows = rows;
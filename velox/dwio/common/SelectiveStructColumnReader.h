@@ -134,6 +134,11 @@ class SelectiveStructColumnReaderBase : public SelectiveColumnReader {
   // created by 'this' to verify they are still valid at load.
   uint64_t numReads_ = 0;
 
+  // False before the first read(). A root reader is made per stripe,
+  // so its first read starts a new stripe and resets the ScanSpec
+  // selectivity history, see ScanSpec::resetSelectivity().
+  bool readStarted_ = false;
+
   vector_size_t lazyVectorReadOffset_;
 
   // Dense set of rows to read in next().
@@ -17,6 +17,12 @@
 #include "velox/dwio/common/SortingWriter.h"
 
 namespace facebook::velox::dwio::common {
+namespace {
+// Output batch sizing for draining the sort buffer, mirroring the query
+// config defaults used by operators: target 10MB batches capped at 10K rows.
+constexpr uint64_t kMaxOutputBatchBytes = 10UL << 20;
+constexpr uint32_t kMaxOutputBatchRows = 10'000;
+} // namespace
 
 SortingWriter::SortingWriter(
     std::unique_ptr<Writer> writer,
@@ -44,10 +50,19 @@ void SortingWriter::close() {
   }
 
   sortBuffer_->noMoreInput();
-  RowVectorPtr output = sortBuffer_->getOutput();
+  const auto averageRowSize = sortBuffer_->estimateOutputRowSize();
+  uint32_t maxOutputRows = kMaxOutputBatchRows;
+  if (averageRowSize.has_value() && averageRowSize.value() > 0) {
+    maxOutputRows = std::max<uint32_t>(
+        1,
+        std::min<uint64_t>(
+            kMaxOutputBatchRows,
+            kMaxOutputBatchBytes / averageRowSize.value()));
+  }
+  RowVectorPtr output = sortBuffer_->getOutput(maxOutputRows);
   while (output != nullptr) {
     outputWriter_->write(output);
-    output = sortBuffer_->getOutput();
+    output = sortBuffer_->getOutput(maxOutputRows);
   }
   sortBuffer_.reset();
   sortPool_->release();
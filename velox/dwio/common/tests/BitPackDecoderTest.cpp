@@ -70,7 +70,9 @@ class BitPackDecoderTest : public testing::Test {
     uint64_t mask = bits::lowMask(bitWidth);
     for (auto i = 0; i < rows.size(); ++i) {
       uint64_t original = reference[rows[i]] & mask;
-      ASSERT_EQ(original, result[i])
+      uint64_t actual =
+          static_cast<typename std::make_unsigned<U>::type>(result[i]);
+      ASSERT_EQ(original, actual)
           << " at " << i << " with bitWidth " << bitWidth;
     }
   }
@@ -147,7 +149,11 @@ class BitPackDecoderTest : public testing::Test {
 };
 
 TEST_F(BitPackDecoderTest, allWidths) {
-  for (auto width = 0; width < bitPackedData_.size() - 1; ++width) {
+  for (auto width = 0; width < bitPackedData_.size(); ++width) {
+    if (width <= 16) {
+      testUnpack<int16_t>(width, allRows_);
+      testUnpack<int16_t>(width, oddRows_);
+    }
     testUnpack<int32_t>(width, allRows_);
     testUnpack<int64_t>(width, allRows_);
     testUnpack<int32_t>(width, oddRows_);
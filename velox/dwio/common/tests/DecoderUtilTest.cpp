@@ -161,6 +161,65 @@ TEST_F(DecoderUtilTest, nonNullsFromSparse) {
   }
 }
 
+TEST_F(DecoderUtilTest, nullRows) {
+  // Checks that nullRowsFromDense() is the complement of
+  // nonNullRowsFromDense() and that nullRowsFromSparse() agrees with it when
+  // all rows are selected.
+  constexpr int32_t kSize = 2000;
+  for (auto nullsIn1000 : {0, 1, 500, 999, 1000}) {
+    // Have an extra word at the end to allow 64 bit access.
+    std::vector<uint64_t> nulls(bits::nwords(kSize) + 1);
+    randomBits(nulls, 1000 - nullsIn1000);
+    raw_vector<int32_t> nonNullRows;
+    raw_vector<int32_t> nullRows;
+    nonNullRowsFromDense(nulls.data(), kSize, nonNullRows);
+    nullRowsFromDense(nulls.data(), kSize, nullRows);
+    EXPECT_EQ(kSize, nonNullRows.size() + nullRows.size());
+    for (auto row : nullRows) {
+      EXPECT_TRUE(bits::isBitNull(nulls.data(), row));
+    }
+    raw_vector<int32_t> allRows(kSize);
+    std::iota(allRows.begin(), allRows.end(), 0);
+    raw_vector<int32_t> sparseNullRows;
+    nullRowsFromSparse(
+        nulls.data(), RowSet(allRows.data(), allRows.size()), sparseNullRows);
+    EXPECT_EQ(nullRows.size(), sparseNullRows.size());
+    for (auto i = 0; i < nullRows.size(); ++i) {
+      EXPECT_EQ(nullRows[i], sparseNullRows[i]);
+    }
+  }
+}
+
+TEST_F(DecoderUtilTest, mergeNullHits) {
+  // Merges two disjoint ascending lists of row numbers, with the hits at the
+  // start of a buffer with space for both.
+  raw_vector<int32_t> hits;
+  raw_vector<int32_t> nullRows;
+  std::vector<int32_t> expected;
+  for (auto row = 0; row < 1000; ++row) {
+    switch (folly::Random::rand32(rng_) % 3) {
+      case 0:
+        hits.push_back(row);
+        expected.push_back(row);
+        break;
+      case 1:
+        nullRows.push_back(row);
+        expected.push_back(row);
+        break;
+      default:
+        break;
+    }
+  }
+  auto numHits = hits.size();
+  hits.resize(numHits + nullRows.size());
+  auto numMerged =
+      mergeNullHits(nullRows.data(), nullRows.size(), hits.data(), numHits);
+  EXPECT_EQ(expected.size(), numMerged);
+  for (auto i = 0; i < numMerged; ++i) {
+    EXPECT_EQ(expected[i], hits[i]);
+  }
+}
+
 namespace facebook::velox::dwio::common {
 // Excerpt from LazyVector.h.
 struct NoHook {
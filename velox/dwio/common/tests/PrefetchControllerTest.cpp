@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/PrefetchController.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox::dwio::common;
+
+// The controller is process-wide, so each test uses its own schemes.
+
+TEST(PrefetchControllerTest, adaptsToLatency) {
+  auto& controller = PrefetchController::instance();
+
+  // Unknown sources get the minimum read-ahead.
+  EXPECT_EQ(controller.numPrefetchQuanta("adapts1://bucket/file"), 1);
+
+  // A fast source stays at the minimum, a slow one gets more, up to the cap.
+  // The first few reads are not trusted yet.
+  for (auto i = 0; i < 20; ++i) {
+    if (i == 2) {
+      EXPECT_EQ(controller.numPrefetchQuanta("adapts1://bucket/file"), 1);
+      EXPECT_EQ(controller.numPrefetchQuanta("/local/path/file"), 1);
+    }
+    controller.recordRead("adapts1://bucket/file", 50'000, 1 << 20);
+    controller.recordRead("/local/path/file", 300, 1 << 20);
+  }
+  EXPECT_EQ(
+      controller.numPrefetchQuanta("adapts1://bucket/file"),
+      PrefetchController::kMaxPrefetchQuanta);
+  EXPECT_EQ(controller.numPrefetchQuanta("/local/path/file"), 1);
+
+  // The estimate is per source, not per file.
+  EXPECT_EQ(
+      controller.numPrefetchQuanta("adapts1://other-bucket/other-file"),
+      PrefetchController::kMaxPrefetchQuanta);
+}
+
+TEST(PrefetchControllerTest, tracksChange) {
+  auto& controller = PrefetchController::instance();
+
+  for (auto i = 0; i < 20; ++i) {
+    controller.recordRead("change1://bucket/file", 12'000, 1 << 20);
+  }
+  const auto slow = controller.numPrefetchQuanta("change1://bucket/file");
+  EXPECT_GT(slow, 1);
+  EXPECT_LT(slow, PrefetchController::kMaxPrefetchQuanta);
+
+  // The moving average follows a drop in latency.
+  for (auto i = 0; i < 50; ++i) {
+    controller.recordRead("change1://bucket/file", 500, 1 << 20);
+  }
+  EXPECT_EQ(controller.numPrefetchQuanta("change1://bucket/file"), 1);
+}
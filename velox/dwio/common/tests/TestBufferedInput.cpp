@@ -347,3 +347,50 @@ TEST(TestBufferedInput, VReadSortingWithLabels) {
     EXPECT_EQ(next.value(), r.second);
   }
 }
+
+TEST(TestBufferedInput, DeferNeverReadStreams) {
+  // 10 chars per letter: "aaaaaaaaaabbbbbbbbbb..."
+  std::string content;
+  for (char c = 'a'; c <= 'j'; ++c) {
+    content += std::string(10, c);
+  }
+
+  auto readFileMock = std::make_shared<ReadFileMock>();
+  // One stream is read every cycle, the other never. The never-read stream is
+  // loaded eagerly in the first two cycles. In the third cycle its load is
+  // deferred and happens on demand only.
+  expectPreads(
+      *readFileMock,
+      content,
+      {{0, 5}, {10, 5}, {20, 5}, {50, 5}, {60, 5}, {70, 5}});
+  auto pool = facebook::velox::memory::addDefaultLeafMemoryPool();
+  BufferedInput input(
+      readFileMock,
+      *pool,
+      MetricsLog::voidLog(),
+      nullptr,
+      10, // Will merge if distance <= 10
+      /* wsVRLoad = */ false);
+
+  StreamIdentifier readId(1);
+  StreamIdentifier unreadId(2);
+
+  std::unique_ptr<SeekableInputStream> unreadStream;
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    auto readStream = input.enqueue({cycle * 10ul, 5}, &readId);
+    unreadStream = input.enqueue({50 + cycle * 10ul, 5}, &unreadId);
+    ASSERT_NE(readStream, nullptr);
+    ASSERT_NE(unreadStream, nullptr);
+
+    input.load(LogType::TEST);
+
+    auto next = getNext(*readStream);
+    ASSERT_TRUE(next.has_value());
+    EXPECT_EQ(next.value(), content.substr(cycle * 10, 5));
+  }
+
+  // Reading the deferred stream after all still returns correct data.
+  auto next = getNext(*unreadStream);
+  ASSERT_TRUE(next.has_value());
+  EXPECT_EQ(next.value(), content.substr(70, 5));
+}
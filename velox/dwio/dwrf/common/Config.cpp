@@ -209,4 +209,8 @@ Config::Entry<uint64_t> Config::RAW_DATA_SIZE_PER_BATCH(
     50UL * 1024 * 1024);
 
 Config::Entry<bool> Config::MAP_STATISTICS("orc.map.statistics", false);
+
+Config::Entry<bool> Config::DISTINCT_SKETCHES(
+    "orc.distinct.sketches",
+    false);
 } // namespace facebook::velox::dwrf
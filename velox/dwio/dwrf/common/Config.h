@@ -74,6 +74,9 @@ class Config : public common::ConfigBase<Config> {
   /// stripes.
   static Entry<uint64_t> RAW_DATA_SIZE_PER_BATCH;
   static Entry<bool> MAP_STATISTICS;
+  /// Collect a HyperLogLog sketch per top-level scalar column and store the
+  /// serialized sketches in the footer's user metadata on close.
+  static Entry<bool> DISTINCT_SKETCHES;
 
   static std::shared_ptr<Config> fromMap(
       const std::map<std::string, std::string>& map) {
@@ -20,6 +20,7 @@
 #include "velox/common/memory/Memory.h"
 #include "velox/dwio/common/Adaptor.h"
 #include "velox/dwio/common/DataBuffer.h"
+#include "velox/dwio/common/DecoderUtil.h"
 #include "velox/dwio/common/IntDecoder.h"
 #include "velox/dwio/common/exception/Exception.h"
 
@@ -72,6 +73,10 @@ class RleDecoderV2 : public dwio::common::IntDecoder<isSigned> {
 
   template <bool hasNulls, typename Visitor>
   void readWithVisitor(const uint64_t* nulls, Visitor visitor) {
+    if (dwio::common::useFastPath<Visitor, hasNulls>(visitor)) {
+      fastPath<hasNulls>(nulls, visitor);
+      return;
+    }
     int32_t current = visitor.start();
     skip<hasNulls>(current, 0, nulls);
 
@@ -110,6 +115,94 @@ class RleDecoderV2 : public dwio::common::IntDecoder<isSigned> {
   }
 
  private:
+  template <bool hasNulls, typename Visitor>
+  void fastPath(const uint64_t* nulls, Visitor& visitor) {
+    constexpr bool hasFilter =
+        !std::is_same_v<typename Visitor::FilterType, common::AlwaysTrue>;
+    constexpr bool hasHook =
+        !std::is_same_v<typename Visitor::HookType, dwio::common::NoHook>;
+    auto rows = visitor.rows();
+    auto numRows = visitor.numRows();
+    auto rowsAsRange = folly::Range<const int32_t*>(rows, numRows);
+    if (hasNulls) {
+      raw_vector<int32_t>* innerVector = nullptr;
+      auto outerVector = &visitor.outerNonNullRows();
+      if (Visitor::dense) {
+        dwio::common::nonNullRowsFromDense(nulls, numRows, *outerVector);
+        if (outerVector->empty()) {
+          visitor.setAllNull(hasFilter ? 0 : numRows);
+          return;
+        }
+        bulkScan<hasFilter, hasHook, true>(
+            folly::Range<const int32_t*>(rows, outerVector->size()),
+            outerVector->data(),
+            visitor);
+      } else {
+        innerVector = &visitor.innerNonNullRows();
+        int32_t tailSkip = -1;
+        auto anyNulls = dwio::common::nonNullRowsFromSparse < hasFilter,
+             !hasFilter &&
+            !hasHook >
+                (nulls,
+                 rowsAsRange,
+                 *innerVector,
+                 *outerVector,
+                 (hasFilter || hasHook) ? nullptr : visitor.rawNulls(numRows),
+                 tailSkip);
+        if (anyNulls) {
+          visitor.setHasNulls();
+        }
+        if (innerVector->empty()) {
+          skip<false>(tailSkip, 0, nullptr);
+          visitor.setAllNull(hasFilter ? 0 : numRows);
+          return;
+        }
+        bulkScan<hasFilter, hasHook, true>(
+            *innerVector, outerVector->data(), visitor);
+        skip<false>(tailSkip, 0, nullptr);
+      }
+    } else {
+      bulkScan<hasFilter, hasHook, false>(rowsAsRange, nullptr, visitor);
+    }
+  }
+
+  // Decodes the span of values covered by 'nonNullRows' in one pass with the
+  // batch run decoders and visits the decoded values, instead of re-entering
+  // the run state machine for every value as the scalar visitor loop does.
+  // The batch decoders expand whole short-repeat/direct/patched/delta runs at
+  // a time.
+  template <bool hasFilter, bool hasHook, bool scatter, typename Visitor>
+  void bulkScan(
+      folly::Range<const int32_t*> nonNullRows,
+      const int32_t* scatterRows,
+      Visitor& visitor) {
+    using DataType = typename Visitor::DataType;
+    const auto numAllRows = visitor.numRows();
+    visitor.setRows(nonNullRows);
+    const auto* rows = visitor.rows();
+    const auto numRows = visitor.numRows();
+    const uint64_t numToDecode = rows[numRows - 1] + 1;
+    auto* values = visitor.rawValues(numRows);
+    if (Visitor::dense && sizeof(DataType) == sizeof(int64_t)) {
+      next(reinterpret_cast<int64_t*>(values), numToDecode, nullptr);
+    } else {
+      // Decode the full span, then gather the rows of interest to the front
+      // of the visitor's values, narrowing to its data type.
+      bulkValues.resize(numToDecode);
+      auto* decoded = bulkValues.data();
+      next(decoded, numToDecode, nullptr);
+      for (int32_t i = 0; i < numRows; ++i) {
+        values[i] =
+            static_cast<DataType>(decoded[Visitor::dense ? i : rows[i]]);
+      }
+    }
+    auto* filterHits = hasFilter ? visitor.outputRows(numRows) : nullptr;
+    int32_t numValues = 0;
+    visitor.template processRun<hasFilter, hasHook, scatter>(
+        values, numRows, scatterRows, filterHits, values, numValues);
+    visitor.setNumValues(hasFilter ? numValues : numAllRows);
+  }
+
   // Used by PATCHED_BASE
   void adjustGapAndPatch() {
     curGap = static_cast<uint64_t>(unpackedPatch[patchIdx]) >> patchBitSize;
@@ -243,6 +336,7 @@ class RleDecoderV2 : public dwio::common::IntDecoder<isSigned> {
   EncodingType type;
   dwio::common::DataBuffer<int64_t> unpacked; // Used by PATCHED_BASE
   dwio::common::DataBuffer<int64_t> unpackedPatch; // Used by PATCHED_BASE
+  dwio::common::DataBuffer<int64_t> bulkValues; // Used by bulkScan
 };
 
 } // namespace facebook::velox::dwrf
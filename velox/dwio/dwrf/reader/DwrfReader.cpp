@@ -97,6 +97,11 @@ DwrfRowReader::DwrfRowReader(
   }
   stripeLoadStatuses_ = folly::Synchronized(
       std::vector<FetchStatus>(numberOfStripes, FetchStatus::NOT_STARTED));
+
+  if (options_.getDecodingExecutor()) {
+    stripePrefetchBarrier_ =
+        std::make_unique<ExecutorBarrier>(options_.getDecodingExecutor());
+  }
 }
 
 uint64_t DwrfRowReader::seekToRow(uint64_t rowNumber) {
@@ -564,6 +569,35 @@ DwrfRowReader::FetchResult DwrfRowReader::prefetch(uint32_t stripeToFetch) {
   return fetch(stripeToFetch);
 }
 
+void DwrfRowReader::scheduleStripePrefetch(uint32_t stripeIndex) {
+  if (!stripePrefetchBarrier_ || stripeIndex >= lastStripe) {
+    return;
+  }
+  if (stripeLoadStatuses_.rlock()->at(stripeIndex) !=
+      FetchStatus::NOT_STARTED) {
+    return;
+  }
+  // Background loads are subject to the same restriction as caller driven
+  // prefetch: seek is not supported once stripes other than the current one
+  // may be loaded.
+  prefetchHasOccurred_ = true;
+  VLOG(1) << "Scheduling background load of stripe " << stripeIndex;
+  stripePrefetchBarrier_->add([this, stripeIndex]() {
+    try {
+      fetch(stripeIndex);
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Background load of stripe " << stripeIndex
+                   << " failed: " << e.what();
+      // Record the error, then unblock the scan thread if it is already
+      // waiting on the baton. safeFetchNextStripe() rethrows the error on its
+      // own thread. The load status is left IN_PROGRESS so no other thread
+      // starts a load before the scan thread re-arms the stripe.
+      *stripeLoadError_.wlock() = std::current_exception();
+      stripeLoadBatons_[stripeIndex]->post();
+    }
+  });
+}
+
 // Guarantee stripe we are currently on is available and loaded
 void DwrfRowReader::safeFetchNextStripe() {
   auto startTime = std::chrono::high_resolution_clock::now();
@@ -594,6 +628,19 @@ void DwrfRowReader::safeFetchNextStripe() {
     };
   }
 
+  if (!prefetchedStripeStates_.rlock()->contains(currentStripe)) {
+    // A background load of this stripe failed and posted the baton after
+    // capturing the error. Re-arm the stripe so a retry can load it again and
+    // rethrow the error on this thread.
+    stripeLoadBatons_[currentStripe] = std::make_unique<folly::Baton<>>();
+    stripeLoadStatuses_.wlock()->operator[](currentStripe) =
+        FetchStatus::NOT_STARTED;
+    std::exception_ptr error;
+    stripeLoadError_.withWLock([&](auto& e) { std::swap(error, e); });
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
   DWIO_ENSURE(prefetchedStripeStates_.rlock()->contains(currentStripe));
 }
 
@@ -627,6 +674,11 @@ void DwrfRowReader::startNextStripe() {
 
   DWIO_ENSURE(freeStripeAt(currentStripe));
 
+  // Start decoding the next stripe's footer and building its reader tree in
+  // the background, so the next stripe transition does not stall the scan
+  // thread.
+  scheduleStripePrefetch(currentStripe + 1);
+
   newStripeReadyForRead = true;
   auto endTime = std::chrono::high_resolution_clock::now();
   VLOG(1) << " time to complete startNextStripe: "
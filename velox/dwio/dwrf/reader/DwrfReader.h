@@ -131,6 +131,12 @@ class DwrfRowReader : public StrideIndexProvider,
   FetchResult fetch(uint32_t stripeIndex);
   FetchResult prefetch(uint32_t stripeToFetch);
 
+  // Kicks off loading 'stripeIndex' on the decoding executor so that the
+  // stripe footer is decoded and the column reader tree is built by the time
+  // the scan thread gets there. No-op when no executor is configured or when
+  // a load of the stripe has already been started, e.g. via prefetchUnits().
+  void scheduleStripePrefetch(uint32_t stripeIndex);
+
   // footer
   std::vector<uint64_t> firstRowOfStripe;
   mutable std::shared_ptr<const dwio::common::TypeWithId> selectedSchema;
@@ -194,6 +200,17 @@ class DwrfRowReader : public StrideIndexProvider,
 
   dwio::common::ColumnReaderStatistics columnReaderStatistics_;
 
+  // Error captured by a background stripe load scheduled with
+  // scheduleStripePrefetch(). Rethrown by safeFetchNextStripe() on the thread
+  // that consumes the stripe.
+  folly::Synchronized<std::exception_ptr> stripeLoadError_;
+
+  // Runs the background stripe loads scheduled by scheduleStripePrefetch().
+  // Kept separate from 'executorBarrier_' so that waiting for decoding work
+  // in readNext() does not also wait for next-stripe loads. Declared last so
+  // pending loads are joined before the state they touch is destroyed.
+  std::unique_ptr<dwio::common::ExecutorBarrier> stripePrefetchBarrier_;
+
   // internal methods
 
   std::optional<size_t> estimatedRowSizeHelper(
@@ -137,6 +137,7 @@ void SelectiveStringDictionaryColumnReader::loadStrideDictionary() {
   // get stride dictionary size and load it if needed
   auto& positions =
       formatData_->as<DwrfData>().index().entry(nextStride).positions();
+  const auto priorStrideDictValues = scanState_.dictionary2.numValues;
   scanState_.dictionary2.numValues = positions.Get(strideDictSizeOffset_);
   if (scanState_.dictionary2.numValues > 0) {
     // seek stride dictionary related streams
@@ -150,7 +151,13 @@ void SelectiveStringDictionaryColumnReader::loadStrideDictionary() {
         *strideDictStream_, *strideDictLengthDecoder_, scanState_.dictionary2);
   }
   lastStrideIndex_ = nextStride;
-  dictionaryValues_ = nullptr;
+  if (scanState_.dictionary2.numValues > 0 || priorStrideDictValues > 0) {
+    // The combined dictionary changed. If neither the new nor the previous
+    // stride has a stride dictionary, the cached stripe-wide values vector
+    // stays valid, so batches across strides keep sharing the same base and
+    // downstream value-id caches keyed on it stay warm.
+    dictionaryValues_ = nullptr;
+  }
 
   if (scanSpec_->hasFilter()) {
     scanState_.filterCache.resize(
@@ -542,6 +542,9 @@ TEST_F(CacheTest, ssd) {
   EXPECT_LT(sparseStripeBytes, fullStripeBytes / 4);
   // Expect the dense fraction of columns to have read ahead.
   EXPECT_LT(1000000, ioStats_->prefetch().sum());
+  // The read-ahead data gets used, so expect first uses of prefetched
+  // entries to be counted.
+  EXPECT_LT(0, ioStats_->prefetchHit().sum());
 
   constexpr int32_t kStripesPerFile = 10;
   auto bytesPerFile = fullStripeBytes * kStripesPerFile;
@@ -18,6 +18,7 @@
 #include <random>
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/config/SpillConfig.h"
+#include "velox/common/hyperloglog/SparseHll.h"
 #include "velox/common/testutil/TestValue.h"
 #include "velox/dwio/common/Options.h"
 #include "velox/dwio/common/Statistics.h"
@@ -1993,3 +1994,77 @@ TEST_F(E2EWriterTest, memoryReclaimThreshold) {
     writer->close();
   }
 }
+
+TEST_F(E2EWriterTest, distinctSketches) {
+  const auto type =
+      ROW({{"id", BIGINT()},
+           {"name", VARCHAR()},
+           {"nested", ROW({{"a", INTEGER()}})}});
+
+  constexpr vector_size_t kSize = 10'000;
+  constexpr int64_t kDistinctIds = 1'000;
+  constexpr int64_t kDistinctNames = 37;
+
+  auto ids = BaseVector::create<FlatVector<int64_t>>(
+      BIGINT(), kSize, leafPool_.get());
+  auto names = BaseVector::create<FlatVector<StringView>>(
+      VARCHAR(), kSize, leafPool_.get());
+  auto nestedInts = BaseVector::create<FlatVector<int32_t>>(
+      INTEGER(), kSize, leafPool_.get());
+  for (vector_size_t i = 0; i < kSize; ++i) {
+    ids->set(i, i % kDistinctIds);
+    names->set(
+        i, StringView(fmt::format("name-{}", i % kDistinctNames).c_str()));
+    nestedInts->set(i, i);
+  }
+  auto nested = std::make_shared<RowVector>(
+      leafPool_.get(),
+      type->childAt(2),
+      nullptr,
+      kSize,
+      std::vector<VectorPtr>{nestedInts});
+  auto batch = std::make_shared<RowVector>(
+      leafPool_.get(),
+      type,
+      nullptr,
+      kSize,
+      std::vector<VectorPtr>{ids, names, nested});
+
+  auto config = std::make_shared<dwrf::Config>();
+  config->set(dwrf::Config::DISTINCT_SKETCHES, true);
+
+  auto sink = std::make_unique<MemorySink>(
+      200 * 1024 * 1024,
+      dwio::common::FileSink::Options{.pool = leafPool_.get()});
+  auto sinkPtr = sink.get();
+
+  dwrf::WriterOptions options;
+  options.config = config;
+  options.schema = type;
+  options.memoryPool = rootPool_.get();
+  dwrf::Writer writer{std::move(sink), options};
+  writer.write(batch);
+  writer.close();
+
+  dwio::common::ReaderOptions readerOpts{defaultPool.get()};
+  auto reader = createReader(*sinkPtr, readerOpts);
+
+  auto estimate = [&](const std::string& column) {
+    auto serialized =
+        reader->getMetadataValue(DistinctSketchCollector::metadataKey(column));
+    if (common::hll::SparseHll::canDeserialize(serialized.data())) {
+      return common::hll::SparseHll::cardinality(serialized.data());
+    }
+    return common::hll::DenseHll::cardinality(serialized.data());
+  };
+
+  // Low cardinalities stay in the sparse layout, which is exact. The 'id'
+  // column overflows to the dense layout, which carries a small standard
+  // error.
+  EXPECT_EQ(kDistinctNames, estimate("name"));
+  EXPECT_NEAR(kDistinctIds, estimate("id"), kDistinctIds * 0.1);
+
+  // Columns of unsupported type have no sketch.
+  EXPECT_FALSE(reader->hasMetadataValue(
+      DistinctSketchCollector::metadataKey("nested")));
+}
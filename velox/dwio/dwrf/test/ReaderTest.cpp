@@ -721,6 +721,35 @@ TEST_F(TestRowReaderPrefetch, testParallelPrefetchNoPreload) {
       expectedBatchSize.size());
 }
 
+// With a decoding executor set, each stripe transition schedules a background
+// load of the following stripe. Verifies reads stay correct when stripes are
+// loaded ahead of the scan thread.
+TEST_F(TestRowReaderPrefetch, testBackgroundStripeLoad) {
+  // batch size is set as 1000 in reading
+  std::array<int32_t, 5> seeks;
+  seeks.fill(0);
+  const std::array<int32_t, 4> expectedBatchSize{300, 300, 300, 100};
+  dwio::common::ReaderOptions readerOpts{pool()};
+  // Explicitly disable so IO takes some time
+  readerOpts.setFilePreloadThreshold(0);
+  RowReaderOptions rowReaderOpts;
+  rowReaderOpts.select(std::make_shared<ColumnSelector>(getFlatmapSchema()));
+  rowReaderOpts.setDecodingExecutor(
+      std::make_shared<folly::CPUThreadPoolExecutor>(2));
+  auto reader = DwrfReader::create(
+      createFileBufferedInput(getFMSmallFile(), readerOpts.getMemoryPool()),
+      readerOpts);
+  auto rowReaderOwner = reader->createRowReader(rowReaderOpts);
+  auto rowReader = dynamic_cast<DwrfRowReader*>(rowReaderOwner.get());
+
+  // Verify reads are correct
+  verifyFlatMapReading(
+      rowReader,
+      seeks.data(),
+      expectedBatchSize.data(),
+      expectedBatchSize.size());
+}
+
 TEST_F(TestRowReaderPrefetch, prefetchWithCachedIndexStream) {
   dwio::common::ReaderOptions readerOpts{pool()};
   readerOpts.setFilePreloadThreshold(0);
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Decode benchmarks for the ORC RLE v1 and v2 integer decoders across value
+// shapes (literal runs at different magnitudes, constant runs, delta runs),
+// null densities and read/skip selectivities. Bit-pack and varint decoding
+// are covered separately by BitPackDecoderBenchmark and IntDecoderBenchmark
+// in velox/dwio/common/tests. Run with --bm_json to get machine readable
+// output for comparing runs.
+
+#include <folly/Benchmark.h>
+#include <folly/Random.h>
+#include <folly/init/Init.h>
+
+#include "velox/common/base/Nulls.h"
+#include "velox/dwio/common/DataBufferHolder.h"
+#include "velox/dwio/common/FileSink.h"
+#include "velox/dwio/common/Range.h"
+#include "velox/dwio/dwrf/common/DecoderUtil.h"
+#include "velox/dwio/dwrf/common/RLEv1.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::dwio::common;
+using namespace facebook::velox::dwrf;
+
+constexpr uint64_t kNumValues = 1'000'000;
+
+namespace {
+
+struct BenchmarkData {
+  std::shared_ptr<memory::MemoryPool> pool;
+
+  // Encoded streams, all holding kNumValues values.
+  std::string v1Literal7Bit;
+  std::string v1Literal16Bit;
+  std::string v1Literal32Bit;
+  std::string v1ConstantRuns;
+  std::string v1DeltaRuns;
+  std::string v1Literal16BitNulls10;
+  std::string v1Literal16BitNulls50;
+  std::string v2Direct8Bit;
+  std::string v2Direct16Bit;
+  std::string v2Direct32Bit;
+  std::string v2ShortRepeat;
+
+  // Null bitmaps with ~10% and ~50% nulls.
+  std::vector<uint64_t> nulls10;
+  std::vector<uint64_t> nulls50;
+
+  // Decode target, reused across benchmarks.
+  std::vector<int64_t> result;
+};
+
+std::unique_ptr<BenchmarkData> data;
+
+std::vector<uint64_t> makeNulls(uint64_t numValues, uint64_t numNulls) {
+  std::vector<uint64_t> nulls(bits::nwords(numValues));
+  memset(nulls.data(), bits::kNotNullByte, nulls.size() * sizeof(uint64_t));
+  while (numNulls > 0) {
+    uint64_t pos = folly::Random::rand32(numValues);
+    if (!bits::isBitNull(nulls.data(), pos)) {
+      bits::setNull(nulls.data(), pos);
+      --numNulls;
+    }
+  }
+  return nulls;
+}
+
+std::vector<int64_t> makeLiterals(uint64_t mask) {
+  std::vector<int64_t> values(kNumValues);
+  for (auto& value : values) {
+    value = folly::Random::rand64() & mask;
+  }
+  return values;
+}
+
+std::string encodeV1(const std::vector<int64_t>& values, const uint64_t* nulls) {
+  MemorySink memSink(
+      values.size() * sizeof(int64_t) * 2, {.pool = data->pool.get()});
+  DataBufferHolder holder{
+      *data->pool, 1024 * 1024, 0, DEFAULT_PAGE_GROW_RATIO, &memSink};
+  RleEncoderV1<false> encoder(
+      std::make_unique<BufferedOutputStream>(holder), true, 8);
+  encoder.add(values.data(), common::Ranges::of(0, values.size()), nulls);
+  encoder.flush();
+  return std::string(memSink.data(), memSink.size());
+}
+
+// Returns the 5 bit encoded width code of the RLEv2 direct encoding for a
+// bit width that is a multiple of 8 and at most 32.
+uint8_t v2WidthCode(uint32_t bitWidth) {
+  return bitWidth <= 24 ? bitWidth - 1 : 27;
+}
+
+void appendBigEndian(std::string& out, uint64_t value, uint32_t numBytes) {
+  for (uint32_t i = 0; i < numBytes; ++i) {
+    out.push_back(
+        static_cast<char>((value >> (8 * (numBytes - 1 - i))) & 0xff));
+  }
+}
+
+// Appends an RLEv2 DIRECT run of 'count' (at most 512) 'bitWidth' bit values.
+void appendV2Direct(
+    std::string& out,
+    uint32_t count,
+    uint32_t bitWidth,
+    uint64_t mask) {
+  out.push_back(
+      static_cast<char>(0x40 | (v2WidthCode(bitWidth) << 1) | ((count - 1) >> 8)));
+  out.push_back(static_cast<char>((count - 1) & 0xff));
+  for (uint32_t i = 0; i < count; ++i) {
+    appendBigEndian(out, folly::Random::rand64() & mask, bitWidth / 8);
+  }
+}
+
+// Builds an RLEv2 stream of 'numValues' values made of maximal DIRECT runs.
+std::string makeV2Direct(uint64_t numValues, uint32_t bitWidth) {
+  std::string out;
+  const uint64_t mask =
+      bitWidth == 64 ? ~0ULL : ((1ULL << bitWidth) - 1);
+  while (numValues > 0) {
+    auto count = static_cast<uint32_t>(std::min<uint64_t>(numValues, 512));
+    appendV2Direct(out, count, bitWidth, mask);
+    numValues -= count;
+  }
+  return out;
+}
+
+// Builds an RLEv2 stream of 'numValues' values made of maximal SHORT_REPEAT
+// runs of single byte values.
+std::string makeV2ShortRepeat(uint64_t numValues) {
+  std::string out;
+  uint64_t value = 0;
+  while (numValues > 0) {
+    auto count = static_cast<uint32_t>(std::min<uint64_t>(numValues, 10));
+    if (count < 3) {
+      // SHORT_REPEAT runs hold 3 to 10 values; round the tail up, the
+      // benchmark never reads past kNumValues.
+      count = 3;
+    }
+    out.push_back(static_cast<char>(count - 3));
+    appendBigEndian(out, value++ & 0xff, 1);
+    numValues -= std::min<uint64_t>(count, numValues);
+  }
+  return out;
+}
+
+void decodeAll(
+    const std::string& buffer,
+    RleVersion version,
+    const uint64_t* nulls) {
+  auto decoder = createRleDecoder<false>(
+      std::make_unique<SeekableArrayInputStream>(buffer.data(), buffer.size()),
+      version,
+      *data->pool,
+      true,
+      dwio::common::INT_BYTE_SIZE);
+  decoder->next(data->result.data(), kNumValues, nulls);
+}
+
+// Alternates reading 'read' values and skipping 'skip' values to mimic a
+// filter that selects read / (read + skip) of the rows.
+void decodeWithSkips(
+    const std::string& buffer,
+    RleVersion version,
+    uint64_t read,
+    uint64_t skip) {
+  auto decoder = createRleDecoder<false>(
+      std::make_unique<SeekableArrayInputStream>(buffer.data(), buffer.size()),
+      version,
+      *data->pool,
+      true,
+      dwio::common::INT_BYTE_SIZE);
+  uint64_t remaining = kNumValues;
+  while (remaining > 0) {
+    auto toRead = std::min(read, remaining);
+    decoder->next(data->result.data(), toRead, nullptr);
+    remaining -= toRead;
+    auto toSkip = std::min(skip, remaining);
+    decoder->skip(toSkip);
+    remaining -= toSkip;
+  }
+}
+
+} // namespace
+
+BENCHMARK(rleV1Literal7Bit) {
+  decodeAll(data->v1Literal7Bit, RleVersion_1, nullptr);
+}
+
+BENCHMARK(rleV1Literal16Bit) {
+  decodeAll(data->v1Literal16Bit, RleVersion_1, nullptr);
+}
+
+BENCHMARK(rleV1Literal32Bit) {
+  decodeAll(data->v1Literal32Bit, RleVersion_1, nullptr);
+}
+
+BENCHMARK(rleV1ConstantRuns) {
+  decodeAll(data->v1ConstantRuns, RleVersion_1, nullptr);
+}
+
+BENCHMARK(rleV1DeltaRuns) {
+  decodeAll(data->v1DeltaRuns, RleVersion_1, nullptr);
+}
+
+BENCHMARK(rleV1Literal16BitNulls10) {
+  decodeAll(data->v1Literal16BitNulls10, RleVersion_1, data->nulls10.data());
+}
+
+BENCHMARK(rleV1Literal16BitNulls50) {
+  decodeAll(data->v1Literal16BitNulls50, RleVersion_1, data->nulls50.data());
+}
+
+BENCHMARK(rleV1Literal16BitRead10Skip90) {
+  decodeWithSkips(data->v1Literal16Bit, RleVersion_1, 10, 90);
+}
+
+BENCHMARK(rleV1DeltaRunsRead10Skip90) {
+  decodeWithSkips(data->v1DeltaRuns, RleVersion_1, 10, 90);
+}
+
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(rleV2Direct8Bit) {
+  decodeAll(data->v2Direct8Bit, RleVersion_2, nullptr);
+}
+
+BENCHMARK(rleV2Direct16Bit) {
+  decodeAll(data->v2Direct16Bit, RleVersion_2, nullptr);
+}
+
+BENCHMARK(rleV2Direct32Bit) {
+  decodeAll(data->v2Direct32Bit, RleVersion_2, nullptr);
+}
+
+BENCHMARK(rleV2ShortRepeat) {
+  decodeAll(data->v2ShortRepeat, RleVersion_2, nullptr);
+}
+
+BENCHMARK(rleV2Direct16BitNulls10) {
+  decodeAll(data->v2Direct16Bit, RleVersion_2, data->nulls10.data());
+}
+
+BENCHMARK(rleV2Direct16BitNulls50) {
+  decodeAll(data->v2Direct16Bit, RleVersion_2, data->nulls50.data());
+}
+
+BENCHMARK(rleV2Direct16BitRead10Skip90) {
+  decodeWithSkips(data->v2Direct16Bit, RleVersion_2, 10, 90);
+}
+
+int32_t main(int32_t argc, char* argv[]) {
+  folly::init(&argc, &argv);
+
+  data = std::make_unique<BenchmarkData>();
+  data->pool = memory::addDefaultLeafMemoryPool();
+  data->result.resize(kNumValues);
+  data->nulls10 = makeNulls(kNumValues, kNumValues / 10);
+  data->nulls50 = makeNulls(kNumValues, kNumValues / 2);
+
+  data->v1Literal7Bit = encodeV1(makeLiterals(0x7f), nullptr);
+  data->v1Literal16Bit = encodeV1(makeLiterals(0xffff), nullptr);
+  data->v1Literal32Bit = encodeV1(makeLiterals(0xffffffff), nullptr);
+
+  std::vector<int64_t> values(kNumValues);
+  for (uint64_t i = 0; i < kNumValues; ++i) {
+    values[i] = i / 512;
+  }
+  data->v1ConstantRuns = encodeV1(values, nullptr);
+  for (uint64_t i = 0; i < kNumValues; ++i) {
+    values[i] = i;
+  }
+  data->v1DeltaRuns = encodeV1(values, nullptr);
+
+  data->v1Literal16BitNulls10 =
+      encodeV1(makeLiterals(0xffff), data->nulls10.data());
+  data->v1Literal16BitNulls50 =
+      encodeV1(makeLiterals(0xffff), data->nulls50.data());
+
+  data->v2Direct8Bit = makeV2Direct(kNumValues, 8);
+  data->v2Direct16Bit = makeV2Direct(kNumValues, 16);
+  data->v2Direct32Bit = makeV2Direct(kNumValues, 32);
+  data->v2ShortRepeat = makeV2ShortRepeat(kNumValues);
+
+  folly::runBenchmarks();
+  data.reset();
+  return 0;
+}
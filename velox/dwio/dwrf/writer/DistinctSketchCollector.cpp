@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/dwrf/writer/DistinctSketchCollector.h"
+
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
+#include "velox/common/hyperloglog/HllUtils.h"
+
+namespace facebook::velox::dwrf {
+
+namespace {
+
+// Values must hash exactly like approx_distinct inputs so that stored
+// sketches merge with aggregate intermediates.
+template <typename T>
+inline uint64_t hashOne(T value) {
+  return XXH64(&value, sizeof(T), 0);
+}
+
+template <>
+inline uint64_t hashOne<StringView>(StringView value) {
+  return XXH64(value.data(), value.size(), 0);
+}
+
+bool isSupportedType(TypeKind kind) {
+  switch (kind) {
+    case TypeKind::BOOLEAN:
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::REAL:
+    case TypeKind::DOUBLE:
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+    case TypeKind::TIMESTAMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
+DistinctSketchCollector::DistinctSketchCollector(
+    const RowTypePtr& type,
+    memory::MemoryPool& pool)
+    : indexBitLength_{common::hll::toIndexBitLength(
+          common::hll::kDefaultStandardError)},
+      allocator_{&pool} {
+  for (auto i = 0; i < type->size(); ++i) {
+    if (!isSupportedType(type->childAt(i)->kind())) {
+      continue;
+    }
+    auto sketch = std::make_unique<Sketch>(&allocator_);
+    sketch->sparse.setSoftMemoryLimit(
+        common::hll::DenseHll::estimateInMemorySize(indexBitLength_));
+    columns_.push_back(Column{
+        static_cast<column_index_t>(i),
+        type->nameOf(i),
+        type->childAt(i)->kind(),
+        std::move(sketch)});
+  }
+}
+
+void DistinctSketchCollector::append(uint64_t hash, Sketch& sketch) {
+  if (sketch.isSparse) {
+    if (sketch.sparse.insertHash(hash)) {
+      sketch.isSparse = false;
+      sketch.dense.initialize(indexBitLength_);
+      sketch.sparse.toDense(sketch.dense);
+      sketch.sparse.reset();
+    }
+  } else {
+    sketch.dense.insertHash(hash);
+  }
+}
+
+template <TypeKind Kind>
+void DistinctSketchCollector::appendColumn(
+    Column& column,
+    vector_size_t numRows) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  for (vector_size_t row = 0; row < numRows; ++row) {
+    if (decodedRow_.isNullAt(row)) {
+      continue;
+    }
+    const auto index = decodedRow_.index(row);
+    if (decodedChild_.isNullAt(index)) {
+      continue;
+    }
+    append(hashOne(decodedChild_.valueAt<T>(index)), *column.sketch);
+  }
+}
+
+void DistinctSketchCollector::addInput(const VectorPtr& input) {
+  const auto numRows = input->size();
+  rows_.resize(numRows);
+  decodedRow_.decode(*input, rows_);
+  auto* base = decodedRow_.base()->as<RowVector>();
+  if (base == nullptr) {
+    return;
+  }
+
+  for (auto& column : columns_) {
+    const auto& child = base->childAt(column.channel);
+    childRows_.resize(child->size());
+    decodedChild_.decode(*child, childRows_);
+    VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+        appendColumn, column.kind, column, numRows);
+  }
+}
+
+std::unordered_map<std::string, std::string>
+DistinctSketchCollector::serialize() {
+  std::unordered_map<std::string, std::string> sketches;
+  sketches.reserve(columns_.size());
+  for (auto& column : columns_) {
+    auto& sketch = *column.sketch;
+    std::string serialized;
+    if (sketch.isSparse) {
+      serialized.resize(sketch.sparse.serializedSize());
+      sketch.sparse.serialize(indexBitLength_, serialized.data());
+    } else {
+      serialized.resize(sketch.dense.serializedSize());
+      sketch.dense.serialize(serialized.data());
+    }
+    sketches.emplace(metadataKey(column.name), std::move(serialized));
+  }
+  return sketches;
+}
+
+} // namespace facebook::velox::dwrf
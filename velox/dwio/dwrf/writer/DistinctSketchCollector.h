@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "velox/common/hyperloglog/DenseHll.h"
+#include "velox/common/hyperloglog/SparseHll.h"
+#include "velox/common/memory/HashStringAllocator.h"
+#include "velox/vector/ComplexVector.h"
+#include "velox/vector/DecodedVector.h"
+
+namespace facebook::velox::dwrf {
+
+/// Accumulates one HyperLogLog sketch per top-level column of supported
+/// scalar type while a file is written. On close the writer serializes the
+/// sketches in the Presto HLL format and stores them in the file footer's
+/// user metadata under metadataKey(columnName). For append-only tables a
+/// distinct-count estimate over many files can then be answered by merging
+/// the stored sketches instead of scanning values; stored sketches also
+/// merge with approx_distinct intermediates since values are hashed the
+/// same way.
+class DistinctSketchCollector {
+ public:
+  static constexpr std::string_view kMetadataKeyPrefix = "velox.hll.sketch.";
+
+  /// Returns the user metadata key under which the sketch for the column
+  /// named 'name' is stored.
+  static std::string metadataKey(const std::string& name) {
+    return fmt::format("{}{}", kMetadataKeyPrefix, name);
+  }
+
+  DistinctSketchCollector(const RowTypePtr& type, memory::MemoryPool& pool);
+
+  /// Updates the sketches of all tracked columns with the values in 'input'.
+  /// 'input' must be a RowVector of the writer's schema, possibly wrapped in
+  /// encodings.
+  void addInput(const VectorPtr& input);
+
+  /// Returns the serialized sketch keyed by metadataKey(columnName) for each
+  /// tracked column.
+  std::unordered_map<std::string, std::string> serialize();
+
+ private:
+  // A sketch that starts in the memory-efficient sparse layout and switches
+  // to the dense layout once the sparse representation grows past the dense
+  // size, same as approx_distinct.
+  struct Sketch {
+    explicit Sketch(HashStringAllocator* allocator)
+        : sparse{allocator}, dense{allocator} {}
+
+    common::hll::SparseHll sparse;
+    common::hll::DenseHll dense;
+    bool isSparse{true};
+  };
+
+  struct Column {
+    column_index_t channel;
+    std::string name;
+    TypeKind kind;
+    std::unique_ptr<Sketch> sketch;
+  };
+
+  void append(uint64_t hash, Sketch& sketch);
+
+  template <TypeKind Kind>
+  void appendColumn(Column& column, vector_size_t numRows);
+
+  const int8_t indexBitLength_;
+  HashStringAllocator allocator_;
+  std::vector<Column> columns_;
+
+  SelectivityVector rows_;
+  SelectivityVector childRows_;
+  DecodedVector decodedRow_;
+  DecodedVector decodedChild_;
+};
+
+} // namespace facebook::velox::dwrf
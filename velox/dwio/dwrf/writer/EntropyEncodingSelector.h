@@ -18,6 +18,8 @@
 
 #include <folly/Random.h>
 
+#include <array>
+
 #include "velox/dwio/common/DataBuffer.h"
 #include "velox/dwio/dwrf/writer/StringDictionaryEncoder.h"
 
@@ -79,20 +81,23 @@ class EntropyEncodingSelector {
  private:
   bool useDictionaryEncodingEntropyHeuristic(
       const StringDictionaryEncoder& dictEncoder) const {
-    std::unordered_set<char> charSet;
+    // Bitmap over the 256 possible byte values seen so far. Tracking distinct
+    // characters with set bits and a popcount is branch-free and allocation
+    // free, unlike a hash set insert per character.
+    std::array<uint64_t, 4> charBits{};
     // Perform sampling if required.
     if (dictEncoder.size() > entropyMinSamples_) {
       auto samples = getSampleIndicesForEntropy(dictEncoder);
       size_t sampleSize = samples.size();
       for (size_t i = 0; i != sampleSize; ++i) {
-        if (isEntropyThresholdExceeded(dictEncoder, charSet, samples[i])) {
+        if (isEntropyThresholdExceeded(dictEncoder, charBits, samples[i])) {
           return true;
         }
       }
     } else {
       size_t dictSize = dictEncoder.size();
       for (size_t i = 0; i != dictSize; ++i) {
-        if (isEntropyThresholdExceeded(dictEncoder, charSet, i)) {
+        if (isEntropyThresholdExceeded(dictEncoder, charBits, i)) {
           return true;
         }
       }
@@ -141,14 +146,18 @@ class EntropyEncodingSelector {
 
   bool isEntropyThresholdExceeded(
       const StringDictionaryEncoder& dictEncoder,
-      std::unordered_set<char>& charSet,
+      std::array<uint64_t, 4>& charBits,
       size_t index) const {
     auto key = dictEncoder.getKey(index);
     size_t size = key.size();
     for (size_t i = 0; i != size; ++i) {
-      charSet.insert(key[i]);
+      auto byte = static_cast<uint8_t>(key[i]);
+      charBits[byte >> 6] |= 1ULL << (byte & 63);
     }
-    return charSet.size() > entropyThreshold_;
+    auto numDistinct = __builtin_popcountll(charBits[0]) +
+        __builtin_popcountll(charBits[1]) + __builtin_popcountll(charBits[2]) +
+        __builtin_popcountll(charBits[3]);
+    return static_cast<size_t>(numDistinct) > entropyThreshold_;
   }
 
   memory::MemoryPool& pool_;
@@ -108,6 +108,17 @@ Writer::Writer(
   } else {
     writer_ = options.columnWriterFactory(writerBase_->getContext(), *schema_);
   }
+
+  if (options.flushExecutor != nullptr) {
+    sinkWriteBarrier_ =
+        std::make_unique<dwio::common::ExecutorBarrier>(options.flushExecutor);
+  }
+
+  if (context.getConfig(Config::DISTINCT_SKETCHES)) {
+    distinctSketches_ = std::make_unique<DistinctSketchCollector>(
+        asRowType(options.schema),
+        context.getMemoryPool(MemoryUsageCategory::GENERAL));
+  }
 }
 
 Writer::Writer(
@@ -147,6 +158,10 @@ void Writer::write(const VectorPtr& input) {
   CHECK_NOT_CLOSED();
   NON_RECLAIMABLE_SECTION_CHECK();
 
+  if (distinctSketches_ != nullptr) {
+    distinctSketches_->addInput(input);
+  }
+
   auto& context = writerBase_->getContext();
   // Calculate length increment based on linear projection of micro batch size.
   // Total length is capped later.
@@ -578,6 +593,13 @@ void Writer::flushInternal(bool close) {
   auto& sink = writerBase_->getSink();
   {
     CpuWallTimer timer{context.flushTiming()};
+    // Wait for the previous stripe to reach the file sink before producing
+    // more sink data, so that stripes are written in order and stripe offsets
+    // read from the sink are final. This rethrows if the background write
+    // failed.
+    if (sinkWriteBarrier_ != nullptr) {
+      sinkWriteBarrier_->waitAll();
+    }
     flushStripe(close);
 
     // if this is the last stripe, add footer
@@ -655,7 +677,14 @@ void Writer::flushInternal(bool close) {
     }
 
     // flush to sink
-    sink.flush();
+    if (sinkWriteBarrier_ != nullptr && !close) {
+      // Hand the stripe buffers to the background executor so the file write
+      // overlaps with accumulating the next stripe. The final flush on close
+      // stays synchronous so that the file is complete when close() returns.
+      sink.flushAsync(*sinkWriteBarrier_);
+    } else {
+      sink.flush();
+    }
   }
 
   if (close) {
@@ -691,6 +720,12 @@ void Writer::close() {
     flushPolicy_->onClose();
     closed_ = true;
   });
+  if (distinctSketches_ != nullptr) {
+    auto sketches = distinctSketches_->serialize();
+    for (auto& [key, sketch] : sketches) {
+      writerBase_->addUserMetadata(key, sketch);
+    }
+  }
   flushInternal(true);
   writerBase_->close();
 }
@@ -698,6 +733,16 @@ void Writer::close() {
 void Writer::abort() {
   RETURN_IF_CLOSED();
   auto exitGuard = folly::makeGuard([this]() { closed_ = true; });
+  if (sinkWriteBarrier_ != nullptr) {
+    // Let any in-flight sink write finish before tearing down the sink. Ignore
+    // its outcome since the file is being abandoned.
+    try {
+      sinkWriteBarrier_->waitAll();
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Ignoring background sink write failure during abort: "
+                   << e.what();
+    }
+  }
   // NOTE: we need to reset column writer as all its dependent objects (e.g.
   // writer context) will be reset by writer base abort.
   writer_.reset();
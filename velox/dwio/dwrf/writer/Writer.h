@@ -19,10 +19,12 @@
 #include <iterator>
 #include <limits>
 
+#include "velox/dwio/common/ExecutorBarrier.h"
 #include "velox/dwio/common/Writer.h"
 #include "velox/dwio/common/WriterFactory.h"
 #include "velox/dwio/dwrf/common/Encryption.h"
 #include "velox/dwio/dwrf/writer/ColumnWriter.h"
+#include "velox/dwio/dwrf/writer/DistinctSketchCollector.h"
 #include "velox/dwio/dwrf/writer/FlushPolicy.h"
 #include "velox/dwio/dwrf/writer/LayoutPlanner.h"
 #include "velox/dwio/dwrf/writer/WriterBase.h"
@@ -51,6 +53,10 @@ struct WriterOptions {
       WriterContext& context,
       const velox::dwio::common::TypeWithId& type)>
       columnWriterFactory;
+  /// If not null, flushed stripes are written to the file sink on this
+  /// executor while the caller thread accumulates the next stripe, instead of
+  /// blocking the caller on file IO at every stripe boundary.
+  std::shared_ptr<folly::Executor> flushExecutor;
 };
 
 class Writer : public dwio::common::Writer {
@@ -214,6 +220,13 @@ class Writer : public dwio::common::Writer {
   std::unique_ptr<DWRFFlushPolicy> flushPolicy_;
   std::unique_ptr<LayoutPlanner> layoutPlanner_;
   std::unique_ptr<ColumnWriter> writer_;
+  // Set when Config::DISTINCT_SKETCHES is enabled. Serialized sketches are
+  // added to the footer's user metadata on close.
+  std::unique_ptr<DistinctSketchCollector> distinctSketches_;
+  // Runs the file sink writes of flushed stripes when 'flushExecutor' is set
+  // in the writer options. Declared last so that its destructor waits for any
+  // in-flight write before the sink goes away.
+  std::unique_ptr<dwio::common::ExecutorBarrier> sinkWriteBarrier_;
 };
 
 class DwrfWriterFactory : public dwio::common::WriterFactory {
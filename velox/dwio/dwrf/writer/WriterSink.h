@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <folly/Executor.h>
 #include <folly/container/Array.h>
 
+#include <atomic>
+
 #include "velox/dwio/common/DataBufferHolder.h"
 #include "velox/dwio/dwrf/common/Checksum.h"
 #include "velox/dwio/dwrf/common/Config.h"
@@ -60,7 +63,7 @@ class WriterSink {
   }
 
   uint64_t size() const {
-    return sink_->size() + size_;
+    return sink_->size() + size_ + pendingSize_;
   }
 
   void init(memory::MemoryPool& pool);
@@ -87,6 +90,25 @@ class WriterSink {
     size_ = 0;
   }
 
+  /// Queues the buffered data to be written to the file sink on 'executor'.
+  /// 'size()' keeps accounting for the queued bytes until they reach the file
+  /// sink. The caller is responsible for waiting for the queued write to
+  /// complete before queueing or performing another flush, so that data
+  /// reaches the file sink in order.
+  void flushAsync(folly::Executor& executor) {
+    auto buffers =
+        std::make_shared<std::vector<dwio::common::DataBuffer<char>>>(
+            std::move(buffers_));
+    buffers_.clear();
+    const auto flushSize = size_;
+    pendingSize_ += flushSize;
+    size_ = 0;
+    executor.add([this, flushSize, buffers]() {
+      sink_->write(*buffers);
+      pendingSize_ -= flushSize;
+    });
+  }
+
   Checksum* getChecksum() {
     return checksum_.get();
   }
@@ -174,6 +196,8 @@ class WriterSink {
   bool initialized_{false};
   Mode mode_;
   uint64_t size_;
+  // Bytes handed to 'flushAsync' that have not yet been written to 'sink_'.
+  std::atomic<uint64_t> pendingSize_{0};
 
   // members used by stripe metadata cache
   dwio::common::DataBufferHolder cacheHolder_;
@@ -19,6 +19,7 @@
 #include "velox/dwio/common/BufferUtil.h"
 #include "velox/dwio/common/ColumnVisitors.h"
 #include "velox/dwio/parquet/thrift/ThriftTransport.h"
+#include "velox/dwio/parquet/reader/Statistics.h"
 #include "velox/vector/FlatVector.h"
 
 #include <thrift/protocol/TCompactProtocol.h> // @manual
@@ -31,6 +32,7 @@ using thrift::PageHeader;
 void PageReader::seekToPage(int64_t row) {
   defineDecoder_.reset();
   repeatDecoder_.reset();
+  pageFilteredOut_ = false;
   // 'rowOfPage_' is the row number of the first row of the next page.
   rowOfPage_ += numRowsInPage_;
   for (;;) {
@@ -72,6 +74,13 @@ void PageReader::seekToPage(int64_t row) {
   }
 }
 
+bool PageReader::pageMatchesFilter(const thrift::Statistics& stats) const {
+  auto columnStats =
+      buildColumnStatisticsFromThrift(stats, *type_->type(), numRowsInPage_);
+  return common::testFilter(
+      visitorFilter_, columnStats.get(), numRowsInPage_, type_->type());
+}
+
 PageHeader PageReader::readPageHeader() {
   if (bufferEnd_ == bufferStart_) {
     const void* buffer;
@@ -235,11 +244,27 @@ void PageReader::prepareDataPageV1(const PageHeader& pageHeader, int64_t row) {
 
     return;
   }
+  if (row != kRepDefOnly && visitorFilter_ != nullptr && isTopLevel_ &&
+      numRowsInPage_ != kRowsUnknown &&
+      pageHeader.data_page_header.__isset.statistics &&
+      !pageMatchesFilter(pageHeader.data_page_header.statistics)) {
+    // No value in the page can pass the filter. Skip the page without
+    // decompressing or decoding it. All its rows are misses.
+    pageFilteredOut_ = true;
+    dwio::common::skipBytes(
+        pageHeader.compressed_page_size,
+        inputStream_.get(),
+        bufferStart_,
+        bufferEnd_);
+    return;
+  }
   pageData_ = readBytes(pageHeader.compressed_page_size, pageBuffer_);
-  pageData_ = decompressData(
-      pageData_,
-      pageHeader.compressed_page_size,
-      pageHeader.uncompressed_page_size);
+  if (codec_ != thrift::CompressionCodec::UNCOMPRESSED) {
+    pageData_ = decompressData(
+        pageData_,
+        pageHeader.compressed_page_size,
+        pageHeader.uncompressed_page_size);
+  }
   auto pageEnd = pageData_ + pageHeader.uncompressed_page_size;
   if (maxRepeat_ > 0) {
     uint32_t repeatLength = readField<int32_t>(pageData_);
@@ -290,6 +315,18 @@ void PageReader::prepareDataPageV2(const PageHeader& pageHeader, int64_t row) {
         bufferEnd_);
     return;
   }
+  if (row != kRepDefOnly && visitorFilter_ != nullptr && isTopLevel_ &&
+      numRowsInPage_ != kRowsUnknown &&
+      pageHeader.data_page_header_v2.__isset.statistics &&
+      !pageMatchesFilter(pageHeader.data_page_header_v2.statistics)) {
+    pageFilteredOut_ = true;
+    skipBytes(
+        pageHeader.compressed_page_size,
+        inputStream_.get(),
+        bufferStart_,
+        bufferEnd_);
+    return;
+  }
 
   uint32_t defineLength = maxDefine_ > 0
       ? pageHeader.data_page_header_v2.definition_levels_byte_length
@@ -315,8 +352,13 @@ void PageReader::prepareDataPageV2(const PageHeader& pageHeader, int64_t row) {
   }
   auto levelsSize = repeatLength + defineLength;
   pageData_ += levelsSize;
-  if (pageHeader.data_page_header_v2.__isset.is_compressed ||
-      pageHeader.data_page_header_v2.is_compressed) {
+  // The levels are never compressed. The data section is compressed
+  // unless 'is_compressed' is explicitly false (it defaults to true).
+  const bool dataCompressed = codec_ !=
+          thrift::CompressionCodec::UNCOMPRESSED &&
+      (!pageHeader.data_page_header_v2.__isset.is_compressed ||
+       pageHeader.data_page_header_v2.is_compressed);
+  if (dataCompressed) {
     pageData_ = decompressData(
         pageData_,
         pageHeader.compressed_page_size - levelsSize,
@@ -683,6 +725,11 @@ void PageReader::skip(int64_t numRows) {
       numLeafNullsConsumed_ = rowOfPage_;
     }
     toSkip -= rowOfPage_ - firstUnvisited_;
+  } else if (pageFilteredOut_) {
+    // The current page was dropped by its header statistics, so there is
+    // no decoder state to advance.
+    firstUnvisited_ += numRows;
+    return;
   }
   firstUnvisited_ += numRows;
 
@@ -815,6 +862,21 @@ bool PageReader::rowsForPage(
       numLeafNullsConsumed_ = rowOfPage_;
     }
   }
+  // If the page was dropped based on its header statistics, all its rows
+  // are filter misses. Advance past them without decoding until a page
+  // that can contain passing values is found.
+  while (pageFilteredOut_) {
+    const int64_t firstOnNextPage = rowOfPage_ + numRowsInPage_ - visitBase_;
+    while (currentVisitorRow_ < numVisitorRows_ &&
+           visitorRows_[currentVisitorRow_] < firstOnNextPage) {
+      ++currentVisitorRow_;
+    }
+    if (currentVisitorRow_ == numVisitorRows_) {
+      firstUnvisited_ = visitBase_ + visitorRows_[currentVisitorRow_ - 1] + 1;
+      return false;
+    }
+    seekToPage(visitBase_ + visitorRows_[currentVisitorRow_]);
+  }
   auto& scanState = reader.scanState();
   if (isDictionary()) {
     if (scanState.dictionary.values != dictionary_.values) {
@@ -185,6 +185,10 @@ class PageReader {
 
   void prepareDataPageV1(const thrift::PageHeader& pageHeader, int64_t row);
   void prepareDataPageV2(const thrift::PageHeader& pageHeader, int64_t row);
+
+  // True if some value in the page described by 'stats' can pass
+  // 'visitorFilter_'.
+  bool pageMatchesFilter(const thrift::Statistics& stats) const;
   void prepareDictionary(const thrift::PageHeader& pageHeader);
   void makeDecoder();
 
@@ -420,6 +424,17 @@ class PageReader {
   dwio::common::DictionaryValues dictionary_;
   thrift::Encoding::type dictionaryEncoding_;
 
+  // Filter of the column being read. Set for the duration of
+  // readWithVisitor(). Used for skipping whole data pages based on the
+  // statistics in their headers.
+  common::Filter* FOLLY_NULLABLE visitorFilter_{nullptr};
+
+  // True if the bytes of the current page were skipped without
+  // decompressing because the page header statistics exclude all values
+  // that could pass 'visitorFilter_'. No decoder state exists for such a
+  // page and all its rows are filter misses.
+  bool pageFilteredOut_{false};
+
   // Offset of current page's header from start of ColumnChunk.
   uint64_t pageStart_{0};
 
@@ -505,6 +520,9 @@ void PageReader::readWithVisitor(Visitor& visitor) {
   auto rows = visitor.rows();
   auto numRows = visitor.numRows();
   auto& reader = visitor.reader();
+  if constexpr (hasFilter) {
+    visitorFilter_ = &visitor.filter();
+  }
   startVisit(folly::Range<const vector_size_t*>(rows, numRows));
   rowsCopy_ = &visitor.rowsCopy();
   folly::Range<const vector_size_t*> pageRows;
@@ -556,6 +574,7 @@ void PageReader::readWithVisitor(Visitor& visitor) {
       reader.offsetOutputRows(numValuesBeforePage, rowNumberBias_);
     }
   }
+  visitorFilter_ = nullptr;
   if (isMultiPage) {
     reader.setNulls(mayProduceNulls ? nullConcatenation_.buffer() : nullptr);
   }
@@ -569,22 +569,18 @@ void ReaderBase::scheduleRowGroups(
     int32_t currentGroup,
     StructColumnReader& reader) {
   auto thisGroup = rowGroupIds[currentGroup];
-  auto nextGroup =
-      currentGroup + 1 < rowGroupIds.size() ? rowGroupIds[currentGroup + 1] : 0;
   auto input = inputs_[thisGroup].get();
   if (!input) {
     inputs_[thisGroup] = reader.loadRowGroup(thisGroup, input_);
   }
-  for (auto counter = 0; counter < options_.prefetchRowGroups(); ++counter) {
-    if (nextGroup) {
-      if (inputs_.count(nextGroup) == 0) {
-        inputs_[nextGroup] = reader.loadRowGroup(nextGroup, input_);
-      }
-    } else {
+  for (auto counter = 1; counter <= options_.prefetchRowGroups(); ++counter) {
+    if (currentGroup + counter >= rowGroupIds.size()) {
       break;
     }
-    nextGroup =
-        nextGroup + 1 < rowGroupIds.size() ? rowGroupIds[nextGroup + 1] : 0;
+    auto nextGroup = rowGroupIds[currentGroup + counter];
+    if (inputs_.count(nextGroup) == 0) {
+      inputs_[nextGroup] = reader.loadRowGroup(nextGroup, input_);
+    }
   }
   if (currentGroup >= 1) {
     inputs_.erase(rowGroupIds[currentGroup - 1]);
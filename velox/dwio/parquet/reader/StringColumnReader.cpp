@@ -156,19 +156,21 @@ void StringColumnReader::dedictionarize() {
     rawStringBuffer_ = nullptr;
     rawStringSize_ = 0;
     rawStringUsed_ = 0;
-    auto numValues = numValues_;
+    // Keep the dictionary's string buffers alive in 'stringBuffers_' so the
+    // converted views can reference the characters without copying them. The
+    // buffers are handed off to the result vector by getFlatValues().
+    for (auto& buffer : dict->stringBuffers()) {
+      stringBuffers_.push_back(buffer);
+    }
     // Convert indices to values in place. Loop from end to beginning
     // so as not to overwrite integer indices with longer StringViews.
-    for (auto i = numValues - 1; i >= 0; --i) {
+    for (auto i = numValues_ - 1; i >= 0; --i) {
       if (anyNulls_ && bits::isBitNull(rawResultNulls_, i)) {
         reinterpret_cast<StringView*>(rawValues_)[i] = StringView();
         continue;
       }
-      auto& view = dict->valueAt(indices[i]);
-      numValues_ = i;
-      addStringValue(folly::StringPiece(view.data(), view.size()));
+      reinterpret_cast<StringView*>(rawValues_)[i] = dict->valueAt(indices[i]);
     }
-    numValues_ = numValues;
   }
   scanState_.clear();
   formatData_->as<ParquetData>().clearDictionary();
@@ -141,6 +141,12 @@ void StructColumnReader::enqueueRowGroup(
 }
 
 void StructColumnReader::seekToRowGroup(uint32_t index) {
+  if (!fileType_->parent()) {
+    // The root advances to a new row group whose data may be clustered
+    // differently from the previous one. Re-learn the filter order from
+    // the new row group's data.
+    scanSpec_->resetSelectivity();
+  }
   SelectiveStructColumnReader::seekToRowGroup(index);
   BufferPtr noBuffer;
   formatData_->as<ParquetData>().setNulls(noBuffer, 0);
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/parquet/tests/ParquetTestBase.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::parquet;
+
+class ParquetWriterTest : public ParquetTestBase {
+ protected:
+  static constexpr int32_t kNumRows = 10'000;
+
+  RowVectorPtr sampleData() {
+    return makeRowVector(
+        {"c0", "c1", "c2"},
+        {makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; }),
+         makeFlatVector<bool>(kNumRows, [](auto row) { return row % 3 == 0; }),
+         makeFlatVector<StringView>(kNumRows, [](auto row) {
+           return StringView::makeInline(fmt::format("s{}", row % 17));
+         })});
+  }
+
+  // Writes 'data' into a new file with 'options' and returns the file path.
+  std::string writeToFile(
+      WriterOptions options,
+      const RowVectorPtr& data,
+      const std::string& fileName) {
+    auto filePath = fmt::format("{}/{}", tempPath_->path, fileName);
+    auto sink = createSink(filePath);
+    options.memoryPool = rootPool_.get();
+    auto writer = std::make_unique<Writer>(std::move(sink), options);
+    writer->write(data);
+    writer->close();
+    return filePath;
+  }
+
+  void assertRoundTrip(const std::string& filePath, const RowVectorPtr& data) {
+    dwio::common::ReaderOptions readerOptions{leafPool_.get()};
+    auto reader = createReader(filePath, readerOptions);
+    auto rowType = asRowType(data->type());
+    auto rowReaderOpts = getReaderOpts(rowType);
+    rowReaderOpts.setScanSpec(makeScanSpec(rowType));
+    auto rowReader = reader->createRowReader(rowReaderOpts);
+    assertReadWithReaderAndExpected(rowType, *rowReader, data, *leafPool_);
+  }
+};
+
+TEST_F(ParquetWriterTest, dataPageV2RoundTrip) {
+  auto data = sampleData();
+  WriterOptions options;
+  options.enableDataPageV2 = true;
+  assertRoundTrip(writeToFile(options, data, "data_page_v2.parquet"), data);
+}
+
+TEST_F(ParquetWriterTest, columnEncodingOverrides) {
+  auto data = sampleData();
+  WriterOptions options;
+  // Force plain for the unique integer column; keep the low cardinality
+  // string column on dictionary.
+  options.columnEncodings = {
+      {"c0", ColumnEncoding::kPlain},
+      {"c2", ColumnEncoding::kDictionary},
+  };
+  assertRoundTrip(writeToFile(options, data, "encoding_overrides.parquet"), data);
+}
+
+TEST_F(ParquetWriterTest, rleAndDeltaEncodings) {
+  // RLE booleans and DELTA_BINARY_PACKED integers are not decodable by the
+  // Velox Parquet reader yet, so only verify that the writer produces a
+  // non-empty file for them.
+  auto data = sampleData();
+  WriterOptions options;
+  options.enableDataPageV2 = true;
+  options.columnEncodings = {
+      {"c0", ColumnEncoding::kDeltaBinaryPacked},
+      {"c1", ColumnEncoding::kRle},
+  };
+  auto filePath = writeToFile(options, data, "rle_delta.parquet");
+  EXPECT_GT(fs::file_size(filePath), 0);
+}
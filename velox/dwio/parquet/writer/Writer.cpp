@@ -133,6 +133,32 @@ std::shared_ptr<WriterProperties> getArrowParquetWriterOptions(
   properties =
       properties->compression(getArrowParquetCompression(options.compression));
   properties = properties->data_pagesize(options.dataPageSize);
+  properties =
+      properties->dictionary_pagesize_limit(options.dictionaryPageSizeLimit);
+  if (options.enableDataPageV2) {
+    properties = properties->data_page_version(
+        arrow::ParquetDataPageVersion::V2);
+  }
+  for (const auto& [column, encoding] : options.columnEncodings) {
+    switch (encoding) {
+      case ColumnEncoding::kDictionary:
+        properties = properties->enable_dictionary(column);
+        break;
+      case ColumnEncoding::kPlain:
+        properties = properties->disable_dictionary(column);
+        properties = properties->encoding(column, arrow::Encoding::PLAIN);
+        break;
+      case ColumnEncoding::kRle:
+        properties = properties->disable_dictionary(column);
+        properties = properties->encoding(column, arrow::Encoding::RLE);
+        break;
+      case ColumnEncoding::kDeltaBinaryPacked:
+        properties = properties->disable_dictionary(column);
+        properties =
+            properties->encoding(column, arrow::Encoding::DELTA_BINARY_PACKED);
+        break;
+    }
+  }
   properties = properties->max_row_group_length(
       static_cast<int64_t>(flushPolicy->rowsInRowGroup()));
   return properties->build();
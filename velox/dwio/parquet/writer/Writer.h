@@ -81,10 +81,34 @@ class LambdaFlushPolicy : public DefaultFlushPolicy {
   std::function<bool()> lambda_;
 };
 
+/// Encodings that can be requested per column via
+/// WriterOptions::columnEncodings. Subset of the Parquet encodings the Arrow
+/// writer supports as direct value encodings.
+enum class ColumnEncoding {
+  /// Dictionary with RLE-encoded indices, falling back to plain once the
+  /// dictionary outgrows WriterOptions::dictionaryPageSizeLimit. The default.
+  kDictionary,
+  kPlain,
+  /// Run length encoding of values. Only valid for BOOLEAN columns.
+  kRle,
+  /// Delta encoding for integer columns. Compact for sorted or slowly
+  /// changing values.
+  kDeltaBinaryPacked,
+};
+
 struct WriterOptions {
   bool enableDictionary = true;
   int64_t dataPageSize = 1'024 * 1'024;
+  // Dictionary size at which a column chunk falls back from dictionary to
+  // plain encoding for the rest of the row group.
   int64_t dictionaryPageSizeLimit = 1'024 * 1'024;
+  // Serialize data pages in the Parquet v2 page format. Required for
+  // RLE-encoded boolean value pages.
+  bool enableDataPageV2 = false;
+  // Per-column encoding overrides keyed by dot-separated column path. Columns
+  // not listed use dictionary encoding with adaptive fallback, or plain when
+  // 'enableDictionary' is false.
+  std::unordered_map<std::string, ColumnEncoding> columnEncodings;
   // Growth ratio passed to ArrowDataBufferSink. The default value is a
   // heuristic borrowed from
   // folly/FBVector(https://github.com/facebook/folly/blob/main/folly/docs/FBVector.md#memory-handling).
@@ -16,6 +16,7 @@
 
 #include "velox/exec/AggregateCompanionAdapter.h"
 
+#include "velox/common/base/SimdUtil.h"
 #include "velox/exec/AggregateCompanionSignatures.h"
 #include "velox/exec/AggregateFunctionRegistry.h"
 #include "velox/exec/RowContainer.h"
@@ -207,7 +208,9 @@ void AggregateCompanionAdapter::ExtractFunction::apply(
 
   // Perform per-row aggregation.
   std::vector<vector_size_t> allSelectedRange;
-  rows.applyToSelected([&](auto row) { allSelectedRange.push_back(row); });
+  allSelectedRange.resize(rows.end());
+  allSelectedRange.resize(simd::indicesOfSetBits(
+      rows.asRange().bits(), 0, rows.end(), allSelectedRange.data()));
   fn_->initializeNewGroups(groups, allSelectedRange);
   fn_->enableValidateIntermediateInputs();
   fn_->addIntermediateResults(groups, rows, args, false);
@@ -66,6 +66,7 @@ class AggregateWindowFunction : public exec::WindowFunction {
         resultType,
         config);
     aggregate_->setAllocator(stringAllocator_);
+    intermediateType_ = exec::Aggregate::intermediateType(name, argTypes_);
 
     // Aggregate initialization.
     // Row layout is:
@@ -108,6 +109,11 @@ class AggregateWindowFunction : public exec::WindowFunction {
       std::vector<char*> singleGroupRowVector = {rawSingleGroupRow_};
       aggregate_->destroy(folly::Range(singleGroupRowVector.data(), 1));
     }
+    if (slidingInitialized_) {
+      std::vector<char*> slidingRows = {
+          rawSuffixRow_, rawFrontRow_, rawSlidingResultRow_};
+      aggregate_->destroy(folly::Range(slidingRows.data(), slidingRows.size()));
+    }
   }
 
   void resetPartition(const exec::WindowPartition* partition) override {
@@ -161,6 +167,16 @@ class AggregateWindowFunction : public exec::WindowFunction {
           rawFrameEnds,
           resultOffset,
           result);
+    } else if (frameMetadata.slidingAggregation) {
+      fillArgVectors(frameMetadata.firstRow, frameMetadata.lastRow);
+      slidingAggregation(
+          validRows,
+          frameMetadata.firstRow,
+          frameMetadata.lastRow,
+          rawFrameStarts,
+          rawFrameEnds,
+          resultOffset,
+          result);
     } else {
       fillArgVectors(frameMetadata.firstRow, frameMetadata.lastRow);
       simpleAggregation(
@@ -189,6 +205,12 @@ class AggregateWindowFunction : public exec::WindowFunction {
     // accumulated over the previous result to obtain the new result.
     bool incrementalAggregation;
 
+    // If both frame starts and frame ends are non-decreasing but the start
+    // is not fixed (a sliding frame such as ROWS BETWEEN 10000 PRECEDING AND
+    // CURRENT ROW), then the aggregation can be computed with amortized O(1)
+    // accumulator updates per row instead of re-aggregating each frame.
+    bool slidingAggregation;
+
     // Resume incremental aggregation from the prior block.
     bool usePreviousAggregate;
   };
@@ -223,6 +245,9 @@ class AggregateWindowFunction : public exec::WindowFunction {
     vector_size_t prevFrameEnds = lastRow;
 
     bool incrementalAggregation = true;
+    bool nonDecreasingStarts = true;
+    bool nonDecreasingEnds = true;
+    vector_size_t prevFrameStarts = firstRow;
     validRows.applyToSelected([&](auto i) {
       firstRow = std::min(firstRow, rawFrameStarts[i]);
       lastRow = std::max(lastRow, rawFrameEnds[i]);
@@ -231,9 +256,14 @@ class AggregateWindowFunction : public exec::WindowFunction {
       // i) All rows have the same frameStart value.
       // ii) The frame end values are non-decreasing.
       incrementalAggregation &= (rawFrameStarts[i] == fixedFrameStartRow);
-      incrementalAggregation &= rawFrameEnds[i] >= prevFrameEnds;
+      nonDecreasingStarts &= rawFrameStarts[i] >= prevFrameStarts;
+      nonDecreasingEnds &= rawFrameEnds[i] >= prevFrameEnds;
+      prevFrameStarts = rawFrameStarts[i];
       prevFrameEnds = rawFrameEnds[i];
     });
+    incrementalAggregation &= nonDecreasingEnds;
+    const bool slidingAggregation =
+        !incrementalAggregation && nonDecreasingStarts && nonDecreasingEnds;
 
     bool usePreviousAggregate = false;
     if (previousFrameMetadata_.has_value()) {
@@ -249,7 +279,12 @@ class AggregateWindowFunction : public exec::WindowFunction {
       }
     }
 
-    return {firstRow, lastRow, incrementalAggregation, usePreviousAggregate};
+    return {
+        firstRow,
+        lastRow,
+        incrementalAggregation,
+        slidingAggregation,
+        usePreviousAggregate};
   }
 
   void fillArgVectors(vector_size_t firstRow, vector_size_t lastRow) {
@@ -310,6 +345,136 @@ class AggregateWindowFunction : public exec::WindowFunction {
     setEmptyFramesResult(validRows, resultOffset, emptyResult_, result);
   }
 
+  // Computes aggregations for a block of sliding frames: both frame starts
+  // and frame ends are non-decreasing but the start is not fixed, e.g.
+  // ROWS BETWEEN 10000 PRECEDING AND CURRENT ROW. Maintains a region of input
+  // rows split at a boundary. The rows before the boundary are covered by
+  // per-position suffix aggregates snapshotted as intermediate results; the
+  // rows from the boundary onwards by a single growing accumulator. Each frame
+  // is then the merge of one suffix snapshot with the growing accumulator.
+  // When the frame start passes the boundary, a new region is built over the
+  // current frame. Each input row thus enters an accumulator a constant
+  // number of times instead of once per frame covering it.
+  void slidingAggregation(
+      const SelectivityVector& validRows,
+      vector_size_t minFrame,
+      vector_size_t maxFrame,
+      const vector_size_t* rawFrameStarts,
+      const vector_size_t* rawFrameEnds,
+      vector_size_t resultOffset,
+      const VectorPtr& result) {
+    initializeSlidingRows();
+
+    const vector_size_t numFrameRows = maxFrame + 1 - minFrame;
+    SelectivityVector inputRows(numFrameRows, false);
+    SelectivityVector mergeRows;
+    static auto kSingleGroup = std::vector<vector_size_t>{0};
+
+    // Aggregates input rows [begin, end) into 'group'.
+    auto addInputRange =
+        [&](char* group, vector_size_t begin, vector_size_t end) {
+          inputRows.clearAll();
+          inputRows.setValidRange(begin, end, true);
+          inputRows.updateBounds();
+          aggregate_->addSingleGroupRawInput(
+              group, inputRows, argVectors_, false);
+        };
+
+    // Merges the intermediate result at 'index' of 'intermediates' into
+    // 'group'.
+    auto mergeIntermediate = [&](char* group,
+                                 const VectorPtr& intermediates,
+                                 vector_size_t index) {
+      if (mergeRows.size() < index + 1) {
+        mergeRows.resize(index + 1, false);
+      }
+      mergeRows.clearAll();
+      mergeRows.setValid(index, true);
+      mergeRows.updateBounds();
+      aggregate_->addSingleGroupIntermediateResults(
+          group, mergeRows, {intermediates}, false);
+    };
+
+    // Suffix snapshots cover input rows [suffixBase, boundary) and the front
+    // accumulator covers [boundary, frontEnd). All indices are relative to
+    // minFrame.
+    vector_size_t suffixBase = 0;
+    vector_size_t boundary = 0;
+    vector_size_t frontEnd = 0;
+    bool hasRegion = false;
+
+    validRows.applyToSelected([&](auto i) {
+      const vector_size_t frameStart = rawFrameStarts[i] - minFrame;
+      const vector_size_t frameEnd = rawFrameEnds[i] - minFrame + 1;
+
+      if (!hasRegion || frameStart >= boundary) {
+        // Start a new region over the current frame. Build the suffix
+        // snapshots back to front so that the snapshot at position j
+        // aggregates rows [j, boundary).
+        hasRegion = true;
+        suffixBase = frameStart;
+        boundary = frameEnd;
+        frontEnd = frameEnd;
+        aggregate_->clear();
+        for (auto* row : {rawSuffixRow_, rawFrontRow_, rawSlidingResultRow_}) {
+          aggregate_->initializeNewGroups(&row, kSingleGroup);
+        }
+        BaseVector::prepareForReuse(
+            suffixIntermediates_, boundary - suffixBase);
+        for (auto j = boundary - 1; j >= suffixBase; --j) {
+          addInputRange(rawSuffixRow_, j, j + 1);
+          BaseVector::prepareForReuse(scratchIntermediate_, 1);
+          aggregate_->extractAccumulators(
+              &rawSuffixRow_, 1, &scratchIntermediate_);
+          suffixIntermediates_->copy(
+              scratchIntermediate_.get(), j - suffixBase, 0, 1);
+        }
+      } else if (frameEnd > frontEnd) {
+        addInputRange(rawFrontRow_, frontEnd, frameEnd);
+        frontEnd = frameEnd;
+      }
+
+      // Combine the suffix snapshot at the frame start with the front
+      // accumulator into a fresh result accumulator.
+      aggregate_->initializeNewGroups(&rawSlidingResultRow_, kSingleGroup);
+      if (frameStart < boundary) {
+        mergeIntermediate(
+            rawSlidingResultRow_, suffixIntermediates_, frameStart - suffixBase);
+      }
+      if (frontEnd > boundary) {
+        BaseVector::prepareForReuse(scratchIntermediate_, 1);
+        aggregate_->extractAccumulators(
+            &rawFrontRow_, 1, &scratchIntermediate_);
+        mergeIntermediate(rawSlidingResultRow_, scratchIntermediate_, 0);
+      }
+      BaseVector::prepareForReuse(aggregateResultVector_, 1);
+      aggregate_->extractValues(
+          &rawSlidingResultRow_, 1, &aggregateResultVector_);
+      result->copy(aggregateResultVector_.get(), resultOffset + i, 0, 1);
+    });
+
+    // Set null values for empty (non valid) frames in the output block.
+    setEmptyFramesResult(validRows, resultOffset, emptyResult_, result);
+  }
+
+  // Allocates the accumulator rows and snapshot vectors used by
+  // slidingAggregation on its first use.
+  void initializeSlidingRows() {
+    if (slidingInitialized_) {
+      return;
+    }
+    suffixRowBufferPtr_ = AlignedBuffer::allocate<char>(singleGroupRowSize_, pool_);
+    rawSuffixRow_ = suffixRowBufferPtr_->asMutable<char>();
+    frontRowBufferPtr_ = AlignedBuffer::allocate<char>(singleGroupRowSize_, pool_);
+    rawFrontRow_ = frontRowBufferPtr_->asMutable<char>();
+    slidingResultRowBufferPtr_ =
+        AlignedBuffer::allocate<char>(singleGroupRowSize_, pool_);
+    rawSlidingResultRow_ = slidingResultRowBufferPtr_->asMutable<char>();
+    suffixIntermediates_ = BaseVector::create(intermediateType_, 0, pool_);
+    scratchIntermediate_ = BaseVector::create(intermediateType_, 1, pool_);
+    slidingInitialized_ = true;
+  }
+
   void simpleAggregation(
       const SelectivityVector& validRows,
       vector_size_t minFrame,
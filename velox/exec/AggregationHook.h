@@ -144,11 +144,32 @@ class SumHook final : public AggregationHook {
   }
 
   void addValue(vector_size_t row, const void* value) override {
+    addValueTyped(row, *reinterpret_cast<const TValue*>(value));
+  }
+
+  void addValues(
+      const vector_size_t* rows,
+      const void* values,
+      vector_size_t size,
+      uint8_t valueWidth) override {
+    if (valueWidth != sizeof(TValue)) {
+      AggregationHook::addValues(rows, values, size, valueWidth);
+      return;
+    }
+    // Decoded runs from e.g. selective readers land here. Iterate over the
+    // typed values directly instead of a virtual call per value.
+    auto typedValues = reinterpret_cast<const TValue*>(values);
+    for (auto i = 0; i < size; ++i) {
+      addValueTyped(rows[i], typedValues[i]);
+    }
+  }
+
+ private:
+  inline void addValueTyped(vector_size_t row, TValue value) {
     auto group = findGroup(row);
     clearNull(group);
     updateSingleValue<TAggregate, Overflow>(
-        *reinterpret_cast<TAggregate*>(group + offset_),
-        TAggregate(*reinterpret_cast<const TValue*>(value)));
+        *reinterpret_cast<TAggregate*>(group + offset_), TAggregate(value));
   }
 };
 
@@ -218,12 +239,30 @@ class MinMaxHook final : public AggregationHook {
   }
 
   void addValue(vector_size_t row, const void* value) override {
+    addValueTyped(row, *reinterpret_cast<const T*>(value));
+  }
+
+  void addValues(
+      const vector_size_t* rows,
+      const void* values,
+      vector_size_t size,
+      uint8_t valueWidth) override {
+    if (valueWidth != sizeof(T)) {
+      AggregationHook::addValues(rows, values, size, valueWidth);
+      return;
+    }
+    auto typedValues = reinterpret_cast<const T*>(values);
+    for (auto i = 0; i < size; ++i) {
+      addValueTyped(rows[i], typedValues[i]);
+    }
+  }
+
+ private:
+  inline void addValueTyped(vector_size_t row, T value) {
     auto group = findGroup(row);
     if (clearNull(group) ||
-        (*reinterpret_cast<T*>(group + offset_) >
-         *reinterpret_cast<const T*>(value)) == isMin) {
-      *reinterpret_cast<T*>(group + offset_) =
-          *reinterpret_cast<const T*>(value);
+        (*reinterpret_cast<T*>(group + offset_) > value) == isMin) {
+      *reinterpret_cast<T*>(group + offset_) = value;
     }
   }
 };
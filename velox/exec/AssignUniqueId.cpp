@@ -47,6 +47,7 @@ AssignUniqueId::AssignUniqueId(
 
   rowIdCounter_ = 0;
   maxRowIdCounterValue_ = 0;
+  numRowIdsPerRequest_ = kMinRowIdsPerRequest;
 }
 
 void AssignUniqueId::addInput(RowVectorPtr input) {
@@ -88,20 +89,22 @@ void AssignUniqueId::generateIdColumn(vector_size_t size) {
       requestRowIds();
     }
 
-    auto batchSize =
-        std::min(maxRowIdCounterValue_ - rowIdCounter_ + 1, kRowIdsPerRequest);
-    auto end = (int32_t)std::min((int64_t)size, start + batchSize);
-    VELOX_CHECK_EQ((rowIdCounter_ + end - 1) & uniqueValueMask_, 0);
+    auto batchSize = std::min<int64_t>(
+        maxRowIdCounterValue_ - rowIdCounter_, size - start);
+    auto end = start + static_cast<vector_size_t>(batchSize);
+    VELOX_CHECK_EQ((rowIdCounter_ + batchSize - 1) & uniqueValueMask_, 0);
     std::iota(
         rawResults + start, rawResults + end, uniqueValueMask_ | rowIdCounter_);
-    rowIdCounter_ += end;
+    rowIdCounter_ += batchSize;
     start = end;
   }
 }
 
 void AssignUniqueId::requestRowIds() {
-  rowIdCounter_ = rowIdPool_->fetch_add(kRowIdsPerRequest);
+  rowIdCounter_ = rowIdPool_->fetch_add(numRowIdsPerRequest_);
   maxRowIdCounterValue_ =
-      std::min(rowIdCounter_ + kRowIdsPerRequest, kMaxRowId);
+      std::min(rowIdCounter_ + numRowIdsPerRequest_, kMaxRowId);
+  numRowIdsPerRequest_ =
+      std::min(numRowIdsPerRequest_ * 2, kMaxRowIdsPerRequest);
 }
 } // namespace facebook::velox::exec
@@ -55,13 +55,19 @@ class AssignUniqueId : public Operator {
 
   void requestRowIds();
 
-  const int64_t kRowIdsPerRequest = 1L << 20;
+  // First reservation from 'rowIdPool_'. Each refill doubles the next
+  // reservation up to kMaxRowIdsPerRequest, so long-running drivers stop
+  // contending on the shared counter while short-lived ones do not strand
+  // large ranges of the id space.
+  const int64_t kMinRowIdsPerRequest = 1L << 16;
+  const int64_t kMaxRowIdsPerRequest = 1L << 24;
   const int64_t kMaxRowId = 1L << 40;
   const int64_t kTaskUniqueIdLimit = 1L << 24;
 
   int64_t uniqueValueMask_;
   int64_t rowIdCounter_;
   int64_t maxRowIdCounterValue_;
+  int64_t numRowIdsPerRequest_;
 
   std::shared_ptr<std::atomic_int64_t> rowIdPool_;
 };
@@ -97,6 +97,20 @@ void recordSilentThrows(Operator& op) {
   }
 }
 
+// Adds hardware counter deltas sampled around an operator call to the
+// operator's runtime stats.
+void recordHardwareCounterStats(
+    Operator& op,
+    const HardwareCounterValues& delta) {
+  auto lockedStats = op.stats().wlock();
+  lockedStats->addRuntimeStat("hwCpuCycles", RuntimeCounter(delta.cpuCycles));
+  lockedStats->addRuntimeStat(
+      "hwInstructions", RuntimeCounter(delta.instructions));
+  lockedStats->addRuntimeStat("hwLlcMisses", RuntimeCounter(delta.llcMisses));
+  lockedStats->addRuntimeStat(
+      "hwBranchMisses", RuntimeCounter(delta.branchMisses));
+}
+
 } // namespace
 
 DriverCtx::DriverCtx(
@@ -252,6 +266,19 @@ void Driver::init(
   operators_ = std::move(operators);
   curOperatorId_ = operators_.size() - 1;
   trackOperatorCpuUsage_ = ctx_->queryConfig().operatorTrackCpuUsage();
+  trackOperatorHardwareCounters_ =
+      ctx_->queryConfig().operatorTrackHardwareCounters();
+  if (ctx_->queryConfig().driverTraceEnabled()) {
+    traceLog_ =
+        std::make_unique<DriverTraceLog>(ctx_->pipelineId, ctx_->driverId);
+    std::vector<std::string> labels;
+    labels.reserve(operators_.size());
+    for (const auto& op : operators_) {
+      labels.push_back(
+          fmt::format("{}.{}", op->operatorType(), op->planNodeId()));
+    }
+    traceLog_->setOperatorLabels(std::move(labels));
+  }
 }
 
 void Driver::initializeOperators() {
@@ -346,7 +373,12 @@ void Driver::enqueueInternal() {
     threadNumVeloxThrow() = 0;                                             \
     opCallStatus_.start(operatorId, operatorMethod);                       \
     auto stopGuard = folly::makeGuard([&]() { opCallStatus_.stop(); });    \
+    const uint64_t traceStartMicros =                                      \
+        traceLog_ != nullptr ? getCurrentTimeMicro() : 0;                  \
     call;                                                                  \
+    if (traceLog_ != nullptr) {                                            \
+      traceLog_->addCallEvent(operatorId, operatorMethod, traceStartMicros); \
+    }                                                                      \
     recordSilentThrows(*operatorPtr);                                      \
   } catch (const VeloxException& e) {                                      \
     throw;                                                                 \
@@ -359,6 +391,68 @@ void Driver::enqueueInternal() {
         e.what());                                                         \
   }
 
+void DriverTraceLog::addCallEvent(
+    int32_t operatorId,
+    const char* method,
+    uint64_t startMicros) {
+  const auto durationMicros = getCurrentTimeMicro() - startMicros;
+  if (durationMicros == 0) {
+    // Skip sub-microsecond calls, e.g. isBlocked() and needsInput() probes,
+    // so they don't push interesting events out of the bounded log.
+    return;
+  }
+  append({startMicros, durationMicros, operatorId, method});
+}
+
+void DriverTraceLog::addWaitEvent(
+    int32_t operatorId,
+    BlockingReason reason,
+    uint64_t startMicros) {
+  append(
+      {startMicros,
+       getCurrentTimeMicro() - startMicros,
+       operatorId,
+       nullptr,
+       reason});
+}
+
+void DriverTraceLog::append(Event event) {
+  if (events_.size() < capacity_) {
+    events_.push_back(event);
+  } else {
+    events_[numEvents_ % capacity_] = event;
+  }
+  ++numEvents_;
+}
+
+void DriverTraceLog::appendTraceEvents(folly::dynamic& traceEvents) const {
+  // Once the log has wrapped around, the oldest retained event lives at
+  // 'numEvents_' modulo the capacity.
+  const auto first = numEvents_ > events_.size() ? numEvents_ % capacity_ : 0;
+  for (size_t i = 0; i < events_.size(); ++i) {
+    const auto& event = events_[(first + i) % events_.size()];
+    const std::string label =
+        static_cast<size_t>(event.operatorId) < operatorLabels_.size()
+        ? operatorLabels_[event.operatorId]
+        : fmt::format("operator {}", event.operatorId);
+    folly::dynamic entry = folly::dynamic::object;
+    entry["ph"] = "X";
+    entry["pid"] = pipelineId_;
+    entry["tid"] = driverId_;
+    entry["ts"] = event.startMicros;
+    entry["dur"] = event.durationMicros;
+    if (event.method != nullptr) {
+      entry["cat"] = "operator";
+      entry["name"] = fmt::format("{}::{}", label, event.method);
+    } else {
+      entry["cat"] = "wait";
+      entry["name"] = fmt::format(
+          "{}: {}", label, blockingReasonToString(event.blockingReason));
+    }
+    traceEvents.push_back(std::move(entry));
+  }
+}
+
 void OpCallStatus::start(int32_t operatorId, const char* operatorMethod) {
   timeStartMs = getCurrentTimeMs();
   opId = operatorId;
@@ -425,6 +519,26 @@ CpuWallTiming Driver::processLazyTiming(
       timing.cpuNanos >= cpuDelta ? timing.cpuNanos - cpuDelta : 0};
 }
 
+BlockingReason Driver::blockedReason(
+    Operator* op,
+    int32_t operatorId,
+    ContinueFuture* future) {
+  BlockingReason reason;
+  CALL_OPERATOR(
+      reason = op->isBlocked(future), op, operatorId, kOpMethodIsBlocked);
+  if (reason != BlockingReason::kNotBlocked && future->isReady() &&
+      !future->hasException()) {
+    // The wait is already over, e.g. the data the operator waits for arrived
+    // between making the future and realizing it. Ask again instead of
+    // unwinding the driver and re-entering through the executor. If the
+    // operator is still blocked, it supplies a new future and the driver goes
+    // off thread as usual.
+    CALL_OPERATOR(
+        reason = op->isBlocked(future), op, operatorId, kOpMethodIsBlocked);
+  }
+  return reason;
+}
+
 StopReason Driver::runInternal(
     std::shared_ptr<Driver>& self,
     std::shared_ptr<BlockingState>& blockingState,
@@ -459,6 +573,14 @@ StopReason Driver::runInternal(
         RuntimeCounter(queuedTime, RuntimeCounter::Unit::kNanos));
   }
 
+  if (traceLog_ != nullptr && traceWaitStartMicros_ != 0) {
+    // Close out the wait that took the driver off thread, including the time
+    // spent queued before resuming.
+    traceLog_->addWaitEvent(
+        curOperatorId_, blockingReason_, traceWaitStartMicros_);
+    traceWaitStartMicros_ = 0;
+  }
+
   CancelGuard guard(task().get(), &state_, [&](StopReason reason) {
     // This is run on error or cancel exit.
     if (reason == StopReason::kTerminate) {
@@ -498,28 +620,23 @@ StopReason Driver::runInternal(
         // In case we are blocked, this index will point to the operator, whose
         // queuedTime we should update.
         curOperatorId_ = i;
-        CALL_OPERATOR(
-            blockingReason_ = op->isBlocked(&future),
-            op,
-            curOperatorId_,
-            kOpMethodIsBlocked);
+        blockingReason_ = blockedReason(op, curOperatorId_, &future);
         if (blockingReason_ != BlockingReason::kNotBlocked) {
           blockingState = std::make_shared<BlockingState>(
               self, std::move(future), op, blockingReason_);
+          recordBlockedWaitStart();
           guard.notThrown();
           return StopReason::kBlock;
         }
         Operator* nextOp = nullptr;
         if (i < operators_.size() - 1) {
           nextOp = operators_[i + 1].get();
-          CALL_OPERATOR(
-              blockingReason_ = nextOp->isBlocked(&future),
-              nextOp,
-              curOperatorId_ + 1,
-              kOpMethodIsBlocked);
+          blockingReason_ =
+              blockedReason(nextOp, curOperatorId_ + 1, &future);
           if (blockingReason_ != BlockingReason::kNotBlocked) {
             blockingState = std::make_shared<BlockingState>(
                 self, std::move(future), nextOp, blockingReason_);
+            recordBlockedWaitStart();
             guard.notThrown();
             return StopReason::kBlock;
           }
@@ -539,6 +656,10 @@ StopReason Driver::runInternal(
                     processLazyTiming(*op, deltaTiming);
                     op->stats().wlock()->getOutputTiming.add(deltaTiming);
                   });
+              auto hwSampler = createHardwareCounterSampler(
+                  [op](const HardwareCounterValues& delta) {
+                    recordHardwareCounterStats(*op, delta);
+                  });
               TestValue::adjust(
                   "facebook::velox::exec::Driver::runInternal::getOutput", op);
               CALL_OPERATOR(
@@ -570,6 +691,10 @@ StopReason Driver::runInternal(
                     auto selfDelta = processLazyTiming(*nextOp, timing);
                     nextOp->stats().wlock()->addInputTiming.add(selfDelta);
                   });
+              auto hwSampler = createHardwareCounterSampler(
+                  [nextOp](const HardwareCounterValues& delta) {
+                    recordHardwareCounterStats(*nextOp, delta);
+                  });
               {
                 auto lockedStats = nextOp->stats().wlock();
                 lockedStats->addInputVector(
@@ -579,6 +704,7 @@ StopReason Driver::runInternal(
                   "facebook::velox::exec::Driver::runInternal::addInput",
                   nextOp);
 
+              nextOp->maybeCaptureInput(intermediateResult);
               CALL_OPERATOR(
                   nextOp->addInput(intermediateResult),
                   nextOp,
@@ -601,14 +727,11 @@ StopReason Driver::runInternal(
               // is not blocked and empty, this is finished. If this is
               // not the source, just try to get output from the one
               // before.
-              CALL_OPERATOR(
-                  blockingReason_ = op->isBlocked(&future),
-                  op,
-                  curOperatorId_,
-                  kOpMethodIsBlocked);
+              blockingReason_ = blockedReason(op, curOperatorId_, &future);
               if (blockingReason_ != BlockingReason::kNotBlocked) {
                 blockingState = std::make_shared<BlockingState>(
                     self, std::move(future), op, blockingReason_);
+                recordBlockedWaitStart();
                 guard.notThrown();
                 return StopReason::kBlock;
               }
@@ -647,6 +770,10 @@ StopReason Driver::runInternal(
                   auto selfDelta = processLazyTiming(*op, timing);
                   op->stats().wlock()->getOutputTiming.add(selfDelta);
                 });
+            auto hwSampler = createHardwareCounterSampler(
+                [op](const HardwareCounterValues& delta) {
+                  recordHardwareCounterStats(*op, delta);
+                });
             CALL_OPERATOR(
                 result = op->getOutput(),
                 op,
@@ -669,6 +796,7 @@ StopReason Driver::runInternal(
 
               // This code path is used only in single-threaded execution.
               blockingReason_ = BlockingReason::kWaitForConsumer;
+              recordBlockedWaitStart();
               guard.notThrown();
               return StopReason::kBlock;
             }
@@ -760,6 +888,14 @@ void Driver::initializeOperatorStats(std::vector<OperatorStats>& stats) {
 }
 
 void Driver::closeOperators() {
+  if (task()->error() != nullptr) {
+    // The task failed. Dump captured input batches, if any, before the
+    // operators free their state.
+    for (auto& op : operators_) {
+      op->dumpCapturedInput();
+    }
+  }
+
   // Close operators.
   for (auto& op : operators_) {
     op->close();
@@ -771,6 +907,10 @@ void Driver::closeOperators() {
     stats.numDrivers = 1;
     task()->addOperatorStats(stats);
   }
+
+  if (traceLog_ != nullptr) {
+    task()->addDriverTraceLog(std::move(traceLog_));
+  }
 }
 
 void Driver::close() {
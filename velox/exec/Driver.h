@@ -22,6 +22,8 @@
 #include "velox/common/future/VeloxPromise.h"
 #include "velox/common/process/ThreadDebugInfo.h"
 #include "velox/common/time/CpuWallTimer.h"
+#include "velox/common/time/HardwareCounters.h"
+#include "velox/common/time/Timer.h"
 #include "velox/connectors/Connector.h"
 #include "velox/core/PlanFragment.h"
 #include "velox/core/PlanNode.h"
@@ -299,6 +301,77 @@ struct OpCallStatus {
   std::atomic<const char*> method{kOpMethodNone};
 };
 
+/// Bounded log of per-operator call and off-thread wait events recorded by a
+/// Driver when the 'driver_trace_enabled' query config is set. Events are
+/// appended only by the thread running the Driver, so no synchronization is
+/// needed. The log keeps the most recent 'capacity' events, overwriting the
+/// oldest ones ring-buffer style. The logs of finished drivers are combined
+/// into a Chrome trace by Task::traceEventsJson().
+class DriverTraceLog {
+ public:
+  /// Number of events kept per driver unless overridden: ~160KB per driver.
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  struct Event {
+    /// Start of the call or wait, in microseconds since epoch.
+    uint64_t startMicros;
+    uint64_t durationMicros;
+    /// Index of the operator in the driver's pipeline.
+    int32_t operatorId;
+    /// One of the kOpMethod* constants for operator calls, nullptr for wait
+    /// events.
+    const char* method;
+    /// For wait events, why the driver went off thread.
+    BlockingReason blockingReason{BlockingReason::kNotBlocked};
+  };
+
+  DriverTraceLog(
+      int32_t pipelineId,
+      int32_t driverId,
+      size_t capacity = kDefaultCapacity)
+      : pipelineId_(pipelineId), driverId_(driverId), capacity_(capacity) {}
+
+  /// Sets the display names of the driver's operators, indexed like the
+  /// operator ids passed to addCallEvent() and addWaitEvent().
+  void setOperatorLabels(std::vector<std::string> labels) {
+    operatorLabels_ = std::move(labels);
+  }
+
+  /// Records a call of 'method' on the operator at 'operatorId' that started
+  /// at 'startMicros' and ended now. Calls that took less than a microsecond,
+  /// e.g. isBlocked() and needsInput() probes, are not recorded.
+  void addCallEvent(
+      int32_t operatorId,
+      const char* method,
+      uint64_t startMicros);
+
+  /// Records an off-thread wait caused by the operator at 'operatorId' that
+  /// started at 'startMicros' and ended now.
+  void addWaitEvent(
+      int32_t operatorId,
+      BlockingReason reason,
+      uint64_t startMicros);
+
+  /// Appends the logged events, oldest first, to 'traceEvents' as Chrome
+  /// trace complete events. The pipeline id is used as the trace process id
+  /// and the driver id as the trace thread id so that a timeline viewer lays
+  /// drivers out as parallel tracks.
+  void appendTraceEvents(folly::dynamic& traceEvents) const;
+
+ private:
+  void append(Event event);
+
+  const int32_t pipelineId_;
+  const int32_t driverId_;
+  const size_t capacity_;
+
+  std::vector<Event> events_;
+  // Total number of events recorded. Exceeds events_.size() once the log has
+  // wrapped around and started overwriting the oldest events.
+  size_t numEvents_{0};
+  std::vector<std::string> operatorLabels_;
+};
+
 class Driver : public std::enable_shared_from_this<Driver> {
  public:
   static void enqueue(std::shared_ptr<Driver> instance);
@@ -413,6 +486,16 @@ class Driver : public std::enable_shared_from_this<Driver> {
       std::shared_ptr<BlockingState>& blockingState,
       RowVectorPtr& result);
 
+  // Calls Operator::isBlocked() on 'op'. If the operator reports itself
+  // blocked but '*future' is already realized, consumes the future and asks
+  // once more, so that a wait that is over by the time it is returned (e.g.
+  // exchange data arriving concurrently) does not unwind the driver and
+  // re-enter through the executor.
+  BlockingReason blockedReason(
+      Operator* op,
+      int32_t operatorId,
+      ContinueFuture* future);
+
   void close();
 
   // Push down dynamic filters produced by the operator at the specified
@@ -430,6 +513,27 @@ class Driver : public std::enable_shared_from_this<Driver> {
         : nullptr;
   }
 
+  // If 'trackOperatorHardwareCounters_' is true and the thread's hardware
+  // counters are available, returns a sampler that passes the hardware counter
+  // deltas of an operation to 'func' upon destruction. Returns null otherwise.
+  template <typename F>
+  std::unique_ptr<DeltaHardwareCounterSampler<F>> createHardwareCounterSampler(
+      F&& func) {
+    return trackOperatorHardwareCounters_ &&
+            ThreadHardwareCounters::forCurrentThread().isEnabled()
+        ? std::make_unique<DeltaHardwareCounterSampler<F>>(std::move(func))
+        : nullptr;
+  }
+
+  // Stamps the start of an off-thread wait so that the trace log can record
+  // a wait event covering the whole gap, including queuing, when the driver
+  // next resumes in runInternal(). No-op when tracing is disabled.
+  void recordBlockedWaitStart() {
+    if (traceLog_ != nullptr) {
+      traceWaitStartMicros_ = getCurrentTimeMicro();
+    }
+  }
+
   // Adjusts 'timing' by removing the lazy load wall and CPU times
   // accrued since last time timing information was recorded for
   // 'op'. The accrued lazy load times are credited to the source
@@ -462,6 +566,17 @@ class Driver : public std::enable_shared_from_this<Driver> {
 
   bool trackOperatorCpuUsage_;
 
+  bool trackOperatorHardwareCounters_;
+
+  // Log of per-operator call and wait events. Null unless the
+  // 'driver_trace_enabled' query config is set. Moved to the Task when the
+  // driver closes.
+  std::unique_ptr<DriverTraceLog> traceLog_;
+
+  // Time when the driver last went off thread blocked. Used to record the
+  // wait event when the driver resumes. Only set when 'traceLog_' is set.
+  uint64_t traceWaitStartMicros_{0};
+
   // Indicates that a DriverAdapter can rearrange Operators. Set to false at end
   // of DriverFactory::createDriver().
   bool isAdaptable_{true};
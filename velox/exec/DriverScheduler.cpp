@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/DriverScheduler.h"
+
+#include <algorithm>
+
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::exec {
+
+// The per-query folly::Executor view. Forwards work to the scheduler's
+// per-query queue and releases the query on destruction.
+class DriverScheduler::QueryExecutor : public folly::Executor {
+ public:
+  QueryExecutor(
+      std::shared_ptr<DriverScheduler> scheduler,
+      std::shared_ptr<QueryState> query)
+      : scheduler_(std::move(scheduler)), query_(std::move(query)) {}
+
+  ~QueryExecutor() override {
+    scheduler_->releaseQuery(query_);
+  }
+
+  void add(folly::Func func) override {
+    scheduler_->enqueue(query_, std::move(func));
+  }
+
+ private:
+  const std::shared_ptr<DriverScheduler> scheduler_;
+  const std::shared_ptr<QueryState> query_;
+};
+
+// static
+std::shared_ptr<DriverScheduler> DriverScheduler::create(
+    folly::Executor* executor) {
+  VELOX_CHECK_NOT_NULL(executor);
+  return std::shared_ptr<DriverScheduler>(new DriverScheduler(executor));
+}
+
+std::shared_ptr<folly::Executor> DriverScheduler::addQuery(int32_t weight) {
+  VELOX_CHECK_GT(weight, 0);
+  auto query = std::make_shared<QueryState>(weight);
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    // Start at the least virtual time of the active queries so that a new
+    // query neither replays the backlog of the others nor gets ahead of
+    // them.
+    if (!queries_.empty()) {
+      query->virtualTime = queries_.front()->virtualTime;
+      for (const auto& other : queries_) {
+        query->virtualTime = std::min(query->virtualTime, other->virtualTime);
+      }
+    }
+    query->numReferences = 1;
+    queries_.push_back(query);
+  }
+  return std::make_shared<QueryExecutor>(shared_from_this(), std::move(query));
+}
+
+void DriverScheduler::enqueue(
+    const std::shared_ptr<QueryState>& query,
+    folly::Func func) {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    query->pending.push_back(std::move(func));
+  }
+  executor_->add([self = shared_from_this()]() { self->dispatchNext(); });
+}
+
+void DriverScheduler::dispatchNext() {
+  folly::Func func;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    std::shared_ptr<QueryState> best;
+    for (const auto& query : queries_) {
+      if (!query->pending.empty() &&
+          (best == nullptr || query->virtualTime < best->virtualTime)) {
+        best = query;
+      }
+    }
+    // One dispatch is scheduled per enqueued work unit, so there is always
+    // pending work.
+    VELOX_CHECK_NOT_NULL(best);
+    func = std::move(best->pending.front());
+    best->pending.pop_front();
+    best->virtualTime += 1.0 / best->weight;
+    maybeRemoveQueryLocked(best);
+  }
+  func();
+}
+
+void DriverScheduler::releaseQuery(const std::shared_ptr<QueryState>& query) {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK_GT(query->numReferences, 0);
+  --query->numReferences;
+  maybeRemoveQueryLocked(query);
+}
+
+void DriverScheduler::maybeRemoveQueryLocked(
+    const std::shared_ptr<QueryState>& query) {
+  if (query->numReferences > 0 || !query->pending.empty()) {
+    return;
+  }
+  auto it = std::find(queries_.begin(), queries_.end(), query);
+  VELOX_CHECK(it != queries_.end());
+  queries_.erase(it);
+}
+
+} // namespace facebook::velox::exec
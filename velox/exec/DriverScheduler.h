@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <folly/Executor.h>
+
+namespace facebook::velox::exec {
+
+/// Shares one driver thread pool between concurrent queries with weight-fair
+/// dispatch. Embedders that run multiple queries on a single folly executor
+/// see starvation: the executor is a FIFO queue, so the drivers of a large
+/// query can keep the drivers of small queries waiting for the whole run.
+///
+/// DriverScheduler wraps the shared executor and hands out a per-query
+/// folly::Executor view to pass as the executor of the query's QueryCtx.
+/// Driver work enqueued through a view is queued per query and dispatched to
+/// the underlying executor in weighted fair order: the query with the least
+/// dispatched work relative to its weight runs next, so a query with weight 2
+/// gets twice the driver time of a query with weight 1 when both have work
+/// pending. Dispatch granularity is one driver run slice, bounded by the
+/// driver yield quantum.
+///
+/// The scheduler and its views are thread-safe. Views keep the scheduler
+/// alive; the underlying executor must outlive all views and any tasks using
+/// them.
+class DriverScheduler : public std::enable_shared_from_this<DriverScheduler> {
+ public:
+  static std::shared_ptr<DriverScheduler> create(folly::Executor* executor);
+
+  /// Returns the executor view for one query. 'weight' sets the query's share
+  /// of driver time relative to the other queries. The view may be destroyed
+  /// before the query's work has drained; remaining work still runs.
+  std::shared_ptr<folly::Executor> addQuery(int32_t weight = 1);
+
+ private:
+  struct QueryState {
+    explicit QueryState(int32_t _weight) : weight(_weight) {}
+
+    const int32_t weight;
+
+    // Work units not yet handed to the underlying executor.
+    std::deque<folly::Func> pending;
+
+    // Weight-scaled count of dispatched work units. The query with the
+    // smallest value runs next.
+    double virtualTime{0};
+
+    // Number of live executor views of this query.
+    int32_t numReferences{0};
+  };
+
+  class QueryExecutor;
+
+  explicit DriverScheduler(folly::Executor* executor) : executor_(executor) {}
+
+  // Queues 'func' for 'query' and schedules one dispatch on the underlying
+  // executor.
+  void enqueue(const std::shared_ptr<QueryState>& query, folly::Func func);
+
+  // Runs the front work unit of the query with the least virtual time.
+  void dispatchNext();
+
+  // Called when an executor view is destroyed.
+  void releaseQuery(const std::shared_ptr<QueryState>& query);
+
+  // Removes 'query' from 'queries_' if it has no views and no pending work.
+  // 'mutex_' must be held.
+  void maybeRemoveQueryLocked(const std::shared_ptr<QueryState>& query);
+
+  folly::Executor* const executor_;
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<QueryState>> queries_;
+};
+
+} // namespace facebook::velox::exec
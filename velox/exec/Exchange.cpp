@@ -18,6 +18,31 @@
 
 namespace facebook::velox::exec {
 
+void Exchange::initialize() {
+  SourceOperator::initialize();
+  if (operatorCtx_->driverCtx()->queryConfig().exchangeDecodeAheadEnabled()) {
+    // Decode pages into vectors on the threads that deliver them instead of
+    // this driver thread. The decoded pages keep counting against the
+    // exchange queue limit via their retained size, so the decode-ahead is
+    // bounded by the queue's buffer size.
+    exchangeClient_->queue()->setPageDecoder(
+        [serde = getSerde(),
+         pool = exchangeClient_->pool(),
+         outputType = outputType_](std::unique_ptr<SerializedPage> page) {
+          std::vector<std::unique_ptr<SerializedPage>> decoded;
+          ByteStream input;
+          page->prepareStreamForDeserialize(&input);
+          while (!input.atEnd()) {
+            RowVectorPtr vector;
+            serde->deserialize(&input, pool, outputType, &vector);
+            decoded.push_back(
+                std::make_unique<SerializedPage>(std::move(vector)));
+          }
+          return decoded;
+        });
+  }
+}
+
 bool Exchange::getSplits(ContinueFuture* future) {
   if (!processSplits_) {
     return false;
@@ -100,6 +125,18 @@ RowVectorPtr Exchange::getOutput() {
     return nullptr;
   }
 
+  // Pages from a same-process producer carry deserialized vectors. Return
+  // these directly without going through the serde.
+  if (currentPage_->rowVector() != nullptr) {
+    auto output = currentPage_->rowVector();
+    currentPage_ = nullptr;
+
+    auto lockedStats = stats_.wlock();
+    lockedStats->rawInputBytes += output->estimateFlatSize();
+    lockedStats->addInputVector(output->estimateFlatSize(), output->size());
+    return output;
+  }
+
   uint64_t rawInputBytes{0};
   if (!inputStream_) {
     inputStream_ = std::make_unique<ByteStream>();
@@ -161,6 +198,11 @@ void Exchange::recordExchangeClientStats() {
 }
 
 VectorSerde* Exchange::getSerde() {
+  const auto serdeName =
+      operatorCtx_->driverCtx()->queryConfig().exchangeVectorSerde();
+  if (!serdeName.empty()) {
+    return getNamedVectorSerde(serdeName);
+  }
   return getVectorSerde();
 }
 
@@ -52,6 +52,8 @@ class Exchange : public SourceOperator {
     close();
   }
 
+  void initialize() override;
+
   RowVectorPtr getOutput() override;
 
   void close() override;
@@ -101,6 +101,7 @@ folly::F14FastMap<std::string, RuntimeMetric> ExchangeClient::stats() const {
   stats["numReceivedPages"] = RuntimeMetric(queue_->receivedPages());
   stats["averageReceivedPageBytes"] = RuntimeMetric(
       queue_->averageReceivedPageBytes(), RuntimeCounter::Unit::kBytes);
+  stats["numSpeculativeRequests"] = RuntimeMetric(numSpeculativeRequests_);
 
   return stats;
 }
@@ -186,6 +187,16 @@ int32_t ExchangeClient::getNumSourcesToRequestLocked(int64_t averagePageSize) {
   auto numToRequest = std::max<int32_t>(
       1, (maxQueuedBytes_ - queue_->totalBytes()) / averagePageSize);
   if (numToRequest <= numPending) {
+    // The consumer has nothing buffered and the whole request window is taken
+    // by sources that have not responded yet. Speculatively request from one
+    // more source, so that a straggler holding its long poll open cannot
+    // stall the exchange while other sources have data ready. Overshoot of
+    // the memory budget is bounded by a single page.
+    if (queue_->empty() && numPending == numToRequest &&
+        numPending < static_cast<int32_t>(sources_.size())) {
+      ++numSpeculativeRequests_;
+      return 1;
+    }
     return 0;
   }
 
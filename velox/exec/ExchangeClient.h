@@ -109,6 +109,10 @@ class ExchangeClient {
   std::vector<std::shared_ptr<ExchangeSource>> sources_;
   bool closed_{false};
 
+  // Number of times a starved consumer triggered a request beyond the memory
+  // budget because all request slots were taken by unresponsive sources.
+  int64_t numSpeculativeRequests_{0};
+
   // A queue of sources that have returned non-empty response from the latest
   // request.
   std::queue<std::shared_ptr<ExchangeSource>> producingSources_;
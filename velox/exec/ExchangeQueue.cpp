@@ -24,6 +24,7 @@ SerializedPage::SerializedPage(
       iobufBytes_(chainBytes(*iobuf_.get())),
       onDestructionCb_(onDestructionCb) {
   VELOX_CHECK_NOT_NULL(iobuf_);
+  ranges_.reserve(iobuf_->countChainElements());
   for (auto& buf : *iobuf_) {
     int32_t bufSize = buf.size();
     ranges_.push_back(ByteRange{
@@ -33,6 +34,12 @@ SerializedPage::SerializedPage(
   }
 }
 
+SerializedPage::SerializedPage(RowVectorPtr rowVector)
+    : iobufBytes_(rowVector->retainedSize()),
+      rowVector_(std::move(rowVector)) {
+  VELOX_CHECK_NOT_NULL(rowVector_);
+}
+
 SerializedPage::~SerializedPage() {
   if (onDestructionCb_) {
     onDestructionCb_(*iobuf_.get());
@@ -40,6 +47,8 @@ SerializedPage::~SerializedPage() {
 }
 
 void SerializedPage::prepareStreamForDeserialize(ByteStream* input) {
+  VELOX_CHECK_NULL(
+      rowVector_, "Page carrying a deserialized vector cannot be deserialized");
   input->resetInput(std::move(ranges_));
 }
 
@@ -62,6 +71,43 @@ void ExchangeQueue::close() {
   clearPromises(promises);
 }
 
+void ExchangeQueue::setPageDecoder(PageDecoder decoder) {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (decoder_ == nullptr) {
+    decoder_ = std::move(decoder);
+  }
+}
+
+std::vector<std::unique_ptr<SerializedPage>> ExchangeQueue::decodePages(
+    std::vector<std::unique_ptr<SerializedPage>> pages) {
+  PageDecoder decoder;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    decoder = decoder_;
+  }
+  if (decoder == nullptr) {
+    return pages;
+  }
+  std::vector<std::unique_ptr<SerializedPage>> decoded;
+  decoded.reserve(pages.size());
+  try {
+    for (auto& page : pages) {
+      if (page->rowVector() != nullptr) {
+        decoded.push_back(std::move(page));
+        continue;
+      }
+      auto vectors = decoder(std::move(page));
+      for (auto& decodedPage : vectors) {
+        decoded.push_back(std::move(decodedPage));
+      }
+    }
+  } catch (const std::exception& e) {
+    setError(e.what());
+    decoded.clear();
+  }
+  return decoded;
+}
+
 void ExchangeQueue::enqueueLocked(
     std::unique_ptr<SerializedPage>&& page,
     std::vector<ContinuePromise>& promises) {
@@ -16,11 +16,14 @@
 #pragma once
 
 #include "velox/common/memory/ByteStream.h"
+#include "velox/vector/ComplexVector.h"
 
 namespace facebook::velox::exec {
 
 // Corresponds to Presto SerializedPage, i.e. a container for
-// serialize vectors in Presto wire format.
+// serialize vectors in Presto wire format. Alternatively, carries a
+// deserialized RowVector when producer and consumer run in the same process
+// and the exchange bypasses serialization.
 class SerializedPage {
  public:
   // Construct from IOBuf chain.
@@ -28,18 +31,32 @@ class SerializedPage {
       std::unique_ptr<folly::IOBuf> iobuf,
       std::function<void(folly::IOBuf&)> onDestructionCb = nullptr);
 
+  // Construct from a deserialized vector. Used for in-process data transfer
+  // where serializing the data into wire format and back would be wasted
+  // work. Pages constructed this way cannot be sent to a remote consumer.
+  explicit SerializedPage(RowVectorPtr rowVector);
+
   ~SerializedPage();
 
-  // Returns the size of the serialized data in bytes.
+  // Returns the size of the serialized data in bytes. For pages carrying a
+  // deserialized vector, returns the retained size of the vector.
   uint64_t size() const {
     return iobufBytes_;
   }
 
+  // Returns the deserialized vector if this page carries one, nullptr for
+  // pages holding serialized data.
+  const RowVectorPtr& rowVector() const {
+    return rowVector_;
+  }
+
   // Makes 'input' ready for deserializing 'this' with
   // VectorStreamGroup::read().
   void prepareStreamForDeserialize(ByteStream* input);
 
   std::unique_ptr<folly::IOBuf> getIOBuf() const {
+    VELOX_CHECK_NOT_NULL(
+        iobuf_, "Page carrying a deserialized vector has no IOBuf");
     return iobuf_->clone();
   }
 
@@ -66,6 +83,9 @@ class SerializedPage {
   // from caller. Caller is responsible to pass in proper cleanup logic to
   // prevent any memory leak.
   std::function<void(folly::IOBuf&)> onDestructionCb_;
+
+  // Deserialized data for in-process exchanges. When set, 'iobuf_' is null.
+  RowVectorPtr rowVector_;
 };
 
 // Queue of results retrieved from source. Owned by shared_ptr by
@@ -83,6 +103,12 @@ class ExchangeQueue {
     clearAllPromises();
   }
 
+  /// Converts a page holding serialized data into one or more pages carrying
+  /// deserialized vectors. See setPageDecoder().
+  using PageDecoder =
+      std::function<std::vector<std::unique_ptr<SerializedPage>>(
+          std::unique_ptr<SerializedPage>)>;
+
   std::mutex& mutex() {
     return mutex_;
   }
@@ -91,6 +117,20 @@ class ExchangeQueue {
     return queue_.empty();
   }
 
+  /// Installs a decoder that sources apply to incoming pages before
+  /// enqueueing them, so that deserialization runs on the threads that
+  /// deliver the data instead of the consuming driver thread. Only the
+  /// first call takes effect; the consuming Exchange operators of a
+  /// queue all install the same decoder.
+  void setPageDecoder(PageDecoder decoder);
+
+  /// Applies the installed decoder, if any, to 'pages'. Called by sources
+  /// without holding the queue mutex. Pages already carrying vectors pass
+  /// through unchanged. A decoding error is recorded with setError() and
+  /// drops the pages.
+  std::vector<std::unique_ptr<SerializedPage>> decodePages(
+      std::vector<std::unique_ptr<SerializedPage>> pages);
+
   void enqueueLocked(
       std::unique_ptr<SerializedPage>&& page,
       std::vector<ContinuePromise>& promises);
@@ -173,6 +213,9 @@ class ExchangeQueue {
   bool atEnd_{false};
 
   std::mutex mutex_;
+  // Applied by sources to incoming pages before enqueueing. Guarded by
+  // 'mutex_'; invoked without it.
+  PageDecoder decoder_;
   std::deque<std::unique_ptr<SerializedPage>> queue_;
   std::vector<ContinuePromise> promises_;
   // When set, all promises will be realized and the next dequeue will
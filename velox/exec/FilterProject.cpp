@@ -91,10 +91,22 @@ void FilterProject::initialize() {
       auto fieldIndex = inputType->getChildIdx(field->name());
       distinctFieldIndices.insert(fieldIndex);
     }
+    std::unordered_set<uint32_t> filterFieldIndices;
+    if (hasFilter_) {
+      for (auto field : exprs_->expr(0)->distinctFields()) {
+        filterFieldIndices.insert(inputType->getChildIdx(field->name()));
+      }
+    }
     for (auto identityField : identityProjections_) {
-      if (distinctFieldIndices.find(identityField.inputChannel) !=
-          distinctFieldIndices.end()) {
-        multiplyReferencedFieldIndices_.push_back(identityField.inputChannel);
+      const auto channel = identityField.inputChannel;
+      if (distinctFieldIndices.find(channel) == distinctFieldIndices.end()) {
+        continue;
+      }
+      if (hasFilter_ &&
+          filterFieldIndices.find(channel) == filterFieldIndices.end()) {
+        deferredMultiplyReferencedFieldIndices_.push_back(channel);
+      } else {
+        multiplyReferencedFieldIndices_.push_back(channel);
       }
     }
   }
@@ -134,8 +146,10 @@ RowVectorPtr FilterProject::getOutput() {
   rows->setAll();
   EvalCtx evalCtx(operatorCtx_->execCtx(), exprs_.get(), input_.get());
 
-  // Pre-load lazy vectors which are referenced by both expressions and identity
-  // projections.
+  // Pre-load lazy vectors which are referenced by the filter (or, without a
+  // filter, by any expression) as well as identity projections. Fields
+  // referenced only by projection expressions are loaded after the filter for
+  // just the passing rows.
   for (auto fieldIdx : multiplyReferencedFieldIndices_) {
     evalCtx.ensureFieldLoaded(fieldIdx, *rows);
   }
@@ -164,9 +178,16 @@ RowVectorPtr FilterProject::getOutput() {
     if (!allRowsSelected) {
       rows->setFromBits(filterEvalCtx_.selectedBits->as<uint64_t>(), size);
     }
+    for (auto fieldIdx : deferredMultiplyReferencedFieldIndices_) {
+      evalCtx.ensureFieldLoaded(fieldIdx, *rows);
+    }
     results = project(*rows, evalCtx);
   }
 
+  // The output wraps the passing rows as a dictionary over the input columns
+  // and the projection's expression results; a downstream consumer, e.g. a
+  // partial aggregation's VectorHashers, decodes them in place without an
+  // intermediate copy.
   return fillOutput(
       numOut,
       allRowsSelected ? nullptr : filterEvalCtx_.selectedIndices,
@@ -117,5 +117,11 @@ class FilterProject : public Operator {
   // will load c1 only for rows where f(c0) is true. However, c1 identity
   // projection needs all rows.
   std::vector<column_index_t> multiplyReferencedFieldIndices_;
+
+  // Subset of the multiply referenced fields that is referenced by projection
+  // expressions but not by the filter. Both the projections and the identity
+  // projections need only the rows that pass the filter, hence, these fields
+  // are loaded after evaluating the filter and only for the passing rows.
+  std::vector<column_index_t> deferredMultiplyReferencedFieldIndices_;
 };
 } // namespace facebook::velox::exec
@@ -62,6 +62,9 @@ GroupId::GroupId(
     const auto& input = aggregationInputs[i];
     aggregationInputs_.push_back(inputType->getChildIdx(input->name()));
   }
+
+  nullKeys_.resize(numGroupingKeys);
+  groupIds_.resize(groupingKeyMappings_.size());
 }
 
 bool GroupId::needsInput() const {
@@ -93,9 +96,15 @@ RowVectorPtr GroupId::getOutput() {
   // Fill in grouping keys.
   for (auto i = 0; i < numGroupingKeys; ++i) {
     if (mapping[i] == kMissingGroupingKey) {
-      // Add null column.
-      outputColumns[i] = BaseVector::createNullConstant(
-          outputType_->childAt(i), numInput, pool());
+      // Add null column. Reuse the constant from a previous batch unless it
+      // is still referenced downstream.
+      if (nullKeys_[i] == nullptr || !nullKeys_[i].unique()) {
+        nullKeys_[i] = BaseVector::createNullConstant(
+            outputType_->childAt(i), numInput, pool());
+      } else {
+        nullKeys_[i]->resize(numInput);
+      }
+      outputColumns[i] = nullKeys_[i];
     } else {
       outputColumns[i] = input_->childAt(mapping[i]);
     }
@@ -107,9 +116,14 @@ RowVectorPtr GroupId::getOutput() {
   }
 
   // Add groupId column.
-  outputColumns[outputType_->size() - 1] =
-      std::make_shared<ConstantVector<int64_t>>(
-          pool(), numInput, false, BIGINT(), groupingSetIndex_);
+  auto& groupId = groupIds_[groupingSetIndex_];
+  if (groupId == nullptr || !groupId.unique()) {
+    groupId = std::make_shared<ConstantVector<int64_t>>(
+        pool(), numInput, false, BIGINT(), groupingSetIndex_);
+  } else {
+    groupId->resize(numInput);
+  }
+  outputColumns[outputType_->size() - 1] = groupId;
 
   ++groupingSetIndex_;
   if (groupingSetIndex_ == groupingKeyMappings_.size()) {
@@ -64,5 +64,15 @@ class GroupId : public Operator {
   /// and lookup the input-to-output column mappings in the
   /// groupingKeyMappings_.
   int32_t groupingSetIndex_{0};
+
+  /// Reusable constant vectors for grouping keys missing from a set, one per
+  /// output grouping key column. Input columns are shared by reference, so
+  /// these constants are the only vectors 'getOutput' makes; reusing them
+  /// across batches when no longer referenced downstream avoids one
+  /// allocation per batch per grouping set.
+  std::vector<VectorPtr> nullKeys_;
+
+  /// Reusable constant groupId vectors, one per grouping set.
+  std::vector<VectorPtr> groupIds_;
 };
 } // namespace facebook::velox::exec
@@ -261,6 +261,15 @@ void GroupingSet::addInputForActiveRows(
   auto* groups = lookup_->hits.data();
   const auto& newGroups = lookup_->newGroups;
 
+  // Warm the accumulator lines of the groups hit by this batch. With tens of
+  // millions of groups the rows are effectively random memory and every
+  // aggregate's update loop would otherwise take a miss per row. One pass
+  // serves all aggregates because a row's accumulators are adjacent.
+  if (!aggregates_.empty()) {
+    activeRows_.applyToSelected(
+        [&](auto row) { __builtin_prefetch(groups[row]); });
+  }
+
   for (auto i = 0; i < aggregates_.size(); ++i) {
     if (!aggregates_[i].sortingKeys.empty()) {
       continue;
@@ -731,22 +740,71 @@ bool GroupingSet::getOutput(
   }
   VELOX_CHECK(!isDistinct());
 
+  if (noMoreInput_) {
+    // No further input is coming, so there is no next flush to retain hot
+    // groups for; emit everything.
+    hotGroups_.clear();
+  }
+
   // @lint-ignore CLANGTIDY
   char* groups[maxOutputRows];
-  const int32_t numGroups = table_
-      ? table_->rows()->listRows(
-            &iterator, maxOutputRows, maxOutputBytes, groups)
-      : 0;
+  int32_t numGroups = 0;
+  if (table_ != nullptr) {
+    // When hot groups are retained across the flush, a listed chunk may
+    // consist entirely of retained groups; keep listing until a chunk yields
+    // groups to emit or the table is exhausted.
+    do {
+      const auto numListed = table_->rows()->listRows(
+          &iterator, maxOutputRows, maxOutputBytes, groups);
+      if (numListed == 0) {
+        break;
+      }
+      if (hotGroups_.empty()) {
+        numGroups = numListed;
+      } else {
+        for (auto i = 0; i < numListed; ++i) {
+          if (hotGroups_.count(groups[i]) == 0) {
+            groups[numGroups++] = groups[i];
+          }
+        }
+      }
+    } while (numGroups == 0);
+  }
   if (numGroups == 0) {
     if (table_ != nullptr) {
-      table_->clear();
+      if (hotGroups_.empty()) {
+        table_->clear();
+        if (sortedAggregations_ != nullptr) {
+          // All groups have been extracted and their buffered input rows
+          // erased. Return the input row container's memory so a streaming
+          // flush does not retain the high-water mark of past clusters.
+          sortedAggregations_->clear();
+        }
+      } else {
+        eraseFlushedGroups();
+      }
     }
     return false;
   }
+  if (!hotGroups_.empty()) {
+    flushedGroups_.insert(flushedGroups_.end(), groups, groups + numGroups);
+  }
   extractGroups(folly::Range<char**>(groups, numGroups), result);
   return true;
 }
 
+void GroupingSet::eraseFlushedGroups() {
+  if (!flushedGroups_.empty()) {
+    table_->erase(
+        folly::Range<char**>(flushedGroups_.data(), flushedGroups_.size()));
+    flushedGroups_.clear();
+    flushedGroups_.shrink_to_fit();
+    tableHasErasedRows_ = true;
+  }
+  hotGroups_.clear();
+  retainedPartialFlush_ = true;
+}
+
 void GroupingSet::extractGroups(
     folly::Range<char**> groups,
     const RowVectorPtr& result) {
@@ -787,14 +845,64 @@ void GroupingSet::extractGroups(
 }
 
 void GroupingSet::resetTable() {
+  if (retainedPartialFlush_) {
+    // The just-finished partial flush erased the cold groups and kept the hot
+    // ones live with their accumulated state; the table must survive.
+    retainedPartialFlush_ = false;
+    return;
+  }
+  hotGroups_.clear();
+  flushedGroups_.clear();
+  tableHasErasedRows_ = false;
   if (table_ != nullptr) {
     table_->clear();
   }
 }
 
+void GroupingSet::retainHotGroupsOnFlush(int64_t maxBytes) {
+  VELOX_CHECK(isPartial_);
+  hotGroups_.clear();
+  if (table_ == nullptr || lookup_ == nullptr || hasSpilled()) {
+    return;
+  }
+  const auto numDistinct = table_->numDistinct();
+  if (numDistinct == 0) {
+    return;
+  }
+  // If most of the last batch's rows created new groups, keys are not
+  // repeating and there is nothing worth retaining. This also keeps the
+  // abandon-partial-aggregation heuristics effective on non-reducing input.
+  if (lookup_->newGroups.size() * 2 > lookup_->rows.size()) {
+    return;
+  }
+  // Cap the retained set so the survivors occupy at most a quarter of
+  // 'maxBytes'. This guarantees that a flush always has cold groups to emit
+  // and erase, even when individual accumulators are large.
+  constexpr int64_t kMaxHotGroups = 1024;
+  const auto avgRowBytes =
+      std::max<int64_t>(1, allocatedBytes() / numDistinct);
+  const auto maxRetained =
+      std::min<int64_t>(kMaxHotGroups, (maxBytes / 4) / avgRowBytes);
+  if (maxRetained <= 0) {
+    return;
+  }
+  // The groups hit by the most recent input batch are the hot set. Entries of
+  // 'hits' outside the last batch's active rows may be stale; this is benign
+  // since 'hotGroups_' is only used for membership tests and never
+  // dereferenced.
+  for (auto* group : lookup_->hits) {
+    if (group != nullptr) {
+      hotGroups_.insert(group);
+      if (static_cast<int64_t>(hotGroups_.size()) >= maxRetained) {
+        break;
+      }
+    }
+  }
+}
+
 bool GroupingSet::isPartialFull(int64_t maxBytes) {
   VELOX_CHECK(isPartial_);
-  if (!table_ || allocatedBytes() <= maxBytes) {
+  if (!table_ || usedBytes() <= maxBytes) {
     return false;
   }
   if (table_->hashMode() != BaseHashTable::HashMode::kArray) {
@@ -810,7 +918,21 @@ bool GroupingSet::isPartialFull(int64_t maxBytes) {
       stats.numDistinct < stats.capacity / 32) {
     table_->decideHashMode(0, true);
   }
-  return allocatedBytes() > maxBytes;
+  return usedBytes() > maxBytes;
+}
+
+int64_t GroupingSet::usedBytes() const {
+  int64_t bytes = allocatedBytes();
+  if (tableHasErasedRows_) {
+    // After a flush that retained hot groups the container keeps its
+    // allocations and new inserts reuse the erased rows' space; discount the
+    // reusable free space so that such a flush counts as freeing memory.
+    const auto freeSpace = table_->rows()->freeSpace();
+    bytes -= std::min<int64_t>(
+        bytes,
+        freeSpace.first * table_->rows()->fixedRowSize() + freeSpace.second);
+  }
+  return bytes;
 }
 
 uint64_t GroupingSet::allocatedBytes() const {
@@ -1242,6 +1364,8 @@ void GroupingSet::toIntermediate(
         intermediateRowNumbers_.begin(), intermediateRowNumbers_.end(), 0);
   }
 
+  // Forward grouping keys as is, keeping any dictionary encoding intact so
+  // that the final aggregation's VectorHashers can use cached value ids.
   for (auto i = 0; i < keyChannels_.size(); ++i) {
     result->childAt(i) = input->childAt(keyChannels_[i]);
   }
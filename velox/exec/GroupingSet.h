@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <folly/container/F14Set.h>
+
 #include "velox/exec/AggregateInfo.h"
 #include "velox/exec/AggregationMasks.h"
 #include "velox/exec/DistinctAggregations.h"
@@ -89,6 +91,16 @@ class GroupingSet {
   /// based on value ranges to one based on value ids can save a lot.
   bool isPartialFull(int64_t maxBytes);
 
+  /// Marks a bounded set of hot groups to survive the next partial flush.
+  /// Called by HashAggregation right before a memory-triggered flush. The
+  /// groups hit by the most recent input batch keep their accumulators and
+  /// stay in 'table_' while the cold groups are emitted and erased, so
+  /// frequent keys are not re-inserted and re-reduced downstream after every
+  /// flush. The retained set is capped so that it never exceeds a quarter of
+  /// 'maxBytes', guaranteeing that each flush still frees memory. No-op for
+  /// final aggregations and after spilling.
+  void retainHotGroupsOnFlush(int64_t maxBytes);
+
   /// Returns the count of the hash table, if any.
   int64_t numDistinct() const {
     return table_ ? table_->numDistinct() : 0;
@@ -204,16 +216,26 @@ class GroupingSet {
   // spills enough to make output fit.
   void ensureOutputFits();
 
+  // Returns the bytes counted against the partial aggregation budget:
+  // allocated bytes minus the free space left in 'table_' by erased groups.
+  int64_t usedBytes() const;
+
+  // Erases 'flushedGroups_' from 'table_' after a partial flush that retained
+  // hot groups and clears the retention state. The retained groups stay live
+  // in the table with their accumulated state.
+  void eraseFlushedGroups();
+
   // Copies the grouping keys and aggregates for 'groups' into 'result' If
   // partial output, extracts the intermediate type for aggregates, final result
   // otherwise.
   void extractGroups(folly::Range<char**> groups, const RowVectorPtr& result);
 
-  // Produces output in if spilling has occurred. First produces data
-  // from non-spilled partitions, then merges spill runs and unspilled data
-  // form spilled partitions. Returns nullptr when at end. 'maxOutputRows' and
-  // 'maxOutputBytes' specifies the max number of output rows and bytes in
-  // 'result'.
+  // Produces output if spilling has occurred. Spill runs are written sorted
+  // on the grouping keys, so finalization streams a merge of the runs and
+  // accumulates one group at a time instead of rebuilding a hash table.
+  // Memory use is bounded by one read buffer per run plus one output batch.
+  // Returns false when at end. 'maxOutputRows' and 'maxOutputBytes' specify
+  // the max number of output rows and bytes in 'result'.
   bool getOutputWithSpill(
       int32_t maxOutputRows,
       int32_t maxOutputBytes,
@@ -358,6 +380,24 @@ class GroupingSet {
   // 'spillConfig_->testSpillPct'.
   uint64_t spillTestCounter_{0};
 
+  // Groups to keep across the next partial flush. Populated by
+  // retainHotGroupsOnFlush() from the groups hit by the most recent input
+  // batch; used for membership tests only in getOutput().
+  folly::F14FastSet<char*> hotGroups_;
+
+  // Groups emitted by the current partial flush while 'hotGroups_' is
+  // non-empty. Erased from 'table_' once the flush is complete.
+  std::vector<char*> flushedGroups_;
+
+  // True if the just-finished partial flush kept 'hotGroups_' alive, in which
+  // case resetTable() must not clear the table.
+  bool retainedPartialFlush_{false};
+
+  // True if 'table_' holds free rows from erasing flushed groups. Makes
+  // isPartialFull() count occupied bytes instead of allocated bytes since the
+  // container keeps its allocations and reuses the erased rows' space.
+  bool tableHasErasedRows_{false};
+
   // True if partial aggregation has been given up as non-productive.
   bool abandonedPartialAggregation_{false};
 
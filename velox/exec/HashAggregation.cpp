@@ -251,6 +251,12 @@ void HashAggregation::addInput(RowVectorPtr input) {
       (abandonPartialEarly ||
        groupingSet_->isPartialFull(maxPartialAggregationMemoryUsage_))) {
     partialFull_ = true;
+    if (!abandonPartialEarly && !isDistinct_) {
+      // Keep the groups hit by the most recent batch alive across the flush
+      // so frequent keys are not re-inserted and re-reduced downstream after
+      // every flush.
+      groupingSet_->retainHotGroupsOnFlush(maxPartialAggregationMemoryUsage_);
+    }
   }
 
   if (isDistinct_) {
@@ -349,11 +355,14 @@ void HashAggregation::maybeIncreasePartialAggregationMemoryUsage(
   constexpr int32_t kPartialMinFinalPct = 40;
   VELOX_DCHECK(isPartialOutput_);
   // If size is at max and there still is not enough reduction, abandon partial
-  // aggregation.
-  if (abandonPartialAggregationEarly(numOutputRows_) ||
-      (aggregationPct > kPartialMinFinalPct &&
-       maxPartialAggregationMemoryUsage_ >=
-           maxExtendedPartialAggregationMemoryUsage_)) {
+  // aggregation. Abandoning requires an empty row container, so defer it while
+  // the flush retained hot groups; a later flush without retention empties the
+  // table.
+  if (groupingSet_->numRows() == 0 &&
+      (abandonPartialAggregationEarly(numOutputRows_) ||
+       (aggregationPct > kPartialMinFinalPct &&
+        maxPartialAggregationMemoryUsage_ >=
+            maxExtendedPartialAggregationMemoryUsage_))) {
     groupingSet_->abandonPartialAggregation();
     pool()->release();
     addRuntimeStat("abandonedPartialAggregation", RuntimeCounter(1));
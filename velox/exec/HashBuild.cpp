@@ -213,6 +213,11 @@ void HashBuild::setupSpiller(SpillPartition* spillPartition) {
               << ", memory pool: " << pool()->name();
     spillInputReader_ = spillPartition->createReader();
 
+    // Restoring a spilled partition that may itself not fit in memory: set up
+    // the next recursion level of grace-join partitioning. Each level hashes
+    // on the 'joinPartitionBits' bits above the bits that selected the
+    // restored partition, so re-spilled rows split into fresh sub-partitions
+    // instead of landing back in one bucket.
     const auto startBit = spillPartition->id().partitionBitOffset() +
         spillConfig.joinPartitionBits;
     // Disable spilling if exceeding the max spill level and the query might run
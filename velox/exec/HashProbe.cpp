@@ -15,10 +15,13 @@
  */
 
 #include "velox/exec/HashProbe.h"
+#include "velox/common/testutil/TestValue.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Task.h"
 #include "velox/expression/FieldReference.h"
 
+using facebook::velox::common::testutil::TestValue;
+
 namespace facebook::velox::exec {
 
 namespace {
@@ -73,11 +76,174 @@ void extractColumns(
       child = BaseVector::create(resultTypes[resultChannel], rows.size(), pool);
     }
     child->resize(rows.size());
+    // The rows are scattered over a table that often exceeds the caches.
+    // Issue prefetches for the column's location in each row before the
+    // copy loop so the extraction does not stall on one miss per row.
+    const auto offset =
+        table->rows()->columnAt(projection.inputChannel).offset();
+    for (auto* row : rows) {
+      if (row != nullptr) {
+        __builtin_prefetch(row + offset);
+      }
+    }
     table->rows()->extractColumn(
         rows.data(), rows.size(), projection.inputChannel, child);
   }
 }
 
+// Feeds the values extracted for a pushed-down aggregate to 'hook'. 'values'
+// holds the value for rows[i] at position i.
+template <TypeKind Kind>
+void feedValueHook(const BaseVector& values, RowSet rows, ValueHook* hook) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  auto* flat = values.asUnchecked<FlatVector<T>>();
+  for (vector_size_t i = 0; i < rows.size(); ++i) {
+    if (flat->isNullAt(i)) {
+      if (hook->acceptsNulls()) {
+        hook->addNull(rows[i]);
+      }
+    } else {
+      const T value = flat->valueAt(i);
+      hook->addValue(rows[i], &value);
+    }
+  }
+}
+
+// Produces a build-side output column from the hash table on first use.
+// Build-side payload columns are exposed as LazyVectors so that rows and
+// columns dropped by selective filters and projections downstream are never
+// copied out of the row container. Keeps the hash table alive, so the cached
+// row pointers stay valid even after the operator moves on to a spill
+// partition or finishes.
+class BuildColumnLoader : public VectorLoader {
+ public:
+  BuildColumnLoader(
+      std::shared_ptr<BaseHashTable> table,
+      std::shared_ptr<const std::vector<char*>> rows,
+      column_index_t channel,
+      TypePtr type,
+      memory::MemoryPool* pool)
+      : table_(std::move(table)),
+        rows_(std::move(rows)),
+        channel_(channel),
+        type_(std::move(type)),
+        pool_(pool) {}
+
+ private:
+  void loadInternal(
+      RowSet rowSet,
+      ValueHook* hook,
+      vector_size_t resultSize,
+      VectorPtr* result) override {
+    // The rows are scattered over the table; prefetch the column's location
+    // in each requested row, as in extractColumns() above.
+    const auto offset = table_->rows()->columnAt(channel_).offset();
+    for (auto row : rowSet) {
+      if (auto* rawRow = (*rows_)[row]) {
+        __builtin_prefetch(rawRow + offset);
+      }
+    }
+
+    if (hook != nullptr) {
+      // Aggregation pushdown. Extract just the requested rows densely and
+      // feed them to the hook without materializing a result vector.
+      auto values = BaseVector::create(type_, rowSet.size(), pool_);
+      table_->rows()->extractColumn(rows_->data(), rowSet, channel_, 0, values);
+      VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+          feedValueHook, type_->kind(), *values, rowSet, hook);
+      return;
+    }
+
+    if (*result == nullptr) {
+      *result = BaseVector::create(type_, resultSize, pool_);
+    } else {
+      BaseVector::prepareForReuse(*result, resultSize);
+    }
+    if (rowSet.size() == resultSize) {
+      table_->rows()->extractColumn(
+          rows_->data(), resultSize, channel_, *result);
+      return;
+    }
+    // Selective load. Null out the pointers of unrequested rows so they come
+    // out as nulls; by contract they are never accessed.
+    std::vector<char*> sparseRows(resultSize, nullptr);
+    for (auto row : rowSet) {
+      sparseRows[row] = (*rows_)[row];
+    }
+    table_->rows()->extractColumn(
+        sparseRows.data(), resultSize, channel_, *result);
+  }
+
+  // Keeps alive the row container rows referenced by 'rows_'.
+  const std::shared_ptr<BaseHashTable> table_;
+  const std::shared_ptr<const std::vector<char*>> rows_;
+  const column_index_t channel_;
+  const TypePtr type_;
+  memory::MemoryPool* const pool_;
+};
+
+// Largest build side for which a Bloom filter over the join keys is built
+// for pushdown into the probe side scan. Building the filter takes one pass
+// over the table.
+constexpr uint64_t kMaxRowsForBloomFilter = 4 << 20;
+
+// Builds a Bloom filter over the join key values of 'table' at 'keyIndex'.
+// Used when the table is in hash mode, where the hashers do not track ranges
+// or distinct values, so no exact filter can be produced. Returns nullptr if
+// the table has no non-null keys.
+template <TypeKind Kind>
+std::unique_ptr<common::Filter> makeKeyBloomFilterTyped(
+    BaseHashTable& table,
+    column_index_t keyIndex,
+    memory::MemoryPool* pool) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  auto values = BaseVector::create<FlatVector<T>>(
+      table.hashers()[keyIndex]->type(), kBatchSize, pool);
+  BloomFilter<> bloomFilter;
+  bloomFilter.reset(static_cast<int32_t>(table.numDistinct()));
+  int64_t min = std::numeric_limits<int64_t>::max();
+  int64_t max = std::numeric_limits<int64_t>::min();
+  std::vector<char*> rows(kBatchSize);
+  BaseHashTable::RowsIterator iter;
+  int32_t numRows;
+  while ((numRows = table.listAllRows(
+              &iter, kBatchSize, RowContainer::kUnlimited, rows.data())) > 0) {
+    table.rows()->extractColumn(rows.data(), numRows, keyIndex, values);
+    for (auto i = 0; i < numRows; ++i) {
+      if (values->isNullAt(i)) {
+        continue;
+      }
+      const int64_t value = values->valueAt(i);
+      min = std::min(min, value);
+      max = std::max(max, value);
+      bloomFilter.insert(folly::hasher<int64_t>()(value));
+    }
+  }
+  if (min > max) {
+    return nullptr;
+  }
+  return std::make_unique<common::BigintValuesUsingBloomFilter>(
+      min, max, bloomFilter, false);
+}
+
+std::unique_ptr<common::Filter> makeKeyBloomFilter(
+    BaseHashTable& table,
+    column_index_t keyIndex,
+    memory::MemoryPool* pool) {
+  switch (table.hashers()[keyIndex]->typeKind()) {
+    case TypeKind::TINYINT:
+      return makeKeyBloomFilterTyped<TypeKind::TINYINT>(table, keyIndex, pool);
+    case TypeKind::SMALLINT:
+      return makeKeyBloomFilterTyped<TypeKind::SMALLINT>(table, keyIndex, pool);
+    case TypeKind::INTEGER:
+      return makeKeyBloomFilterTyped<TypeKind::INTEGER>(table, keyIndex, pool);
+    case TypeKind::BIGINT:
+      return makeKeyBloomFilterTyped<TypeKind::BIGINT>(table, keyIndex, pool);
+    default:
+      return nullptr;
+  }
+}
+
 BlockingReason fromStateToBlockingReason(ProbeOperatorState state) {
   switch (state) {
     case ProbeOperatorState::kRunning:
@@ -318,8 +484,7 @@ void HashProbe::asyncWaitForHashTable() {
   } else if (
       (isInnerJoin(joinType_) || isLeftSemiFilterJoin(joinType_) ||
        isRightSemiFilterJoin(joinType_) || isRightSemiProjectJoin(joinType_)) &&
-      table_->hashMode() != BaseHashTable::HashMode::kHash && !isSpillInput() &&
-      !hasMoreSpillData()) {
+      !isSpillInput() && !hasMoreSpillData()) {
     // Find out whether there are any upstream operators that can accept
     // dynamic filters on all or a subset of the join keys. Create dynamic
     // filters to push down.
@@ -331,12 +496,25 @@ void HashProbe::asyncWaitForHashTable() {
     const auto& buildHashers = table_->hashers();
     auto channels = operatorCtx_->driverCtx()->driver->canPushdownFilters(
         this, keyChannels_);
-    for (auto i = 0; i < keyChannels_.size(); i++) {
-      if (channels.find(keyChannels_[i]) != channels.end()) {
-        if (auto filter = buildHashers[i]->getFilter(false)) {
-          dynamicFilters_.emplace(keyChannels_[i], std::move(filter));
+    if (table_->hashMode() != BaseHashTable::HashMode::kHash) {
+      for (auto i = 0; i < keyChannels_.size(); i++) {
+        if (channels.find(keyChannels_[i]) != channels.end()) {
+          if (auto filter = buildHashers[i]->getFilter(false)) {
+            dynamicFilters_.emplace(keyChannels_[i], std::move(filter));
+          }
         }
       }
+    } else if (
+        keyChannels_.size() == 1 &&
+        channels.find(keyChannels_[0]) != channels.end() &&
+        table_->numDistinct() <= kMaxRowsForBloomFilter) {
+      // In hash mode the hashers track neither ranges nor distinct values,
+      // so no exact filter can be produced. Build an approximate Bloom
+      // filter over the keys instead. False positives are fine since the
+      // join itself re-verifies all matches.
+      if (auto filter = makeKeyBloomFilter(*table_, 0, pool())) {
+        dynamicFilters_.emplace(keyChannels_[0], std::move(filter));
+      }
     }
   }
 }
@@ -486,6 +664,10 @@ BlockingReason HashProbe::isBlocked(ContinueFuture* future) {
   if (future_.valid()) {
     VELOX_CHECK(!isRunning());
     *future = std::move(future_);
+  } else if (yield_) {
+    yield_ = false;
+    *future = ContinueFuture{folly::Unit{}};
+    return BlockingReason::kYield;
   }
   return fromStateToBlockingReason(state_);
 }
@@ -585,9 +767,15 @@ void HashProbe::addInput(RowVectorPtr input) {
   auto& buildHashers = table_->hashers();
   for (auto i = 0; i < keyChannels_.size(); ++i) {
     if (mode != BaseHashTable::HashMode::kHash) {
-      auto key = input_->childAt(keyChannels_[i]);
+      // The build-side hashers own the value-id mappings. The keys were
+      // already decoded into the probe-side hashers by
+      // decodeAndDetectNonNullKeys(), so look up the ids from the decoded
+      // keys instead of decoding them a second time.
       buildHashers[i]->lookupValueIds(
-          *key, activeRows_, scratchMemory_, lookup_->hashes);
+          hashers_[i]->decodedVector(),
+          activeRows_,
+          scratchMemory_,
+          lookup_->hashes);
     } else {
       hashers_[i]->hash(activeRows_, i > 0, lookup_->hashes);
     }
@@ -698,6 +886,15 @@ void HashProbe::fillLeftSemiProjectMatchColumn(vector_size_t size) {
 }
 
 void HashProbe::fillOutput(vector_size_t size) {
+  if (output_ != nullptr && output_.unique() &&
+      !isLeftSemiProjectJoin(joinType_)) {
+    // Build-side children are replaced with new LazyVectors below; drop them
+    // so prepareOutput() does not allocate replacements just to have them
+    // overwritten.
+    for (const auto& projection : tableOutputProjections_) {
+      output_->childAt(projection.outputChannel) = nullptr;
+    }
+  }
   prepareOutput(size);
 
   for (auto projection : identityProjections_) {
@@ -712,14 +909,23 @@ void HashProbe::fillOutput(vector_size_t size) {
 
   if (isLeftSemiProjectJoin(joinType_)) {
     fillLeftSemiProjectMatchColumn(size);
-  } else {
-    extractColumns(
-        table_.get(),
-        folly::Range<char**>(outputTableRows_.data(), size),
-        tableOutputProjections_,
-        pool(),
-        outputType_->children(),
-        output_->children());
+  } else if (!tableOutputProjections_.empty()) {
+    // Expose build-side columns as LazyVectors loaded from the hash table on
+    // first use, so that a selective filter or projection downstream only
+    // pays for the rows and columns it actually consumes. The loaders share
+    // a snapshot of the row pointers because 'outputTableRows_' is reused for
+    // the next output batch.
+    auto rowsSnapshot = std::make_shared<const std::vector<char*>>(
+        outputTableRows_.begin(), outputTableRows_.begin() + size);
+    for (const auto& projection : tableOutputProjections_) {
+      const auto& type = outputType_->childAt(projection.outputChannel);
+      output_->childAt(projection.outputChannel) = std::make_shared<LazyVector>(
+          pool(),
+          type,
+          size,
+          std::make_unique<BuildColumnLoader>(
+              table_, rowsSnapshot, projection.inputChannel, type, pool()));
+    }
   }
 }
 
@@ -955,6 +1161,16 @@ RowVectorPtr HashProbe::getOutput() {
     numOut = evalFilter(numOut);
 
     if (!numOut) {
+      // With a highly selective filter, this loop can walk all matches of the
+      // probe-side batch without producing a row. Check between listed chunks
+      // whether the task asked the drivers on thread to stop, so that a single
+      // getOutput() call does not hold the thread for the whole batch.
+      if (operatorCtx_->task()->shouldStop() != StopReason::kNone) {
+        yield_ = true;
+        TestValue::adjust(
+            "facebook::velox::exec::HashProbe::getOutput::yield", this);
+        return nullptr;
+      }
       continue;
     }
 
@@ -285,6 +285,13 @@ class HashProbe : public Operator {
   // Channel of probe keys in 'input_'.
   std::vector<column_index_t> keyChannels_;
 
+  // True if getOutput() bailed out of its probe loop because the task asked
+  // the drivers on thread to stop, e.g. to yield to other tasks or to pause.
+  // Makes the next isBlocked() call return kYield with a fulfilled future so
+  // the driver goes back to the executor's queue and resumes the probe of the
+  // current input from where it left off.
+  bool yield_{false};
+
   // True if the join can become a no-op starting with the next batch of input.
   bool canReplaceWithDynamicFilter_{false};
 
@@ -108,6 +108,12 @@ class ProbeState {
     indexInTags_ = kNotSet;
     __builtin_prefetch(
         reinterpret_cast<uint8_t*>(table.table_) + bucketOffset_);
+    // Also prefetch the next bucket line. With a 7/8 load factor probes
+    // commonly overflow into the next bucket and for tables larger than
+    // L3 the second line would otherwise be a full memory stall.
+    __builtin_prefetch(
+        reinterpret_cast<uint8_t*>(table.table_) +
+        table.nextBucketOffset(bucketOffset_));
   }
 
   // Use one instruction to load 16 tags. Use another one instruction
@@ -118,7 +124,7 @@ class ProbeState {
     tagsInTable_ = BaseHashTable::loadTags(
         reinterpret_cast<uint8_t*>(table.table_), bucketOffset_);
     table.incrementTagLoads();
-    hits_ = simd::toBitMask(tagsInTable_ == wantedTags_);
+    hits_ = BaseHashTable::compareTags(tagsInTable_, wantedTags_);
     if (hits_) {
       loadNextHit<op>(table, firstKey);
     }
@@ -144,7 +150,7 @@ class ProbeState {
     auto alreadyChecked = group_;
     if (extraCheck) {
       tagsInTable_ = table.loadTags(bucketOffset_);
-      hits_ = simd::toBitMask(tagsInTable_ == wantedTags_);
+      hits_ = BaseHashTable::compareTags(tagsInTable_, wantedTags_);
     }
 
     int64_t insertBucketOffset = -1;
@@ -171,7 +177,7 @@ class ProbeState {
         }
       }
 
-      uint16_t empty = simd::toBitMask(tagsInTable_ == kEmptyGroup) & kFullMask;
+      uint16_t empty = BaseHashTable::compareTags(tagsInTable_, kEmptyGroup) & kFullMask;
       if (empty > 0) {
         if (op == Operation::kProbe) {
           return nullptr;
@@ -192,7 +198,7 @@ class ProbeState {
       if (op == Operation::kInsert && indexInTags_ == kNotSet) {
         // We passed through a full group.
         uint16_t tombstones =
-            simd::toBitMask(tagsInTable_ == kTombstoneGroup) & kFullMask;
+            BaseHashTable::compareTags(tagsInTable_, kTombstoneGroup) & kFullMask;
         if (tombstones > 0) {
           insertBucketOffset = bucketOffset_;
           indexInTags_ = bits::getAndClearLastSetBit(tombstones);
@@ -200,7 +206,7 @@ class ProbeState {
       }
       bucketOffset_ = table.nextBucketOffset(bucketOffset_);
       tagsInTable_ = table.loadTags(bucketOffset_);
-      hits_ = simd::toBitMask(tagsInTable_ == wantedTags_);
+      hits_ = BaseHashTable::compareTags(tagsInTable_, wantedTags_);
     }
   }
 
@@ -214,7 +220,7 @@ class ProbeState {
     const auto kEmptyGroup = BaseHashTable::TagVector::broadcast(kEmptyTag);
     for (;;) {
       if (!hits_) {
-        const uint16_t empty = simd::toBitMask(tagsInTable_ == kEmptyGroup);
+        const uint16_t empty = BaseHashTable::compareTags(tagsInTable_, kEmptyGroup);
         if (empty) {
           return nullptr;
         }
@@ -230,7 +236,7 @@ class ProbeState {
       bucketOffset_ = table.nextBucketOffset(bucketOffset_);
       tagsInTable_ = BaseHashTable::loadTags(
           reinterpret_cast<uint8_t*>(table.table_), bucketOffset_);
-      hits_ = simd::toBitMask(tagsInTable_ == wantedTags_) & kFullMask;
+      hits_ = BaseHashTable::compareTags(tagsInTable_, wantedTags_) & kFullMask;
     }
   }
 
@@ -253,7 +259,7 @@ class ProbeState {
   void eraseHit(Table& table, int64_t& numTombstones) {
     const auto kEmptyGroup = BaseHashTable::TagVector::broadcast(kEmptyTag);
     const bool hasEmptyGroup =
-        simd::toBitMask(tagsInTable_ == kEmptyGroup) != 0;
+        BaseHashTable::compareTags(tagsInTable_, kEmptyGroup) != 0;
 
     table.bucketAt(bucketOffset_)
         ->setTag(indexInTags_, hasEmptyGroup ? 0 : kTombstoneTag);
@@ -440,6 +446,9 @@ void HashTable<ignoreNullKeys>::groupProbe(HashLookup& lookup) {
     groupNormalizedKeyProbe(lookup);
     return;
   }
+  if (UNLIKELY(oldTable_ != nullptr)) {
+    migrateForProbe(lookup);
+  }
   ProbeState state1;
   ProbeState state2;
   ProbeState state3;
@@ -477,6 +486,9 @@ void HashTable<ignoreNullKeys>::groupProbe(HashLookup& lookup) {
 
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::groupNormalizedKeyProbe(HashLookup& lookup) {
+  if (UNLIKELY(oldTable_ != nullptr)) {
+    migrateForProbe(lookup);
+  }
   ProbeState state1;
   ProbeState state2;
   ProbeState state3;
@@ -703,6 +715,7 @@ void HashTable<ignoreNullKeys>::allocateTables(uint64_t size) {
 
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::clear() {
+  abandonIncrementalResize();
   rows_->clear();
   if (table_) {
     // All modes have 8 bytes per slot.
@@ -740,12 +753,152 @@ void HashTable<ignoreNullKeys>::checkSize(
     // then the table lookup will become slow. Given that, we treat tombstone
     // slot as non-empty slot here to decide whether to trigger rehash or not.
   } else if (newNumDistincts > rehashSize()) {
+    // A pending incremental resize must complete before the table can grow
+    // again.
+    finishIncrementalResize();
     // NOTE: we need to plus one here as number itself could be power of two.
     const auto newCapacity = bits::nextPowerOfTwo(
         std::max(newNumDistincts, capacity_ - numTombstones_) + 1);
-    allocateTables(newCapacity);
-    rehash(initNormalizedKeys);
+    if (canResizeIncrementally(initNormalizedKeys)) {
+      beginIncrementalResize(newCapacity);
+    } else {
+      allocateTables(newCapacity);
+      rehash(initNormalizedKeys);
+    }
+  }
+}
+
+template <bool ignoreNullKeys>
+bool HashTable<ignoreNullKeys>::canResizeIncrementally(
+    bool initNormalizedKeys) const {
+  // Joins build the table once at the end, tombstones would make the frozen
+  // probe chains of the old table unreliable and kArray tables are resized
+  // by changing hash mode. Small tables rehash fast enough that dual tables
+  // are not worth the bookkeeping.
+  return !isJoinBuild_ && !initNormalizedKeys && otherTables_.empty() &&
+      numTombstones_ == 0 &&
+      (hashMode_ == HashMode::kNormalizedKey ||
+       hashMode_ == HashMode::kHash) &&
+      capacity_ >= minIncrementalResizeEntries_;
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::beginIncrementalResize(uint64_t newCapacity) {
+  VELOX_CHECK_NULL(oldTable_);
+  VELOX_CHECK_EQ(numTombstones_, 0);
+  oldTableAllocation_ = std::move(tableAllocation_);
+  oldTable_ = table_;
+  oldSizeMask_ = sizeMask_;
+  oldBucketOffsetMask_ = bucketOffsetMask_;
+  numOldBuckets_ = (oldSizeMask_ + 1) / kBucketSize;
+  numMigratedBuckets_ = 0;
+  migrationCursor_ = 0;
+  migratedBuckets_.resize(bits::nwords(numOldBuckets_));
+  std::fill(migratedBuckets_.begin(), migratedBuckets_.end(), 0);
+  migrationHashes_.resize(sizeof(TagVector));
+  allocateTables(newCapacity);
+  ++numRehashes_;
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::migrateBucket(int64_t oldOffset) {
+  const auto bucketIndex = oldOffset / kBucketSize;
+  if (bits::isBitSet(migratedBuckets_.data(), bucketIndex)) {
+    return;
+  }
+  bits::setBit(migratedBuckets_.data(), bucketIndex);
+  ++numMigratedBuckets_;
+  auto* bucket =
+      reinterpret_cast<Bucket*>(reinterpret_cast<char*>(oldTable_) + oldOffset);
+  char* groups[sizeof(TagVector)];
+  int32_t numGroups = 0;
+  for (auto i = 0; i < sizeof(TagVector); ++i) {
+    if (bucket->tagAt(i) != ProbeState::kEmptyTag) {
+      groups[numGroups++] = bucket->pointerAt(i);
+    }
+  }
+  if (numGroups == 0) {
+    return;
+  }
+  // Rederives the hashes from the stored normalized keys or recomputes them
+  // from the key columns. This cannot fail since value id mapping is not
+  // involved in either mode.
+  VELOX_CHECK(hashRows(
+      folly::Range<char**>(groups, numGroups), false, migrationHashes_));
+  insertForGroupBy(groups, migrationHashes_.data(), numGroups);
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::ensureProbeChainMigrated(uint64_t hash) {
+  const auto kEmptyGroup =
+      BaseHashTable::TagVector::broadcast(ProbeState::kEmptyTag);
+  auto offset = hash & oldBucketOffsetMask_;
+  for (;;) {
+    migrateBucket(offset);
+    // A probe of the frozen old table would have stopped at the first bucket
+    // with an empty slot, so the chain of buckets that could hold the key
+    // ends there.
+    const auto tags =
+        BaseHashTable::loadTags(reinterpret_cast<uint8_t*>(oldTable_), offset);
+    if (BaseHashTable::compareTags(tags, kEmptyGroup) & ProbeState::kFullMask) {
+      return;
+    }
+    offset = oldSizeMask_ & (offset + kBucketSize);
+  }
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::migrateForProbe(HashLookup& lookup) {
+  for (auto row : lookup.rows) {
+    ensureProbeChainMigrated(lookup.hashes[row]);
+  }
+  // Additionally migrate a quota of sequential buckets, paced so that the
+  // migration completes no later than the new table reaching its rehash
+  // limit even if every probed row made a new group.
+  constexpr int64_t kMinMigrationQuota = 64;
+  const int64_t freeBeforeRehash =
+      std::max<int64_t>(1, rehashSize() - numDistinct_);
+  const int64_t numLeft = numOldBuckets_ - numMigratedBuckets_;
+  int64_t quota = std::max<int64_t>(
+      kMinMigrationQuota,
+      numLeft * static_cast<int64_t>(lookup.rows.size()) / freeBeforeRehash);
+  while (quota > 0 && migrationCursor_ <= oldSizeMask_) {
+    if (!bits::isBitSet(
+            migratedBuckets_.data(), migrationCursor_ / kBucketSize)) {
+      migrateBucket(migrationCursor_);
+      --quota;
+    }
+    migrationCursor_ += kBucketSize;
+  }
+  if (numMigratedBuckets_ == numOldBuckets_) {
+    abandonIncrementalResize();
+  }
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::finishIncrementalResize() {
+  if (oldTable_ == nullptr) {
+    return;
+  }
+  for (int64_t offset = 0; offset <= oldSizeMask_; offset += kBucketSize) {
+    migrateBucket(offset);
+  }
+  abandonIncrementalResize();
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::abandonIncrementalResize() {
+  if (oldTable_ == nullptr) {
+    return;
   }
+  rows_->pool()->freeContiguous(oldTableAllocation_);
+  oldTable_ = nullptr;
+  oldSizeMask_ = 0;
+  oldBucketOffsetMask_ = 0;
+  numOldBuckets_ = 0;
+  numMigratedBuckets_ = 0;
+  migrationCursor_ = 0;
+  migratedBuckets_.clear();
 }
 
 template <bool ignoreNullKeys>
@@ -1178,8 +1331,57 @@ void HashTable<ignoreNullKeys>::insertForJoin(
     return;
   }
 
+  // Interleave 4 probes like groupProbe so the bucket loads of one insert
+  // overlap the compares of the others. Inserts modify the table, so all but
+  // the first probe of a group re-load their tags via 'extraCheck'.
   ProbeState state1;
-  for (auto i = 0; i < numGroups; ++i) {
+  ProbeState state2;
+  ProbeState state3;
+  ProbeState state4;
+  int32_t i = 0;
+  for (; i + 4 <= numGroups; i += 4) {
+    state1.preProbe(*this, hashes[i], i);
+    state2.preProbe(*this, hashes[i + 1], i + 1);
+    state3.preProbe(*this, hashes[i + 2], i + 2);
+    state4.preProbe(*this, hashes[i + 3], i + 3);
+    state1.firstProbe<ProbeState::Operation::kInsert>(*this, 0);
+    state2.firstProbe<ProbeState::Operation::kInsert>(*this, 0);
+    state3.firstProbe<ProbeState::Operation::kInsert>(*this, 0);
+    state4.firstProbe<ProbeState::Operation::kInsert>(*this, 0);
+    buildFullProbe(
+        state1,
+        hashes[i],
+        groups[i],
+        i,
+        partitionBegin,
+        partitionEnd,
+        overflow);
+    buildFullProbe(
+        state2,
+        hashes[i + 1],
+        groups[i + 1],
+        true,
+        partitionBegin,
+        partitionEnd,
+        overflow);
+    buildFullProbe(
+        state3,
+        hashes[i + 2],
+        groups[i + 2],
+        true,
+        partitionBegin,
+        partitionEnd,
+        overflow);
+    buildFullProbe(
+        state4,
+        hashes[i + 3],
+        groups[i + 3],
+        true,
+        partitionBegin,
+        partitionEnd,
+        overflow);
+  }
+  for (; i < numGroups; ++i) {
     state1.preProbe(*this, hashes[i], i);
     state1.firstProbe(*this, 0);
 
@@ -1196,6 +1398,9 @@ void HashTable<ignoreNullKeys>::insertForJoin(
 
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::rehash(bool initNormalizedKeys) {
+  // A full rebuild reinserts every row from the row containers, which
+  // supersedes any in-progress incremental resize.
+  abandonIncrementalResize();
   ++numRehashes_;
   constexpr int32_t kHashBatchSize = 1024;
   if (canApplyParallelJoinBuild()) {
@@ -1810,6 +2015,8 @@ template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::eraseWithHashes(
     folly::Range<char**> rows,
     uint64_t* hashes) {
+  // Erase probes must be able to find every row in 'table_'.
+  finishIncrementalResize();
   auto numRows = rows.size();
   if (hashMode_ == HashMode::kArray) {
     for (auto i = 0; i < numRows; ++i) {
@@ -1854,12 +2061,42 @@ void HashTable<ignoreNullKeys>::eraseWithHashes(
   }
 }
 
+template <bool ignoreNullKeys>
+int64_t HashTable<ignoreNullKeys>::compact() {
+  VELOX_CHECK(
+      otherTables_.empty(),
+      "Cannot compact a hash table with multiple row containers");
+  if (rows_->numFreeRows() == 0) {
+    return 0;
+  }
+  const auto released = rows_->compact();
+  if (table_ != nullptr) {
+    // All row addresses may have changed. An in-progress incremental resize
+    // refers to the old addresses, so drop it, then clear the table,
+    // including any tombstones left by erase(), and reinsert the relocated
+    // rows. Normalized keys moved with the rows, so they need not be
+    // recomputed.
+    abandonIncrementalResize();
+    memset(table_, 0, capacity_ * sizeof(char*));
+    numTombstones_ = 0;
+    if (numDistinct_ > 0) {
+      rehash(false);
+    }
+  }
+  return released;
+}
+
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::checkConsistency() const {
   VELOX_CHECK_GE(capacity_, numDistinct_);
   if (hashMode_ == BaseHashTable::HashMode::kArray) {
     return;
   }
+  if (oldTable_ != nullptr) {
+    // During an incremental resize the entries are split between the old and
+    // the new table, so the slot counts of 'table_' alone say nothing.
+    return;
+  }
   uint64_t numEmpty = 0;
   uint64_t numTombstone = 0;
   for (auto start = 0; start < sizeMask_; start += kBucketSize) {
@@ -245,6 +245,13 @@ class BaseHashTable {
   // and be unique.
   virtual void erase(folly::Range<char**> rows) = 0;
 
+  /// Compacts the RowContainer to reclaim the space of rows freed by erase()
+  /// and rebuilds the table entries from the relocated rows. Invalidates all
+  /// previously returned row pointers. Only supported for tables with a
+  /// single row container, e.g. group by tables. Returns the number of bytes
+  /// released to the memory pool.
+  virtual int64_t compact() = 0;
+
   /// Returns a brief description for use in debugging.
   virtual std::string toString() = 0;
 
@@ -290,6 +297,18 @@ class BaseHashTable {
 #endif
   }
 
+  /// Compares a vector of tags to 16 copies of a wanted tag and returns a
+  /// bitmask with a bit set for each match. With AVX-512BW the compare
+  /// produces the mask register directly, saving the separate movemask of
+  /// the SSE2 path.
+  static MaskType compareTags(TagVector tags, TagVector wantedTags) {
+#if XSIMD_WITH_AVX512BW
+    return _mm_cmpeq_epu8_mask(tags, wantedTags);
+#else
+    return simd::toBitMask(tags == wantedTags);
+#endif
+  }
+
   const CpuWallTiming& offThreadBuildTiming() const {
     return offThreadBuildTiming_;
   }
@@ -412,8 +431,10 @@ class HashTable : public BaseHashTable {
 
   int64_t allocatedBytes() const override {
     // For each row: sizeof(char*) per table entry + memory
-    // allocated with MemoryAllocator for fixed-width rows and strings.
-    return sizeof(char*) * capacity_ + rows_->allocatedBytes();
+    // allocated with MemoryAllocator for fixed-width rows and strings. The
+    // old table of an in-progress incremental resize counts as well.
+    return sizeof(char*) * capacity_ + oldTableAllocation_.size() +
+        rows_->allocatedBytes();
   }
 
   HashStringAllocator* stringAllocator() override {
@@ -446,6 +467,8 @@ class HashTable : public BaseHashTable {
 
   void erase(folly::Range<char**> rows) override;
 
+  int64_t compact() override;
+
   // Moves the contents of 'tables' into 'this' and prepares 'this'
   // for use in hash join probe. A hash join build side is prepared as
   // follows: 1. Each build side thread gets a random selection of the
@@ -500,6 +523,18 @@ class HashTable : public BaseHashTable {
     setHashMode(mode, numNew);
   }
 
+  /// Lowers the table size above which a group by resize proceeds
+  /// incrementally. Used by tests to exercise incremental resize without
+  /// building very large tables.
+  void testingSetMinIncrementalResizeEntries(uint64_t numEntries) {
+    minIncrementalResizeEntries_ = numEntries;
+  }
+
+  /// Returns true if an incremental resize is in progress.
+  bool testingHasPendingResize() const {
+    return oldTable_ != nullptr;
+  }
+
   auto& testingOtherTables() const {
     return otherTables_;
   }
@@ -634,6 +669,44 @@ class HashTable : public BaseHashTable {
   // from this, without recomputing the normalized key.
   void checkSize(int32_t numNew, bool initNormalizedKeys);
 
+  // Returns true if a resize triggered by checkSize() can proceed
+  // incrementally: group by table in kNormalizedKey or kHash mode with no
+  // tombstones, large enough for the stop-the-world rehash to cause a
+  // noticeable stall.
+  bool canResizeIncrementally(bool initNormalizedKeys) const;
+
+  // Starts an incremental resize to 'newCapacity'. The current table is kept
+  // as a frozen migration source and its buckets are moved into the new
+  // table a few at a time from groupProbe(), so no single input batch pays
+  // the whole rehash cost. The hash of a migrated row is rederived from the
+  // stored normalized key or recomputed from the keys one bucket at a time.
+  void beginIncrementalResize(uint64_t newCapacity);
+
+  // Migrates the old table bucket at byte offset 'oldOffset' into 'table_'
+  // if it has not been migrated yet.
+  void migrateBucket(int64_t oldOffset);
+
+  // Migrates all old table buckets a key hashing to 'hash' could reside in:
+  // the probe sequence from the hash's bucket up to and including the first
+  // bucket with an empty slot. After this the key, if present, is findable
+  // in 'table_'.
+  void ensureProbeChainMigrated(uint64_t hash);
+
+  // Migrates the probe chains of all rows in 'lookup' plus a quota of
+  // sequential buckets paced to complete the migration before 'table_'
+  // reaches its rehash limit. Frees the old table once all buckets have been
+  // migrated.
+  void migrateForProbe(HashLookup& lookup);
+
+  // Completes an in-progress incremental resize by migrating all remaining
+  // buckets. No-op if none is in progress.
+  void finishIncrementalResize();
+
+  // Drops incremental resize state without migrating. Called when the table
+  // is rebuilt from the row container or cleared, which supersedes any
+  // pending migration.
+  void abandonIncrementalResize();
+
   // Computes hash numbers of the appropriate hash mode for 'groups',
   // stores these in 'hashes' and inserts the groups using
   // insertForJoin or insertForGroupBy.
@@ -879,6 +952,31 @@ class HashTable : public BaseHashTable {
   //  Counts parallel build rows. Used for consistency check.
   std::atomic<int64_t> numParallelBuildRows_{0};
 
+  // The min number of table slots above which a group by resize proceeds
+  // incrementally instead of with a stop-the-world rehash.
+  uint64_t minIncrementalResizeEntries_ = 2UL << 20;
+
+  // State of an in-progress incremental resize. 'oldTable_' is non-null
+  // while buckets are still being migrated into 'table_'. The old table is
+  // frozen: new groups go to 'table_' only and migration just clears
+  // ownership, so its tags remain valid for chain termination checks.
+  memory::ContiguousAllocation oldTableAllocation_;
+  char** oldTable_{nullptr};
+  int64_t oldSizeMask_{0};
+  int64_t oldBucketOffsetMask_{0};
+  int64_t numOldBuckets_{0};
+  int64_t numMigratedBuckets_{0};
+
+  // Byte offset into the old table up to which the sequential migration
+  // quota has advanced.
+  int64_t migrationCursor_{0};
+
+  // One bit per old table bucket, set once the bucket has been migrated.
+  raw_vector<uint64_t> migratedBuckets_;
+
+  // Scratch for hashes of the rows of one bucket being migrated.
+  raw_vector<uint64_t> migrationHashes_;
+
   // If true, avoids using VectorHasher value ranges with kArray hash mode.
   bool disableRangeArrayHash_{false};
 };
@@ -29,27 +29,32 @@ void notify(std::vector<ContinuePromise>& promises) {
 bool LocalExchangeMemoryManager::increaseMemoryUsage(
     ContinueFuture* future,
     int64_t added) {
-  std::lock_guard<std::mutex> l(mutex_);
-  bufferedBytes_ += added;
-
-  if (bufferedBytes_ >= maxBufferSize_) {
-    promises_.emplace_back("LocalExchangeMemoryManager::updateMemoryUsage");
-    *future = promises_.back().getSemiFuture();
-    return true;
+  if (bufferedBytes_.fetch_add(added) + added < maxBufferSize_) {
+    return false;
   }
 
-  return false;
+  std::lock_guard<std::mutex> l(mutex_);
+  // Re-check under the mutex. A consumer may have brought the usage below the
+  // limit in the meantime, in which case its sweep of 'promises_' may already
+  // have run and the producer must not block.
+  if (bufferedBytes_ < maxBufferSize_) {
+    return false;
+  }
+  promises_.emplace_back("LocalExchangeMemoryManager::updateMemoryUsage");
+  *future = promises_.back().getSemiFuture();
+  hasBlockedProducers_ = true;
+  return true;
 }
 
 std::vector<ContinuePromise> LocalExchangeMemoryManager::decreaseMemoryUsage(
     int64_t removed) {
   std::vector<ContinuePromise> promises;
-  {
+  if (bufferedBytes_.fetch_sub(removed) - removed < maxBufferSize_ &&
+      hasBlockedProducers_) {
     std::lock_guard<std::mutex> l(mutex_);
-    bufferedBytes_ -= removed;
-
     if (bufferedBytes_ < maxBufferSize_) {
       promises = std::move(promises_);
+      hasBlockedProducers_ = false;
     }
   }
   return promises;
@@ -80,23 +85,24 @@ BlockingReason LocalExchangeQueue::enqueue(
     ContinueFuture* future) {
   auto inputBytes = input->estimateFlatSize();
 
+  // Account the memory before publishing the data so that the accounting and
+  // the queue mutex are never held at the same time.
+  const bool blockedOnConsumer =
+      memoryManager_->increaseMemoryUsage(future, inputBytes);
+
   std::vector<ContinuePromise> consumerPromises;
-  bool blockedOnConsumer = false;
   bool isClosed = queue_.withWLock([&](auto& queue) {
     if (closed_) {
       return true;
     }
     queue.push(std::move(input));
     consumerPromises = std::move(consumerPromises_);
-
-    if (memoryManager_->increaseMemoryUsage(future, inputBytes)) {
-      blockedOnConsumer = true;
-    }
-
     return false;
   });
 
   if (isClosed) {
+    // The data was never added to the queue; give back its memory.
+    notify(memoryManager_->decreaseMemoryUsage(inputBytes));
     return BlockingReason::kNotBlocked;
   }
 
@@ -125,7 +131,6 @@ BlockingReason LocalExchangeQueue::next(
     ContinueFuture* future,
     memory::MemoryPool* pool,
     RowVectorPtr* data) {
-  std::vector<ContinuePromise> memoryPromises;
   auto blockingReason = queue_.withWLock([&](auto& queue) {
     *data = nullptr;
     if (queue.empty()) {
@@ -139,15 +144,16 @@ BlockingReason LocalExchangeQueue::next(
       return BlockingReason::kWaitForProducer;
     }
 
-    *data = queue.front();
+    *data = std::move(queue.front());
     queue.pop();
 
-    memoryPromises =
-        memoryManager_->decreaseMemoryUsage((*data)->estimateFlatSize());
-
     return BlockingReason::kNotBlocked;
   });
-  notify(memoryPromises);
+  if (*data != nullptr) {
+    // Release the memory outside of the queue mutex. Unblocking producers is
+    // rare: it only happens when the usage drops below the limit.
+    notify(memoryManager_->decreaseMemoryUsage((*data)->estimateFlatSize()));
+  }
   return blockingReason;
 }
 
@@ -170,23 +176,20 @@ bool LocalExchangeQueue::isFinished() {
 
 void LocalExchangeQueue::close() {
   std::vector<ContinuePromise> consumerPromises;
-  std::vector<ContinuePromise> memoryPromises;
+  uint64_t freedBytes = 0;
   queue_.withWLock([&](auto& queue) {
-    uint64_t freedBytes = 0;
     while (!queue.empty()) {
       freedBytes += queue.front()->estimateFlatSize();
       queue.pop();
     }
 
-    if (freedBytes) {
-      memoryPromises = memoryManager_->decreaseMemoryUsage(freedBytes);
-    }
-
     consumerPromises = std::move(consumerPromises_);
     closed_ = true;
   });
   notify(consumerPromises);
-  notify(memoryPromises);
+  if (freedBytes) {
+    notify(memoryManager_->decreaseMemoryUsage(freedBytes));
+  }
 }
 
 LocalExchange::LocalExchange(
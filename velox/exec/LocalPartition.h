@@ -38,8 +38,11 @@ class LocalExchangeMemoryManager {
 
  private:
   const int64_t maxBufferSize_;
+  std::atomic<int64_t> bufferedBytes_{0};
+  // True if 'promises_' may be non-empty. Lets decreaseMemoryUsage() skip the
+  // mutex when no producer is blocked, which is the common case.
+  std::atomic<bool> hasBlockedProducers_{false};
   std::mutex mutex_;
-  int64_t bufferedBytes_{0};
   std::vector<ContinuePromise> promises_;
 };
 
@@ -49,6 +49,20 @@ namespace facebook::velox::exec {
 
 namespace detail {
 
+/// Returns true if 'aggregationNode' has aggregates that require their inputs
+/// to be sorted. StreamingAggregation doesn't support these, so such
+/// aggregations run through HashAggregation which streams output at
+/// pre-grouped key boundaries.
+bool hasSortedAggregations(
+    const std::shared_ptr<const core::AggregationNode>& aggregationNode) {
+  for (const auto& aggregate : aggregationNode->aggregates()) {
+    if (!aggregate.sortingKeys.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /// Returns true if source nodes must run in a separate pipeline.
 bool mustStartNewPipeline(
     std::shared_ptr<const core::PlanNode> planNode,
@@ -473,7 +487,8 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
             std::dynamic_pointer_cast<const core::AggregationNode>(planNode)) {
       if (!aggregationNode->preGroupedKeys().empty() &&
           aggregationNode->preGroupedKeys().size() ==
-              aggregationNode->groupingKeys().size()) {
+              aggregationNode->groupingKeys().size() &&
+          !detail::hasSortedAggregations(aggregationNode)) {
         operators.push_back(std::make_unique<StreamingAggregation>(
             id, ctx.get(), aggregationNode));
       } else {
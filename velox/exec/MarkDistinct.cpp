@@ -72,9 +72,10 @@ RowVectorPtr MarkDistinct::getOutput() {
     result = BaseVector::create(BOOLEAN(), outputSize, operatorCtx_->pool());
   }
 
-  // newGroups contains the indices of distinct rows.
-  // For each index in newGroups, we mark the index'th bit true in the result
-  // vector.
+  // The grouping set probes the batch through HashTable::groupProbe, so
+  // 'newGroups' holds the input indices of first occurrences computed in one
+  // vectorized pass. For each index in newGroups, we mark the index'th bit
+  // true in the result vector.
   auto resultBits =
       results_[0]->as<FlatVector<bool>>()->mutableRawValues<uint64_t>();
 
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/MemoryAdmissionController.h"
+
+#include <map>
+
+namespace facebook::velox::exec {
+
+namespace {
+void collectNodeCounts(
+    const core::PlanNode& node,
+    std::map<std::string_view, int32_t>& counts) {
+  ++counts[node.name()];
+  for (const auto& source : node.sources()) {
+    collectNodeCounts(*source, counts);
+  }
+}
+} // namespace
+
+// static
+std::string MemoryAdmissionController::planSignature(
+    const core::PlanNode& plan) {
+  std::map<std::string_view, int32_t> counts;
+  collectNodeCounts(plan, counts);
+  std::string signature;
+  for (const auto& [name, count] : counts) {
+    if (!signature.empty()) {
+      signature += ",";
+    }
+    signature += fmt::format("{}:{}", name, count);
+  }
+  return signature;
+}
+
+MemoryAdmissionController::MemoryAdmissionController(const Config& config)
+    : capacity_(config.capacity), defaultTaskMemory_(config.defaultTaskMemory) {
+  VELOX_CHECK_GT(capacity_, 0, "Admission capacity must be positive");
+}
+
+uint64_t MemoryAdmissionController::forecast(const core::PlanNode& plan) const {
+  auto signature = planSignature(plan);
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = observedPeaks_.find(signature);
+  return it == observedPeaks_.end() ? defaultTaskMemory_ : it->second;
+}
+
+std::unique_ptr<MemoryAdmissionController::Admission>
+MemoryAdmissionController::admit(
+    const core::PlanNode& plan,
+    int32_t priority,
+    ContinueFuture* future) {
+  auto signature = planSignature(plan);
+  std::lock_guard<std::mutex> l(mutex_);
+  uint64_t predicted;
+  {
+    auto it = observedPeaks_.find(signature);
+    predicted = it == observedPeaks_.end() ? defaultTaskMemory_ : it->second;
+  }
+  auto admission = std::unique_ptr<Admission>(
+      new Admission(this, std::move(signature), predicted));
+  // Admit right away if the prediction fits or nothing is running: a
+  // prediction larger than the whole capacity then runs alone instead of
+  // wedging the queue. Do not jump ahead of already queued admissions.
+  if (queue_.empty() &&
+      (admittedBytes_ + predicted <= capacity_ || numAdmitted_ == 0)) {
+    admittedBytes_ += predicted;
+    ++numAdmitted_;
+    return admission;
+  }
+  auto [promise, semiFuture] =
+      makeVeloxContinuePromiseContract("MemoryAdmissionController::admit");
+  queue_.emplace(priority, Waiter{predicted, std::move(promise)});
+  *future = std::move(semiFuture);
+  return admission;
+}
+
+void MemoryAdmissionController::releaseAdmission(
+    const std::string& signature,
+    uint64_t predictedBytes,
+    std::optional<uint64_t> observedPeakBytes) {
+  std::vector<ContinuePromise> resumes;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    VELOX_CHECK_GE(admittedBytes_, predictedBytes);
+    admittedBytes_ -= predictedBytes;
+    --numAdmitted_;
+    if (observedPeakBytes.has_value()) {
+      // Keep the largest observed peak per plan shape. This is conservative:
+      // it may under-admit but does not over-admit once the peaks of a shape
+      // have been seen.
+      auto& peak = observedPeaks_[signature];
+      peak = std::max(peak, observedPeakBytes.value());
+    }
+    // Let queued admissions in, highest priority first, as long as they fit
+    // or nothing is running.
+    while (!queue_.empty()) {
+      auto it = queue_.begin();
+      auto& waiter = it->second;
+      if (admittedBytes_ + waiter.predictedBytes > capacity_ &&
+          numAdmitted_ > 0) {
+        break;
+      }
+      admittedBytes_ += waiter.predictedBytes;
+      ++numAdmitted_;
+      resumes.push_back(std::move(waiter.promise));
+      queue_.erase(it);
+    }
+  }
+  // Realize the futures outside of the mutex in case continuations run
+  // inline.
+  for (auto& promise : resumes) {
+    promise.setValue();
+  }
+}
+
+uint64_t MemoryAdmissionController::admittedBytes() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return admittedBytes_;
+}
+
+size_t MemoryAdmissionController::numQueued() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return queue_.size();
+}
+
+MemoryAdmissionController::Admission::~Admission() {
+  if (!released_) {
+    // Destroyed without an observation, e.g. the task failed before running.
+    // Give the capacity back without recording a peak.
+    controller_->releaseAdmission(signature_, predictedBytes_, std::nullopt);
+  }
+}
+
+void MemoryAdmissionController::Admission::release(
+    uint64_t observedPeakBytes) {
+  VELOX_CHECK(!released_, "Admission has already been released");
+  released_ = true;
+  controller_->releaseAdmission(signature_, predictedBytes_, observedPeakBytes);
+}
+
+} // namespace facebook::velox::exec
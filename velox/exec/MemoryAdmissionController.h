@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include "velox/common/future/VeloxPromise.h"
+#include "velox/core/PlanNode.h"
+
+namespace facebook::velox::exec {
+
+/// Admission control in front of Task creation. Memory arbitration reacts
+/// after query memory pools hit their limits; by then the only options left
+/// are spilling and aborting. The admission controller is proactive instead:
+/// it predicts the peak memory of a task from the plan node types in its plan
+/// and the observed peaks of previously finished tasks with the same plan
+/// shape, and makes tasks wait for admission when the sum of the predictions
+/// of the running tasks would exceed the controller's capacity.
+///
+/// The query system calls admit() before creating a Task and waits for the
+/// returned future, if any, before doing so. When the task finishes, it calls
+/// Admission::release() with the task's observed peak memory (the peak of the
+/// task's root memory pool), which both refines later forecasts for the same
+/// plan shape and lets queued tasks in.
+///
+/// All methods are thread-safe.
+class MemoryAdmissionController {
+ public:
+  struct Config {
+    /// The total memory capacity in bytes the controller admits against.
+    /// This should match the capacity of the associated memory manager.
+    uint64_t capacity;
+
+    /// The predicted peak for plan shapes with no completed history yet.
+    uint64_t defaultTaskMemory{256 << 20};
+  };
+
+  /// RAII handle for an admitted task's predicted memory. The reservation is
+  /// given back via release() or, failing that, on destruction.
+  class Admission {
+   public:
+    ~Admission();
+
+    /// The predicted peak memory this admission reserved.
+    uint64_t predictedBytes() const {
+      return predictedBytes_;
+    }
+
+    /// Gives the reservation back and records 'observedPeakBytes' as the
+    /// actual peak of the finished task so that later forecasts of the same
+    /// plan shape improve. Unblocks queued admissions that now fit.
+    void release(uint64_t observedPeakBytes);
+
+   private:
+    Admission(
+        MemoryAdmissionController* controller,
+        std::string signature,
+        uint64_t predictedBytes)
+        : controller_(controller),
+          signature_(std::move(signature)),
+          predictedBytes_(predictedBytes) {}
+
+    MemoryAdmissionController* const controller_;
+    const std::string signature_;
+    const uint64_t predictedBytes_;
+    bool released_{false};
+
+    friend class MemoryAdmissionController;
+  };
+
+  explicit MemoryAdmissionController(const Config& config);
+
+  /// Requests admission for a task executing 'plan' with 'priority'. If the
+  /// predicted memory does not fit in the remaining capacity, sets '*future'
+  /// and the caller must wait for it before creating the task. Admissions
+  /// with a higher priority are admitted first, ties in arrival order. A task
+  /// whose prediction exceeds the whole capacity is admitted alone rather
+  /// than rejected, so a mispredicted shape cannot wedge the queue.
+  std::unique_ptr<Admission> admit(
+      const core::PlanNode& plan,
+      int32_t priority,
+      ContinueFuture* future);
+
+  /// Returns the predicted peak memory for 'plan': the largest observed peak
+  /// of finished tasks with the same plan shape, or the configured default if
+  /// the shape has not been seen.
+  uint64_t forecast(const core::PlanNode& plan) const;
+
+  /// The sum of the predictions of the currently admitted tasks.
+  uint64_t admittedBytes() const;
+
+  /// The number of admissions waiting in the queue.
+  size_t numQueued() const;
+
+ private:
+  // A key describing the shape of a plan: the plan node type names with
+  // multiplicities, independent of ids and expression details.
+  static std::string planSignature(const core::PlanNode& plan);
+
+  void releaseAdmission(
+      const std::string& signature,
+      uint64_t predictedBytes,
+      std::optional<uint64_t> observedPeakBytes);
+
+  struct Waiter {
+    uint64_t predictedBytes;
+    ContinuePromise promise;
+  };
+
+  const uint64_t capacity_;
+  const uint64_t defaultTaskMemory_;
+
+  mutable std::mutex mutex_;
+  // Sum of the predictions of admitted, unreleased tasks.
+  uint64_t admittedBytes_{0};
+  int64_t numAdmitted_{0};
+  // Largest observed peak per plan signature.
+  std::unordered_map<std::string, uint64_t> observedPeaks_;
+  // Waiters ordered by descending priority, arrival order within a priority.
+  std::multimap<int32_t, Waiter, std::greater<int32_t>> queue_;
+};
+
+} // namespace facebook::velox::exec
@@ -17,11 +17,99 @@
 #include "velox/exec/Merge.h"
 #include "velox/common/testutil/TestValue.h"
 #include "velox/exec/Task.h"
+#include "velox/vector/FlatVector.h"
 
 using facebook::velox::common::testutil::TestValue;
 
 namespace facebook::velox::exec {
 
+namespace {
+// Upper bound on the per-row size of the normalized binary key.
+constexpr int32_t kMaxNormalizedKeyBytes = 16;
+
+// Returns the value width of a key in the normalized encoding, 0 if the
+// type does not support normalization.
+int32_t normalizedKeyWidth(TypeKind kind) {
+  switch (kind) {
+    case TypeKind::TINYINT:
+      return 1;
+    case TypeKind::SMALLINT:
+      return 2;
+    case TypeKind::INTEGER:
+      return 4;
+    case TypeKind::BIGINT:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+// Writes the normalized encoding of 'keys' at byte 'offset' of each
+// 'stride'-sized row of 'out'. A key encodes as one null indicator byte
+// followed by the big-endian value with the sign bit flipped, so that
+// memcmp order matches the sort order: the value bytes are inverted for
+// descending keys and the null byte places nulls before or after all
+// values according to 'flags'. The encoding is lossless, equal encodings
+// mean equal keys. Returns false if 'keys' is not flat.
+template <TypeKind Kind>
+bool encodeKeyColumnTyped(
+    const BaseVector& keys,
+    const CompareFlags& flags,
+    int32_t offset,
+    int32_t stride,
+    std::vector<uint8_t>& out) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  if (keys.encoding() != VectorEncoding::Simple::FLAT) {
+    return false;
+  }
+  const auto* flat = keys.asUnchecked<FlatVector<T>>();
+  using U = std::make_unsigned_t<T>;
+  const uint8_t nullByte = flags.nullsFirst ? 0 : 2;
+  for (vector_size_t i = 0; i < keys.size(); ++i) {
+    uint8_t* row = out.data() + i * stride + offset;
+    if (flat->isNullAt(i)) {
+      row[0] = nullByte;
+      std::memset(row + 1, 0, sizeof(T));
+      continue;
+    }
+    row[0] = 1;
+    U bits = static_cast<U>(flat->valueAt(i)) ^ (U{1} << (8 * sizeof(T) - 1));
+    if (!flags.ascending) {
+      bits = ~bits;
+    }
+    for (size_t byte = 0; byte < sizeof(T); ++byte) {
+      row[1 + byte] =
+          static_cast<uint8_t>(bits >> (8 * (sizeof(T) - 1 - byte)));
+    }
+  }
+  return true;
+}
+
+bool encodeKeyColumn(
+    const BaseVector& keys,
+    const CompareFlags& flags,
+    int32_t offset,
+    int32_t stride,
+    std::vector<uint8_t>& out) {
+  switch (keys.typeKind()) {
+    case TypeKind::TINYINT:
+      return encodeKeyColumnTyped<TypeKind::TINYINT>(
+          keys, flags, offset, stride, out);
+    case TypeKind::SMALLINT:
+      return encodeKeyColumnTyped<TypeKind::SMALLINT>(
+          keys, flags, offset, stride, out);
+    case TypeKind::INTEGER:
+      return encodeKeyColumnTyped<TypeKind::INTEGER>(
+          keys, flags, offset, stride, out);
+    case TypeKind::BIGINT:
+      return encodeKeyColumnTyped<TypeKind::BIGINT>(
+          keys, flags, offset, stride, out);
+    default:
+      return false;
+  }
+}
+} // namespace
+
 Merge::Merge(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -189,7 +277,24 @@ void Merge::close() {
 
 bool SourceStream::operator<(const MergeStream& other) const {
   const auto& otherCursor = static_cast<const SourceStream&>(other);
-  for (auto i = 0; i < sortingKeys_.size(); ++i) {
+  size_t startKey = 0;
+  if (hasKeyPrefixes_ && otherCursor.hasKeyPrefixes_) {
+    const auto* left =
+        keyPrefixes_.data() + currentSourceRow_ * normalizedKeySize_;
+    const auto* right = otherCursor.keyPrefixes_.data() +
+        otherCursor.currentSourceRow_ * normalizedKeySize_;
+    if (auto result = ::memcmp(left, right, normalizedKeySize_)) {
+      return result < 0;
+    }
+    if (numNormalizedKeys_ == static_cast<int32_t>(sortingKeys_.size())) {
+      // The encoding is lossless, equal normalized keys mean equal rows.
+      return false;
+    }
+    // Equal normalized keys mean the first 'numNormalizedKeys_' keys are
+    // equal; compare the remaining keys only.
+    startKey = numNormalizedKeys_;
+  }
+  for (auto i = startKey; i < sortingKeys_.size(); ++i) {
     const auto& [_, compareFlags] = sortingKeys_[i];
     VELOX_DCHECK(
         compareFlags.nullHandlingMode == CompareFlags::NullHandlingMode::NoStop,
@@ -264,10 +369,47 @@ bool SourceStream::fetchMoreData(std::vector<ContinueFuture>& futures) {
     for (const auto& key : sortingKeys_) {
       keyColumns_.push_back(data_->childAt(key.first).get());
     }
+    fillKeyPrefixes();
   }
   return false;
 }
 
+void SourceStream::fillKeyPrefixes() {
+  if (numNormalizedKeys_ < 0) {
+    // Decide once how many leading keys fit the normalized encoding. Key
+    // types are the same for all batches and all streams of the merge.
+    numNormalizedKeys_ = 0;
+    normalizedKeySize_ = 0;
+    for (const auto* key : keyColumns_) {
+      const auto width = normalizedKeyWidth(key->typeKind());
+      if (width == 0 ||
+          normalizedKeySize_ + 1 + width > kMaxNormalizedKeyBytes) {
+        break;
+      }
+      normalizedKeySize_ += 1 + width;
+      ++numNormalizedKeys_;
+    }
+  }
+  hasKeyPrefixes_ = numNormalizedKeys_ > 0;
+  if (!hasKeyPrefixes_) {
+    return;
+  }
+  keyPrefixes_.resize(data_->size() * normalizedKeySize_);
+  int32_t offset = 0;
+  for (auto i = 0; i < numNormalizedKeys_; ++i) {
+    if (!encodeKeyColumn(
+            *keyColumns_[i],
+            sortingKeys_[i].second,
+            offset,
+            normalizedKeySize_,
+            keyPrefixes_)) {
+      hasKeyPrefixes_ = false;
+      return;
+    }
+    offset += 1 + normalizedKeyWidth(keyColumns_[i]->typeKind());
+  }
+}
+
 LocalMerge::LocalMerge(
     int32_t operatorId,
     DriverCtx* driverCtx,
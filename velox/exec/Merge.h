@@ -136,6 +136,12 @@ class SourceStream final : public MergeStream {
  private:
   bool fetchMoreData(std::vector<ContinueFuture>& futures);
 
+  // Computes normalized binary keys for all rows in 'data_': the leading
+  // fixed-width sort keys encoded so that memcmp order matches the sort
+  // order. Sets 'hasKeyPrefixes_' if at least the leading key type supports
+  // the encoding.
+  void fillKeyPrefixes();
+
   MergeSource* source_;
 
   const std::vector<std::pair<column_index_t, CompareFlags>>& sortingKeys_;
@@ -147,6 +153,22 @@ class SourceStream final : public MergeStream {
   /// order as 'sortingKeys_'.
   std::vector<BaseVector*> keyColumns_;
 
+  /// Normalized binary keys, 'normalizedKeySize_' bytes per row of 'data_'.
+  /// Valid only if 'hasKeyPrefixes_' is true. Used to decide comparisons in
+  /// operator< with one memcmp instead of virtual per-column compares. If
+  /// the encoding covers all sort keys, equal normalized keys settle the
+  /// comparison without falling back at all.
+  std::vector<uint8_t> keyPrefixes_;
+
+  /// Number of leading sort keys covered by the normalized encoding and the
+  /// per-row encoding size in bytes. Computed from the key types on the
+  /// first batch; -1 until then.
+  int32_t numNormalizedKeys_{-1};
+  int32_t normalizedKeySize_{0};
+
+  /// True if 'keyPrefixes_' is populated for the current 'data_'.
+  bool hasKeyPrefixes_{false};
+
   /// Index of the current row.
   vector_size_t currentSourceRow_{0};
 
@@ -457,12 +457,25 @@ RowVectorPtr NestedLoopJoinProbe::doMatch(vector_size_t probeCnt) {
   auto* probeIndices = probeIndices_->asMutable<vector_size_t>();
   auto* buildIndices = buildIndices_->asMutable<vector_size_t>();
   int32_t numOutputRows{0};
-  for (auto i = 0; i < maxOutputRows; ++i) {
-    if (!decodedFilterResult.isNullAt(i) &&
-        decodedFilterResult.valueAt<bool>(i)) {
-      rawProbeOutMapping[numOutputRows] = probeIndices[i];
-      rawBuildOutMapping[numOutputRows] = buildIndices[i];
-      ++numOutputRows;
+  if (decodedFilterResult.isIdentityMapping() &&
+      !decodedFilterResult.mayHaveNulls()) {
+    // Flat filter result without nulls, e.g. from a range condition over
+    // numeric columns. Walk the set bits of the result bitmap directly, which
+    // skips over words of all-false rows.
+    bits::forEachSetBit(
+        decodedFilterResult.data<uint64_t>(), 0, maxOutputRows, [&](auto i) {
+          rawProbeOutMapping[numOutputRows] = probeIndices[i];
+          rawBuildOutMapping[numOutputRows] = buildIndices[i];
+          ++numOutputRows;
+        });
+  } else {
+    for (auto i = 0; i < maxOutputRows; ++i) {
+      if (!decodedFilterResult.isNullAt(i) &&
+          decodedFilterResult.valueAt<bool>(i)) {
+        rawProbeOutMapping[numOutputRows] = probeIndices[i];
+        rawBuildOutMapping[numOutputRows] = buildIndices[i];
+        ++numOutputRows;
+      }
     }
   }
   if (needsProbeMismatch(joinType_)) {
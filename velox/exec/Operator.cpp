@@ -62,7 +62,9 @@ OperatorCtx::createConnectorQueryCtx(
       driverCtx_->task->queryCtx()->queryId(),
       taskId(),
       planNodeId,
-      driverCtx_->driverId);
+      driverCtx_->driverId,
+      io::ioSchedulingClassFromName(
+          driverCtx_->queryConfig().scanIoSchedulingClass()));
 }
 
 Operator::Operator(
@@ -83,7 +85,18 @@ Operator::Operator(
           operatorId,
           driverCtx->pipelineId,
           std::move(planNodeId),
-          std::move(operatorType)}) {}
+          std::move(operatorType)}),
+      inputCapture_(OperatorInputCapture::createIfEnabled()) {}
+
+void Operator::dumpCapturedInput() {
+  if (inputCapture_ == nullptr) {
+    return;
+  }
+  const auto& task = operatorCtx_->task();
+  inputCapture_->dump(
+      fmt::format("{}.{}.{}", task->taskId(), operatorType(), planNodeId()),
+      task->planFragment().planNode->toString(true, true));
+}
 
 void Operator::maybeSetReclaimer() {
   VELOX_CHECK_NULL(pool()->reclaimer());
@@ -224,12 +237,21 @@ RowVectorPtr Operator::fillOutput(
       size,
       wrapResults ? mapping : nullptr);
 
-  return std::make_shared<RowVector>(
-      operatorCtx_->pool(),
-      outputType_,
-      nullptr,
-      size,
-      std::move(projectedChildren));
+  // Reuse the previous output vector if the consumer no longer references it
+  // and it has not acquired nulls.
+  if (lastFillOutput_ && lastFillOutput_.use_count() == 1 &&
+      lastFillOutput_->nulls() == nullptr) {
+    lastFillOutput_->unsafeResize(size);
+    lastFillOutput_->children() = std::move(projectedChildren);
+  } else {
+    lastFillOutput_ = std::make_shared<RowVector>(
+        operatorCtx_->pool(),
+        outputType_,
+        nullptr,
+        size,
+        std::move(projectedChildren));
+  }
+  return lastFillOutput_;
 }
 
 RowVectorPtr Operator::fillOutput(
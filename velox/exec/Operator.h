@@ -20,6 +20,7 @@
 #include "velox/core/PlanNode.h"
 #include "velox/exec/Driver.h"
 #include "velox/exec/JoinBridge.h"
+#include "velox/exec/OperatorInputCapture.h"
 #include "velox/exec/Spiller.h"
 #include "velox/type/Filter.h"
 
@@ -415,10 +416,24 @@ class Operator : public BaseRuntimeStatWriter {
   virtual void close() {
     input_ = nullptr;
     results_.clear();
+    lastFillOutput_ = nullptr;
     // Release the unused memory reservation on close.
     operatorCtx_->pool()->release();
   }
 
+  /// Records 'input' in the capture ring buffer if input capture is enabled.
+  /// Called by the Driver right before addInput().
+  void maybeCaptureInput(const RowVectorPtr& input) {
+    if (FOLLY_UNLIKELY(inputCapture_ != nullptr)) {
+      inputCapture_->append(input);
+    }
+  }
+
+  /// Writes the captured input batches and the task's plan fragment to disk.
+  /// Called by the Driver before close() when the task has failed. No-op if
+  /// input capture is disabled or no batches were captured.
+  void dumpCapturedInput();
+
   /// Invoked by memory arbitrator to free up operator's resource immediately on
   /// memory abort, and the query will stop running after this call.
   ///
@@ -707,6 +722,11 @@ class Operator : public BaseRuntimeStatWriter {
   /// Maps between index in results_ and index in output RowVector.
   std::vector<IdentityProjection> resultProjections_;
 
+  /// The last output vector returned by fillOutput. Reused for the next output
+  /// batch once the consumer has dropped its reference, so that steady-state
+  /// pipelines do not allocate a new row vector per batch.
+  RowVectorPtr lastFillOutput_;
+
   /// True if the input and output rows have exactly the same fields, i.e. one
   /// could copy directly from input to output if no cardinality change.
   bool isIdentityProjection_ = false;
@@ -716,6 +736,10 @@ class Operator : public BaseRuntimeStatWriter {
 
   /// The number of times that spilling run on this operator.
   uint32_t numSpillRuns_{0};
+
+  /// Ring buffer of recent input batches. Non-null only when input capture is
+  /// enabled by the flags, see OperatorInputCapture.
+  std::unique_ptr<OperatorInputCapture> inputCapture_;
 };
 
 /// Given a row type returns indices for the specified subset of columns.
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/OperatorInputCapture.h"
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <sstream>
+
+#include "velox/common/base/Fs.h"
+#include "velox/vector/VectorSaver.h"
+
+DEFINE_int64(
+    velox_experimental_operator_input_capture_bytes,
+    0,
+    "This is an experimental flag only to be used for debugging purposes. "
+    "If non-zero, each operator keeps a ring buffer of its most recent "
+    "input batches serialized with VectorSaver, bounded to this many bytes. "
+    "When the task fails, the buffered batches and the plan fragment are "
+    "written to the directory given by "
+    "'velox_experimental_operator_input_capture_path' so the failing "
+    "workload can be replayed offline.");
+
+DEFINE_string(
+    velox_experimental_operator_input_capture_path,
+    "",
+    "Directory to write captured operator input batches and the plan "
+    "fragment to when a task fails and "
+    "'velox_experimental_operator_input_capture_bytes' is non-zero. The "
+    "directory must exist.");
+
+namespace facebook::velox::exec {
+
+// static
+std::unique_ptr<OperatorInputCapture> OperatorInputCapture::createIfEnabled() {
+  if (FLAGS_velox_experimental_operator_input_capture_bytes <= 0 ||
+      FLAGS_velox_experimental_operator_input_capture_path.empty()) {
+    return nullptr;
+  }
+  return std::unique_ptr<OperatorInputCapture>(new OperatorInputCapture(
+      FLAGS_velox_experimental_operator_input_capture_bytes));
+}
+
+void OperatorInputCapture::append(const RowVectorPtr& input) {
+  try {
+    std::ostringstream out;
+    saveVector(*input, out);
+    auto serialized = out.str();
+    bufferedBytes_ += serialized.size();
+    batches_.push_back(std::move(serialized));
+  } catch (const std::exception& e) {
+    // Capture must never fail the query.
+    LOG(WARNING) << "Error serializing input batch for capture: " << e.what();
+    return;
+  }
+  while (bufferedBytes_ > maxBytes_ && batches_.size() > 1) {
+    bufferedBytes_ -= batches_.front().size();
+    batches_.pop_front();
+  }
+}
+
+void OperatorInputCapture::dump(
+    const std::string& label,
+    const std::string& planFragment) const {
+  if (batches_.empty()) {
+    return;
+  }
+  const auto& basePath = FLAGS_velox_experimental_operator_input_capture_path;
+  try {
+    auto planPathOpt =
+        common::generateTempFilePath(basePath.c_str(), (label + ".plan").c_str());
+    if (!planPathOpt.has_value()) {
+      return;
+    }
+    saveStringToFile(planFragment, planPathOpt.value().c_str());
+    LOG(ERROR) << "Captured plan fragment: " << planPathOpt.value();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << "Error saving captured plan fragment: " << e.what();
+  }
+
+  for (const auto& batch : batches_) {
+    try {
+      auto dataPathOpt =
+          common::generateTempFilePath(basePath.c_str(), (label + ".batch").c_str());
+      if (!dataPathOpt.has_value()) {
+        return;
+      }
+      saveStringToFile(batch, dataPathOpt.value().c_str());
+      LOG(ERROR) << "Captured input batch: " << dataPathOpt.value();
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Error saving captured input batch: " << e.what();
+    }
+  }
+}
+
+} // namespace facebook::velox::exec
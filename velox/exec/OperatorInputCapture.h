@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "velox/vector/ComplexVector.h"
+
+namespace facebook::velox::exec {
+
+/// Bounded ring buffer of an operator's most recent input batches serialized
+/// with VectorSaver. When a task fails, the buffered batches and the plan
+/// fragment are written to disk so the workload that led to the failure can
+/// be replayed offline against the same plan.
+///
+/// Capture is enabled by setting the
+/// 'velox_experimental_operator_input_capture_bytes' flag to the per-operator
+/// buffer size and 'velox_experimental_operator_input_capture_path' to an
+/// existing directory. Batches are serialized on the driver thread, so this
+/// is a debugging feature, not free to leave on.
+class OperatorInputCapture {
+ public:
+  /// Returns a capture buffer if capture is enabled by the flags, nullptr
+  /// otherwise.
+  static std::unique_ptr<OperatorInputCapture> createIfEnabled();
+
+  /// Appends a serialized copy of 'input' to the ring buffer, evicting the
+  /// oldest batches to stay within the configured byte budget. The most
+  /// recent batch is always kept, even if it alone exceeds the budget.
+  void append(const RowVectorPtr& input);
+
+  /// Writes the buffered batches and 'planFragment' to files in the
+  /// configured directory. 'label' identifies the operator in file names and
+  /// should include the task id, operator type and plan node id. Logs the
+  /// paths of the written files. Does nothing if no batches were captured.
+  void dump(const std::string& label, const std::string& planFragment) const;
+
+ private:
+  explicit OperatorInputCapture(int64_t maxBytes) : maxBytes_{maxBytes} {}
+
+  const int64_t maxBytes_;
+  int64_t bufferedBytes_{0};
+  std::deque<std::string> batches_;
+};
+
+} // namespace facebook::velox::exec
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/exec/OperatorUtils.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/exec/VectorHasher.h"
 #include "velox/expression/EvalCtx.h"
 #include "velox/vector/ConstantVector.h"
@@ -200,12 +201,15 @@ vector_size_t processFlatFilterResults(
     memcpy(selectedBits, nonNullBits, bits::nbytes(size));
   }
 
-  vector_size_t passed = 0;
+  const auto passed = bits::countBits(selectedBits, 0, size);
+  if (passed == 0 || passed == size) {
+    // Consumers only look at the row mapping when the filter drops some but
+    // not all rows, so skip building the indices.
+    return passed;
+  }
+
   auto* rawSelected = filterEvalCtx.getRawSelectedIndices(size, pool);
-  bits::forEachSetBit(
-      selectedBits, 0, size, [&rawSelected, &passed](vector_size_t row) {
-        rawSelected[passed++] = row;
-      });
+  simd::indicesOfSetBits(selectedBits, 0, size, rawSelected);
   return passed;
 }
 
@@ -236,6 +240,51 @@ vector_size_t processEncodedFilterResults(
   }
   return passed;
 }
+
+// Fast path for a dictionary filter result over flat booleans, the shape
+// produced when expression evaluation peels a dictionary-encoded column,
+// evaluates the filter on the dictionary values and wraps the result back in
+// the column's indices. Folds nulls into a pass/fail bit per dictionary value
+// instead of per row and skips the DecodedVector pass over all rows.
+vector_size_t processDictionaryFilterResults(
+    const VectorPtr& filterResult,
+    const SelectivityVector& rows,
+    FilterEvalCtx& filterEvalCtx,
+    memory::MemoryPool* pool) {
+  auto& base = filterResult->valueVector();
+  if (base->encoding() != VectorEncoding::Simple::FLAT) {
+    return processEncodedFilterResults(filterResult, rows, filterEvalCtx, pool);
+  }
+  auto size = rows.size();
+  auto* indices = filterResult->wrapInfo()->as<vector_size_t>();
+  auto* nulls = filterResult->rawNulls();
+  auto* baseValues = base->as<FlatVector<bool>>()->rawValues<uint64_t>();
+  auto* baseNulls = base->rawNulls();
+
+  // A set bit per dictionary value that is a non-null 'true'.
+  const auto baseSize = base->size();
+  std::vector<uint64_t> passing(bits::nwords(baseSize));
+  if (baseNulls) {
+    bits::andBits(passing.data(), baseValues, baseNulls, 0, baseSize);
+  } else {
+    memcpy(passing.data(), baseValues, bits::nbytes(baseSize));
+  }
+
+  vector_size_t passed = 0;
+  auto* rawSelected = filterEvalCtx.getRawSelectedIndices(size, pool);
+  auto* rawSelectedBits = filterEvalCtx.getRawSelectedBits(size, pool);
+  memset(rawSelectedBits, 0, bits::nbytes(size));
+  for (vector_size_t i = 0; i < size; ++i) {
+    if (nulls && bits::isBitNull(nulls, i)) {
+      continue;
+    }
+    if (bits::isBitSet(passing.data(), indices[i])) {
+      rawSelected[passed++] = i;
+      bits::setBit(rawSelectedBits, i);
+    }
+  }
+  return passed;
+}
 } // namespace
 
 vector_size_t processFilterResults(
@@ -248,6 +297,9 @@ vector_size_t processFilterResults(
       return processConstantFilterResults(filterResult, rows);
     case VectorEncoding::Simple::FLAT:
       return processFlatFilterResults(filterResult, rows, filterEvalCtx, pool);
+    case VectorEncoding::Simple::DICTIONARY:
+      return processDictionaryFilterResults(
+          filterResult, rows, filterEvalCtx, pool);
     default:
       return processEncodedFilterResults(
           filterResult, rows, filterEvalCtx, pool);
@@ -62,9 +62,6 @@ OrderBy::OrderBy(
       outputType_,
       sortColumnIndices,
       sortCompareFlags,
-      outputBatchRows(), // TODO(gaoge): Move to where we can estimate the
-                         // average row size and set the output batch rows based
-                         // on it.
       pool(),
       &nonReclaimableSection_,
       &numSpillRuns_,
@@ -105,6 +102,9 @@ void OrderBy::reclaim(
 
 void OrderBy::noMoreInput() {
   Operator::noMoreInput();
+  // Capture the average row size before the sort buffer starts releasing rows
+  // so that output batches are sized to the preferred output batch bytes.
+  maxOutputRows_ = outputBatchRows(sortBuffer_->estimateOutputRowSize());
   sortBuffer_->noMoreInput();
 
   recordSpillStats();
@@ -115,7 +115,7 @@ RowVectorPtr OrderBy::getOutput() {
     return nullptr;
   }
 
-  RowVectorPtr output = sortBuffer_->getOutput();
+  RowVectorPtr output = sortBuffer_->getOutput(maxOutputRows_);
   finished_ = (output == nullptr);
   return output;
 }
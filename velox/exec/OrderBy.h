@@ -68,6 +68,9 @@ class OrderBy : public Operator {
   void recordSpillStats();
 
   std::unique_ptr<SortBuffer> sortBuffer_;
+  // Maximum number of rows in one output batch. Set once all input has been
+  // received, based on the average size of the accumulated rows.
+  uint32_t maxOutputRows_{0};
   bool finished_ = false;
 };
 } // namespace facebook::velox::exec
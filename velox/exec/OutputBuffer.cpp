@@ -113,6 +113,9 @@ void DestinationBuffer::enqueue(std::shared_ptr<SerializedPage> data) {
     return;
   }
 
+  if (data != nullptr) {
+    bufferedBytes_ += data->size();
+  }
   data_.push_back(std::move(data));
 }
 
@@ -179,6 +182,9 @@ std::vector<std::shared_ptr<SerializedPage>> DestinationBuffer::acknowledge(
   }
   data_.erase(data_.begin(), data_.begin() + numDeleted);
   sequence_ += numDeleted;
+  for (const auto& page : freed) {
+    bufferedBytes_ -= page->size();
+  }
   return freed;
 }
 
@@ -193,6 +199,7 @@ DestinationBuffer::deleteResults() {
     freed.push_back(std::move(data_[i]));
   }
   data_.clear();
+  bufferedBytes_ = 0;
   return freed;
 }
 
@@ -229,6 +236,12 @@ OutputBuffer::OutputBuffer(
       maxSize_(
           task_->queryCtx()->queryConfig().maxPartitionedOutputBufferSize()),
       continueSize_((maxSize_ * kContinuePct) / 100),
+      destinationSize_(
+          isPartitioned() ? std::max<uint64_t>(
+                                maxSize_ / numDestinations,
+                                maxSize_ / kMaxWindowsPerBuffer)
+                          : 0),
+      destinationContinueSize_((destinationSize_ * kContinuePct) / 100),
       arbitraryBuffer_(
           isArbitrary() ? std::make_unique<ArbitraryBuffer>() : nullptr),
       numDrivers_(numDrivers) {
@@ -236,6 +249,9 @@ OutputBuffer::OutputBuffer(
   for (int i = 0; i < numDestinations; i++) {
     buffers_.push_back(std::make_unique<DestinationBuffer>());
   }
+  if (isPartitioned()) {
+    destinationPromises_.resize(numDestinations);
+  }
 }
 
 void OutputBuffer::updateOutputBuffers(int numBuffers, bool noMoreBuffers) {
@@ -334,10 +350,21 @@ bool OutputBuffer::enqueue(
         VELOX_UNREACHABLE(PartitionedOutputNode::kindString(kind_));
     }
 
-    if (totalSize_ > maxSize_ && future) {
-      promises_.emplace_back("OutputBuffer::enqueue");
-      *future = promises_.back().getSemiFuture();
-      blocked = true;
+    if (future) {
+      if (totalSize_ > maxSize_) {
+        promises_.emplace_back("OutputBuffer::enqueue");
+        *future = promises_.back().getSemiFuture();
+        blocked = true;
+      } else if (
+          isPartitioned() && buffers_[destination] != nullptr &&
+          buffers_[destination]->bufferedBytes() > destinationSize_) {
+        // The destination exceeded its share of the buffer. Block only the
+        // producers of this destination; the other destinations continue
+        // against the remaining global budget.
+        destinationPromises_[destination].emplace_back("OutputBuffer::enqueue");
+        *future = destinationPromises_[destination].back().getSemiFuture();
+        blocked = true;
+      }
     }
   }
 
@@ -500,6 +527,7 @@ void OutputBuffer::acknowledge(int destination, int64_t sequence) {
     }
     freed = buffer->acknowledge(sequence, false);
     updateAfterAcknowledgeLocked(freed, promises);
+    maybeUnblockDestinationLocked(destination, promises);
   }
   releaseAfterAcknowledge(freed, promises);
 }
@@ -530,6 +558,27 @@ void OutputBuffer::updateAfterAcknowledgeLocked(
   }
 }
 
+void OutputBuffer::maybeUnblockDestinationLocked(
+    int destination,
+    std::vector<ContinuePromise>& promises) {
+  if (!isPartitioned()) {
+    return;
+  }
+  auto& blocked = destinationPromises_[destination];
+  if (blocked.empty()) {
+    return;
+  }
+  const auto* buffer = buffers_[destination].get();
+  if (buffer == nullptr ||
+      buffer->bufferedBytes() <= destinationContinueSize_) {
+    promises.insert(
+        promises.end(),
+        std::make_move_iterator(blocked.begin()),
+        std::make_move_iterator(blocked.end()));
+    blocked.clear();
+  }
+}
+
 bool OutputBuffer::deleteResults(int destination) {
   std::vector<std::shared_ptr<SerializedPage>> freed;
   std::vector<ContinuePromise> promises;
@@ -549,6 +598,7 @@ bool OutputBuffer::deleteResults(int destination) {
     ++numFinalAcknowledges_;
     isFinished = isFinishedLocked();
     updateAfterAcknowledgeLocked(freed, promises);
+    maybeUnblockDestinationLocked(destination, promises);
   }
 
   // Outside of mutex.
@@ -589,6 +639,7 @@ void OutputBuffer::getData(
         sequence);
     freed = buffer->acknowledge(sequence, true);
     updateAfterAcknowledgeLocked(freed, promises);
+    maybeUnblockDestinationLocked(destination, promises);
     data = buffer->getData(maxBytes, sequence, notify, arbitraryBuffer_.get());
   }
   releaseAfterAcknowledge(freed, promises);
@@ -604,6 +655,13 @@ void OutputBuffer::terminate() {
   {
     std::lock_guard<std::mutex> l(mutex_);
     outstandingPromises.swap(promises_);
+    for (auto& blocked : destinationPromises_) {
+      std::move(
+          blocked.begin(),
+          blocked.end(),
+          std::back_inserter(outstandingPromises));
+      blocked.clear();
+    }
   }
   for (auto& promise : outstandingPromises) {
     promise.setValue();
@@ -114,10 +114,18 @@ class DestinationBuffer {
   // the callback.
   DataAvailable getAndClearNotify();
 
+  /// Returns the total bytes buffered in this destination, including pages
+  /// fetched but not yet acknowledged.
+  uint64_t bufferedBytes() const {
+    return bufferedBytes_;
+  }
+
   std::string toString();
 
  private:
   std::vector<std::shared_ptr<SerializedPage>> data_;
+  // Total bytes of the pages in 'data_'.
+  uint64_t bufferedBytes_{0};
   // The sequence number of the first in 'data_'.
   int64_t sequence_ = 0;
   DataAvailableCallback notify_ = nullptr;
@@ -196,6 +204,12 @@ class OutputBuffer {
   // be unblocked.
   static constexpr int32_t kContinuePct = 90;
 
+  // Caps the number of per-destination windows 'maxSize_' is divided into:
+  // with more destinations each window stays at least 1 /
+  // kMaxWindowsPerBuffer of 'maxSize_' so that windows do not degenerate into
+  // blocking after every page.
+  static constexpr int32_t kMaxWindowsPerBuffer = 16;
+
   /// If this is called due to a driver processed all its data (no more data),
   /// we increment the number of finished drivers. If it is called due to us
   /// updating the total number of drivers, we don't.
@@ -207,6 +221,14 @@ class OutputBuffer {
       const std::vector<std::shared_ptr<SerializedPage>>& freed,
       std::vector<ContinuePromise>& promises);
 
+  // Moves producer promises blocked on 'destination's window into 'promises'
+  // if the destination's buffered bytes dropped below
+  // 'destinationContinueSize_' or the destination's buffer was deleted. No-op
+  // for non-partitioned output.
+  void maybeUnblockDestinationLocked(
+      int destination,
+      std::vector<ContinuePromise>& promises);
+
   /// Given an updated total number of broadcast buffers, add any missing ones
   /// and enqueue data that has been produced so far (e.g. dataToBroadcast_).
   void addOutputBuffersLocked(int numBuffers);
@@ -246,6 +268,15 @@ class OutputBuffer {
   // When 'totalSize_' goes below 'continueSize_', blocked producers are
   // resumed.
   const uint64_t continueSize_;
+  /// Caps the bytes buffered for any single destination of partitioned
+  /// output. A producer adding data to a destination over this cap is blocked
+  /// against that destination only, so that one slow consumer does not take
+  /// over 'maxSize_' and stall the producers of the other destinations. 0 for
+  /// non-partitioned output.
+  const uint64_t destinationSize_;
+  // When a destination's buffered bytes go below 'destinationContinueSize_',
+  // producers blocked on that destination's window are resumed.
+  const uint64_t destinationContinueSize_;
   const std::unique_ptr<ArbitraryBuffer> arbitraryBuffer_;
 
   // Total number of drivers expected to produce results. This number will
@@ -266,6 +297,9 @@ class OutputBuffer {
   // Actual data size in 'buffers_'.
   uint64_t totalSize_ = 0;
   std::vector<ContinuePromise> promises_;
+  // Producer promises blocked on a single destination's window, one list per
+  // destination. Only used for partitioned output.
+  std::vector<std::vector<ContinuePromise>> destinationPromises_;
   // The next buffer index in 'buffers_' to load data from arbitrary buffer
   // which is only used by arbitrary output type.
   int32_t nextArbitraryLoadBufferIndex_{0};
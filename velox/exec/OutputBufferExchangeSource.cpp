@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/OutputBufferExchangeSource.h"
+
+#include "velox/exec/ExchangeClient.h"
+#include "velox/exec/OutputBufferManager.h"
+
+namespace facebook::velox::exec {
+
+// static
+std::shared_ptr<ExchangeSource> OutputBufferExchangeSource::createIfLocal(
+    const std::string& taskId,
+    int destination,
+    std::shared_ptr<ExchangeQueue> queue,
+    memory::MemoryPool* pool) {
+  auto buffers = OutputBufferManager::getInstance().lock();
+  if (buffers == nullptr || buffers->getBufferIfExists(taskId) == nullptr) {
+    // The producing task does not run in this process. Fall through to the
+    // remote transport's factory.
+    return nullptr;
+  }
+  return std::make_shared<OutputBufferExchangeSource>(
+      taskId, destination, std::move(queue), pool);
+}
+
+bool OutputBufferExchangeSource::shouldRequestLocked() {
+  if (atEnd_) {
+    return false;
+  }
+  return !requestPending_.exchange(true);
+}
+
+folly::SemiFuture<ExchangeSource::Response> OutputBufferExchangeSource::request(
+    uint32_t maxBytes,
+    uint32_t /*maxWaitSeconds*/) {
+  auto promise = VeloxPromise<Response>("OutputBufferExchangeSource::request");
+  auto future = promise.getSemiFuture();
+  promise_ = std::move(promise);
+
+  auto buffers = OutputBufferManager::getInstance().lock();
+  VELOX_CHECK_NOT_NULL(buffers, "invalid OutputBufferManager");
+  VELOX_CHECK(requestPending_);
+  const auto requestedSequence = sequence_;
+  auto self = shared_from_this();
+  buffers->getData(
+      taskId_,
+      destination_,
+      maxBytes,
+      sequence_,
+      // Since this lambda may outlive 'this', we need to capture a
+      // shared_ptr to the current object (self).
+      [self, requestedSequence, buffers, this](
+          std::vector<std::unique_ptr<folly::IOBuf>> data, int64_t sequence) {
+        if (requestedSequence > sequence) {
+          VLOG(2) << "Receives earlier sequence than requested: task "
+                  << taskId_ << ", destination " << destination_
+                  << ", requested " << sequence << ", received "
+                  << requestedSequence;
+          int64_t nExtra = requestedSequence - sequence;
+          VELOX_CHECK(nExtra < data.size());
+          data.erase(data.begin(), data.begin() + nExtra);
+          sequence = requestedSequence;
+        }
+        std::vector<std::unique_ptr<SerializedPage>> pages;
+        bool atEnd = false;
+        int64_t totalBytes = 0;
+        for (auto& inputPage : data) {
+          if (!inputPage) {
+            atEnd = true;
+            // Keep looping, there could be extra end markers.
+            continue;
+          }
+          totalBytes += inputPage->length();
+          inputPage->unshare();
+          pages.push_back(
+              std::make_unique<SerializedPage>(std::move(inputPage)));
+          inputPage = nullptr;
+        }
+        numPages_ += pages.size();
+        totalBytes_ += totalBytes;
+
+        // Count the wire pages before decoding: a decoder may expand one
+        // page into several and the sequence numbers track wire pages.
+        const auto numReceivedPages = pages.size();
+        pages = queue_->decodePages(std::move(pages));
+
+        int64_t ackSequence;
+        VeloxPromise<Response> requestPromise;
+        {
+          std::vector<ContinuePromise> queuePromises;
+          {
+            std::lock_guard<std::mutex> l(queue_->mutex());
+            requestPending_ = false;
+            requestPromise = std::move(promise_);
+            for (auto& page : pages) {
+              queue_->enqueueLocked(std::move(page), queuePromises);
+            }
+            if (atEnd) {
+              queue_->enqueueLocked(nullptr, queuePromises);
+              atEnd_ = true;
+            }
+            ackSequence = sequence_ = sequence + numReceivedPages;
+          }
+          for (auto& promise : queuePromises) {
+            promise.setValue();
+          }
+        }
+        // Outside of queue mutex.
+        if (atEnd_) {
+          buffers->deleteResults(taskId_, destination_);
+        } else {
+          buffers->acknowledge(taskId_, destination_, ackSequence);
+        }
+
+        if (!requestPromise.isFulfilled()) {
+          requestPromise.setValue(Response{totalBytes, atEnd_});
+        }
+      });
+
+  return future;
+}
+
+void OutputBufferExchangeSource::close() {
+  checkSetRequestPromise();
+
+  auto buffers = OutputBufferManager::getInstance().lock();
+  if (buffers != nullptr) {
+    buffers->deleteResults(taskId_, destination_);
+  }
+}
+
+folly::F14FastMap<std::string, int64_t> OutputBufferExchangeSource::stats()
+    const {
+  return {
+      {"outputBufferExchangeSource.numPages", numPages_},
+      {"outputBufferExchangeSource.totalBytes", totalBytes_},
+      {ExchangeClient::kBackgroundCpuTimeMs, 0},
+  };
+}
+
+bool OutputBufferExchangeSource::checkSetRequestPromise() {
+  VeloxPromise<Response> promise;
+  {
+    std::lock_guard<std::mutex> l(queue_->mutex());
+    promise = std::move(promise_);
+  }
+  if (promise.valid() && !promise.isFulfilled()) {
+    promise.setValue(Response{0, false});
+    return true;
+  }
+
+  return false;
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/exec/ExchangeSource.h"
+
+namespace facebook::velox::exec {
+
+/// ExchangeSource over the process-local OutputBufferManager. When the
+/// producing task runs in the same process as the consumer, pages are moved
+/// from the producer's output buffer straight into the exchange queue, with
+/// no serialization round trip through a network transport.
+///
+/// Register createIfLocal() ahead of the remote transport's factory so that
+/// intra-process shuffles take this path and everything else falls through
+/// to the remote transport.
+class OutputBufferExchangeSource : public ExchangeSource {
+ public:
+  OutputBufferExchangeSource(
+      const std::string& taskId,
+      int destination,
+      std::shared_ptr<ExchangeQueue> queue,
+      memory::MemoryPool* pool)
+      : ExchangeSource(taskId, destination, std::move(queue), pool) {}
+
+  /// Returns a source if 'taskId' has an output buffer registered with this
+  /// process's OutputBufferManager, nullptr otherwise. Suitable for passing
+  /// to ExchangeSource::registerFactory().
+  static std::shared_ptr<ExchangeSource> createIfLocal(
+      const std::string& taskId,
+      int destination,
+      std::shared_ptr<ExchangeQueue> queue,
+      memory::MemoryPool* pool);
+
+  bool shouldRequestLocked() override;
+
+  folly::SemiFuture<Response> request(uint32_t maxBytes, uint32_t maxWaitSeconds)
+      override;
+
+  void close() override;
+
+  folly::F14FastMap<std::string, int64_t> stats() const override;
+
+ private:
+  // Sets a pending request promise, if any, to an empty response. Returns
+  // true if a promise was set.
+  bool checkSetRequestPromise();
+
+  // Records the total number of pages and bytes fetched from the buffer.
+  std::atomic<int64_t> numPages_{0};
+  std::atomic<uint64_t> totalBytes_{0};
+  VeloxPromise<Response> promise_{VeloxPromise<Response>::makeEmpty()};
+};
+
+} // namespace facebook::velox::exec
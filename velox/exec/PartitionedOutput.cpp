@@ -62,7 +62,9 @@ BlockingReason Destination::advance(
 
   // Serialize
   if (!current_) {
-    current_ = std::make_unique<VectorStreamGroup>(pool_);
+    current_ = std::make_unique<VectorStreamGroup>(pool_, serde_);
+  }
+  if (!current_->hasStreamTree()) {
     auto rowType = asRowType(output->type());
     current_->createStreamTree(rowType, rowsInCurrent_);
   }
@@ -82,7 +84,7 @@ BlockingReason Destination::flush(
     OutputBufferManager& bufferManager,
     const std::function<void()>& bufferReleaseFn,
     ContinueFuture* future) {
-  if (!current_) {
+  if (!current_ || !current_->hasStreamTree()) {
     return BlockingReason::kNotBlocked;
   }
 
@@ -94,7 +96,10 @@ BlockingReason Destination::flush(
       listener.get(),
       std::max<int64_t>(kMinMessageSize, current_->size()));
   current_->flush(&stream);
-  current_.reset();
+  // Keep the stream group and reuse its arena memory for the next page; high
+  // fan-out shuffles flush many small pages per destination and the per-page
+  // allocations add up.
+  current_->clear();
   bytesInCurrent_ = 0;
   rowsInCurrent_ = 0;
   setTargetSizePct();
@@ -109,6 +114,102 @@ BlockingReason Destination::flush(
 }
 } // namespace detail
 
+namespace {
+
+// Returns true if 'outputType' declares a pruned version of 'inputType', i.e.
+// a ROW type (possibly nested inside another row, array or map) with a subset
+// of the input's fields.
+bool isPrunedType(const TypePtr& outputType, const TypePtr& inputType) {
+  return *outputType != *inputType;
+}
+
+// Restructures 'vector' to match 'type', dropping the struct fields that
+// 'type' does not mention.  Fields are matched to the input by name.  Returns
+// 'vector' unchanged when the types already match.
+VectorPtr pruneToType(const TypePtr& type, const VectorPtr& vector) {
+  if (*type == *vector->type()) {
+    return vector;
+  }
+  auto& base = BaseVector::loadedVectorShared(vector);
+  switch (base->encoding()) {
+    case VectorEncoding::Simple::DICTIONARY:
+      return BaseVector::wrapInDictionary(
+          base->nulls(),
+          base->wrapInfo(),
+          base->size(),
+          pruneToType(type, base->valueVector()));
+    case VectorEncoding::Simple::CONSTANT: {
+      if (base->isNullAt(0)) {
+        return BaseVector::createNullConstant(
+            type, base->size(), base->pool());
+      }
+      return BaseVector::wrapInConstant(
+          base->size(),
+          base->as<ConstantVector<ComplexType>>()->index(),
+          pruneToType(type, base->valueVector()));
+    }
+    case VectorEncoding::Simple::ROW: {
+      auto* row = base->as<RowVector>();
+      auto& inputRowType = base->type()->asRow();
+      auto& outputRowType = type->asRow();
+      std::vector<VectorPtr> children;
+      children.reserve(outputRowType.size());
+      for (auto i = 0; i < outputRowType.size(); ++i) {
+        auto& child =
+            row->childAt(inputRowType.getChildIdx(outputRowType.nameOf(i)));
+        children.push_back(pruneToType(outputRowType.childAt(i), child));
+      }
+      return std::make_shared<RowVector>(
+          base->pool(), type, row->nulls(), row->size(), std::move(children));
+    }
+    case VectorEncoding::Simple::ARRAY: {
+      auto* array = base->as<ArrayVector>();
+      return std::make_shared<ArrayVector>(
+          base->pool(),
+          type,
+          array->nulls(),
+          array->size(),
+          array->offsets(),
+          array->sizes(),
+          pruneToType(type->childAt(0), array->elements()));
+    }
+    case VectorEncoding::Simple::MAP: {
+      auto* map = base->as<MapVector>();
+      return std::make_shared<MapVector>(
+          base->pool(),
+          type,
+          map->nulls(),
+          map->size(),
+          map->offsets(),
+          map->sizes(),
+          pruneToType(type->childAt(0), map->mapKeys()),
+          pruneToType(type->childAt(1), map->mapValues()));
+    }
+    default:
+      VELOX_USER_FAIL(
+          "Output type {} of PartitionedOutput is not a pruned version of the input type {}",
+          type->toString(),
+          vector->type()->toString());
+  }
+}
+
+// Returns true if any output column declares a pruned version of the
+// corresponding input column.
+bool hasPrunedColumns(
+    const RowTypePtr& inputType,
+    const RowTypePtr& outputType) {
+  for (auto i = 0; i < outputType->size(); ++i) {
+    if (isPrunedType(
+            outputType->childAt(i),
+            inputType->findChild(outputType->nameOf(i)))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
 PartitionedOutput::PartitionedOutput(
     int32_t operatorId,
     DriverCtx* ctx,
@@ -130,6 +231,8 @@ PartitionedOutput::PartitionedOutput(
           planNode->inputType(),
           planNode->outputType(),
           planNode->outputType())),
+      prunesColumns_(
+          hasPrunedColumns(planNode->inputType(), planNode->outputType())),
       bufferManager_(OutputBufferManager::getInstance()),
       // NOTE: 'bufferReleaseFn_' holds a reference on the associated task to
       // prevent it from deleting while there are output buffers being accessed
@@ -138,7 +241,12 @@ PartitionedOutput::PartitionedOutput(
       bufferReleaseFn_([task = operatorCtx_->task()]() {}),
       maxBufferedBytes_(ctx->task->queryCtx()
                             ->queryConfig()
-                            .maxPartitionedOutputBufferSize()) {
+                            .maxPartitionedOutputBufferSize()),
+      serde_(
+          ctx->task->queryCtx()->queryConfig().exchangeVectorSerde().empty()
+              ? getVectorSerde()
+              : getNamedVectorSerde(
+                    ctx->task->queryCtx()->queryConfig().exchangeVectorSerde())) {
   if (!planNode->isPartitioned()) {
     VELOX_USER_CHECK_EQ(numDestinations_, 1);
   }
@@ -157,13 +265,16 @@ void PartitionedOutput::initializeInput(RowVectorPtr input) {
         nullptr /*nulls*/,
         input_->size(),
         std::vector<VectorPtr>{});
-  } else if (outputChannels_.empty()) {
+  } else if (outputChannels_.empty() && !prunesColumns_) {
     output_ = input_;
   } else {
     std::vector<VectorPtr> outputColumns;
-    outputColumns.reserve(outputChannels_.size());
-    for (auto i : outputChannels_) {
-      outputColumns.push_back(input_->childAt(i));
+    outputColumns.reserve(outputType_->size());
+    for (auto i = 0; i < outputType_->size(); ++i) {
+      auto& child =
+          input_->childAt(outputChannels_.empty() ? i : outputChannels_[i]);
+      outputColumns.push_back(
+          prunesColumns_ ? pruneToType(outputType_->childAt(i), child) : child);
     }
 
     output_ = std::make_shared<RowVector>(
@@ -180,7 +291,7 @@ void PartitionedOutput::initializeDestinations() {
     auto taskId = operatorCtx_->taskId();
     for (int i = 0; i < numDestinations_; ++i) {
       destinations_.push_back(
-          std::make_unique<detail::Destination>(taskId, i, pool()));
+          std::make_unique<detail::Destination>(taskId, i, serde_, pool()));
     }
   }
 }
@@ -205,9 +316,17 @@ void PartitionedOutput::initializeSizeBuffers() {
 void PartitionedOutput::estimateRowSizes() {
   auto numInput = input_->size();
   std::fill(rowSize_.begin(), rowSize_.end(), 0);
-  for (int i = 0; i < output_->childrenSize(); ++i) {
-    VectorStreamGroup::estimateSerializedSize(
-        output_->childAt(i),
+  if (serde_->estimatesSerializedSizeByColumn()) {
+    for (int i = 0; i < output_->childrenSize(); ++i) {
+      serde_->estimateSerializedSize(
+          output_->childAt(i),
+          folly::Range(topLevelRanges_.data(), numInput),
+          sizePointers_.data());
+    }
+  } else {
+    // Row-oriented serdes estimate whole rows at a time.
+    serde_->estimateSerializedSize(
+        output_,
         folly::Range(topLevelRanges_.data(), numInput),
         sizePointers_.data());
   }
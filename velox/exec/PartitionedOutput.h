@@ -28,8 +28,9 @@ class Destination {
   Destination(
       const std::string& taskId,
       int destination,
+      VectorSerde* serde,
       memory::MemoryPool* pool)
-      : taskId_(taskId), destination_(destination), pool_(pool) {
+      : taskId_(taskId), destination_(destination), serde_(serde), pool_(pool) {
     setTargetSizePct();
   }
 
@@ -92,6 +93,8 @@ class Destination {
 
   const std::string taskId_;
   const int destination_;
+  // The serde to serialize exchange pages with. Not owned.
+  VectorSerde* const serde_;
   memory::MemoryPool* const pool_;
   // Bytes serialized in 'current_'
   uint64_t bytesInCurrent_{0};
@@ -135,7 +138,8 @@ class Destination {
 // is responsible for this process: it takes a stream of data that is not
 // partitioned, and divides the stream into a series of output data ready to be
 // sent to other workers. This operator is also capable of re-ordering and
-// dropping columns from its input.
+// dropping columns from its input, as well as dropping unused struct fields
+// when the plan declares a pruned output type for a column.
 class PartitionedOutput : public Operator {
  public:
   // Minimum flush size for non-final flush. 60KB + overhead fits a
@@ -193,9 +197,17 @@ class PartitionedOutput : public Operator {
   std::unique_ptr<core::PartitionFunction> partitionFunction_;
   // Empty if column order in the output is exactly the same as in input.
   const std::vector<column_index_t> outputChannels_;
+  // True if some output column declares a pruned version of the corresponding
+  // input column type, i.e. a struct with a subset of the input's fields. Such
+  // columns are restructured before serialization so that only the declared
+  // fields are shuffled.
+  const bool prunesColumns_;
   const std::weak_ptr<exec::OutputBufferManager> bufferManager_;
   const std::function<void()> bufferReleaseFn_;
   const int64_t maxBufferedBytes_;
+  // The serde used for exchange pages, resolved from the query config. Not
+  // owned.
+  VectorSerde* const serde_;
 
   BlockingReason blockingReason_{BlockingReason::kNotBlocked};
   ContinueFuture future_;
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/PlanWarmup.h"
+
+#include <folly/Synchronized.h>
+#include <folly/container/F14Set.h>
+
+#include "velox/exec/Aggregate.h"
+#include "velox/expression/Expr.h"
+
+namespace facebook::velox::exec {
+namespace {
+
+// Fingerprints of plan trees that have already been warmed up.
+folly::Synchronized<folly::F14FastSet<uint64_t>>& warmedPlans() {
+  static folly::Synchronized<folly::F14FastSet<uint64_t>> plans;
+  return plans;
+}
+
+void compile(
+    const std::vector<core::TypedExprPtr>& expressions,
+    core::ExecCtx& execCtx) {
+  ExprSet exprSet(expressions, &execCtx);
+}
+
+void warmUpNode(const core::PlanNodePtr& node, core::ExecCtx& execCtx) {
+  if (auto filterNode =
+          std::dynamic_pointer_cast<const core::FilterNode>(node)) {
+    compile({filterNode->filter()}, execCtx);
+  } else if (
+      auto projectNode =
+          std::dynamic_pointer_cast<const core::ProjectNode>(node)) {
+    compile(projectNode->projections(), execCtx);
+  } else if (
+      auto aggregationNode =
+          std::dynamic_pointer_cast<const core::AggregationNode>(node)) {
+    const auto step = isPartialOutput(aggregationNode->step())
+        ? core::AggregationNode::Step::kPartial
+        : core::AggregationNode::Step::kSingle;
+    const auto numKeys = aggregationNode->groupingKeys().size();
+    for (auto i = 0; i < aggregationNode->aggregates().size(); ++i) {
+      const auto& aggregate = aggregationNode->aggregates()[i];
+      Aggregate::create(
+          aggregate.call->name(),
+          step,
+          aggregate.rawInputTypes,
+          aggregationNode->outputType()->childAt(numKeys + i),
+          execCtx.queryCtx()->queryConfig());
+    }
+  } else if (
+      auto joinNode =
+          std::dynamic_pointer_cast<const core::AbstractJoinNode>(node)) {
+    if (joinNode->filter()) {
+      compile({joinNode->filter()}, execCtx);
+    }
+  } else if (
+      auto nestedLoopJoinNode =
+          std::dynamic_pointer_cast<const core::NestedLoopJoinNode>(node)) {
+    if (nestedLoopJoinNode->joinCondition()) {
+      compile({nestedLoopJoinNode->joinCondition()}, execCtx);
+    }
+  }
+
+  for (const auto& source : node->sources()) {
+    warmUpNode(source, execCtx);
+  }
+}
+} // namespace
+
+void warmUpPlanFragment(
+    const core::PlanFragment& fragment,
+    std::shared_ptr<core::QueryCtx> queryCtx) {
+  VELOX_CHECK_NOT_NULL(fragment.planNode);
+  VELOX_CHECK_NOT_NULL(queryCtx);
+
+  const uint64_t fingerprint =
+      std::hash<std::string>()(fragment.planNode->toString(true, true));
+  if (warmedPlans().rlock()->contains(fingerprint)) {
+    return;
+  }
+
+  auto pool = queryCtx->pool()->addLeafChild("plan_warmup");
+  core::ExecCtx execCtx(pool.get(), queryCtx.get());
+  warmUpNode(fragment.planNode, execCtx);
+
+  warmedPlans().wlock()->insert(fingerprint);
+}
+
+} // namespace facebook::velox::exec
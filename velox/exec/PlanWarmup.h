@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/core/PlanFragment.h"
+#include "velox/core/QueryCtx.h"
+
+namespace facebook::velox::exec {
+
+/// Compiles the expressions of 'fragment' and resolves its aggregate
+/// functions once ahead of Task creation. Registry lookups, signature
+/// binding and constant folding thus happen off the task launch path
+/// and a fragment with an unresolvable function fails here instead of
+/// in the first Driver. Warmed-up plans are remembered process-wide by
+/// a fingerprint of the plan tree, so calling this for every Task of a
+/// distributed stage does the work only once. The compiled ExprSets
+/// themselves are not shared: expressions hold per-instance state
+/// (cached results, stats, function instances) and each Driver still
+/// builds its own.
+void warmUpPlanFragment(
+    const core::PlanFragment& fragment,
+    std::shared_ptr<core::QueryCtx> queryCtx);
+
+} // namespace facebook::velox::exec
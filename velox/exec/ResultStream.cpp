@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/ResultStream.h"
+
+#include "velox/vector/arrow/Bridge.h"
+
+namespace facebook::velox::exec {
+
+// static
+std::shared_ptr<ResultStream> ResultStream::create(uint64_t maxQueuedBytes) {
+  return std::shared_ptr<ResultStream>(new ResultStream(maxQueuedBytes));
+}
+
+Consumer ResultStream::consumer() {
+  return [self = shared_from_this()](
+             RowVectorPtr vector, ContinueFuture* future) {
+    return self->enqueue(std::move(vector), future);
+  };
+}
+
+void ResultStream::setNumProducers(int32_t numProducers) {
+  std::lock_guard<std::mutex> l(mutex_);
+  numProducers_ = numProducers;
+}
+
+BlockingReason ResultStream::enqueue(
+    RowVectorPtr vector,
+    ContinueFuture* future) {
+  if (!vector) {
+    std::lock_guard<std::mutex> l(mutex_);
+    ++numProducersFinished_;
+    if (consumerBlocked_) {
+      consumerBlocked_ = false;
+      consumerPromise_.setValue();
+    }
+    return BlockingReason::kNotBlocked;
+  }
+
+  const auto bytes = vector->retainedSize();
+  std::lock_guard<std::mutex> l(mutex_);
+  if (closed_) {
+    // The client went away. Drop the batch and let the producers run to
+    // completion; the embedder is expected to also cancel the task.
+    return BlockingReason::kNotBlocked;
+  }
+  queue_.push_back(Entry{std::move(vector), bytes});
+  queuedBytes_ += bytes;
+  if (consumerBlocked_) {
+    consumerBlocked_ = false;
+    consumerPromise_.setValue();
+  }
+  if (queuedBytes_ > maxQueuedBytes_) {
+    auto [unblockPromise, unblockFuture] = makeVeloxContinuePromiseContract(
+        "ResultStream::enqueue");
+    producerUnblockPromises_.push_back(std::move(unblockPromise));
+    *future = std::move(unblockFuture);
+    return BlockingReason::kWaitForConsumer;
+  }
+  return BlockingReason::kNotBlocked;
+}
+
+RowVectorPtr ResultStream::next() {
+  for (;;) {
+    RowVectorPtr vector;
+    std::vector<ContinuePromise> mayContinue;
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      if (closed_) {
+        return nullptr;
+      }
+      if (!queue_.empty()) {
+        vector = std::move(queue_.front().vector);
+        queuedBytes_ -= queue_.front().bytes;
+        queue_.pop_front();
+        if (queuedBytes_ < maxQueuedBytes_ / 2) {
+          mayContinue = std::move(producerUnblockPromises_);
+        }
+      } else if (numProducersFinished_ == numProducers_) {
+        return nullptr;
+      } else {
+        consumerBlocked_ = true;
+        consumerPromise_ = ContinuePromise("ResultStream::next");
+        consumerFuture_ = consumerPromise_.getSemiFuture();
+      }
+    }
+    // Outside of 'mutex_'.
+    for (auto& promise : mayContinue) {
+      promise.setValue();
+    }
+    if (vector) {
+      return vector;
+    }
+    consumerFuture_.wait();
+  }
+}
+
+bool ResultStream::nextArrow(
+    ArrowArray& array,
+    ArrowSchema& schema,
+    memory::MemoryPool* pool) {
+  auto vector = next();
+  if (!vector) {
+    return false;
+  }
+  // The exported structures keep the underlying buffers alive; 'vector' need
+  // not outlive them.
+  exportToArrow(vector, schema);
+  exportToArrow(vector, array, pool);
+  return true;
+}
+
+void ResultStream::close() {
+  std::vector<ContinuePromise> mayContinue;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (closed_) {
+      return;
+    }
+    closed_ = true;
+    queue_.clear();
+    queuedBytes_ = 0;
+    mayContinue = std::move(producerUnblockPromises_);
+    if (consumerBlocked_) {
+      consumerBlocked_ = false;
+      consumerPromise_.setValue();
+    }
+  }
+  for (auto& promise : mayContinue) {
+    promise.setValue();
+  }
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <optional>
+
+#include "velox/common/future/VeloxPromise.h"
+#include "velox/exec/Driver.h"
+#include "velox/vector/arrow/Abi.h"
+#include "velox/vector/ComplexVector.h"
+
+namespace facebook::velox::exec {
+
+/// Streams the results of a Task to the embedding application with bounded
+/// memory. The stream keeps a queue of result batches capped at
+/// 'maxQueuedBytes' of retained size. Drivers of the output pipeline hand
+/// batches to the queue through the Consumer callback returned by consumer().
+/// Once the cap is reached the producing drivers block until the client
+/// drains the queue below half of the cap, so a slow client pauses the
+/// pipeline instead of accumulating the result set in memory.
+///
+/// Usage:
+///
+///   auto results = ResultStream::create();
+///   auto task = Task::create(taskId, plan, 0, queryCtx, results->consumer());
+///   results->setNumProducers(maxDrivers);
+///   task->start(maxDrivers);
+///   while (auto batch = results->next()) {
+///     ... send 'batch' to the client ...
+///   }
+///   ... check task->error() ...
+///
+/// A failed Task closes its sinks like a finished one, so next() returns
+/// nullptr in both cases; the caller distinguishes them via Task::error() or
+/// the onError callback passed to Task::create.
+class ResultStream : public std::enable_shared_from_this<ResultStream> {
+ public:
+  static constexpr uint64_t kDefaultMaxQueuedBytes = 32UL << 20;
+
+  /// 'maxQueuedBytes' caps the total retained size of queued batches. The cap
+  /// is soft: a batch is queued first and the producer blocked after, so at
+  /// most one extra batch per producer is held above the cap.
+  static std::shared_ptr<ResultStream> create(
+      uint64_t maxQueuedBytes = kDefaultMaxQueuedBytes);
+
+  /// Returns the callback to pass to Task::create. In multi-threaded
+  /// execution every driver of the output pipeline invokes the same callback.
+  Consumer consumer();
+
+  /// Sets the number of drivers that produce into this stream, i.e. the
+  /// number of drivers in the task's output pipeline. next() reports end of
+  /// data only once this many producers have finished. Must be called before
+  /// the results are drained; defaults to 1.
+  void setNumProducers(int32_t numProducers);
+
+  /// Returns the next batch of results, blocking while none are available.
+  /// Returns nullptr once all producers are finished or the stream is closed.
+  /// The batch may reference memory owned by the producing task; keep the
+  /// Task alive until done with the batch or copy it.
+  RowVectorPtr next();
+
+  /// Exports the next batch of results in Arrow format. Returns false at end
+  /// of data. 'pool' is used for allocations when the conversion is not
+  /// zero-copy. The caller owns the returned structures and must call their
+  /// release functions.
+  bool nextArrow(ArrowArray& array, ArrowSchema& schema, memory::MemoryPool* pool);
+
+  /// Unblocks all producers and discards queued and future results. Use when
+  /// abandoning the stream before end of data, together with cancelling the
+  /// task. Called by the destructor.
+  void close();
+
+  ~ResultStream() {
+    close();
+  }
+
+ private:
+  struct Entry {
+    RowVectorPtr vector;
+    uint64_t bytes;
+  };
+
+  explicit ResultStream(uint64_t maxQueuedBytes)
+      : maxQueuedBytes_(maxQueuedBytes) {}
+
+  // Adds a batch to the queue. Returns kWaitForConsumer and sets '*future' if
+  // the queue is over the cap after the addition. A nullptr 'vector' marks
+  // the calling producer as finished.
+  BlockingReason enqueue(RowVectorPtr vector, ContinueFuture* future);
+
+  const uint64_t maxQueuedBytes_;
+
+  std::mutex mutex_;
+  std::deque<Entry> queue_;
+  uint64_t queuedBytes_{0};
+  int32_t numProducers_{1};
+  int32_t numProducersFinished_{0};
+  // Producers blocked on a full queue; realized when the queue drains below
+  // half of 'maxQueuedBytes_' or the stream is closed.
+  std::vector<ContinuePromise> producerUnblockPromises_;
+  bool consumerBlocked_{false};
+  ContinuePromise consumerPromise_;
+  ContinueFuture consumerFuture_{ContinueFuture::makeEmpty()};
+  bool closed_{false};
+};
+
+} // namespace facebook::velox::exec
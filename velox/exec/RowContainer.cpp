@@ -249,6 +249,15 @@ RowContainer::RowContainer(
         (nullableKeys_ || i >= keyTypes_.size()) ? nullOffsets_[i]
                                                  : RowColumn::kNotNullOffset);
   }
+  columnHasNulls_.resize(offsets_.size());
+  resetColumnHasNulls();
+}
+
+void RowContainer::resetColumnHasNulls() {
+  std::fill(columnHasNulls_.begin(), columnHasNulls_.end(), false);
+  for (auto i = 0; i < accumulators_.size(); ++i) {
+    columnHasNulls_[keyTypes_.size() + i] = true;
+  }
 }
 
 RowContainer::~RowContainer() {
@@ -421,6 +430,9 @@ void RowContainer::store(
         offsets_[column]);
   } else {
     VELOX_DCHECK(column < keyTypes_.size() || accumulators_.empty());
+    if (decoded.isNullAt(index)) {
+      columnHasNulls_[column] = true;
+    }
     auto rowColumn = rowColumns_[column];
     VELOX_DYNAMIC_TYPE_DISPATCH_ALL(
         storeWithNulls,
@@ -464,6 +476,44 @@ void RowContainer::extractString(
   values->setNoCopy(index, StringView(rawBuffer, value.size()));
 }
 
+void RowContainer::extractColumnReferencingStrings(
+    const char* const* rows,
+    int32_t numRows,
+    int32_t columnIndex,
+    const VectorPtr& result) {
+  const auto kind = types_[columnIndex]->kind();
+  if (kind != TypeKind::VARCHAR && kind != TypeKind::VARBINARY) {
+    extractColumn(rows, numRows, columnIndex, result);
+    return;
+  }
+  const auto column = columnForExtraction(columnIndex);
+  const auto offset = column.offset();
+  const auto nullByte = column.nullByte();
+  const auto nullMask = column.nullMask();
+  result->resize(numRows);
+  auto* values = result->as<FlatVector<StringView>>();
+  for (int32_t i = 0; i < numRows; ++i) {
+    const char* row = rows[i];
+    if (nullMask != 0 && isNullAt(row, nullByte, nullMask)) {
+      values->setNull(i, true);
+      continue;
+    }
+    values->setNull(i, false);
+    const auto value = valueAt<StringView>(row, offset);
+    if (value.isInline() ||
+        reinterpret_cast<const HashStringAllocator::Header*>(
+            value.data())[-1]
+                .size() >= value.size()) {
+      // Inline or stored in one piece: reference the allocator memory. The
+      // caller serializes 'result' before the row is freed.
+      values->setNoCopy(i, value);
+    } else {
+      // Stored in multiple pieces: copy into the result's buffers.
+      extractString(value, values, i);
+    }
+  }
+}
+
 void RowContainer::storeComplexType(
     const DecodedVector& decoded,
     vector_size_t index,
@@ -627,6 +677,113 @@ void RowContainer::clear() {
   normalizedKeySize_ = originalNormalizedKeySize_;
   numFreeRows_ = 0;
   firstFreeRow_ = nullptr;
+  resetColumnHasNulls();
+}
+
+int64_t RowContainer::compact() {
+  VELOX_CHECK(mutable_, "Can't compact an immutable row container");
+  VELOX_CHECK_EQ(
+      nextOffset_, 0, "Compaction is not supported with next row pointers");
+  if (numFreeRows_ == 0) {
+    return 0;
+  }
+  // Iterates over the row slots in the same order as listRows(): the first
+  // 'numRowsWithNormalizedKey_' slots are preceded by a normalized key word.
+  // The slot layout is positional and stays as is, only the row contents move
+  // between slots.
+  const int32_t numRanges = rows_.numRanges();
+  std::vector<char*> rangeData(numRanges);
+  std::vector<int64_t> rangeLimit(numRanges);
+  for (auto i = 0; i < numRanges; ++i) {
+    auto range = rows_.rangeAt(i);
+    auto* data =
+        range.data() + memory::alignmentPadding(range.data(), alignment_);
+    rangeData[i] = data;
+    rangeLimit[i] = range.size() -
+        (reinterpret_cast<uintptr_t>(data) -
+         reinterpret_cast<uintptr_t>(range.data()));
+  }
+  struct SlotCursor {
+    int32_t range{0};
+    int64_t offset{0};
+    int64_t slotIndex{0};
+  };
+  auto slotSize = [&](int64_t slotIndex) -> int32_t {
+    return fixedRowSize_ +
+        (slotIndex < numRowsWithNormalizedKey_ ? originalNormalizedKeySize_
+                                               : 0);
+  };
+  // Returns the row of the slot at 'cursor' and advances 'cursor' past it,
+  // moving to the next range when the slot does not fit in the current one.
+  auto nextSlot = [&](SlotCursor& cursor) -> char* {
+    for (;;) {
+      VELOX_CHECK_LT(cursor.range, numRanges);
+      const auto size = slotSize(cursor.slotIndex);
+      if (cursor.offset + size <= rangeLimit[cursor.range]) {
+        char* row =
+            rangeData[cursor.range] + cursor.offset + size - fixedRowSize_;
+        cursor.offset += size;
+        ++cursor.slotIndex;
+        return row;
+      }
+      ++cursor.range;
+      cursor.offset = 0;
+    }
+  };
+  // Move each row in turn to the first slot that does not already hold a
+  // moved row. 'dest' never passes 'src', so a forward pass is safe.
+  SlotCursor src;
+  SlotCursor dest;
+  for (uint64_t numLive = 0; numLive < numRows_; ++numLive) {
+    char* srcRow;
+    do {
+      srcRow = nextSlot(src);
+    } while (bits::isBitSet(srcRow, freeFlagOffset_));
+    char* destRow = nextSlot(dest);
+    if (destRow != srcRow) {
+      if (normalizedKeySize_ != 0) {
+        // Normalized keys are in use, so every slot has one below the row.
+        // Move it with the row.
+        ::memcpy(
+            destRow - originalNormalizedKeySize_,
+            srcRow - originalNormalizedKeySize_,
+            originalNormalizedKeySize_ + fixedRowSize_);
+      } else {
+        ::memcpy(destRow, srcRow, fixedRowSize_);
+      }
+    }
+  }
+  // 'dest' is now positioned right after the last row.
+  firstFreeRow_ = nullptr;
+  numFreeRows_ = 0;
+  int64_t released = 0;
+  const int32_t lastRange = numRows_ == 0 ? -1 : dest.range;
+  if (lastRange == numRanges - 1 &&
+      rows_.isInCurrentRange(rangeData[lastRange])) {
+    // The last row is in the run allocations are made from. Shrink the run so
+    // the tail is allocated from again.
+    rows_.setFirstFreeInRun(rangeData[lastRange] + dest.offset);
+  } else {
+    // Put the slots after the last row in its range on the free list and
+    // release the ranges after it. A previous compaction may have left no
+    // current run, in which case there is nothing to free after the last
+    // range and its tail is free listed like that of any full range.
+    while (lastRange >= 0 &&
+           dest.offset + slotSize(dest.slotIndex) <= rangeLimit[lastRange]) {
+      auto* row = nextSlot(dest);
+      bits::setBit(row, freeFlagOffset_);
+      nextFree(row) = firstFreeRow_;
+      firstFreeRow_ = row;
+      ++numFreeRows_;
+    }
+    released = rows_.freeRangesFrom(lastRange + 1);
+  }
+  // Slots past the last kept one are gone, so cap the count of slots with a
+  // normalized key below them. Matters when normalized keys were disabled
+  // mid-use and prefixed slots got freed.
+  numRowsWithNormalizedKey_ =
+      std::min<int64_t>(numRowsWithNormalizedKey_, dest.slotIndex);
+  return released;
 }
 
 void RowContainer::setProbedFlag(char** rows, int32_t numRows) {
@@ -901,6 +1058,163 @@ void RowPartitions::appendPartitions(folly::Range<const uint8_t*> partitions) {
   }
 }
 
+namespace {
+// Layout and ordering of one sort key, captured by value when
+// RowContainer::createComparator() builds a fused comparator.
+struct ComparatorKey {
+  int32_t offset;
+  int32_t nullByte;
+  uint8_t nullMask;
+  CompareFlags flags;
+};
+
+template <TypeKind Kind>
+FOLLY_ALWAYS_INLINE int32_t compareTypedKey(
+    const ComparatorKey& key,
+    const char* FOLLY_NONNULL left,
+    const char* FOLLY_NONNULL right) {
+  const bool leftNull = (left[key.nullByte] & key.nullMask) != 0;
+  const bool rightNull = (right[key.nullByte] & key.nullMask) != 0;
+  if (leftNull) {
+    return rightNull ? 0 : key.flags.nullsFirst ? -1 : 1;
+  }
+  if (rightNull) {
+    return key.flags.nullsFirst ? 1 : -1;
+  }
+  int32_t result;
+  if constexpr (Kind == TypeKind::VARCHAR) {
+    std::string leftStorage;
+    std::string rightStorage;
+    result = HashStringAllocator::contiguousString(
+                 *reinterpret_cast<const StringView*>(left + key.offset),
+                 leftStorage)
+                 .compare(HashStringAllocator::contiguousString(
+                     *reinterpret_cast<const StringView*>(right + key.offset),
+                     rightStorage));
+  } else {
+    using T = typename KindToFlatVector<Kind>::HashRowType;
+    result = SimpleVector<T>::comparePrimitiveAsc(
+        *reinterpret_cast<const T*>(left + key.offset),
+        *reinterpret_cast<const T*>(right + key.offset));
+  }
+  return key.flags.ascending ? result : -result;
+}
+
+template <TypeKind Kind>
+std::function<int32_t(const char*, const char*)> makeFusedComparator(
+    const ComparatorKey& key) {
+  return [key](const char* left, const char* right) {
+    return compareTypedKey<Kind>(key, left, right);
+  };
+}
+
+template <TypeKind Kind1, TypeKind Kind2>
+std::function<int32_t(const char*, const char*)> makeFusedComparator(
+    const ComparatorKey& key1,
+    const ComparatorKey& key2) {
+  return [key1, key2](const char* left, const char* right) {
+    if (auto result = compareTypedKey<Kind1>(key1, left, right)) {
+      return result;
+    }
+    return compareTypedKey<Kind2>(key2, left, right);
+  };
+}
+
+// True for key types that have a fused comparator instantiation below.
+bool supportsFusedCompare(const TypePtr& type, CompareFlags flags) {
+  if (flags.nullHandlingMode != CompareFlags::NullHandlingMode::NoStop) {
+    return false;
+  }
+  switch (type->kind()) {
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::VARCHAR:
+    case TypeKind::TIMESTAMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <TypeKind Kind1>
+std::function<int32_t(const char*, const char*)> makeTwoKeyComparator(
+    TypeKind kind2,
+    const ComparatorKey& key1,
+    const ComparatorKey& key2) {
+  switch (kind2) {
+    case TypeKind::INTEGER:
+      return makeFusedComparator<Kind1, TypeKind::INTEGER>(key1, key2);
+    case TypeKind::BIGINT:
+      return makeFusedComparator<Kind1, TypeKind::BIGINT>(key1, key2);
+    case TypeKind::VARCHAR:
+      return makeFusedComparator<Kind1, TypeKind::VARCHAR>(key1, key2);
+    case TypeKind::TIMESTAMP:
+      return makeFusedComparator<Kind1, TypeKind::TIMESTAMP>(key1, key2);
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+} // namespace
+
+std::function<int32_t(const char*, const char*)> RowContainer::createComparator(
+    const std::vector<std::pair<column_index_t, CompareFlags>>& keys) {
+  VELOX_CHECK(!keys.empty());
+  const bool fusable = keys.size() <= 2 &&
+      std::all_of(keys.begin(), keys.end(), [&](const auto& key) {
+        return supportsFusedCompare(types_[key.first], key.second);
+      });
+  if (fusable) {
+    auto comparatorKey = [&](int32_t i) {
+      const auto column = columnAt(keys[i].first);
+      return ComparatorKey{
+          column.offset(),
+          column.nullByte(),
+          column.nullMask(),
+          keys[i].second};
+    };
+    const auto kind1 = types_[keys[0].first]->kind();
+    if (keys.size() == 1) {
+      switch (kind1) {
+        case TypeKind::INTEGER:
+          return makeFusedComparator<TypeKind::INTEGER>(comparatorKey(0));
+        case TypeKind::BIGINT:
+          return makeFusedComparator<TypeKind::BIGINT>(comparatorKey(0));
+        case TypeKind::VARCHAR:
+          return makeFusedComparator<TypeKind::VARCHAR>(comparatorKey(0));
+        case TypeKind::TIMESTAMP:
+          return makeFusedComparator<TypeKind::TIMESTAMP>(comparatorKey(0));
+        default:
+          VELOX_UNREACHABLE();
+      }
+    }
+    const auto kind2 = types_[keys[1].first]->kind();
+    switch (kind1) {
+      case TypeKind::INTEGER:
+        return makeTwoKeyComparator<TypeKind::INTEGER>(
+            kind2, comparatorKey(0), comparatorKey(1));
+      case TypeKind::BIGINT:
+        return makeTwoKeyComparator<TypeKind::BIGINT>(
+            kind2, comparatorKey(0), comparatorKey(1));
+      case TypeKind::VARCHAR:
+        return makeTwoKeyComparator<TypeKind::VARCHAR>(
+            kind2, comparatorKey(0), comparatorKey(1));
+      case TypeKind::TIMESTAMP:
+        return makeTwoKeyComparator<TypeKind::TIMESTAMP>(
+            kind2, comparatorKey(0), comparatorKey(1));
+      default:
+        VELOX_UNREACHABLE();
+    }
+  }
+  return [this, keys](const char* left, const char* right) -> int32_t {
+    for (const auto& [column, flags] : keys) {
+      if (auto result = compare(left, right, column, flags)) {
+        return result;
+      }
+    }
+    return 0;
+  };
+}
+
 RowComparator::RowComparator(
     const RowTypePtr& rowType,
     const std::vector<core::FieldAccessTypedExprPtr>& sortingKeys,
@@ -916,22 +1230,21 @@ RowComparator::RowComparator(
         "RowComparator doesn't allow constant comparison keys");
     keyInfo_.push_back(std::make_pair(channel, sortingOrders[i]));
   }
+  std::vector<std::pair<column_index_t, CompareFlags>> keys;
+  keys.reserve(numKeys);
+  for (const auto& [channel, order] : keyInfo_) {
+    keys.emplace_back(
+        channel,
+        CompareFlags{order.isNullsFirst(), order.isAscending(), false});
+  }
+  comparator_ = rowContainer_->createComparator(keys);
 }
 
 bool RowComparator::operator()(const char* lhs, const char* rhs) {
   if (lhs == rhs) {
     return false;
   }
-  for (auto& key : keyInfo_) {
-    if (auto result = rowContainer_->compare(
-            lhs,
-            rhs,
-            key.first,
-            {key.second.isNullsFirst(), key.second.isAscending(), false})) {
-      return result < 0;
-    }
-  }
-  return false;
+  return comparator_(lhs, rhs) < 0;
 }
 
 bool RowComparator::operator()(
@@ -295,6 +295,12 @@ class RowContainer {
     return numRows_;
   }
 
+  /// Returns the number of erased rows on the free list. Their space is
+  /// reused by newRow() and can be reclaimed with compact().
+  int64_t numFreeRows() const {
+    return numFreeRows_;
+  }
+
   /// Copies the values at 'col' into 'result' (starting at 'resultOffset')
   /// for the 'numRows' rows pointed to by 'rows'. If a 'row' is null, sets
   /// corresponding row in 'result' to null.
@@ -345,9 +351,22 @@ class RowContainer {
       int32_t numRows,
       int32_t columnIndex,
       const VectorPtr& result) {
-    extractColumn(rows, numRows, columnAt(columnIndex), result);
+    extractColumn(rows, numRows, columnForExtraction(columnIndex), result);
   }
 
+  /// Variant of extractColumn for spilling unsorted content. Out-of-line
+  /// strings stored in one piece in the container's string allocator are
+  /// referenced in place instead of copied into 'result''s string buffers.
+  /// 'result' is then only valid until the referenced rows are freed or
+  /// modified, so the caller must serialize it before erasing the rows.
+  /// Other types and strings stored in multiple pieces behave exactly like
+  /// extractColumn().
+  void extractColumnReferencingStrings(
+      const char* FOLLY_NONNULL const* FOLLY_NONNULL rows,
+      int32_t numRows,
+      int32_t columnIndex,
+      const VectorPtr& result);
+
   /// Copies the values at 'columnIndex' into 'result' (starting at
   /// 'resultOffset') for the 'numRows' rows pointed to by 'rows'. If an
   /// entry in 'rows' is null, sets corresponding row in 'result' to null.
@@ -357,7 +376,8 @@ class RowContainer {
       int32_t columnIndex,
       int32_t resultOffset,
       const VectorPtr& result) {
-    extractColumn(rows, numRows, columnAt(columnIndex), resultOffset, result);
+    extractColumn(
+        rows, numRows, columnForExtraction(columnIndex), resultOffset, result);
   }
 
   /// Copies the values at 'columnIndex' at positions in the 'rowNumbers' array
@@ -374,7 +394,11 @@ class RowContainer {
       const vector_size_t resultOffset,
       const VectorPtr& result) {
     extractColumn(
-        rows, rowNumbers, columnAt(columnIndex), resultOffset, result);
+        rows,
+        rowNumbers,
+        columnForExtraction(columnIndex),
+        resultOffset,
+        result);
   }
 
   /// Sets in result all locations with null values in columnIndex for rows.
@@ -571,6 +595,13 @@ class RowContainer {
     return rowColumns_[index];
   }
 
+  /// Returns true if a null has been stored in 'columnIndex' via store().
+  /// Always true for accumulator columns, which are written by aggregate
+  /// functions directly.
+  bool columnHasNulls(int32_t columnIndex) const {
+    return columnHasNulls_[columnIndex];
+  }
+
   // Bit offset of the probed flag for a full or right outer join  payload.
   // 0 if not applicable.
   int32_t probedFlagOffset() const {
@@ -622,6 +653,18 @@ class RowContainer {
   // Resets the state to be as after construction. Frees memory for payload.
   void clear();
 
+  /// Moves the rows into the smallest prefix of the allocated space and
+  /// returns the now empty tail of allocation ranges to the memory pool. Use
+  /// after many erases to reclaim the space of the freed rows, e.g. in a
+  /// long-lived aggregation where groups come and go. Rows keep their
+  /// relative order but change address, so all row pointers previously
+  /// returned by 'this' and any RowContainerIterator over 'this' are
+  /// invalidated; the caller owns rebuilding any index over the rows, e.g. a
+  /// HashTable rebuilds its entries via rehash. Variable length data is not
+  /// moved. Not supported if rows link to each other with a next row pointer
+  /// (hash join build). Returns the number of bytes released to the pool.
+  int64_t compact();
+
   int32_t compareRows(
       const char* FOLLY_NONNULL left,
       const char* FOLLY_NONNULL right,
@@ -637,6 +680,16 @@ class RowContainer {
     return 0;
   }
 
+  /// Returns a comparator over the columns in 'keys', each given as a column
+  /// index and the compare flags to use for it. The result is equivalent to
+  /// comparing the keys one by one with compare() but is created once, so
+  /// frequent sort shapes - one or two keys of BIGINT, INTEGER, VARCHAR or
+  /// TIMESTAMP - get a fused comparator with no per-comparison type dispatch.
+  /// Other shapes fall back to the generic per-key compare() loop. The
+  /// comparator is only valid while 'this' is live.
+  std::function<int32_t(const char*, const char*)> createComparator(
+      const std::vector<std::pair<column_index_t, CompareFlags>>& keys);
+
   memory::MemoryPool* FOLLY_NONNULL pool() const {
     return stringAllocator_->pool();
   }
@@ -773,6 +826,22 @@ class RowContainer {
     }
   }
 
+  // Returns the column descriptor to use for extraction. If no null has been
+  // stored in 'columnIndex', drops the null mask so extraction takes the
+  // fast path without per-row null checks. The row layout is unchanged; only
+  // the reads skip the null bits.
+  RowColumn columnForExtraction(int32_t columnIndex) const {
+    const auto column = columnAt(columnIndex);
+    if (column.nullMask() != 0 && !columnHasNulls_[columnIndex]) {
+      return {column.offset(), RowColumn::kNotNullOffset};
+    }
+    return column;
+  }
+
+  // Sets 'columnHasNulls_' to the state of an empty container: false for key
+  // and dependent columns, true for accumulators.
+  void resetColumnHasNulls();
+
   char* FOLLY_NULLABLE& nextFree(char* FOLLY_NONNULL row) {
     return *reinterpret_cast<char**>(row + kNextFreeOffset);
   }
@@ -925,8 +994,7 @@ class RowContainer {
       return compareComplexType(row, offset, decoded, index) == 0;
     }
     if (Kind == TypeKind::VARCHAR || Kind == TypeKind::VARBINARY) {
-      return compareStringAsc(
-                 valueAt<StringView>(row, offset), decoded, index) == 0;
+      return equalsString(valueAt<StringView>(row, offset), decoded, index);
     }
     return decoded.valueAt<T>(index) == valueAt<T>(row, offset);
   }
@@ -944,13 +1012,31 @@ class RowContainer {
       return compareComplexType(row, offset, decoded, index) == 0;
     }
     if (Kind == TypeKind::VARCHAR || Kind == TypeKind::VARBINARY) {
-      return compareStringAsc(
-                 valueAt<StringView>(row, offset), decoded, index) == 0;
+      return equalsString(valueAt<StringView>(row, offset), decoded, index);
     }
 
     return decoded.valueAt<T>(index) == valueAt<T>(row, offset);
   }
 
+  // Fast equality for string keys. Different sizes decide inequality without
+  // touching out-of-line storage and strings of up to 12 characters are
+  // stored inline in the row and compare in place. Falls back to
+  // compareStringAsc() for equal-size strings stored out of line, which may
+  // be multipart in the HashStringAllocator.
+  static inline bool equalsString(
+      StringView left,
+      const DecodedVector& decoded,
+      vector_size_t index) {
+    const auto right = decoded.valueAt<StringView>(index);
+    if (left.size() != right.size()) {
+      return false;
+    }
+    if (left.isInline()) {
+      return left == right;
+    }
+    return compareStringAsc(left, decoded, index) == 0;
+  }
+
   template <TypeKind Kind>
   inline int compare(
       const char* FOLLY_NONNULL row,
@@ -1199,6 +1285,10 @@ class RowContainer {
   // Copied over the null bits of each row on initialization. Keys are
   // not null, aggregates are null.
   std::vector<uint8_t> initialNulls_;
+  // True for columns that have had a null stored via store(). Extraction of
+  // columns that never saw a null skips per-row null checks. Accumulator
+  // columns are always treated as possibly null.
+  std::vector<bool> columnHasNulls_;
   uint64_t numRows_ = 0;
   // Head of linked list of free rows.
   char* FOLLY_NULLABLE firstFreeRow_ = nullptr;
@@ -1479,6 +1569,10 @@ class RowComparator {
  private:
   std::vector<std::pair<column_index_t, core::SortOrder>> keyInfo_;
   RowContainer* rowContainer_;
+
+  // Row-to-row comparator from RowContainer::createComparator(), fused for
+  // frequent key shapes.
+  std::function<int32_t(const char*, const char*)> comparator_;
 };
 
 } // namespace facebook::velox::exec
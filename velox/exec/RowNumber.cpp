@@ -298,6 +298,10 @@ RowVectorPtr RowNumber::getOutput() {
     if (index == 0) {
       // Drop all rows.
       output = nullptr;
+    } else if (index == numInput) {
+      // No rows dropped. Skip the identity dictionary wrap so that downstream
+      // operators see the input columns as is.
+      output = fillOutput(numInput, nullptr);
     } else {
       output = fillOutput(index, mapping);
     }
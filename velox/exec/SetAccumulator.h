@@ -224,6 +224,147 @@ struct ComplexTypeSetAccumulator {
   }
 };
 
+/// Alternative to SetAccumulator for fixed width values that defers
+/// deduplication. addValue() appends the value to a per group run in
+/// HashStringAllocator with no hashing and no memory overhead beyond
+/// sizeof(T) per value. The run is sorted and deduplicated once, on the first
+/// call to size() or extractValues(), and rewritten as a run of sorted unique
+/// values. With many groups holding few values each this takes a fraction of
+/// the memory of the F14 set, at the cost of a sort at extraction time.
+/// Values are extracted in ascending order.
+template <typename T>
+struct SortedSetAccumulator {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  bool hasNull{false};
+
+  SortedSetAccumulator(
+      const TypePtr& /*type*/,
+      HashStringAllocator* /*allocator*/) {}
+
+  /// Appends the value. Duplicates are removed later, in finalize().
+  void addValue(
+      const DecodedVector& decoded,
+      vector_size_t index,
+      HashStringAllocator* allocator) {
+    if (decoded.isNullAt(index)) {
+      hasNull = true;
+      return;
+    }
+    append(decoded.valueAt<T>(index), allocator);
+  }
+
+  /// Appends the values from an array.
+  void addValues(
+      const ArrayVector& arrayVector,
+      vector_size_t index,
+      const DecodedVector& values,
+      HashStringAllocator* allocator) {
+    const auto size = arrayVector.sizeAt(index);
+    const auto offset = arrayVector.offsetAt(index);
+
+    for (auto i = 0; i < size; ++i) {
+      addValue(values, offset + i, allocator);
+    }
+  }
+
+  /// Returns number of unique values including null. Sorts and deduplicates
+  /// the pending values first.
+  size_t size(HashStringAllocator* allocator) {
+    finalize(allocator);
+    return size_ + (hasNull ? 1 : 0);
+  }
+
+  /// Copies the unique values in ascending order followed by a null, if any,
+  /// into 'values' starting at 'offset'.
+  vector_size_t extractValues(
+      FlatVector<T>& values,
+      vector_size_t offset,
+      HashStringAllocator* allocator) {
+    finalize(allocator);
+    vector_size_t index = offset;
+    if (size_ > 0) {
+      ByteStream stream;
+      HashStringAllocator::prepareRead(begin_, stream);
+      for (auto i = 0; i < size_; ++i) {
+        T value;
+        stream.readBytes(reinterpret_cast<uint8_t*>(&value), sizeof(T));
+        values.set(index++, value);
+      }
+    }
+
+    if (hasNull) {
+      values.setNull(index++, true);
+    }
+
+    return index - offset;
+  }
+
+  void free(HashStringAllocator& allocator) {
+    if (begin_ != nullptr) {
+      allocator.free(begin_);
+    }
+  }
+
+ private:
+  // Sorts the appended values and rewrites the run with duplicates removed.
+  // No-op if there were no appends since the last call.
+  void finalize(HashStringAllocator* allocator) {
+    if (sorted_ || size_ == 0) {
+      return;
+    }
+    std::vector<T> scratch(size_);
+    ByteStream in;
+    HashStringAllocator::prepareRead(begin_, in);
+    for (auto& value : scratch) {
+      in.readBytes(reinterpret_cast<uint8_t*>(&value), sizeof(T));
+    }
+    std::sort(scratch.begin(), scratch.end());
+    auto end = std::unique(scratch.begin(), scratch.end());
+    size_ = end - scratch.begin();
+
+    allocator->free(begin_);
+    ByteStream out(allocator);
+    begin_ = allocator->newWrite(out, size_ * sizeof(T)).header;
+    out.append(folly::Range<const T*>(scratch.data(), size_));
+    current_ = allocator->finishWrite(out, 0).second;
+    sorted_ = true;
+  }
+
+  void append(T value, HashStringAllocator* allocator) {
+    ByteStream stream(allocator);
+    if (begin_ == nullptr) {
+      begin_ = allocator->newWrite(stream, kInitialBytes).header;
+    } else {
+      allocator->extendWrite(current_, stream);
+    }
+    stream.appendOne(value);
+    // Leave space up to the size appended so far, at least 24 bytes but no
+    // more than 1024.
+    current_ = allocator
+                   ->finishWrite(
+                       stream,
+                       std::clamp<int32_t>(size_ * sizeof(T), 24, 1024))
+                   .second;
+    ++size_;
+    sorted_ = false;
+  }
+
+  // Initial allocation, compact for groups with few values.
+  static constexpr int32_t kInitialBytes = 44;
+
+  // The run of values (potentially multi-part).
+  HashStringAllocator::Header* begin_{nullptr};
+  HashStringAllocator::Position current_{nullptr, nullptr};
+
+  // Number of values in the run. Unique count after finalize().
+  vector_size_t size_{0};
+
+  // True if the run holds sorted unique values and nothing was appended
+  // since.
+  bool sorted_{false};
+};
+
 template <typename T>
 struct SetAccumulatorTypeTraits {
   using AccumulatorType = SetAccumulator<T>;
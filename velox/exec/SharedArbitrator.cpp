@@ -16,6 +16,8 @@
 
 #include "velox/exec/SharedArbitrator.h"
 
+#include <algorithm>
+
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/testutil/TestValue.h"
 #include "velox/common/time/Timer.h"
@@ -379,19 +381,42 @@ uint64_t SharedArbitrator::reclaimUsedMemoryFromCandidates(
   // Sort candidate memory pools based on their reclaimable memory.
   sortCandidatesByReclaimableMemory(candidates);
 
-  int64_t freedBytes{0};
-  for (const auto& candidate : candidates) {
-    VELOX_CHECK_LT(freedBytes, targetBytes);
-    if (!candidate.reclaimable || candidate.reclaimableBytes == 0) {
-      break;
+  // The sort above puts the non-reclaimable candidates at the end so the
+  // leading entries form the reclaimable set.
+  size_t numReclaimable{0};
+  while (numReclaimable < candidates.size() &&
+         candidates[numReclaimable].reclaimable &&
+         candidates[numReclaimable].reclaimableBytes > 0) {
+    ++numReclaimable;
+  }
+
+  uint64_t freedBytes{0};
+  while (freedBytes < targetBytes && numReclaimable > 0) {
+    const uint64_t bytesNeeded = targetBytes - freedBytes;
+    // Reclaim from the smallest candidate that can cover the remaining
+    // shortfall by itself so that a small request does not spill the operator
+    // with the most state, which is also the most expensive one to restore.
+    // If no candidate is large enough, fall back to the largest one.
+    size_t victimIdx{0};
+    for (size_t i = numReclaimable; i-- > 0;) {
+      if (candidates[i].reclaimableBytes >= bytesNeeded) {
+        victimIdx = i;
+        break;
+      }
     }
-    const int64_t bytesToReclaim = std::max<int64_t>(
-        targetBytes - freedBytes, memoryPoolTransferCapacity_);
-    VELOX_CHECK_GT(bytesToReclaim, 0);
-    freedBytes += reclaim(candidate.pool, bytesToReclaim);
-    if ((freedBytes >= targetBytes) || requestor->aborted()) {
+    const uint64_t bytesToReclaim =
+        std::max<uint64_t>(bytesNeeded, memoryPoolTransferCapacity_);
+    freedBytes += reclaim(candidates[victimIdx].pool, bytesToReclaim);
+    if (requestor->aborted()) {
       break;
     }
+    // Move the used victim past the reclaimable range, keeping the remaining
+    // candidates sorted.
+    std::rotate(
+        candidates.begin() + victimIdx,
+        candidates.begin() + victimIdx + 1,
+        candidates.begin() + numReclaimable);
+    --numReclaimable;
   }
   return freedBytes;
 }
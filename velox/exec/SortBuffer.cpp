@@ -17,14 +17,85 @@
 #include "SortBuffer.h"
 #include "velox/exec/MemoryReclaimer.h"
 #include "velox/vector/BaseVector.h"
+#include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
 
+namespace {
+
+// A row pointer prefixed with an order-preserving 64-bit encoding of the
+// leading sort key. Most comparisons are decided on the prefix with a single
+// integer compare; rows with equal prefixes fall back to full row comparison.
+struct PrefixedRow {
+  uint64_t prefix;
+  char* row;
+};
+
+// Nearly sorted input with fewer sorted runs than this is ordered by merging
+// the runs; with more runs a full sort is cheaper.
+constexpr size_t kMaxSortedRunsToMerge = 16;
+
+template <TypeKind Kind>
+void fillPrefixesTyped(
+    RowContainer& data,
+    const CompareFlags& flags,
+    memory::MemoryPool* pool,
+    std::vector<PrefixedRow>& rows) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  const auto numRows = static_cast<vector_size_t>(rows.size());
+  auto values = BaseVector::create<FlatVector<T>>(
+      data.keyTypes()[0], numRows, pool);
+  std::vector<char*> rawRows(numRows);
+  for (vector_size_t i = 0; i < numRows; ++i) {
+    rawRows[i] = rows[i].row;
+  }
+  data.extractColumn(rawRows.data(), numRows, 0, values);
+  const uint64_t nullPrefix =
+      flags.nullsFirst ? 0 : std::numeric_limits<uint64_t>::max();
+  for (vector_size_t i = 0; i < numRows; ++i) {
+    if (values->isNullAt(i)) {
+      rows[i].prefix = nullPrefix;
+      continue;
+    }
+    // Flip the sign bit so that two's complement order matches unsigned
+    // order.
+    uint64_t prefix = static_cast<uint64_t>(
+                          static_cast<int64_t>(values->valueAt(i))) ^
+        (uint64_t(1) << 63);
+    rows[i].prefix = flags.ascending ? prefix : ~prefix;
+  }
+}
+
+// Fills the order-preserving prefix of the leading sort key for 'rows'.
+// Returns false if the key type does not support prefix encoding.
+bool fillPrefixes(
+    RowContainer& data,
+    const CompareFlags& flags,
+    memory::MemoryPool* pool,
+    std::vector<PrefixedRow>& rows) {
+  switch (data.keyTypes()[0]->kind()) {
+    case TypeKind::TINYINT:
+      fillPrefixesTyped<TypeKind::TINYINT>(data, flags, pool, rows);
+      return true;
+    case TypeKind::SMALLINT:
+      fillPrefixesTyped<TypeKind::SMALLINT>(data, flags, pool, rows);
+      return true;
+    case TypeKind::INTEGER:
+      fillPrefixesTyped<TypeKind::INTEGER>(data, flags, pool, rows);
+      return true;
+    case TypeKind::BIGINT:
+      fillPrefixesTyped<TypeKind::BIGINT>(data, flags, pool, rows);
+      return true;
+    default:
+      return false;
+  }
+}
+} // namespace
+
 SortBuffer::SortBuffer(
     const RowTypePtr& input,
     const std::vector<column_index_t>& sortColumnIndices,
     const std::vector<CompareFlags>& sortCompareFlags,
-    uint32_t outputBatchSize,
     velox::memory::MemoryPool* pool,
     tsan_atomic<bool>* nonReclaimableSection,
     uint32_t* numSpillRuns,
@@ -32,7 +103,6 @@ SortBuffer::SortBuffer(
     uint64_t spillMemoryThreshold)
     : input_(input),
       sortCompareFlags_(sortCompareFlags),
-      outputBatchSize_(outputBatchSize),
       pool_(pool),
       nonReclaimableSection_(nonReclaimableSection),
       numSpillRuns_(numSpillRuns),
@@ -41,7 +111,6 @@ SortBuffer::SortBuffer(
   VELOX_CHECK_GE(input_->size(), sortCompareFlags_.size());
   VELOX_CHECK_GT(sortCompareFlags_.size(), 0);
   VELOX_CHECK_EQ(sortColumnIndices.size(), sortCompareFlags_.size());
-  VELOX_CHECK_GT(outputBatchSize_, 0);
   VELOX_CHECK_NOT_NULL(nonReclaimableSection_);
   VELOX_CHECK_NOT_NULL(numSpillRuns_);
 
@@ -78,6 +147,12 @@ SortBuffer::SortBuffer(
 
   data_ = std::make_unique<RowContainer>(
       sortedColumnTypes, nonSortedColumnTypes, pool_);
+  std::vector<std::pair<column_index_t, CompareFlags>> comparatorKeys;
+  comparatorKeys.reserve(sortCompareFlags_.size());
+  for (column_index_t i = 0; i < sortCompareFlags_.size(); ++i) {
+    comparatorKeys.emplace_back(i, sortCompareFlags_[i]);
+  }
+  rowComparator_ = data_->createComparator(comparatorKeys);
   spillerStoreType_ =
       ROW(std::move(sortedSpillColumnNames), std::move(sortedSpillColumnTypes));
 }
@@ -99,9 +174,54 @@ void SortBuffer::addInput(const VectorPtr& input) {
       data_->store(decoded, i, rows[i], columnProjection.inputChannel);
     }
   }
+  if (spiller_ == nullptr) {
+    for (vector_size_t i = 0; i < input->size(); ++i) {
+      if (lastInputRow_ != nullptr &&
+          rowComparator_(lastInputRow_, rows[i]) > 0) {
+        runStarts_.push_back(numInputRows_ + i);
+      }
+      lastInputRow_ = rows[i];
+    }
+  }
   numInputRows_ += allRows.size();
 }
 
+bool SortBuffer::compareRows(const char* leftRow, const char* rightRow) const {
+  return rowComparator_(leftRow, rightRow) < 0;
+}
+
+void SortBuffer::mergeSortedRuns() {
+  // Start offsets of the remaining runs. Runs are contiguous in
+  // 'sortedRows_': each run ends where the next begins and the last ends at
+  // 'numInputRows_'.
+  std::vector<vector_size_t> starts;
+  starts.reserve(runStarts_.size() + 1);
+  starts.push_back(0);
+  starts.insert(starts.end(), runStarts_.begin(), runStarts_.end());
+  const auto lessThan = [this](const char* leftRow, const char* rightRow) {
+    return rowComparator_(leftRow, rightRow) < 0;
+  };
+  // Merge pairs of adjacent runs until a single run remains.
+  while (starts.size() > 1) {
+    std::vector<vector_size_t> merged;
+    merged.reserve(starts.size() / 2 + 1);
+    for (size_t i = 0; i < starts.size(); i += 2) {
+      merged.push_back(starts[i]);
+      if (i + 1 == starts.size()) {
+        break;
+      }
+      const auto end =
+          i + 2 < starts.size() ? starts[i + 2] : vector_size_t(numInputRows_);
+      std::inplace_merge(
+          sortedRows_.begin() + starts[i],
+          sortedRows_.begin() + starts[i + 1],
+          sortedRows_.begin() + end,
+          lessThan);
+    }
+    starts = std::move(merged);
+  }
+}
+
 void SortBuffer::noMoreInput() {
   VELOX_CHECK(!noMoreInput_);
   noMoreInput_ = true;
@@ -118,19 +238,46 @@ void SortBuffer::noMoreInput() {
     sortedRows_.resize(numInputRows_);
     RowContainerIterator iter;
     data_->listRows(&iter, numInputRows_, sortedRows_.data());
-    std::sort(
-        sortedRows_.begin(),
-        sortedRows_.end(),
-        [this](const char* leftRow, const char* rightRow) {
-          for (vector_size_t index = 0; index < sortCompareFlags_.size();
-               ++index) {
-            if (auto result = data_->compare(
-                    leftRow, rightRow, index, sortCompareFlags_[index])) {
-              return result < 0;
+    if (runStarts_.empty()) {
+      // listRows() returns rows in insertion order and the input arrived
+      // sorted on the sort keys, e.g. when compacting already sorted
+      // partitions. Nothing to sort.
+      return;
+    }
+    if (runStarts_.size() < kMaxSortedRunsToMerge) {
+      // Nearly sorted input: merging the few runs is cheaper than a full
+      // sort.
+      mergeSortedRuns();
+      return;
+    }
+    std::vector<PrefixedRow> prefixedRows(numInputRows_);
+    for (size_t i = 0; i < numInputRows_; ++i) {
+      prefixedRows[i].row = sortedRows_[i];
+    }
+    if (fillPrefixes(*data_, sortCompareFlags_[0], pool_, prefixedRows)) {
+      // Most comparisons are decided on the normalized prefix of the leading
+      // key without touching the rows; ties, including null collisions with
+      // extreme values, re-compare the full keys.
+      std::sort(
+          prefixedRows.begin(),
+          prefixedRows.end(),
+          [this](const PrefixedRow& left, const PrefixedRow& right) {
+            if (left.prefix != right.prefix) {
+              return left.prefix < right.prefix;
             }
-          }
-          return false;
-        });
+            return compareRows(left.row, right.row);
+          });
+      for (size_t i = 0; i < numInputRows_; ++i) {
+        sortedRows_[i] = prefixedRows[i].row;
+      }
+    } else {
+      std::sort(
+          sortedRows_.begin(),
+          sortedRows_.end(),
+          [this](const char* leftRow, const char* rightRow) {
+            return compareRows(leftRow, rightRow);
+          });
+    }
   } else {
     // Finish spill, and we shouldn't get any rows from non-spilled partition as
     // there is only one hash partition for SortBuffer.
@@ -140,19 +287,18 @@ void SortBuffer::noMoreInput() {
 
     VELOX_CHECK_NULL(spillMerger_);
     spillMerger_ = spiller_->startMerge(0);
-    spillSources_.resize(outputBatchSize_);
-    spillSourceRows_.resize(outputBatchSize_);
   }
 }
 
-RowVectorPtr SortBuffer::getOutput() {
+RowVectorPtr SortBuffer::getOutput(uint32_t maxOutputRows) {
   VELOX_CHECK(noMoreInput_);
+  VELOX_CHECK_GT(maxOutputRows, 0);
 
   if (numOutputRows_ == numInputRows_) {
     return nullptr;
   }
 
-  prepareOutput();
+  prepareOutput(maxOutputRows);
   if (spiller_ != nullptr) {
     getOutputWithSpill();
   } else {
@@ -161,6 +307,17 @@ RowVectorPtr SortBuffer::getOutput() {
   return output_;
 }
 
+std::optional<uint64_t> SortBuffer::estimateOutputRowSize() const {
+  if (data_ == nullptr || data_->numRows() == 0) {
+    return std::nullopt;
+  }
+  const std::optional<int64_t> rowSize = data_->estimateRowSize();
+  if (!rowSize.has_value()) {
+    return std::nullopt;
+  }
+  return rowSize.value();
+}
+
 void SortBuffer::spill(int64_t targetRows, int64_t targetBytes) {
   VELOX_CHECK_NOT_NULL(
       spillConfig_, "spill config is null when SortBuffer spill is called");
@@ -173,6 +330,10 @@ void SortBuffer::spill(int64_t targetRows, int64_t targetBytes) {
   }
 
   ++(*numSpillRuns_);
+  // Spilled rows are freed from 'data_', so stop tracking sorted runs; the
+  // spill path orders rows through the spill merge instead.
+  lastInputRow_ = nullptr;
+  runStarts_.clear();
   if (spiller_ == nullptr) {
     spiller_ = std::make_unique<Spiller>(
         Spiller::Type::kOrderBy,
@@ -287,11 +448,11 @@ void SortBuffer::ensureInputFits(const VectorPtr& input) {
           0, outOfLineBytes - (rowsToSpill * outOfLineBytesPerRow)));
 }
 
-void SortBuffer::prepareOutput() {
+void SortBuffer::prepareOutput(uint32_t maxOutputRows) {
   VELOX_CHECK_GT(numInputRows_, numOutputRows_);
 
   const vector_size_t batchSize =
-      std::min<vector_size_t>(numInputRows_ - numOutputRows_, outputBatchSize_);
+      std::min<vector_size_t>(numInputRows_ - numOutputRows_, maxOutputRows);
   if (output_ != nullptr) {
     VectorPtr output = std::move(output_);
     BaseVector::prepareForReuse(output, batchSize);
@@ -308,7 +469,6 @@ void SortBuffer::prepareOutput() {
 
 void SortBuffer::getOutputWithoutSpill() {
   VELOX_CHECK_GT(output_->size(), 0);
-  VELOX_DCHECK_LE(output_->size(), outputBatchSize_);
   VELOX_CHECK_LE(output_->size() + numOutputRows_, numInputRows_);
   VELOX_DCHECK_EQ(numInputRows_, sortedRows_.size());
 
@@ -325,8 +485,10 @@ void SortBuffer::getOutputWithoutSpill() {
 void SortBuffer::getOutputWithSpill() {
   VELOX_CHECK_NOT_NULL(spillMerger_);
   VELOX_DCHECK_EQ(sortedRows_.size(), 0);
-  VELOX_DCHECK_EQ(spillSources_.size(), outputBatchSize_);
-  VELOX_DCHECK_EQ(spillSourceRows_.size(), outputBatchSize_);
+  if (spillSources_.size() < output_->size()) {
+    spillSources_.resize(output_->size());
+    spillSourceRows_.resize(output_->size());
+  }
 
   int32_t outputRow = 0;
   int32_t outputSize = 0;
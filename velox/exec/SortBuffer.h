@@ -34,7 +34,6 @@ class SortBuffer {
       const RowTypePtr& input,
       const std::vector<column_index_t>& sortColumnIndices,
       const std::vector<CompareFlags>& sortCompareFlags,
-      uint32_t outputBatchSize,
       velox::memory::MemoryPool* pool,
       tsan_atomic<bool>* nonReclaimableSection,
       uint32_t* numSpillRuns,
@@ -49,8 +48,15 @@ class SortBuffer {
   ///  processing for the output.
   void noMoreInput();
 
-  /// Returns the sorted output rows in batch.
-  RowVectorPtr getOutput();
+  /// Returns the sorted output rows in batch. 'maxOutputRows' caps the number
+  /// of rows in the batch; callers derive it from the average row size so
+  /// batches target the preferred output batch bytes.
+  RowVectorPtr getOutput(uint32_t maxOutputRows);
+
+  /// Returns the average size of the accumulated rows if it can be estimated,
+  /// e.g. to size output batches. Returns std::nullopt before any input or
+  /// after all rows have been spilled.
+  std::optional<uint64_t> estimateOutputRowSize() const;
 
   /// Indicates if this sort buffer can spill or not.
   bool canSpill() const {
@@ -79,14 +85,17 @@ class SortBuffer {
   // Ensures there is sufficient memory reserved to process 'input'.
   void ensureInputFits(const VectorPtr& input);
   // Invoked to initialize or reset the reusable output buffer to get output.
-  void prepareOutput();
+  void prepareOutput(uint32_t maxOutputRows);
+  // Returns true if 'leftRow' orders before 'rightRow' on the sort keys.
+  bool compareRows(const char* leftRow, const char* rightRow) const;
+  // Merges the contiguous sorted runs in 'sortedRows_' delimited by
+  // 'runStarts_' into fully sorted order.
+  void mergeSortedRuns();
   void getOutputWithoutSpill();
   void getOutputWithSpill();
 
   const RowTypePtr input_;
   const std::vector<CompareFlags> sortCompareFlags_;
-  // Maximum number of rows to return in one output batch.
-  const uint32_t outputBatchSize_;
   velox::memory::MemoryPool* const pool_;
   // The flag is passed from the associated operator such as OrderBy or
   // TableWriter to indicate if this sort buffer object is under non-reclaimable
@@ -112,7 +121,20 @@ class SortBuffer {
   size_t numInputRows_ = 0;
   // Used to store the input data in row format.
   std::unique_ptr<RowContainer> data_;
+  // Compares two rows in 'data_' on the sort keys. Created once from
+  // 'sortCompareFlags_' so frequent key shapes use a fused comparator.
+  std::function<int32_t(const char*, const char*)> rowComparator_;
   std::vector<char*> sortedRows_;
+  // Row index of the first row of each sorted run detected at input time. Row
+  // 'i' starts a new run when it compares less than row 'i - 1' on the sort
+  // keys. Empty means all input so far arrived in sorted order, e.g. when
+  // compacting already sorted partitions, so noMoreInput() skips the sort;
+  // a few runs are merged instead of fully sorted. Cleared when spilling
+  // starts since the spill path sorts through the spill merge.
+  std::vector<vector_size_t> runStarts_;
+  // The last row stored into 'data_', to detect run breaks across input
+  // batches. Cleared when spilling starts since spilled rows are freed.
+  char* lastInputRow_{nullptr};
 
   // The data type of the rows stored in 'data_' and spilled on disk. The
   // sort key columns are stored first then the non-sorted data columns.
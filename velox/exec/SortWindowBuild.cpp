@@ -197,11 +197,19 @@ void SortWindowBuild::sortPartitions() {
   RowContainerIterator iter;
   data_->listRows(&iter, numRows_, sortedRows_.data());
 
+  std::vector<std::pair<column_index_t, CompareFlags>> comparatorKeys;
+  comparatorKeys.reserve(allKeyInfo_.size());
+  for (const auto& [channel, order] : allKeyInfo_) {
+    comparatorKeys.emplace_back(
+        channel,
+        CompareFlags{order.isNullsFirst(), order.isAscending(), false});
+  }
+  const auto comparator = data_->createComparator(comparatorKeys);
   std::sort(
       sortedRows_.begin(),
       sortedRows_.end(),
-      [this](const char* leftRow, const char* rightRow) {
-        return compareRowsWithKeys(leftRow, rightRow, allKeyInfo_);
+      [&](const char* leftRow, const char* rightRow) {
+        return comparator(leftRow, rightRow) < 0;
       });
 
   computePartitionStartRows();
@@ -270,12 +278,11 @@ void SortWindowBuild::loadNextPartitionFromSpill() {
   }
 }
 
-std::unique_ptr<WindowPartition> SortWindowBuild::nextPartition() {
+WindowPartition* SortWindowBuild::nextPartition() {
   if (merge_ != nullptr) {
     VELOX_CHECK(!sortedRows_.empty(), "No window partitions available")
     auto partition = folly::Range(sortedRows_.data(), sortedRows_.size());
-    return std::make_unique<WindowPartition>(
-        data_.get(), partition, inputColumns_, sortKeyInfo_);
+    return makeWindowPartition(partition);
   }
 
   VELOX_CHECK(!partitionStartRows_.empty(), "No window partitions available")
@@ -292,8 +299,7 @@ std::unique_ptr<WindowPartition> SortWindowBuild::nextPartition() {
   auto partition = folly::Range(
       sortedRows_.data() + partitionStartRows_[currentPartition_],
       partitionSize);
-  return std::make_unique<WindowPartition>(
-      data_.get(), partition, inputColumns_, sortKeyInfo_);
+  return makeWindowPartition(partition);
 }
 
 bool SortWindowBuild::hasNextPartition() {
@@ -52,7 +52,7 @@ class SortWindowBuild : public WindowBuild {
 
   bool hasNextPartition() override;
 
-  std::unique_ptr<WindowPartition> nextPartition() override;
+  WindowPartition* nextPartition() override;
 
  private:
   void ensureInputFits(const RowVectorPtr& input);
@@ -48,6 +48,7 @@ struct RowPointers {
       firstBlock = nullptr;
       currentBlock = {nullptr, nullptr};
     }
+    size = 0;
   }
 
   std::vector<char*> read(HashStringAllocator& allocator) {
@@ -311,6 +312,24 @@ void SortedAggregations::extractValues(
         groups.data(),
         folly::Range<const int32_t*>(iota(groups.size(), temp), groups.size()));
   }
+
+  // All aggregates have consumed the inputs accumulated for 'groups'. Free
+  // the input rows and row-pointer lists right away. When input is clustered
+  // on the grouping keys and groups are emitted as soon as they are complete,
+  // this caps the buffered input at the size of a single cluster instead of
+  // the whole partition.
+  std::vector<char*> inputRows;
+  for (auto* group : groups) {
+    auto* accumulator = reinterpret_cast<RowPointers*>(group + offset_);
+    auto groupRows = accumulator->read(*allocator_);
+    inputRows.insert(inputRows.end(), groupRows.begin(), groupRows.end());
+    accumulator->free(*allocator_);
+  }
+  inputData_->eraseRows(folly::Range(inputRows.data(), inputRows.size()));
+}
+
+void SortedAggregations::clear() {
+  inputData_->clear();
 }
 
 } // namespace facebook::velox::exec
@@ -65,9 +65,16 @@ class SortedAggregations {
   void noMoreInput();
 
   /// Sorts input row for the specified groups, computes aggregations and stores
-  /// results in the specified 'result' vector.
+  /// results in the specified 'result' vector. Frees the input rows accumulated
+  /// for 'groups' afterwards. When input is clustered on the grouping keys and
+  /// groups are emitted as soon as they are complete, this caps the buffered
+  /// input at the size of a single cluster instead of the whole partition.
   void extractValues(folly::Range<char**> groups, const RowVectorPtr& result);
 
+  /// Resets the row container storing input rows and returns its memory.
+  /// Called after all groups have been extracted.
+  void clear();
+
  private:
   void addNewRow(char* group, char* newRow);
 
@@ -46,12 +46,62 @@ folly::Synchronized<SpillStats>& localSpillStats() {
 
 std::atomic<int32_t> SpillFile::ordinalCounter_;
 
+SpillInput::~SpillInput() {
+  // Let any read-ahead in flight finish before releasing the buffer it reads
+  // into. Ignore its outcome.
+  if (readAhead_.valid()) {
+    std::move(readAhead_).wait();
+  }
+}
+
 void SpillInput::next(bool /*throwIfPastEnd*/) {
-  int32_t readBytes = std::min(input_->size() - offset_, buffer_->capacity());
-  VELOX_CHECK_LT(0, readBytes, "Reading past end of spill file");
-  setRange({buffer_->asMutable<uint8_t>(), readBytes, 0});
-  input_->pread(offset_, readBytes, buffer_->asMutable<char>());
-  offset_ += readBytes;
+  const auto readAheadBytes = waitForReadAhead();
+  if (readAheadBytes.has_value()) {
+    std::swap(buffer_, readAheadBuffer_);
+    setRange(
+        {buffer_->asMutable<uint8_t>(),
+         static_cast<int32_t>(readAheadBytes.value()),
+         0});
+    offset_ += readAheadBytes.value();
+  } else {
+    int32_t readBytes = std::min(input_->size() - offset_, buffer_->capacity());
+    VELOX_CHECK_LT(0, readBytes, "Reading past end of spill file");
+    setRange({buffer_->asMutable<uint8_t>(), readBytes, 0});
+    input_->pread(offset_, readBytes, buffer_->asMutable<char>());
+    offset_ += readBytes;
+  }
+  maybeIssueReadAhead();
+}
+
+void SpillInput::maybeIssueReadAhead() {
+  VELOX_DCHECK(!readAhead_.valid());
+  if (executor_ == nullptr || readAheadBuffer_ == nullptr ||
+      offset_ >= size_) {
+    return;
+  }
+  const auto readBytes =
+      std::min(size_ - offset_, readAheadBuffer_->capacity());
+  auto [promise, future] = folly::makePromiseContract<uint64_t>();
+  readAhead_ = std::move(future);
+  executor_->add([this,
+                  offset = offset_,
+                  readBytes,
+                  _promise = std::move(promise)]() mutable {
+    _promise.setTry(folly::makeTryWith([&] {
+      input_->pread(offset, readBytes, readAheadBuffer_->asMutable<char>());
+      return readBytes;
+    }));
+  });
+}
+
+std::optional<uint64_t> SpillInput::waitForReadAhead() {
+  if (!readAhead_.valid()) {
+    return std::nullopt;
+  }
+  auto future = std::move(readAhead_);
+  readAhead_ = folly::SemiFuture<uint64_t>::makeEmpty();
+  // Rethrows if the read-ahead failed.
+  return std::move(future).get();
 }
 
 void SpillMergeStream::pop() {
@@ -102,7 +152,8 @@ SpillFile::SpillFile(
     const std::vector<CompareFlags>& sortCompareFlags,
     const std::string& path,
     common::CompressionKind compressionKind,
-    memory::MemoryPool* pool)
+    memory::MemoryPool* pool,
+    folly::Executor* FOLLY_NULLABLE executor)
     : id_(id),
       type_(std::move(type)),
       numSortingKeys_(numSortingKeys),
@@ -110,7 +161,8 @@ SpillFile::SpillFile(
       ordinal_(ordinalCounter_++),
       path_(fmt::format("{}-{}", path, ordinal_)),
       compressionKind_(compressionKind),
-      pool_(pool) {
+      pool_(pool),
+      executor_(executor) {
   // NOTE: if the spilling operator has specified the sort comparison flags,
   // then it must match the number of sorting keys.
   VELOX_CHECK(
@@ -120,7 +172,11 @@ SpillFile::SpillFile(
 WriteFile& SpillFile::output() {
   if (!output_) {
     auto fs = filesystems::getFileSystem(path_, nullptr);
-    output_ = fs->openFileForWrite(path_);
+    // Spill data is written once and read back at most once, so ask the file
+    // system to keep it out of the OS page cache.
+    filesystems::FileOptions options;
+    options.values[filesystems::FileOptions::kDropCacheOnWrite] = "true";
+    output_ = fs->openFileForWrite(path_, options);
   }
   return *output_;
 }
@@ -132,9 +188,18 @@ void SpillFile::startRead() {
   VELOX_CHECK(!input_);
   auto fs = filesystems::getFileSystem(path_, nullptr);
   auto file = fs->openFileForRead(path_);
-  auto buffer = AlignedBuffer::allocate<char>(
-      std::min<uint64_t>(fileSize_, kMaxReadBufferSize), pool_);
-  input_ = std::make_unique<SpillInput>(std::move(file), std::move(buffer));
+  const auto bufferSize = std::min<uint64_t>(fileSize_, kMaxReadBufferSize);
+  auto buffer = AlignedBuffer::allocate<char>(bufferSize, pool_);
+  // Only files larger than one buffer benefit from read-ahead.
+  BufferPtr readAheadBuffer;
+  if (executor_ != nullptr && fileSize_ > bufferSize) {
+    readAheadBuffer = AlignedBuffer::allocate<char>(bufferSize, pool_);
+  }
+  input_ = std::make_unique<SpillInput>(
+      std::move(file),
+      std::move(buffer),
+      std::move(readAheadBuffer),
+      executor_);
 }
 
 bool SpillFile::nextBatch(RowVectorPtr& rowVector) {
@@ -156,7 +221,8 @@ SpillFileList::SpillFileList(
     uint64_t writeBufferSize,
     common::CompressionKind compressionKind,
     memory::MemoryPool* pool,
-    folly::Synchronized<SpillStats>* stats)
+    folly::Synchronized<SpillStats>* stats,
+    folly::Executor* FOLLY_NULLABLE executor)
     : type_(type),
       numSortingKeys_(numSortingKeys),
       sortCompareFlags_(sortCompareFlags),
@@ -165,7 +231,8 @@ SpillFileList::SpillFileList(
       writeBufferSize_(writeBufferSize),
       compressionKind_(compressionKind),
       pool_(pool),
-      stats_(stats) {
+      stats_(stats),
+      executor_(executor) {
   // NOTE: if the associated spilling operator has specified the sort
   // comparison flags, then it must match the number of sorting keys.
   VELOX_CHECK(
@@ -186,7 +253,8 @@ WriteFile& SpillFileList::currentOutput() {
         sortCompareFlags_,
         fmt::format("{}-{}", path_, files_.size()),
         compressionKind_,
-        pool_));
+        pool_,
+        executor_));
   }
   return files_.back()->output();
 }
@@ -311,7 +379,8 @@ SpillState::SpillState(
     uint64_t writeBufferSize,
     common::CompressionKind compressionKind,
     memory::MemoryPool* pool,
-    folly::Synchronized<SpillStats>* stats)
+    folly::Synchronized<SpillStats>* stats,
+    folly::Executor* FOLLY_NULLABLE executor)
     : path_(path),
       maxPartitions_(maxPartitions),
       numSortingKeys_(numSortingKeys),
@@ -321,6 +390,7 @@ SpillState::SpillState(
       compressionKind_(compressionKind),
       pool_(pool),
       stats_(stats),
+      executor_(executor),
       files_(maxPartitions_) {}
 
 void SpillState::setPartitionSpilled(int32_t partition) {
@@ -358,7 +428,8 @@ uint64_t SpillState::appendToPartition(
         writeBufferSize_,
         compressionKind_,
         pool_,
-        stats_);
+        stats_,
+        executor_);
   }
   updateSpilledInputBytes(rows->estimateFlatSize());
 
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <folly/Executor.h>
 #include <folly/container/F14Set.h>
+#include <folly/futures/Future.h>
+
+#include <optional>
 
 #include "velox/common/compression/Compression.h"
 #include "velox/common/file/File.h"
@@ -31,14 +35,25 @@ namespace facebook::velox::exec {
 // Input stream backed by spill file.
 class SpillInput : public ByteStream {
  public:
-  // Reads from 'input' using 'buffer' for buffering reads.
-  SpillInput(std::unique_ptr<ReadFile>&& input, BufferPtr buffer)
+  // Reads from 'input' using 'buffer' for buffering reads. If 'executor' and
+  // 'readAheadBuffer' are both set, the buffer after the current one is read
+  // on 'executor' while the current one is being consumed, so a merge of many
+  // spilled runs does not block on a disk read at every buffer boundary.
+  SpillInput(
+      std::unique_ptr<ReadFile>&& input,
+      BufferPtr buffer,
+      BufferPtr readAheadBuffer = nullptr,
+      folly::Executor* FOLLY_NULLABLE executor = nullptr)
       : input_(std::move(input)),
         buffer_(std::move(buffer)),
-        size_(input_->size()) {
+        size_(input_->size()),
+        readAheadBuffer_(std::move(readAheadBuffer)),
+        executor_(executor) {
     next(true);
   }
 
+  ~SpillInput() override;
+
   void next(bool throwIfPastEnd) override;
 
   // True if all of the file has been read into vectors.
@@ -47,11 +62,27 @@ class SpillInput : public ByteStream {
   }
 
  private:
+  // Starts reading the region after 'offset_' into 'readAheadBuffer_' on
+  // 'executor_' if read-ahead is enabled and there is data left.
+  void maybeIssueReadAhead();
+
+  // Waits for any read-ahead in flight. Returns the number of bytes read into
+  // 'readAheadBuffer_' or std::nullopt if no read-ahead was pending.
+  std::optional<uint64_t> waitForReadAhead();
+
   std::unique_ptr<ReadFile> input_;
   BufferPtr buffer_;
   const uint64_t size_;
   // Offset of first byte not in 'buffer_'
   uint64_t offset_ = 0;
+  // Second buffer for read-ahead, swapped with 'buffer_' when the read-ahead
+  // data is consumed. Null if read-ahead is disabled.
+  BufferPtr readAheadBuffer_;
+  folly::Executor* FOLLY_NULLABLE executor_;
+  // Completes with the number of bytes read when the read-ahead in flight
+  // finishes. Invalid if none is pending.
+  folly::SemiFuture<uint64_t> readAhead_{
+      folly::SemiFuture<uint64_t>::makeEmpty()};
 };
 
 /// Represents a spill file that is first in write mode and then
@@ -71,7 +102,8 @@ class SpillFile {
       const std::vector<CompareFlags>& sortCompareFlags,
       const std::string& path,
       common::CompressionKind compressionKind,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      folly::Executor* FOLLY_NULLABLE executor = nullptr);
 
   uint32_t id() const {
     return id_;
@@ -142,6 +174,8 @@ class SpillFile {
   const std::string path_;
   const common::CompressionKind compressionKind_;
   memory::MemoryPool* const pool_;
+  // If not null, used by 'input_' for read-ahead when reading back the file.
+  folly::Executor* const FOLLY_NULLABLE executor_;
 
   // Byte size of the backing file. Set when finishing writing.
   uint64_t fileSize_ = 0;
@@ -248,7 +282,8 @@ class SpillFileList {
       uint64_t writeBufferSize,
       common::CompressionKind compressionKind,
       memory::MemoryPool* pool,
-      folly::Synchronized<SpillStats>* stats);
+      folly::Synchronized<SpillStats>* stats,
+      folly::Executor* FOLLY_NULLABLE executor = nullptr);
 
   /// Adds 'rows' for the positions in 'indices' into 'this'. The indices
   /// must produce a view where the rows are sorted if sorting is desired.
@@ -301,6 +336,8 @@ class SpillFileList {
   const common::CompressionKind compressionKind_;
   memory::MemoryPool* const pool_;
   folly::Synchronized<SpillStats>* const stats_;
+  // Passed to the created spill files for read-ahead on restore.
+  folly::Executor* const FOLLY_NULLABLE executor_;
   uint32_t nextFileId_{0};
   std::unique_ptr<VectorStreamGroup> batch_;
   SpillFiles files_;
@@ -607,7 +644,8 @@ class SpillState {
       uint64_t writeBufferSize,
       common::CompressionKind compressionKind,
       memory::MemoryPool* pool,
-      folly::Synchronized<SpillStats>* stats);
+      folly::Synchronized<SpillStats>* stats,
+      folly::Executor* FOLLY_NULLABLE executor = nullptr);
 
   /// Indicates if a given 'partition' has been spilled or not.
   bool isPartitionSpilled(int32_t partition) const {
@@ -699,6 +737,8 @@ class SpillState {
   const common::CompressionKind compressionKind_;
   memory::MemoryPool* const pool_;
   folly::Synchronized<SpillStats>* const stats_;
+  // Passed down to the spill files for read-ahead on restore.
+  folly::Executor* const FOLLY_NULLABLE executor_;
 
   // A set of spilled partition numbers.
   SpillPartitionNumSet spilledPartitionSet_;
@@ -160,7 +160,8 @@ Spiller::Spiller(
           writeBufferSize,
           compressionKind,
           pool_,
-          &stats_) {
+          &stats_,
+          executor) {
   TestValue::adjust(
       "facebook::velox::exec::Spiller", const_cast<HashBitRange*>(&bits_));
 
@@ -187,7 +188,15 @@ void Spiller::extractSpill(folly::Range<char**> rows, RowVectorPtr& resultPtr) {
   auto result = resultPtr.get();
   auto& types = container_->columnTypes();
   for (auto i = 0; i < types.size(); ++i) {
-    container_->extractColumn(rows.data(), rows.size(), i, result->childAt(i));
+    if (!needSort()) {
+      // Unsorted content is serialized before the rows are erased, so strings
+      // can reference the container's memory instead of being copied.
+      container_->extractColumnReferencingStrings(
+          rows.data(), rows.size(), i, result->childAt(i));
+    } else {
+      container_->extractColumn(
+          rows.data(), rows.size(), i, result->childAt(i));
+    }
   }
 
   auto& accumulators = container_->accumulators();
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/exec/StreamingAggregation.h"
+#include "velox/common/base/BitUtil.h"
 #include "velox/exec/Aggregate.h"
 #include "velox/exec/RowContainer.h"
 
@@ -158,6 +159,66 @@ bool equalKeys(
 
   return true;
 }
+
+// Compares two non-null values. Matches BaseVector::equalValueAt semantics
+// where NaNs compare equal.
+template <typename T>
+FOLLY_ALWAYS_INLINE bool equalValues(const T& a, const T& b) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+  } else {
+    return a == b;
+  }
+}
+
+// Sets a bit in 'boundaries' for each row in [1, size) whose value in 'key'
+// differs from the previous row. Nulls compare equal to each other and
+// different from any value.
+template <TypeKind Kind>
+void markColumnBoundaries(
+    const DecodedVector& key,
+    vector_size_t size,
+    uint64_t* boundaries) {
+  if constexpr (
+      TypeTraits<Kind>::isPrimitiveType && Kind != TypeKind::BOOLEAN) {
+    using T = typename TypeTraits<Kind>::NativeType;
+    if (key.isIdentityMapping() && !key.mayHaveNulls()) {
+      // Tight branch-free-comparison loop over the flat values array.
+      const T* values = key.data<T>();
+      for (vector_size_t i = 1; i < size; ++i) {
+        if (!equalValues(values[i - 1], values[i])) {
+          bits::setBit(boundaries, i);
+        }
+      }
+      return;
+    }
+    for (vector_size_t i = 1; i < size; ++i) {
+      const bool prevNull = key.isNullAt(i - 1);
+      const bool isNull = key.isNullAt(i);
+      if (isNull || prevNull) {
+        if (isNull != prevNull) {
+          bits::setBit(boundaries, i);
+        }
+      } else if (!equalValues(key.valueAt<T>(i - 1), key.valueAt<T>(i))) {
+        bits::setBit(boundaries, i);
+      }
+    }
+  } else {
+    // Booleans and complex types compare through the base vector.
+    const auto* base = key.base();
+    for (vector_size_t i = 1; i < size; ++i) {
+      const bool prevNull = key.isNullAt(i - 1);
+      const bool isNull = key.isNullAt(i);
+      if (isNull || prevNull) {
+        if (isNull != prevNull) {
+          bits::setBit(boundaries, i);
+        }
+      } else if (!base->equalValueAt(base, key.index(i - 1), key.index(i))) {
+        bits::setBit(boundaries, i);
+      }
+    }
+  }
+}
 } // namespace
 
 char* StreamingAggregation::startNewGroup(vector_size_t index) {
@@ -203,41 +264,57 @@ RowVectorPtr StreamingAggregation::createOutput(size_t numGroups) {
   return output;
 }
 
+void StreamingAggregation::markGroupBoundaries() {
+  const auto numInput = input_->size();
+  groupBoundaries_.resize(bits::nwords(numInput));
+  std::fill(groupBoundaries_.begin(), groupBoundaries_.end(), 0);
+
+  for (const auto& key : decodedKeys_) {
+    VELOX_DYNAMIC_TYPE_DISPATCH_ALL(
+        markColumnBoundaries,
+        key.base()->typeKind(),
+        key,
+        numInput,
+        groupBoundaries_.data());
+  }
+}
+
 void StreamingAggregation::assignGroups() {
   auto numInput = input_->size();
 
   inputGroups_.resize(numInput);
 
-  // Look for the end of the last group.
+  for (auto i = 0; i < groupingKeys_.size(); ++i) {
+    decodedKeys_[i].decode(*input_->childAt(groupingKeys_[i]), inputRows_);
+  }
+
+  markGroupBoundaries();
+
+  // Look for the end of the last group. Only the first row needs comparing
+  // with the previous batch; the following rows continue the same group up to
+  // the first group boundary.
   vector_size_t index = 0;
-  if (prevInput_) {
-    auto prevIndex = prevInput_->size() - 1;
+  if (prevInput_ &&
+      equalKeys(
+          groupingKeys_, prevInput_, prevInput_->size() - 1, input_, 0)) {
     auto* prevGroup = groups_[numGroups_ - 1];
-    for (; index < numInput; ++index) {
-      if (equalKeys(groupingKeys_, prevInput_, prevIndex, input_, index)) {
-        inputGroups_[index] = prevGroup;
-      } else {
-        break;
-      }
+    inputGroups_[0] = prevGroup;
+    for (index = 1; index < numInput &&
+         !bits::isBitSet(groupBoundaries_.data(), index);
+         ++index) {
+      inputGroups_[index] = prevGroup;
     }
   }
 
   if (index < numInput) {
-    for (auto i = 0; i < groupingKeys_.size(); ++i) {
-      decodedKeys_[i].decode(*input_->childAt(groupingKeys_[i]), inputRows_);
-    }
-
     auto* newGroup = startNewGroup(index);
     inputGroups_[index] = newGroup;
 
     for (auto i = index + 1; i < numInput; ++i) {
-      if (equalKeys(groupingKeys_, input_, index, input_, i)) {
-        inputGroups_[i] = inputGroups_[index];
-      } else {
+      if (bits::isBitSet(groupBoundaries_.data(), i)) {
         newGroup = startNewGroup(i);
-        inputGroups_[i] = newGroup;
-        index = i;
       }
+      inputGroups_[i] = newGroup;
     }
   }
 }
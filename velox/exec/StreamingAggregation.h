@@ -67,6 +67,13 @@ class StreamingAggregation : public Operator {
   // assignments in inputGroups_.
   void assignGroups();
 
+  // Computes for each input row whether it starts a new group, i.e. differs
+  // from the previous row in at least one grouping key. Processes one key
+  // column at a time and stores the result in groupBoundaries_. Bit 0 is
+  // never set; whether row 0 continues the last group of the previous batch
+  // is decided separately in assignGroups().
+  void markGroupBoundaries();
+
   // Add input data to accumulators.
   void evaluateAggregates();
 
@@ -104,6 +111,9 @@ class StreamingAggregation : public Operator {
   // Pointers to groups for all input rows.
   std::vector<char*> inputGroups_;
 
+  // Bitmask with bit i set if input row i starts a new group.
+  std::vector<uint64_t> groupBoundaries_;
+
   // A subset of input rows to evaluate the aggregate function on. Rows
   // where aggregation mask is false are excluded.
   SelectivityVector inputRows_;
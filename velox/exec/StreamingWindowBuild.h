@@ -46,7 +46,7 @@ class StreamingWindowBuild : public WindowBuild {
 
   bool hasNextPartition() override;
 
-  std::unique_ptr<WindowPartition> nextPartition() override;
+  WindowPartition* nextPartition() override;
 
   bool needsInput() override {
     // No partitions are available or the currentPartition is the last available
@@ -85,7 +85,9 @@ RowVectorPtr TableScan::getOutput() {
           split,
           blockingFuture_,
           maxPreloadedSplits_,
-          splitPreloader_);
+          splitPreloader_,
+          driverCtx_->driverId,
+          driverCtx_->task->numDrivers(driverCtx_->driver));
       if (blockingReason_ != BlockingReason::kNotBlocked) {
         return nullptr;
       }
@@ -114,6 +116,7 @@ RowVectorPtr TableScan::getOutput() {
       }
 
       const auto& connectorSplit = split.connectorSplit;
+      currentSplit_ = connectorSplit;
       needNewSplit_ = false;
 
       VELOX_CHECK_EQ(
@@ -237,7 +240,7 @@ RowVectorPtr TableScan::getOutput() {
       }
     }
 
-    driverCtx_->task->splitFinished();
+    driverCtx_->task->splitFinished(planNodeId(), std::move(currentSplit_));
     needNewSplit_ = true;
   }
 }
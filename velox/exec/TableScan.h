@@ -84,6 +84,9 @@ class TableScan : public SourceOperator {
   std::shared_ptr<connector::Connector> connector_;
   std::shared_ptr<connector::ConnectorQueryCtx> connectorQueryCtx_;
   std::unique_ptr<connector::DataSource> dataSource_;
+  // The split currently being processed. Passed to Task::splitFinished() once
+  // fully read, where it is optionally recorded for scan checkpointing.
+  std::shared_ptr<connector::ConnectorSplit> currentSplit_;
   bool noMoreSplits_ = false;
   // Dynamic filters to add to the data source when it gets created.
   std::unordered_map<column_index_t, std::shared_ptr<common::Filter>>
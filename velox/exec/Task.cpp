@@ -40,6 +40,10 @@ using facebook::velox::common::testutil::TestValue;
 namespace facebook::velox::exec {
 
 namespace {
+// Number of queued splits examined when looking for one whose cache affinity
+// key maps to the driver asking for a split.
+constexpr int32_t kSplitAffinityWindow = 16;
+
 // RAII helper class to satisfy given promises and notify listeners of an event
 // connected to the promises outside of the mutex that guards the promises.
 // Inactive on creation. Must be activated explicitly by calling 'activate'.
@@ -90,6 +94,11 @@ folly::Synchronized<std::vector<std::shared_ptr<TaskListener>>>& listeners() {
   return kListeners;
 }
 
+std::atomic<folly::Executor*>& driverCloseExecutorHolder() {
+  static std::atomic<folly::Executor*> kExecutor{nullptr};
+  return kExecutor;
+}
+
 std::string errorMessageImpl(const std::exception_ptr& exception) {
   if (!exception) {
     return "";
@@ -210,6 +219,11 @@ bool unregisterTaskListener(const std::shared_ptr<TaskListener>& listener) {
   });
 }
 
+// static.
+void Task::setDriverCloseExecutor(folly::Executor* executor) {
+  driverCloseExecutorHolder() = executor;
+}
+
 // static.
 std::shared_ptr<Task> Task::create(
     const std::string& taskId,
@@ -1311,14 +1325,18 @@ BlockingReason Task::getSplitOrFuture(
     exec::Split& split,
     ContinueFuture& future,
     int32_t maxPreloadSplits,
-    std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload) {
+    std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload,
+    int32_t preferredDriverId,
+    int32_t numDrivers) {
   std::lock_guard<std::mutex> l(mutex_);
   return getSplitOrFutureLocked(
       getPlanNodeSplitsStateLocked(planNodeId).groupSplitsStores[splitGroupId],
       split,
       future,
       maxPreloadSplits,
-      preload);
+      preload,
+      preferredDriverId,
+      numDrivers);
 }
 
 BlockingReason Task::getSplitOrFutureLocked(
@@ -1326,7 +1344,9 @@ BlockingReason Task::getSplitOrFutureLocked(
     exec::Split& split,
     ContinueFuture& future,
     int32_t maxPreloadSplits,
-    std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload) {
+    std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload,
+    int32_t preferredDriverId,
+    int32_t numDrivers) {
   if (splitsStore.splits.empty()) {
     if (splitsStore.noMoreSplits) {
       return BlockingReason::kNotBlocked;
@@ -1338,14 +1358,17 @@ BlockingReason Task::getSplitOrFutureLocked(
     return BlockingReason::kWaitForSplit;
   }
 
-  split = getSplitLocked(splitsStore, maxPreloadSplits, preload);
+  split = getSplitLocked(
+      splitsStore, maxPreloadSplits, preload, preferredDriverId, numDrivers);
   return BlockingReason::kNotBlocked;
 }
 
 exec::Split Task::getSplitLocked(
     SplitsStore& splitsStore,
     int32_t maxPreloadSplits,
-    std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload) {
+    std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload,
+    int32_t preferredDriverId,
+    int32_t numDrivers) {
   int32_t readySplitIndex = -1;
   if (maxPreloadSplits) {
     for (auto i = 0; i < splitsStore.splits.size() && i < maxPreloadSplits;
@@ -1359,12 +1382,38 @@ exec::Split Task::getSplitLocked(
       }
     }
   }
+  if (readySplitIndex == -1 && preferredDriverId >= 0 && numDrivers > 1) {
+    // Prefer a split whose cache affinity key maps to the calling driver, so
+    // that re-scans of a file land on the driver that warmed the cache for
+    // it. Only a bounded window is considered to keep arrival order roughly
+    // intact.
+    const int32_t window = std::min<int32_t>(
+        splitsStore.splits.size(),
+        std::max<int32_t>(maxPreloadSplits, kSplitAffinityWindow));
+    for (auto i = 0; i < window; ++i) {
+      const auto& candidate = splitsStore.splits[i];
+      if (!candidate.hasConnectorSplit()) {
+        continue;
+      }
+      const auto key = candidate.connectorSplit->cacheAffinityKey();
+      if (key.has_value() &&
+          (*key % numDrivers) == (preferredDriverId % numDrivers)) {
+        readySplitIndex = i;
+        break;
+      }
+    }
+  }
   if (readySplitIndex == -1) {
     readySplitIndex = 0;
   }
   assert(!splitsStore.splits.empty());
-  auto split = std::move(splitsStore.splits[readySplitIndex]);
-  splitsStore.splits.erase(splitsStore.splits.begin() + readySplitIndex);
+  // Swap the picked split to the front for O(1) removal. The split left in
+  // its place stays within the preload window, so its preload is not lost.
+  if (readySplitIndex != 0) {
+    std::swap(splitsStore.splits[0], splitsStore.splits[readySplitIndex]);
+  }
+  auto split = std::move(splitsStore.splits.front());
+  splitsStore.splits.pop_front();
 
   --taskStats_.numQueuedSplits;
   ++taskStats_.numRunningSplits;
@@ -1376,10 +1425,16 @@ exec::Split Task::getSplitLocked(
   return split;
 }
 
-void Task::splitFinished() {
+void Task::splitFinished(
+    const core::PlanNodeId& planNodeId,
+    std::shared_ptr<connector::ConnectorSplit> split) {
   std::lock_guard<std::mutex> l(mutex_);
   ++taskStats_.numFinishedSplits;
   --taskStats_.numRunningSplits;
+  if (split != nullptr &&
+      queryCtx_->queryConfig().tableScanRecordCompletedSplits()) {
+    taskStats_.completedScanSplits[planNodeId].push_back(std::move(split));
+  }
   if (isAllSplitsFinishedLocked()) {
     taskStats_.executionEndTimeMs = getCurrentTimeMs();
   }
@@ -1745,9 +1800,24 @@ ContinueFuture Task::terminate(TaskState terminalState) {
   stateChangeNotifier.notify();
 
   // Get the stats and free the resources of Drivers that were not on
-  // thread.
-  for (auto& driver : offThreadDrivers) {
-    driver->closeByTask();
+  // thread. If a driver close executor is set, do this on the executor so that
+  // freeing possibly large operator state (hash tables, spill state) does not
+  // block the thread that requested cancellation. The drivers were already
+  // marked terminated and counted off under the mutex above, hence, closing
+  // them later does not delay the finish future.
+  if (!offThreadDrivers.empty()) {
+    auto* driverCloseExecutor = driverCloseExecutorHolder().load();
+    if (driverCloseExecutor != nullptr) {
+      driverCloseExecutor->add([drivers = std::move(offThreadDrivers)]() {
+        for (auto& driver : drivers) {
+          driver->closeByTask();
+        }
+      });
+    } else {
+      for (auto& driver : offThreadDrivers) {
+        driver->closeByTask();
+      }
+    }
   }
 
   // We continue all Drivers waiting for promises known to the
@@ -1794,7 +1864,7 @@ ContinueFuture Task::terminate(TaskState terminalState) {
         std::vector<exec::Split> splits;
         for (auto& [groupId, store] : splitState.groupSplitsStores) {
           while (!store.splits.empty()) {
-            splits.emplace_back(getSplitLocked(store, 0, nullptr));
+            splits.emplace_back(getSplitLocked(store, 0, nullptr, -1, 0));
           }
         }
         if (!splits.empty()) {
@@ -1874,6 +1944,24 @@ void Task::addOperatorStats(OperatorStats& stats) {
       .add(stats);
 }
 
+void Task::addDriverTraceLog(std::unique_ptr<DriverTraceLog> traceLog) {
+  std::lock_guard<std::mutex> l(mutex_);
+  driverTraceLogs_.push_back(std::move(traceLog));
+}
+
+std::string Task::traceEventsJson() const {
+  folly::dynamic traceEvents = folly::dynamic::array;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    for (const auto& traceLog : driverTraceLogs_) {
+      traceLog->appendTraceEvents(traceEvents);
+    }
+  }
+  folly::dynamic trace = folly::dynamic::object;
+  trace["traceEvents"] = std::move(traceEvents);
+  return folly::toJson(trace);
+}
+
 TaskStats Task::taskStats() const {
   std::lock_guard<std::mutex> l(mutex_);
 
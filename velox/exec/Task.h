@@ -89,6 +89,11 @@ class Task : public std::enable_shared_from_this<Task> {
     return taskId_;
   }
 
+  /// Returns the plan fragment specified in the constructor.
+  const core::PlanFragment& planFragment() const {
+    return planFragment_;
+  }
+
   const int destination() const {
     return destination_;
   }
@@ -259,6 +264,11 @@ class Task : public std::enable_shared_from_this<Task> {
   /// structure.
   TaskStats taskStats() const;
 
+  /// Returns the per-operator call and wait events recorded by finished
+  /// drivers as a JSON string in Chrome trace format. The trace is empty
+  /// unless the task ran with the 'driver_trace_enabled' query config set.
+  std::string traceEventsJson() const;
+
   /// Returns time (ms) since the task execution started or zero, if not
   /// started.
   uint64_t timeSinceStartMs() const;
@@ -334,7 +344,10 @@ class Task : public std::enable_shared_from_this<Task> {
   /// that will complete when split becomes available or no-more-splits
   /// signal is received. If 'maxPreloadSplits' is given, ensures that
   /// so many of splits at the head of the queue are preloading. If
-  /// they are not, calls preload on them to start preload.
+  /// they are not, calls preload on them to start preload. If
+  /// 'preferredDriverId' and 'numDrivers' are given, prefers a queued split
+  /// whose cache affinity key maps to the calling driver, so that re-scans
+  /// of a file are processed by the driver that read it before.
   BlockingReason getSplitOrFuture(
       uint32_t splitGroupId,
       const core::PlanNodeId& planNodeId,
@@ -342,9 +355,18 @@ class Task : public std::enable_shared_from_this<Task> {
       ContinueFuture& future,
       int32_t maxPreloadSplits = 0,
       std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload =
-          nullptr);
-
-  void splitFinished();
+          nullptr,
+      int32_t preferredDriverId = -1,
+      int32_t numDrivers = 0);
+
+  /// Records that a split of source node 'planNodeId' has been fully
+  /// processed. 'split' identifies the finished connector split; it is
+  /// retained in TaskStats::completedScanSplits when
+  /// QueryConfig::kTableScanRecordCompletedSplits is set so that callers can
+  /// checkpoint scan progress.
+  void splitFinished(
+      const core::PlanNodeId& planNodeId,
+      std::shared_ptr<connector::ConnectorSplit> split);
 
   void multipleSplitsFinished(int32_t numSplits);
 
@@ -470,6 +492,10 @@ class Task : public std::enable_shared_from_this<Task> {
   /// stats. Called from Drivers upon their closure.
   void addOperatorStats(OperatorStats& stats);
 
+  /// Takes ownership of a closing driver's trace event log. The logs of all
+  /// finished drivers are combined by traceEventsJson().
+  void addDriverTraceLog(std::unique_ptr<DriverTraceLog> traceLog);
+
   /// Returns kNone if no pause or terminate is requested. The thread count is
   /// incremented if kNone is returned. If something else is returned the
   /// calling thread should unwind and return itself to its pool. If 'this' goes
@@ -540,6 +566,16 @@ class Task : public std::enable_shared_from_this<Task> {
     return terminate(kAborted);
   }
 
+  /// Sets a process-wide executor used by terminate() to close drivers that
+  /// are not on thread and free their operator state (hash tables, spill
+  /// state). Freeing this state can take long for large queries, so offloading
+  /// it keeps the thread that requested cancellation responsive. The executor
+  /// must outlive all tasks. Pass nullptr (the default) to close drivers
+  /// synchronously on the terminating thread. Note that with an executor set,
+  /// memory of cancelled tasks is freed asynchronously, shortly after
+  /// terminate() returns.
+  static void setDriverCloseExecutor(folly::Executor* executor);
+
   void requestYield() {
     std::lock_guard<std::mutex> l(mutex_);
     toYield_ = numThreads_;
@@ -745,14 +781,18 @@ class Task : public std::enable_shared_from_this<Task> {
       ContinueFuture& future,
       int32_t maxPreloadSplits = 0,
       std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload =
-          nullptr);
+          nullptr,
+      int32_t preferredDriverId = -1,
+      int32_t numDrivers = 0);
 
   /// Returns next split from the store. The caller must ensure the store is not
   /// empty.
   exec::Split getSplitLocked(
       SplitsStore& splitsStore,
       int32_t maxPreloadSplits,
-      std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload);
+      std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload,
+      int32_t preferredDriverId,
+      int32_t numDrivers);
 
   // Creates for the given split group and fills up the 'SplitGroupState'
   // structure, which stores inter-operator state (local exchange, bridges).
@@ -1004,6 +1044,10 @@ class Task : public std::enable_shared_from_this<Task> {
 
   TaskStats taskStats_;
 
+  // Trace event logs handed over by finished drivers. Only populated when the
+  // 'driver_trace_enabled' query config is set.
+  std::vector<std::unique_ptr<DriverTraceLog>> driverTraceLogs_;
+
   /// Stores inter-operator state (exchange, bridges) per split group.
   /// During ungrouped execution we use the [0] entry in this vector.
   std::unordered_map<uint32_t, SplitGroupState> splitGroupStates_;
@@ -96,6 +96,18 @@ struct TaskStats {
   std::string longestRunningOpCall;
   /// The longest still running operator call's duration in ms.
   size_t longestRunningOpCallMs{0};
+
+  /// Connector splits fully processed by each table scan node. Only populated
+  /// when QueryConfig::kTableScanRecordCompletedSplits is set. This is the
+  /// checkpoint state for resuming a long-running scan: persist it
+  /// periodically and, after a restart, re-add only the splits that are
+  /// missing from it via Task::addSplit(). Sub-file resume granularity is
+  /// available by adding splits with byte ranges, e.g. via
+  /// HiveConnectorSplit::subdivide().
+  std::unordered_map<
+      core::PlanNodeId,
+      std::vector<std::shared_ptr<connector::ConnectorSplit>>>
+      completedScanSplits;
 };
 
 } // namespace facebook::velox::exec
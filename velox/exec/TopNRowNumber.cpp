@@ -89,6 +89,30 @@ std::vector<CompareFlags> makeSpillCompareFlags(
   return compareFlags;
 }
 
+// Fills 'prefixes' with order-preserving 64-bit encodings of the first 'size'
+// values of 'decoded': the sign bit is flipped so that two's complement order
+// maps to unsigned order, the bits are inverted for descending keys and nulls
+// map to the extremes according to 'flags'.
+template <TypeKind Kind>
+void fillPrefixesTyped(
+    const DecodedVector& decoded,
+    vector_size_t size,
+    const CompareFlags& flags,
+    std::vector<uint64_t>& prefixes) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  const uint64_t nullPrefix = flags.nullsFirst ? 0 : UINT64_MAX;
+  for (vector_size_t i = 0; i < size; ++i) {
+    if (decoded.isNullAt(i)) {
+      prefixes[i] = nullPrefix;
+    } else {
+      auto prefix = static_cast<uint64_t>(
+                        static_cast<int64_t>(decoded.valueAt<T>(i))) ^
+          (1ULL << 63);
+      prefixes[i] = flags.ascending ? prefix : ~prefix;
+    }
+  }
+}
+
 // Returns a [start, end) slice of the 'types' vector.
 std::vector<TypePtr>
 slice(const std::vector<TypePtr>& types, int32_t start, int32_t end) {
@@ -186,6 +210,8 @@ void TopNRowNumber::addInput(RowVectorPtr input) {
     decodedVectors_[i].decode(*input->childAt(inputChannels_[i]));
   }
 
+  fillInputPrefixes(numInput);
+
   if (table_) {
     ensureInputFits(input);
 
@@ -240,21 +266,57 @@ void TopNRowNumber::initializeNewPartitions() {
   }
 }
 
+void TopNRowNumber::fillInputPrefixes(vector_size_t size) {
+  inputPrefixes_.resize(size);
+
+  const auto& decoded = decodedVectors_[numPartitionKeys_];
+  const auto& flags = spillCompareFlags_[numPartitionKeys_];
+  switch (inputType_->childAt(numPartitionKeys_)->kind()) {
+    case TypeKind::TINYINT:
+      fillPrefixesTyped<TypeKind::TINYINT>(
+          decoded, size, flags, inputPrefixes_);
+      break;
+    case TypeKind::SMALLINT:
+      fillPrefixesTyped<TypeKind::SMALLINT>(
+          decoded, size, flags, inputPrefixes_);
+      break;
+    case TypeKind::INTEGER:
+      fillPrefixesTyped<TypeKind::INTEGER>(
+          decoded, size, flags, inputPrefixes_);
+      break;
+    case TypeKind::BIGINT:
+      fillPrefixesTyped<TypeKind::BIGINT>(decoded, size, flags, inputPrefixes_);
+      break;
+    default:
+      // Equal prefixes fall back to the full row comparison.
+      std::fill(inputPrefixes_.begin(), inputPrefixes_.end(), 0);
+      break;
+  }
+}
+
 void TopNRowNumber::processInputRow(vector_size_t index, TopRows& partition) {
   auto& topRows = partition.rows;
 
+  const auto prefix = inputPrefixes_[index];
   char* newRow = nullptr;
   if (topRows.size() < limit_) {
     newRow = data_->newRow();
   } else {
-    char* topRow = topRows.top();
+    const auto& top = topRows.top();
+
+    if (prefix > top.prefix) {
+      // Drop this input row. It sorts after the current heap max on the
+      // leading sorting key alone.
+      return;
+    }
 
-    if (!comparator_(decodedVectors_, index, topRow)) {
+    if (prefix == top.prefix && !comparator_(decodedVectors_, index, top.row)) {
       // Drop this input row.
       return;
     }
 
     // Replace existing row.
+    char* topRow = top.row;
     topRows.pop();
 
     // Reuse the topRow's memory.
@@ -265,7 +327,7 @@ void TopNRowNumber::processInputRow(vector_size_t index, TopRows& partition) {
     data_->store(decodedVectors_[col], index, newRow, col);
   }
 
-  topRows.push(newRow);
+  topRows.push({prefix, newRow});
 }
 
 void TopNRowNumber::noMoreInput() {
@@ -362,7 +424,7 @@ void TopNRowNumber::appendPartitionRows(
     if (rowNumbers) {
       rowNumbers->set(index, rowNumber--);
     }
-    outputRows_[index] = partition.rows.top();
+    outputRows_[index] = partition.rows.top().row;
     partition.rows.pop();
   }
 }
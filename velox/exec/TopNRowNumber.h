@@ -71,19 +71,33 @@ class TopNRowNumber : public Operator {
  private:
   // A priority queue to keep track of top 'limit' rows for a given partition.
   struct TopRows {
+    // A row in 'data_' paired with an order-preserving 64-bit prefix of the
+    // leading sorting key. Unequal prefixes decide a comparison with a single
+    // integer compare; equal prefixes fall back to the full row comparison.
+    struct PrefixedRow {
+      uint64_t prefix;
+      char* row;
+    };
+
     struct Compare {
       RowComparator& comparator;
 
-      bool operator()(const char* lhs, const char* rhs) {
-        return comparator(lhs, rhs);
+      bool operator()(const PrefixedRow& lhs, const PrefixedRow& rhs) {
+        if (lhs.prefix != rhs.prefix) {
+          return lhs.prefix < rhs.prefix;
+        }
+        return comparator(lhs.row, rhs.row);
       }
     };
 
-    std::priority_queue<char*, std::vector<char*, StlAllocator<char*>>, Compare>
+    std::priority_queue<
+        PrefixedRow,
+        std::vector<PrefixedRow, StlAllocator<PrefixedRow>>,
+        Compare>
         rows;
 
     TopRows(HashStringAllocator* allocator, RowComparator& comparator)
-        : rows{{comparator}, StlAllocator<char*>(allocator)} {}
+        : rows{{comparator}, StlAllocator<PrefixedRow>(allocator)} {}
   };
 
   void initializeNewPartitions();
@@ -92,6 +106,12 @@ class TopNRowNumber : public Operator {
     return *reinterpret_cast<TopRows*>(group + partitionOffset_);
   }
 
+  // Computes order-preserving 64-bit prefixes of the leading sorting key for
+  // the first 'size' rows of the decoded input and stores these in
+  // 'inputPrefixes_'. Fills zeros if the leading sorting key type doesn't
+  // support prefix encoding.
+  void fillInputPrefixes(vector_size_t size);
+
   // Adds input row to a partition or discards the row.
   void processInputRow(vector_size_t index, TopRows& partition);
 
@@ -199,6 +219,10 @@ class TopNRowNumber : public Operator {
 
   std::vector<DecodedVector> decodedVectors_;
 
+  // Order-preserving 64-bit prefixes of the leading sorting key for the
+  // current input batch, aligned with input rows.
+  std::vector<uint64_t> inputPrefixes_;
+
   bool finished_{false};
 
   // Size of a single output row estimated using 'data_->estimateRowSize()'.
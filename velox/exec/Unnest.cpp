@@ -182,9 +182,19 @@ RowVectorPtr Unnest::generateOutput(
     BufferPtr elementIndices = allocateIndices(numElements, pool());
     auto* rawElementIndices = elementIndices->asMutable<vector_size_t>();
 
-    auto nulls =
-        AlignedBuffer::allocate<bool>(numElements, pool(), bits::kNotNull);
-    auto rawNulls = nulls->asMutable<uint64_t>();
+    // Allocated only if null arrays (or maps) or rows shorter than the row's
+    // max size need null padding. Otherwise the dictionary stays nulls-free,
+    // which also keeps mayHaveNulls() false for downstream operators.
+    BufferPtr nulls;
+    uint64_t* rawNulls = nullptr;
+    auto setNull = [&](vector_size_t nullIndex) {
+      if (rawNulls == nullptr) {
+        nulls =
+            AlignedBuffer::allocate<bool>(numElements, pool(), bits::kNotNull);
+        rawNulls = nulls->asMutable<uint64_t>();
+      }
+      bits::setNull(rawNulls, nullIndex, true);
+    };
 
     // Make dictionary index for elements column since they may be out of order.
     index = 0;
@@ -205,13 +215,13 @@ RowVectorPtr Unnest::generateOutput(
         }
 
         for (auto i = unnestSize; i < maxSize; ++i) {
-          bits::setNull(rawNulls, index++, true);
+          setNull(index++);
         }
       } else if (maxSize > 0) {
         identityMapping = false;
 
         for (auto i = 0; i < maxSize; ++i) {
-          bits::setNull(rawNulls, index++, true);
+          setNull(index++);
         }
       }
     }
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/UpsertIndex.h"
+
+namespace facebook::velox::exec {
+
+UpsertIndex::UpsertIndex(
+    const RowTypePtr& inputType,
+    const std::vector<column_index_t>& keyChannels,
+    memory::MemoryPool* pool) {
+  VELOX_CHECK(!keyChannels.empty(), "Upsert requires at least one key column");
+
+  std::vector<std::unique_ptr<VectorHasher>> hashers;
+  hashers.reserve(keyChannels.size());
+  for (auto channel : keyChannels) {
+    hashers.push_back(
+        VectorHasher::create(inputType->childAt(channel), channel));
+  }
+
+  table_ = std::make_unique<HashTable<false>>(
+      std::move(hashers),
+      std::vector<Accumulator>{},
+      std::vector<TypePtr>{BIGINT()},
+      false, // allowDuplicates
+      false, // isJoinBuild
+      false, // hasProbedFlag
+      0, // minTableSizeForParallelJoinBuild
+      pool);
+  lookup_ = std::make_unique<HashLookup>(table_->hashers());
+
+  positionOffset_ = table_->rows()->columnAt(keyChannels.size()).offset();
+}
+
+void UpsertIndex::addInput(const RowVectorPtr& input) {
+  const auto numInput = input->size();
+
+  SelectivityVector rows(numInput);
+  table_->prepareForProbe(*lookup_, input, rows, false);
+  table_->groupProbe(*lookup_);
+
+  std::vector<bool> isNew(numInput, false);
+  for (auto i : lookup_->newGroups) {
+    isNew[i] = true;
+  }
+
+  // Process rows in order so that a key repeated within 'input' supersedes
+  // its earlier occurrence in the same batch.
+  for (auto i = 0; i < numInput; ++i) {
+    auto* entry = lookup_->hits[i];
+    if (!isNew[i]) {
+      deletePositions_.push_back(position(entry));
+    }
+    setPosition(entry, numRows_ + i);
+  }
+  numRows_ += numInput;
+}
+
+std::vector<int64_t> UpsertIndex::takeDeletePositions() {
+  std::vector<int64_t> positions;
+  positions.swap(deletePositions_);
+  std::sort(positions.begin(), positions.end());
+  return positions;
+}
+
+void UpsertIndex::clear() {
+  table_->clear();
+  numRows_ = 0;
+  deletePositions_.clear();
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/exec/HashTable.h"
+
+namespace facebook::velox::exec {
+
+/// In-memory primary-key index for upsert-style ingestion. Tracks the
+/// position of the latest row written for each key within the current write
+/// batch. When a key reappears, the previously written row's position is
+/// recorded as a positional delete, turning updates into positional deletes
+/// plus appends without rewriting already written data. The caller writes
+/// the accumulated delete positions alongside the data files (e.g. as a
+/// positional delete file) when the batch is flushed, then calls clear() to
+/// start the next batch.
+///
+/// Null key values are treated as regular values, matching the semantics of
+/// group-by keys.
+class UpsertIndex {
+ public:
+  /// 'keyChannels' are the primary key columns of 'inputType'.
+  UpsertIndex(
+      const RowTypePtr& inputType,
+      const std::vector<column_index_t>& keyChannels,
+      memory::MemoryPool* pool);
+
+  /// Indexes 'input' as if appended at positions [numRows(), numRows() +
+  /// input->size()). Rows whose key was already indexed record the superseded
+  /// row's position as a delete, including duplicates within 'input' itself.
+  void addInput(const RowVectorPtr& input);
+
+  /// Number of rows indexed since the last clear().
+  int64_t numRows() const {
+    return numRows_;
+  }
+
+  /// Number of delete positions accumulated since the last clear().
+  int64_t numDeletes() const {
+    return deletePositions_.size();
+  }
+
+  /// Returns the accumulated delete positions in ascending order, as required
+  /// by positional delete files, and removes them from the index.
+  std::vector<int64_t> takeDeletePositions();
+
+  /// Resets the index after the current write batch has been flushed.
+  void clear();
+
+ private:
+  // Returns the position stored for an indexed key.
+  int64_t position(char* entry) const {
+    return *reinterpret_cast<int64_t*>(entry + positionOffset_);
+  }
+
+  void setPosition(char* entry, int64_t position) {
+    *reinterpret_cast<int64_t*>(entry + positionOffset_) = position;
+  }
+
+  // Hash table over the primary key columns with the latest position as the
+  // only dependent column.
+  std::unique_ptr<BaseHashTable> table_;
+  std::unique_ptr<HashLookup> lookup_;
+  int32_t positionOffset_;
+
+  // Number of rows indexed since the last clear().
+  int64_t numRows_{0};
+
+  // Positions of superseded rows, in insertion order.
+  std::vector<int64_t> deletePositions_;
+};
+
+} // namespace facebook::velox::exec
@@ -14,11 +14,91 @@
  * limitations under the License.
  */
 #include "velox/exec/Values.h"
+#include "velox/common/base/BitUtil.h"
 #include "velox/common/testutil/TestValue.h"
 
 using facebook::velox::common::testutil::TestValue;
 
 namespace facebook::velox::exec {
+namespace {
+// Minimum combined size of a ValuesNode's vectors for interning them in the
+// process-wide LiteralVectorCache. Small literal lists are cheaper to keep
+// per task than to hash and look up.
+constexpr uint64_t kMinInternBytes = 1 << 20;
+
+uint64_t hashContent(const RowVector& vector) {
+  uint64_t hash = vector.size();
+  for (vector_size_t i = 0; i < vector.size(); ++i) {
+    hash = bits::hashMix(hash, vector.hashValueAt(i));
+  }
+  return hash;
+}
+
+bool equalContent(const RowVector& left, const RowVector& right) {
+  if (left.size() != right.size() || *left.type() != *right.type()) {
+    return false;
+  }
+  for (vector_size_t i = 0; i < left.size(); ++i) {
+    if (!left.equalValueAt(&right, i, i)) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+// static
+LiteralVectorCache& LiteralVectorCache::instance() {
+  static LiteralVectorCache cache;
+  return cache;
+}
+
+LiteralVectorCache::LiteralVectorCache()
+    : pool_{memory::addDefaultLeafMemoryPool("_sys.literals")} {}
+
+RowVectorPtr LiteralVectorCache::get(const RowVectorPtr& vector) {
+  const auto hash = hashContent(*vector);
+
+  auto find = [&](std::vector<std::weak_ptr<RowVector>>& candidates)
+      -> RowVectorPtr {
+    auto it = candidates.begin();
+    while (it != candidates.end()) {
+      if (auto cached = it->lock()) {
+        if (equalContent(*cached, *vector)) {
+          return cached;
+        }
+        ++it;
+      } else {
+        it = candidates.erase(it);
+      }
+    }
+    return nullptr;
+  };
+
+  {
+    auto locked = vectors_.wlock();
+    auto it = locked->find(hash);
+    if (it != locked->end()) {
+      if (auto cached = find(it->second)) {
+        return cached;
+      }
+    }
+  }
+
+  // Copy into the process-wide pool outside of the lock. Equal vectors
+  // interned concurrently may race here; the loser's copy is simply dropped.
+  auto copy = std::static_pointer_cast<RowVector>(
+      BaseVector::create(vector->type(), vector->size(), pool_.get()));
+  copy->copy(vector.get(), 0, 0, vector->size());
+
+  auto locked = vectors_.wlock();
+  auto& candidates = (*locked)[hash];
+  if (auto cached = find(candidates)) {
+    return cached;
+  }
+  candidates.push_back(copy);
+  return copy;
+}
 
 Values::Values(
     int32_t operatorId,
@@ -34,9 +114,19 @@ Values::Values(
   // Drop empty vectors. Operator::getOutput is expected to return nullptr or a
   // non-empty vector.
   values_.reserve(values->values().size());
+  uint64_t totalBytes = 0;
   for (auto& vector : values->values()) {
     if (vector->size() > 0) {
       values_.emplace_back(vector);
+      totalBytes += vector->estimateFlatSize();
+    }
+  }
+
+  // Share large literal tables, e.g. broadcast lookup tables embedded in the
+  // plan, with other tasks and queries using the same literals.
+  if (totalBytes >= kMinInternBytes) {
+    for (auto& vector : values_) {
+      vector = LiteralVectorCache::instance().get(vector);
     }
   }
 }
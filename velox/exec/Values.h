@@ -13,11 +13,44 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
+
 #include "velox/core/PlanNode.h"
 #include "velox/exec/Operator.h"
 
 namespace facebook::velox::exec {
 
+/// Process-wide cache of materialized literal tables. Distributed plans embed
+/// broadcast lookup tables in ValuesNode as literal vectors and every task
+/// materializes a private copy of them. The cache interns literal vectors by
+/// content so that concurrent tasks and queries referencing equal tables
+/// share a single immutable copy backed by a process-wide memory pool.
+/// Entries hold weak references: a cached table is freed once the last task
+/// using it finishes.
+class LiteralVectorCache {
+ public:
+  static LiteralVectorCache& instance();
+
+  /// Returns a vector with the same content as 'vector', shared with all
+  /// other callers that passed an equal vector while the result of an earlier
+  /// call is still alive. The returned vector must not be modified.
+  RowVectorPtr get(const RowVectorPtr& vector);
+
+ private:
+  LiteralVectorCache();
+
+  // Holds the cached copies. Not subject to per-query memory limits, like the
+  // spill memory pool.
+  std::shared_ptr<memory::MemoryPool> pool_;
+
+  // Content hash to cached vectors with that hash. Expired entries are pruned
+  // on lookup.
+  folly::Synchronized<
+      folly::F14FastMap<uint64_t, std::vector<std::weak_ptr<RowVector>>>>
+      vectors_;
+};
+
 class Values : public SourceOperator {
  public:
   Values(
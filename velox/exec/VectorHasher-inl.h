@@ -16,17 +16,18 @@
 namespace facebook::velox::exec {
 
 template <typename T>
-bool VectorHasher::tryMapToRangeSimd(
+bool VectorHasher::mapToRangeRun(
     const T* values,
-    const SelectivityVector& rows,
+    vector_size_t begin,
+    vector_size_t end,
     uint64_t* result) {
   bool inRange = true;
   auto allLow = xsimd::broadcast<T>(min_);
   auto allHigh = xsimd::broadcast<T>(max_);
   auto allOne = xsimd::broadcast<T>(1);
-  vector_size_t row = rows.begin();
+  vector_size_t row = begin;
   constexpr int kWidth = xsimd::batch<T>::size;
-  for (; row + kWidth <= rows.end(); row += kWidth) {
+  for (; row + kWidth <= end; row += kWidth) {
     auto data = xsimd::load_unaligned(values + row);
     int32_t gtMax = simd::toBitMask(data > allHigh);
     int32_t ltMin = simd::toBitMask(data < allLow);
@@ -42,7 +43,7 @@ bool VectorHasher::tryMapToRangeSimd(
   }
 
   if (inRange) {
-    for (; row < rows.end(); row++) {
+    for (; row < end; row++) {
       auto value = values[row];
       if (value > max_ || value < min_) {
         inRange = false;
@@ -53,7 +54,7 @@ bool VectorHasher::tryMapToRangeSimd(
       }
     }
     if constexpr (sizeof(T) != sizeof(uint64_t)) {
-      for (row = rows.begin(); row < rows.end(); row++) {
+      for (row = begin; row < end; row++) {
         result[row] = values[row] - min_ + 1;
       }
     }
@@ -61,4 +62,12 @@ bool VectorHasher::tryMapToRangeSimd(
   return inRange;
 }
 
+template <typename T>
+bool VectorHasher::tryMapToRangeSimd(
+    const T* values,
+    const SelectivityVector& rows,
+    uint64_t* result) {
+  return mapToRangeRun(values, rows.begin(), rows.end(), result);
+}
+
 } // namespace facebook::velox::exec
@@ -62,6 +62,37 @@ uint64_t hashOne(DecodedVector& decoded, vector_size_t index) {
   using T = typename KindToFlatVector<Kind>::HashRowType;
   return folly::hasher<T>()(decoded.valueAt<T>(index));
 }
+
+// Hashes a contiguous run of fixed-width values three rows per iteration. The
+// multiply/shift mixing in folly::hasher serializes on a single value, so
+// interleaving independent rows keeps several hash chains in flight at once.
+template <typename T>
+void hashFlatRun(
+    const T* values,
+    vector_size_t begin,
+    vector_size_t end,
+    bool mix,
+    uint64_t* result) {
+  auto row = begin;
+  for (; row + 3 <= end; row += 3) {
+    const uint64_t hash0 = folly::hasher<T>()(values[row]);
+    const uint64_t hash1 = folly::hasher<T>()(values[row + 1]);
+    const uint64_t hash2 = folly::hasher<T>()(values[row + 2]);
+    if (mix) {
+      result[row] = bits::hashMix(result[row], hash0);
+      result[row + 1] = bits::hashMix(result[row + 1], hash1);
+      result[row + 2] = bits::hashMix(result[row + 2], hash2);
+    } else {
+      result[row] = hash0;
+      result[row + 1] = hash1;
+      result[row + 2] = hash2;
+    }
+  }
+  for (; row < end; ++row) {
+    const uint64_t hash = folly::hasher<T>()(values[row]);
+    result[row] = mix ? bits::hashMix(result[row], hash) : hash;
+  }
+}
 } // namespace
 
 template <TypeKind Kind>
@@ -80,6 +111,7 @@ void VectorHasher::hashValues(
   } else if (
       !decoded_.isIdentityMapping() &&
       rows.countSelected() > decoded_.base()->size()) {
+    invalidateCachedValueIds();
     cachedHashes_.resize(decoded_.base()->size());
     std::fill(cachedHashes_.begin(), cachedHashes_.end(), kNullHash);
     rows.applyToSelected([&](vector_size_t row) {
@@ -96,6 +128,19 @@ void VectorHasher::hashValues(
       result[row] = mix ? bits::hashMix(result[row], hash) : hash;
     });
   } else {
+    using HashT = typename KindToFlatVector<Kind>::HashRowType;
+    if constexpr (
+        std::is_same_v<T, HashT> && std::is_arithmetic_v<T> &&
+        !std::is_same_v<T, bool>) {
+      // Batch kernel for flat fixed-width columns with no nulls: hash straight
+      // off the values buffer without per-row null checks or decoding.
+      if (decoded_.isIdentityMapping() && !decoded_.mayHaveNulls() &&
+          rows.isAllSelected()) {
+        hashFlatRun<T>(
+            decoded_.data<T>(), rows.begin(), rows.end(), mix, result);
+        return;
+      }
+    }
     rows.applyToSelected([&](vector_size_t row) {
       if (decoded_.isNullAt(row)) {
         result[row] = mix ? bits::hashMix(result[row], kNullHash) : kNullHash;
@@ -242,8 +287,10 @@ template <typename T, bool mayHaveNulls>
 bool VectorHasher::makeValueIdsDecoded(
     const SelectivityVector& rows,
     uint64_t* result) {
-  cachedHashes_.resize(decoded_.base()->size());
-  std::fill(cachedHashes_.begin(), cachedHashes_.end(), 0);
+  if (!tryReuseCachedValueIds()) {
+    cachedHashes_.resize(decoded_.base()->size());
+    std::fill(cachedHashes_.begin(), cachedHashes_.end(), 0);
+  }
 
   auto indices = decoded_.indices();
   auto values = decoded_.data<T>();
@@ -513,10 +560,19 @@ void VectorHasher::lookupValueIds(
     raw_vector<uint64_t>& result,
     bool noNulls) const {
   scratchMemory.decoded.decode(values, rows);
+  lookupValueIds(scratchMemory.decoded, rows, scratchMemory, result, noNulls);
+}
+
+void VectorHasher::lookupValueIds(
+    const DecodedVector& decoded,
+    SelectivityVector& rows,
+    ScratchMemory& scratchMemory,
+    raw_vector<uint64_t>& result,
+    bool noNulls) const {
   VALUE_ID_TYPE_DISPATCH(
       lookupValueIdsTyped,
       typeKind_,
-      scratchMemory.decoded,
+      decoded,
       rows,
       scratchMemory.hashes,
       result.data(),
@@ -654,7 +710,13 @@ std::unique_ptr<common::Filter> VectorHasher::getFilter(
 
         return common::createBigintValues(values, nullAllowed);
       }
-      [[fallthrough]];
+      if (hasRange_ && !rangeOverflow_) {
+        // Too many distinct values to enumerate, but the exact range of the
+        // values is known. A min/max filter still prunes rows and, once
+        // pushed into a scan, whole row groups and files.
+        return std::make_unique<common::BigintRange>(min_, max_, nullAllowed);
+      }
+      return nullptr;
     default:
       // TODO Add support for strings.
       return nullptr;
@@ -771,11 +833,24 @@ void VectorHasher::cardinality(
   asDistincts = addIdReserve(uniqueValues_.size(), reservePct) + 1;
 }
 
+bool VectorHasher::tryReuseCachedValueIds() {
+  const auto* base = decoded_.base();
+  if (base == cachedBaseVector_ && cachedBaseValues_ != nullptr &&
+      cachedBaseValues_ == base->values() &&
+      cachedHashes_.size() == base->size()) {
+    return true;
+  }
+  cachedBaseVector_ = base;
+  cachedBaseValues_ = base->values();
+  return false;
+}
+
 uint64_t VectorHasher::enableValueIds(uint64_t multiplier, int32_t reservePct) {
   VELOX_CHECK_NE(
       typeKind_,
       TypeKind::BOOLEAN,
       "A boolean VectorHasher should  always be by range");
+  invalidateCachedValueIds();
   multiplier_ = multiplier;
   rangeSize_ = addIdReserve(uniqueValues_.size(), reservePct) + 1;
   isRange_ = false;
@@ -789,6 +864,7 @@ uint64_t VectorHasher::enableValueIds(uint64_t multiplier, int32_t reservePct) {
 uint64_t VectorHasher::enableValueRange(
     uint64_t multiplier,
     int32_t reservePct) {
+  invalidateCachedValueIds();
   multiplier_ = multiplier;
   VELOX_CHECK_LE(0, reservePct);
   VELOX_CHECK(hasRange_);
@@ -808,6 +884,7 @@ uint64_t VectorHasher::enableValueRange(
 }
 
 void VectorHasher::copyStatsFrom(const VectorHasher& other) {
+  invalidateCachedValueIds();
   hasRange_ = other.hasRange_;
   rangeOverflow_ = other.rangeOverflow_;
   distinctOverflow_ = other.distinctOverflow_;
@@ -821,6 +898,7 @@ void VectorHasher::merge(const VectorHasher& other) {
   if (typeKind_ == TypeKind::BOOLEAN) {
     return;
   }
+  invalidateCachedValueIds();
   if (other.empty()) {
     return;
   }
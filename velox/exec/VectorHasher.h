@@ -236,18 +236,31 @@ class VectorHasher {
       raw_vector<uint64_t>& result,
       bool noNulls = true) const;
 
+  // Same as above, but takes keys that are already decoded, e.g. by a
+  // probe-side hasher over the same column. Saves decoding the keys a second
+  // time. 'decoded' must cover at least 'rows'.
+  void lookupValueIds(
+      const DecodedVector& decoded,
+      SelectivityVector& rows,
+      ScratchMemory& scratchMemory,
+      raw_vector<uint64_t>& result,
+      bool noNulls = true) const;
+
   // Returns true if either range or distinct values have not overflowed.
   bool mayUseValueIds() const {
     return hasRange_ || !distinctOverflow_;
   }
 
   // Returns an instance of the filter corresponding to a set of unique values.
-  // Returns null if distinctOverflow_ is true.
+  // If there are too many distinct values to enumerate but their range is
+  // known, returns a min/max range filter instead. Returns null if neither
+  // distinct values nor a range are tracked.
   std::unique_ptr<common::Filter> getFilter(bool nullAllowed) const;
 
   void resetStats() {
     uniqueValues_.clear();
     uniqueValuesStorage_.clear();
+    invalidateCachedValueIds();
   }
 
   // Sets 'this' to range mode and adds 'reservePct' values to the
@@ -350,6 +363,19 @@ class VectorHasher {
   template <typename T, bool mayHaveNulls>
   bool makeValueIdsDecoded(const SelectivityVector& rows, uint64_t* result);
 
+  // Returns true if 'cachedHashes_' still holds the value ids for the base of
+  // 'decoded_', i.e. makeValueIdsDecoded() already processed the same
+  // dictionary alphabet and the id mapping has not changed since. If not,
+  // records the new alphabet identity and returns false.
+  bool tryReuseCachedValueIds();
+
+  // Forgets value ids cached by makeValueIdsDecoded(). Must be called whenever
+  // the value-id mapping changes or 'cachedHashes_' is repurposed.
+  void invalidateCachedValueIds() {
+    cachedBaseVector_ = nullptr;
+    cachedBaseValues_ = nullptr;
+  }
+
   template <TypeKind Kind>
   bool makeValueIdsForRows(
       char** groups,
@@ -431,6 +457,15 @@ class VectorHasher {
       const SelectivityVector& rows,
       uint64_t* result);
 
+  // Maps 'values' in rows [begin, end) to range ids with a vectorized
+  // min/max check. Returns false if a value falls outside [min_, max_].
+  template <typename T>
+  bool mapToRangeRun(
+      const T* values,
+      vector_size_t begin,
+      vector_size_t end,
+      uint64_t* result);
+
   template <typename T>
   bool tryMapToRange(
       const T* values,
@@ -444,8 +479,21 @@ class VectorHasher {
     if constexpr (
         std::is_same_v<T, std::int64_t> || std::is_same_v<T, std::int32_t> ||
         std::is_same_v<T, std::int16_t>) {
-      if (rows.isAllSelected() && multiplier_ == 1) {
-        return tryMapToRangeSimd(values, rows, result);
+      if (multiplier_ == 1) {
+        if (rows.isAllSelected()) {
+          return tryMapToRangeSimd(values, rows, result);
+        }
+        // A sparse selection, e.g. after a filter, often consists of long
+        // contiguous stretches of selected rows. Map each stretch with the
+        // same vectorized kernel instead of going row by row.
+        bool inRange = true;
+        rows.applyToSelectedRuns(
+            [&](vector_size_t runBegin, vector_size_t runEnd) {
+              if (inRange) {
+                inRange = mapToRangeRun(values, runBegin, runEnd, result);
+              }
+            });
+        return inRange;
       }
     }
 
@@ -543,6 +591,14 @@ class VectorHasher {
   DecodedVector decoded_;
   raw_vector<uint64_t> cachedHashes_;
 
+  // Identity of the dictionary alphabet whose value ids are cached in
+  // 'cachedHashes_' by makeValueIdsDecoded(). Lets consecutive batches
+  // wrapping the same alphabet, e.g. scans of dictionary-encoded files, skip
+  // recomputing ids for the alphabet. The buffer reference guards against the
+  // values buffer being recycled for other content.
+  const BaseVector* cachedBaseVector_{nullptr};
+  BufferPtr cachedBaseValues_;
+
   // Single precomputed hash for constant partition keys.
   uint64_t precomputedHash_{0};
 
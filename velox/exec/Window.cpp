@@ -211,7 +211,7 @@ void Window::callResetPartition() {
   if (windowBuild_->hasNextPartition()) {
     currentPartition_ = windowBuild_->nextPartition();
     for (int i = 0; i < windowFunctions_.size(); i++) {
-      windowFunctions_[i]->resetPartition(currentPartition_.get());
+      windowFunctions_[i]->resetPartition(currentPartition_);
     }
   }
 }
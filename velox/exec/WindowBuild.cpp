@@ -121,6 +121,17 @@ WindowBuild::WindowBuild(
   }
 }
 
+WindowPartition* WindowBuild::makeWindowPartition(
+    const folly::Range<char**>& rows) {
+  if (windowPartition_ == nullptr) {
+    windowPartition_ = std::make_unique<WindowPartition>(
+        data_.get(), rows, inputColumns_, sortKeyInfo_);
+  } else {
+    windowPartition_->resetPartition(rows);
+  }
+  return windowPartition_.get();
+}
+
 bool WindowBuild::compareRowsWithKeys(
     const char* lhs,
     const char* rhs,
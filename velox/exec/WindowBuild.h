@@ -66,9 +66,11 @@ class WindowBuild {
   // The Window operator invokes this function to get the next Window partition
   // to pass along to the WindowFunction. The WindowPartition has APIs to access
   // the underlying columns of Window partition data.
+  // The returned WindowPartition is owned by the WindowBuild and remains valid
+  // only until the next call to nextPartition().
   // Check hasNextPartition() before invoking this function. This function fails
   // if called when no partition is available.
-  virtual std::unique_ptr<WindowPartition> nextPartition() = 0;
+  virtual WindowPartition* nextPartition() = 0;
 
   // Returns the average size of input rows in bytes stored in the
   // data container of the WindowBuild.
@@ -82,6 +84,11 @@ class WindowBuild {
       const char* rhs,
       const std::vector<std::pair<column_index_t, core::SortOrder>>& keys);
 
+  // Points 'windowPartition_' at 'rows' and returns it. The WindowPartition
+  // is allocated on first use and reused for subsequent partitions to avoid
+  // a per-partition allocation when a task has many small partitions.
+  WindowPartition* makeWindowPartition(const folly::Range<char**>& rows);
+
   // The below 2 vectors represent the ChannelIndex of the partition keys
   // and the order by keys. These keyInfo are used for sorting by those
   // key combinations during the processing.
@@ -109,6 +116,10 @@ class WindowBuild {
   // RowColumns for window build used to construct WindowPartition.
   std::vector<exec::RowColumn> inputColumns_;
 
+  // Reusable WindowPartition handed out by nextPartition(). See
+  // makeWindowPartition().
+  std::unique_ptr<WindowPartition> windowPartition_;
+
   // Number of input rows.
   vector_size_t numRows_ = 0;
 };
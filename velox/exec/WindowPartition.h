@@ -40,6 +40,15 @@ class WindowPartition {
       const std::vector<std::pair<column_index_t, core::SortOrder>>&
           sortKeyInfo);
 
+  /// Points this WindowPartition at the next partition's 'rows'. The
+  /// underlying RowContainer and column layout do not change between
+  /// partitions, so WindowBuild reuses one WindowPartition object instead of
+  /// allocating one per partition, which matters when a task has many small
+  /// partitions.
+  void resetPartition(const folly::Range<char**>& rows) {
+    partition_ = rows;
+  }
+
   /// Returns the number of rows in the current WindowPartition.
   vector_size_t numRows() const {
     return partition_.size();
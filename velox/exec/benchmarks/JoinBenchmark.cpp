@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <fstream>
+
+#include <folly/Random.h>
+#include <folly/init/Init.h>
+#include <folly/json.h>
+
+#include "velox/common/time/Timer.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/functions/prestosql/aggregates/RegisterAggregateFunctions.h"
+#include "velox/parse/TypeResolver.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+/// End-to-end hash join benchmark sweeping the join space: build size x key
+/// type x match rate x null fraction. Each cell runs an inner hash join
+/// between a probe side of --probe_rows rows and a build side of distinct
+/// keys, consumed by a global aggregation so that join output is not
+/// materialized. Reports wall time and probe throughput per cell and emits
+/// the full matrix as JSON for trend dashboards.
+///
+/// The matrix is controlled by comma-separated flags, e.g.
+///
+///   velox_join_benchmark --build_sizes=1000,1000000,100000000 \
+///       --key_types=bigint,varchar --match_rates=100,10 --null_pcts=0,10 \
+///       --json_output=/tmp/join_benchmark.json
+
+DEFINE_string(
+    build_sizes,
+    "1000,100000,4000000",
+    "Comma-separated build side row counts");
+DEFINE_string(
+    key_types,
+    "bigint,integer,varchar",
+    "Comma-separated join key types: bigint, integer or varchar");
+DEFINE_string(
+    match_rates,
+    "100,50,10,1",
+    "Comma-separated percentages of probe rows that match a build row");
+DEFINE_string(
+    null_pcts,
+    "0,10",
+    "Comma-separated percentages of null join keys on both sides");
+DEFINE_int64(probe_rows, 1'000'000, "Number of probe side rows per cell");
+DEFINE_int32(batch_size, 4096, "Number of rows per input vector");
+DEFINE_int32(num_repeats, 3, "Number of runs per cell; the best is reported");
+DEFINE_string(
+    json_output,
+    "",
+    "Path of the JSON results file; empty prints JSON to stdout");
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::test;
+
+namespace {
+
+struct JoinBenchmarkParams {
+  std::string keyTypeName;
+  TypePtr keyType;
+  int64_t buildSize;
+  int32_t matchPct;
+  int32_t nullPct;
+
+  std::string toString() const {
+    return fmt::format(
+        "{} build={} match%={} null%={}",
+        keyTypeName,
+        buildSize,
+        matchPct,
+        nullPct);
+  }
+};
+
+struct JoinBenchmarkRun {
+  JoinBenchmarkParams params;
+
+  // Best wall time over the repeats.
+  uint64_t micros{0};
+
+  // Number of join output rows, as counted by the aggregation above the join.
+  int64_t numOutputRows{0};
+
+  std::string toString() const {
+    return fmt::format(
+        "{}: {} ms, {} output rows, {:.1f}M probe rows/s",
+        params.toString(),
+        micros / 1000,
+        numOutputRows,
+        micros == 0 ? 0 : FLAGS_probe_rows / static_cast<float>(micros));
+  }
+
+  folly::dynamic toJson() const {
+    folly::dynamic obj = folly::dynamic::object;
+    obj["keyType"] = params.keyTypeName;
+    obj["buildSize"] = params.buildSize;
+    obj["matchPct"] = params.matchPct;
+    obj["nullPct"] = params.nullPct;
+    obj["probeRows"] = FLAGS_probe_rows;
+    obj["micros"] = micros;
+    obj["outputRows"] = numOutputRows;
+    obj["probeRowsPerSecond"] =
+        micros == 0 ? 0 : FLAGS_probe_rows * 1'000'000.0 / micros;
+    return obj;
+  }
+};
+
+class JoinBenchmark : public VectorTestBase {
+ public:
+  JoinBenchmarkRun run(const JoinBenchmarkParams& params) {
+    auto buildVectors = makeBuildVectors(params);
+    auto probeVectors = makeProbeVectors(params);
+
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto buildPlan = exec::test::PlanBuilder(planNodeIdGenerator)
+                         .values(buildVectors)
+                         .planNode();
+    auto plan = exec::test::PlanBuilder(planNodeIdGenerator)
+                    .values(probeVectors)
+                    .hashJoin({"t0"}, {"u0"}, buildPlan, "", {"t1", "u1"})
+                    .singleAggregation({}, {"count(1)", "sum(t1)", "sum(u1)"})
+                    .planNode();
+
+    JoinBenchmarkRun result;
+    result.params = params;
+    result.micros = std::numeric_limits<uint64_t>::max();
+    for (auto repeat = 0; repeat < FLAGS_num_repeats; ++repeat) {
+      const auto start = getCurrentTimeMicro();
+      auto output =
+          exec::test::AssertQueryBuilder(plan).copyResults(pool_.get());
+      result.micros = std::min(result.micros, getCurrentTimeMicro() - start);
+      result.numOutputRows =
+          output->childAt(0)->as<FlatVector<int64_t>>()->valueAt(0);
+    }
+    return result;
+  }
+
+ private:
+  // Returns the key at 'row' of the build side: each key in
+  // [0, buildSize) appears exactly once.
+  static int64_t buildKeyAt(const JoinBenchmarkParams& params, int64_t row) {
+    return row;
+  }
+
+  // Returns the key at 'row' of the probe side: 'matchPct' percent of the
+  // rows hit a build key, the rest fall above the build key range.
+  int64_t probeKeyAt(const JoinBenchmarkParams& params, int64_t /*row*/) {
+    const auto match =
+        static_cast<int32_t>(folly::Random::rand32(100, rng_)) <
+        params.matchPct;
+    const auto key = folly::Random::rand64(params.buildSize, rng_);
+    return match ? key : params.buildSize + key;
+  }
+
+  // Makes one key vector of 'size' rows with 'nullPct' percent nulls, keys
+  // produced by 'keyAt'.
+  VectorPtr makeKeyVector(
+      const JoinBenchmarkParams& params,
+      vector_size_t size,
+      const std::function<int64_t(vector_size_t)>& keyAt) {
+    auto nullAt = [&](vector_size_t row) {
+      return params.nullPct > 0 && row % 100 < params.nullPct;
+    };
+    switch (params.keyType->kind()) {
+      case TypeKind::BIGINT:
+        return makeFlatVector<int64_t>(size, keyAt, nullAt);
+      case TypeKind::INTEGER:
+        return makeFlatVector<int32_t>(
+            size,
+            [&](auto row) { return static_cast<int32_t>(keyAt(row)); },
+            nullAt);
+      case TypeKind::VARCHAR: {
+        std::string temp;
+        return makeFlatVector<StringView>(
+            size,
+            [&](auto row) {
+              temp = fmt::format("key-{}", keyAt(row));
+              return StringView(temp);
+            },
+            nullAt);
+      }
+      default:
+        VELOX_FAIL("Unsupported key type {}", params.keyType->toString());
+    }
+  }
+
+  std::vector<RowVectorPtr> makeBuildVectors(
+      const JoinBenchmarkParams& params) {
+    std::vector<RowVectorPtr> vectors;
+    for (int64_t start = 0; start < params.buildSize;
+         start += FLAGS_batch_size) {
+      const auto size = static_cast<vector_size_t>(
+          std::min<int64_t>(FLAGS_batch_size, params.buildSize - start));
+      vectors.push_back(makeRowVector(
+          {"u0", "u1"},
+          {makeKeyVector(
+               params,
+               size,
+               [&](auto row) { return buildKeyAt(params, start + row); }),
+           makeFlatVector<int64_t>(
+               size, [&](auto row) { return start + row; })}));
+    }
+    return vectors;
+  }
+
+  std::vector<RowVectorPtr> makeProbeVectors(
+      const JoinBenchmarkParams& params) {
+    std::vector<RowVectorPtr> vectors;
+    for (int64_t start = 0; start < FLAGS_probe_rows;
+         start += FLAGS_batch_size) {
+      const auto size = static_cast<vector_size_t>(
+          std::min<int64_t>(FLAGS_batch_size, FLAGS_probe_rows - start));
+      vectors.push_back(makeRowVector(
+          {"t0", "t1"},
+          {makeKeyVector(
+               params,
+               size,
+               [&](auto row) { return probeKeyAt(params, start + row); }),
+           makeFlatVector<int64_t>(
+               size, [&](auto row) { return start + row; })}));
+    }
+    return vectors;
+  }
+
+  folly::Random::DefaultGenerator rng_;
+};
+
+template <typename T>
+std::vector<T> parseList(const std::string& flag) {
+  std::vector<std::string> parts;
+  folly::split(',', flag, parts);
+  std::vector<T> values;
+  values.reserve(parts.size());
+  for (const auto& part : parts) {
+    values.push_back(folly::to<T>(folly::trimWhitespace(part)));
+  }
+  return values;
+}
+
+TypePtr keyTypeFromName(const std::string& name) {
+  if (name == "bigint") {
+    return BIGINT();
+  }
+  if (name == "integer") {
+    return INTEGER();
+  }
+  if (name == "varchar") {
+    return VARCHAR();
+  }
+  VELOX_FAIL("Unsupported key type name: {}", name);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv);
+  aggregate::prestosql::registerAllAggregateFunctions();
+  parse::registerTypeResolver();
+
+  JoinBenchmark bm;
+  std::vector<JoinBenchmarkRun> runs;
+  for (const auto& keyTypeName : parseList<std::string>(FLAGS_key_types)) {
+    const auto keyType = keyTypeFromName(keyTypeName);
+    for (const auto buildSize : parseList<int64_t>(FLAGS_build_sizes)) {
+      for (const auto matchPct : parseList<int32_t>(FLAGS_match_rates)) {
+        for (const auto nullPct : parseList<int32_t>(FLAGS_null_pcts)) {
+          JoinBenchmarkParams params{
+              keyTypeName, keyType, buildSize, matchPct, nullPct};
+          runs.push_back(bm.run(params));
+          std::cout << runs.back().toString() << std::endl;
+        }
+      }
+    }
+  }
+
+  folly::dynamic results = folly::dynamic::array;
+  for (const auto& run : runs) {
+    results.push_back(run.toJson());
+  }
+  const auto json = folly::toPrettyJson(results);
+  if (FLAGS_json_output.empty()) {
+    std::cout << json << std::endl;
+  } else {
+    std::ofstream out(FLAGS_json_output);
+    out << json << std::endl;
+  }
+  return 0;
+}
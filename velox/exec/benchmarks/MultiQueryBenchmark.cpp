@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <thread>
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/init/Init.h>
+
+#include "velox/common/time/Timer.h"
+#include "velox/exec/DriverScheduler.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/functions/prestosql/aggregates/RegisterAggregateFunctions.h"
+#include "velox/parse/TypeResolver.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+/// Multi-query scheduling benchmark: runs N concurrent queries on one driver
+/// thread pool and reports per-query latency percentiles and total wall time,
+/// once with the queries sharing the pool directly (FIFO, the starvation
+/// baseline) and once through DriverScheduler's weight-fair dispatch.
+///
+/// Most queries are small aggregations; every --heavy_every'th query joins
+/// and aggregates --heavy_multiplier times the data to model the large query
+/// that starves the small ones on a FIFO executor.
+
+DEFINE_int32(num_queries, 16, "Number of concurrent queries");
+DEFINE_int32(num_threads, 4, "Number of driver threads");
+DEFINE_int64(rows_per_query, 1'000'000, "Input rows of a small query");
+DEFINE_int32(batch_size, 4096, "Number of rows per input vector");
+DEFINE_int32(
+    heavy_every,
+    4,
+    "Every n-th query is heavy; 0 makes all queries small");
+DEFINE_int32(
+    heavy_multiplier,
+    8,
+    "Input size of a heavy query relative to a small one");
+DEFINE_int32(num_repeats, 3, "Number of runs per mode; the best is reported");
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::test;
+
+namespace {
+
+struct MultiQueryRunResult {
+  // Per-query wall times, sorted ascending.
+  std::vector<uint64_t> latenciesMicros;
+
+  // Wall time from first submit to last completion.
+  uint64_t totalMicros{0};
+
+  uint64_t percentile(int32_t pct) const {
+    return latenciesMicros[std::min(
+        latenciesMicros.size() - 1, latenciesMicros.size() * pct / 100)];
+  }
+
+  std::string toString() const {
+    return fmt::format(
+        "p50={} ms p95={} ms max={} ms total={} ms {:.2f} queries/s",
+        percentile(50) / 1000,
+        percentile(95) / 1000,
+        latenciesMicros.back() / 1000,
+        totalMicros / 1000,
+        latenciesMicros.size() * 1'000'000.0 / totalMicros);
+  }
+};
+
+class MultiQueryBenchmark : public VectorTestBase {
+ public:
+  MultiQueryBenchmark() {
+    makePlans();
+  }
+
+  // Runs all queries concurrently, each on 'executorAt(i)', and reports
+  // latency distribution and total wall time.
+  MultiQueryRunResult run(
+      const std::function<std::shared_ptr<folly::Executor>(int32_t)>&
+          executorAt) {
+    std::vector<std::shared_ptr<folly::Executor>> executors;
+    for (auto i = 0; i < FLAGS_num_queries; ++i) {
+      executors.push_back(executorAt(i));
+    }
+
+    MultiQueryRunResult result;
+    result.latenciesMicros.resize(FLAGS_num_queries);
+    const auto start = getCurrentTimeMicro();
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < FLAGS_num_queries; ++i) {
+      threads.emplace_back([&, i]() {
+        const auto queryStart = getCurrentTimeMicro();
+        auto queryCtx =
+            std::make_shared<core::QueryCtx>(executors[i].get());
+        exec::test::AssertQueryBuilder(isHeavy(i) ? heavyPlan_ : smallPlan_)
+            .queryCtx(queryCtx)
+            .copyResults(pool_.get());
+        result.latenciesMicros[i] = getCurrentTimeMicro() - queryStart;
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    result.totalMicros = getCurrentTimeMicro() - start;
+    std::sort(result.latenciesMicros.begin(), result.latenciesMicros.end());
+    return result;
+  }
+
+  static bool isHeavy(int32_t queryIndex) {
+    return FLAGS_heavy_every > 0 && queryIndex % FLAGS_heavy_every == 0;
+  }
+
+ private:
+  std::vector<RowVectorPtr> makeData(int64_t numRows) {
+    std::vector<RowVectorPtr> vectors;
+    for (int64_t start = 0; start < numRows; start += FLAGS_batch_size) {
+      const auto size = static_cast<vector_size_t>(
+          std::min<int64_t>(FLAGS_batch_size, numRows - start));
+      vectors.push_back(makeRowVector({
+          makeFlatVector<int64_t>(
+              size, [&](auto row) { return (start + row) % 10'000; }),
+          makeFlatVector<int64_t>(
+              size, [&](auto row) { return start + row; }),
+      }));
+    }
+    return vectors;
+  }
+
+  void makePlans() {
+    auto makePlan = [&](int64_t numRows) {
+      auto data = makeData(numRows);
+      auto planNodeIdGenerator =
+          std::make_shared<core::PlanNodeIdGenerator>();
+      auto buildPlan = exec::test::PlanBuilder(planNodeIdGenerator)
+                           .values(data)
+                           .singleAggregation({"c0"}, {"max(c1) as m1"})
+                           .planNode();
+      return exec::test::PlanBuilder(planNodeIdGenerator)
+          .values(data)
+          .hashJoin({"c0"}, {"c0"}, buildPlan, "", {"c1", "m1"})
+          .singleAggregation({}, {"count(1)", "sum(c1)", "sum(m1)"})
+          .planNode();
+    };
+    smallPlan_ = makePlan(FLAGS_rows_per_query);
+    heavyPlan_ = makePlan(FLAGS_rows_per_query * FLAGS_heavy_multiplier);
+  }
+
+  core::PlanNodePtr smallPlan_;
+  core::PlanNodePtr heavyPlan_;
+};
+
+// Runs 'run' --num_repeats times and returns the run with the least total
+// time.
+MultiQueryRunResult best(const std::function<MultiQueryRunResult()>& run) {
+  MultiQueryRunResult result;
+  for (auto repeat = 0; repeat < FLAGS_num_repeats; ++repeat) {
+    auto candidate = run();
+    if (result.totalMicros == 0 ||
+        candidate.totalMicros < result.totalMicros) {
+      result = std::move(candidate);
+    }
+  }
+  return result;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv);
+  aggregate::prestosql::registerAllAggregateFunctions();
+  parse::registerTypeResolver();
+
+  MultiQueryBenchmark bm;
+  auto driverExecutor =
+      std::make_shared<folly::CPUThreadPoolExecutor>(FLAGS_num_threads);
+
+  // Baseline: all queries share the pool's FIFO queue directly.
+  auto fifo = best([&]() {
+    return bm.run([&](int32_t /*queryIndex*/) {
+      return std::static_pointer_cast<folly::Executor>(driverExecutor);
+    });
+  });
+  std::cout << "fifo: " << fifo.toString() << std::endl;
+
+  // Weight-fair dispatch through DriverScheduler; heavy queries get no extra
+  // weight, so small query latency is protected.
+  auto scheduler = DriverScheduler::create(driverExecutor.get());
+  auto fair = best([&]() {
+    return bm.run(
+        [&](int32_t /*queryIndex*/) { return scheduler->addQuery(); });
+  });
+  std::cout << "fair: " << fair.toString() << std::endl;
+
+  return 0;
+}
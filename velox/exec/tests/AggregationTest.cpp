@@ -837,6 +837,41 @@ TEST_F(AggregationTest, partialAggregationMemoryLimit) {
           .customStats.count("flushRowCount"));
 }
 
+TEST_F(AggregationTest, partialAggregationHotGroupRetention) {
+  // Skewed key distribution: a handful of hot keys repeat in every batch
+  // while the remaining rows produce fresh cold keys. With a low memory limit
+  // the partial aggregation flushes repeatedly; the hot groups are retained
+  // across flushes and emitted more than once, which the final aggregation
+  // must combine correctly.
+  std::vector<RowVectorPtr> vectors;
+  for (auto batch = 0; batch < 5; ++batch) {
+    vectors.push_back(makeRowVector({makeFlatVector<int64_t>(
+        1'000, [&](auto row) {
+          return row % 3 == 0 ? batch * 10'000 + row : row % 17;
+        })}));
+  }
+
+  createDuckDbTable(vectors);
+
+  core::PlanNodeId aggNodeId;
+  auto task =
+      AssertQueryBuilder(duckDbQueryRunner_)
+          .config(QueryConfig::kMaxPartialAggregationMemory, "20000")
+          .plan(PlanBuilder()
+                    .values(vectors)
+                    .partialAggregation({"c0"}, {"count(1)", "sum(c0)"})
+                    .capturePlanNodeId(aggNodeId)
+                    .finalAggregation()
+                    .planNode())
+          .assertResults("SELECT c0, count(1), sum(c0) FROM tmp GROUP BY 1");
+  EXPECT_GT(
+      toPlanStats(task->taskStats())
+          .at(aggNodeId)
+          .customStats.at("flushRowCount")
+          .count,
+      1);
+}
+
 TEST_F(AggregationTest, partialDistinctWithAbandon) {
   auto vectors = {
       // 1st batch will produce 100 distinct groups from 10 rows.
@@ -1882,6 +1917,63 @@ TEST_F(AggregationTest, preGroupedAggregationWithSpilling) {
   OperatorTestBase::deleteTaskAndCheckSpillDirectory(task);
 }
 
+TEST_F(AggregationTest, preGroupedSortedAggregation) {
+  std::vector<RowVectorPtr> vectors;
+  int64_t val = 0;
+  for (int32_t i = 0; i < 4; ++i) {
+    const int64_t base = i * 20;
+    vectors.push_back(makeRowVector(
+        {// Pre-grouped key. Clusters span batch boundaries.
+         makeFlatVector<int64_t>(20, [&](auto /*row*/) { return val++ / 8; }),
+         // Grouping key that is not pre-grouped.
+         makeFlatVector<int64_t>(20, [](auto row) { return row % 2; }),
+         // Payload.
+         makeFlatVector<int64_t>(20, [&](auto row) { return base + row; }),
+         // Sorting key, unique across the input.
+         makeFlatVector<int64_t>(
+             20, [&](auto row) { return 1'000 - (base + row); })}));
+  }
+  createDuckDbTable(vectors);
+
+  // Sorted-aggregate input rows are freed at every pre-grouped key boundary
+  // flush. Use a small output batch size so that each flush extracts groups
+  // over multiple calls.
+  AssertQueryBuilder(
+      PlanBuilder()
+          .values(vectors)
+          .aggregation(
+              {"c0", "c1"},
+              {"c0"},
+              {"sum(c2)", "array_agg(c2 ORDER BY c3 DESC)"},
+              {},
+              core::AggregationNode::Step::kSingle,
+              false)
+          .planNode(),
+      duckDbQueryRunner_)
+      .config(QueryConfig::kPreferredOutputBatchRows, "3")
+      .assertResults(
+          "SELECT c0, c1, sum(c2), array_agg(c2 ORDER BY c3 DESC) "
+          "FROM tmp GROUP BY c0, c1");
+
+  // When input is clustered on all grouping keys, sorted aggregates still run
+  // through the hash aggregation streaming path since StreamingAggregation
+  // doesn't support them.
+  AssertQueryBuilder(
+      PlanBuilder()
+          .values(vectors)
+          .aggregation(
+              {"c0"},
+              {"c0"},
+              {"array_agg(c2 ORDER BY c3 DESC)"},
+              {},
+              core::AggregationNode::Step::kSingle,
+              false)
+          .planNode(),
+      duckDbQueryRunner_)
+      .assertResults(
+          "SELECT c0, array_agg(c2 ORDER BY c3 DESC) FROM tmp GROUP BY c0");
+}
+
 TEST_F(AggregationTest, adaptiveOutputBatchRows) {
   int32_t defaultOutputBatchRows = 10;
   vector_size_t size = defaultOutputBatchRows * 5;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/DriverScheduler.h"
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/executors/ManualExecutor.h>
+
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::exec::test;
+
+class DriverSchedulerTest : public OperatorTestBase {};
+
+TEST_F(DriverSchedulerTest, weightedFairDispatch) {
+  // Queue work for two queries on a manual executor and drain it. Work must
+  // interleave proportionally to the weights instead of the FIFO enqueue
+  // order.
+  folly::ManualExecutor manualExecutor;
+  auto scheduler = DriverScheduler::create(&manualExecutor);
+
+  auto lightQuery = scheduler->addQuery(1);
+  auto heavyQuery = scheduler->addQuery(2);
+
+  std::vector<int32_t> dispatchOrder;
+  for (auto i = 0; i < 12; ++i) {
+    lightQuery->add([&]() { dispatchOrder.push_back(1); });
+  }
+  for (auto i = 0; i < 12; ++i) {
+    heavyQuery->add([&]() { dispatchOrder.push_back(2); });
+  }
+
+  manualExecutor.drain();
+  ASSERT_EQ(dispatchOrder.size(), 24);
+
+  // In the first half of the dispatches the heavy query must get twice the
+  // slots of the light one despite enqueueing last.
+  const auto numHeavy =
+      std::count(dispatchOrder.begin(), dispatchOrder.begin() + 12, 2);
+  ASSERT_EQ(numHeavy, 8);
+}
+
+TEST_F(DriverSchedulerTest, queryLifetime) {
+  // Work enqueued through a view still runs after the view is destroyed, and
+  // the scheduler stays usable for new queries.
+  folly::ManualExecutor manualExecutor;
+  auto scheduler = DriverScheduler::create(&manualExecutor);
+
+  int32_t numRuns = 0;
+  {
+    auto query = scheduler->addQuery();
+    for (auto i = 0; i < 5; ++i) {
+      query->add([&]() { ++numRuns; });
+    }
+  }
+  manualExecutor.drain();
+  ASSERT_EQ(numRuns, 5);
+
+  auto query = scheduler->addQuery();
+  query->add([&]() { ++numRuns; });
+  manualExecutor.drain();
+  ASSERT_EQ(numRuns, 6);
+}
+
+TEST_F(DriverSchedulerTest, concurrentQueries) {
+  // End to end: run concurrent aggregations over a shared driver pool with
+  // one thread per query's executor view.
+  folly::CPUThreadPoolExecutor driverExecutor(2);
+  auto scheduler = DriverScheduler::create(&driverExecutor);
+
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(10'000, [](auto row) { return row % 100; }),
+      makeFlatVector<int64_t>(10'000, [](auto row) { return row; }),
+  });
+  auto plan = PlanBuilder()
+                  .values({data, data, data})
+                  .singleAggregation({"c0"}, {"sum(c1)"})
+                  .singleAggregation({}, {"count(1)"})
+                  .planNode();
+
+  constexpr int32_t kNumQueries = 4;
+  std::vector<std::shared_ptr<folly::Executor>> queryExecutors;
+  std::vector<std::thread> threads;
+  std::atomic<int32_t> numCompleted{0};
+  for (auto i = 0; i < kNumQueries; ++i) {
+    queryExecutors.push_back(scheduler->addQuery(1 + i % 2));
+  }
+  for (auto i = 0; i < kNumQueries; ++i) {
+    threads.emplace_back([&, i]() {
+      auto queryCtx =
+          std::make_shared<core::QueryCtx>(queryExecutors[i].get());
+      auto result = AssertQueryBuilder(plan)
+                        .queryCtx(queryCtx)
+                        .copyResults(pool_.get());
+      ASSERT_EQ(result->size(), 1);
+      ASSERT_EQ(
+          result->childAt(0)->asFlatVector<int64_t>()->valueAt(0), 100);
+      ++numCompleted;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(numCompleted, kNumQueries);
+}
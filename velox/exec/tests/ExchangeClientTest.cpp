@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/exec/Exchange.h"
+#include "velox/exec/OutputBufferExchangeSource.h"
 #include "velox/exec/OutputBufferManager.h"
 #include "velox/exec/Task.h"
 #include "velox/exec/tests/utils/LocalExchangeSource.h"
@@ -108,6 +109,24 @@ TEST_F(ExchangeClientTest, nonVeloxCreateExchangeSourceException) {
       "Task ID: xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx.");
 }
 
+TEST_F(ExchangeClientTest, deserializedPage) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>({1, 2, 3, 4, 5}),
+  });
+
+  auto page = std::make_unique<SerializedPage>(data);
+  ASSERT_EQ(page->rowVector(), data);
+  ASSERT_EQ(page->size(), data->retainedSize());
+
+  // Pages carrying deserialized vectors cannot be sent to a remote consumer.
+  ByteStream stream;
+  VELOX_ASSERT_THROW(
+      page->prepareStreamForDeserialize(&stream),
+      "Page carrying a deserialized vector cannot be deserialized");
+  VELOX_ASSERT_THROW(
+      page->getIOBuf(), "Page carrying a deserialized vector has no IOBuf");
+}
+
 TEST_F(ExchangeClientTest, stats) {
   auto data = {
       makeRowVector({makeFlatVector<int32_t>({1, 2, 3})}),
@@ -197,5 +216,157 @@ TEST_F(ExchangeClientTest, flowControl) {
   }
 }
 
+// Test scenario where the whole request window is taken by a source that does
+// not respond. Verify that a starved client speculatively requests from one
+// more source instead of waiting out the straggler's long poll.
+TEST_F(ExchangeClientTest, stragglerSource) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+  });
+
+  auto plan = test::PlanBuilder()
+                  .values({data})
+                  .partitionedOutput({"c0"}, 100)
+                  .planNode();
+
+  // A tiny queue size limits the request window to a single source at a time.
+  ExchangeClient client("straggler", 17, pool(), 1);
+
+  // The first task is a straggler: it has no data, so its request stays
+  // pending and takes up the only request slot.
+  const auto stragglerTaskId = "local://straggler-t0";
+  auto stragglerTask = makeTask(stragglerTaskId, plan, 17);
+  bufferManager_->initializeTask(
+      stragglerTask, core::PartitionedOutputNode::Kind::kPartitioned, 100, 16);
+  client.addRemoteTaskId(stragglerTaskId);
+
+  // The second task has data ready.
+  const auto taskId = "local://straggler-t1";
+  auto task = makeTask(taskId, plan, 17);
+  bufferManager_->initializeTask(
+      task, core::PartitionedOutputNode::Kind::kPartitioned, 100, 16);
+  for (auto i = 0; i < 3; ++i) {
+    enqueue(taskId, 17, data);
+  }
+  client.addRemoteTaskId(taskId);
+
+  int32_t numPages = 0;
+  while (numPages < 3) {
+    bool atEnd;
+    ContinueFuture future;
+    auto page = client.next(&atEnd, &future);
+    if (page == nullptr) {
+      std::move(future).wait();
+      continue;
+    }
+    ++numPages;
+  }
+
+  auto stats = client.stats();
+  EXPECT_EQ(3, stats.at("numReceivedPages").sum);
+  EXPECT_GE(stats.at("numSpeculativeRequests").sum, 1);
+
+  for (auto& t : {stragglerTask, task}) {
+    t->requestCancel();
+    bufferManager_->removeTask(t->taskId());
+  }
+}
+
+TEST_F(ExchangeClientTest, outputBufferExchangeSource) {
+  // The in-process source is selected by the presence of an output buffer in
+  // this process, not by the task ID format.
+  exec::ExchangeSource::factories().clear();
+  exec::ExchangeSource::registerFactory(
+      OutputBufferExchangeSource::createIfLocal);
+
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+  });
+
+  auto plan = test::PlanBuilder()
+                  .values({data})
+                  .partitionedOutput({"c0"}, 100)
+                  .planNode();
+  const std::string taskId = "remote-looking-task-id.1.2.3";
+  auto task = makeTask(taskId, plan, 17);
+  bufferManager_->initializeTask(
+      task, core::PartitionedOutputNode::Kind::kPartitioned, 100, 16);
+
+  const auto numPages = 3;
+  for (auto i = 0; i < numPages; ++i) {
+    enqueue(taskId, 17, data);
+  }
+
+  ExchangeClient client(
+      "output.buffer", 17, pool(), ExchangeClient::kDefaultMaxQueuedBytes);
+  client.addRemoteTaskId(taskId);
+
+  fetchPages(client, numPages);
+
+  const auto stats = client.stats();
+  EXPECT_EQ(numPages, stats.at("outputBufferExchangeSource.numPages").sum);
+  EXPECT_EQ(numPages, stats.at("numReceivedPages").sum);
+
+  client.close();
+  task->requestCancel();
+  bufferManager_->removeTask(taskId);
+}
+
+TEST_F(ExchangeClientTest, pageDecoder) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(100, [](auto row) { return row; }),
+  });
+
+  auto plan = test::PlanBuilder()
+                  .values({data})
+                  .partitionedOutput({"c0"}, 100)
+                  .planNode();
+  const std::string taskId = "local://decode";
+  auto task = makeTask(taskId, plan, 17);
+  bufferManager_->initializeTask(
+      task, core::PartitionedOutputNode::Kind::kPartitioned, 100, 16);
+
+  ExchangeClient client(
+      "decode", 17, pool(), ExchangeClient::kDefaultMaxQueuedBytes);
+
+  // Decode pages into vectors on the enqueueing thread, the way Exchange
+  // installs its decoder when decode-ahead is enabled.
+  const auto outputType = asRowType(data->type());
+  client.queue()->setPageDecoder(
+      [&, outputType](std::unique_ptr<SerializedPage> page) {
+        std::vector<std::unique_ptr<SerializedPage>> decoded;
+        ByteStream input;
+        page->prepareStreamForDeserialize(&input);
+        while (!input.atEnd()) {
+          RowVectorPtr vector;
+          getVectorSerde()->deserialize(&input, pool(), outputType, &vector);
+          decoded.push_back(
+              std::make_unique<SerializedPage>(std::move(vector)));
+        }
+        return decoded;
+      });
+
+  client.addRemoteTaskId(taskId);
+
+  const auto numPages = 3;
+  for (auto i = 0; i < numPages; ++i) {
+    enqueue(taskId, 17, data);
+  }
+
+  // The pages arrive carrying deserialized vectors.
+  for (auto i = 0; i < numPages; ++i) {
+    bool atEnd;
+    ContinueFuture future;
+    auto page = client.next(&atEnd, &future);
+    ASSERT_TRUE(page != nullptr);
+    ASSERT_TRUE(page->rowVector() != nullptr);
+    velox::test::assertEqualVectors(data, page->rowVector());
+  }
+
+  client.close();
+  task->requestCancel();
+  bufferManager_->removeTask(taskId);
+}
+
 } // namespace
 } // namespace facebook::velox::exec
@@ -99,6 +99,37 @@ TEST_F(FilterProjectTest, filterOverDictionary) {
   assertFilter(vectors);
 }
 
+TEST_F(FilterProjectTest, filterOverDictionaryWithNulls) {
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 10; ++i) {
+    auto vector = std::dynamic_pointer_cast<RowVector>(
+        BatchMaker::createBatch(rowType_, 100, *pool_));
+
+    auto indices = allocateIndices(vector->size(), pool_.get());
+    auto indicesPtr = indices->asMutable<int32_t>();
+    auto nulls = allocateNulls(vector->size(), pool_.get());
+    auto nullsPtr = nulls->asMutable<uint64_t>();
+    for (int32_t j = 0; j < vector->size(); j++) {
+      indicesPtr[j] = j / 2;
+      if (j % 7 == 0) {
+        bits::setNull(nullsPtr, j);
+      }
+    }
+    std::vector<VectorPtr> newChildren = vector->children();
+    newChildren[1] = BaseVector::wrapInDictionary(
+        nulls, indices, vector->size(), vector->childAt(1));
+    vectors.push_back(std::make_shared<RowVector>(
+        pool_.get(),
+        rowType_,
+        BufferPtr(nullptr),
+        vector->size(),
+        newChildren));
+  }
+  createDuckDbTable(vectors);
+
+  assertFilter(vectors);
+}
+
 TEST_F(FilterProjectTest, filterOverConstant) {
   std::vector<RowVectorPtr> vectors;
   for (int32_t i = 0; i < 10; ++i) {
@@ -325,6 +356,43 @@ TEST_F(FilterProjectTest, projectAndIdentityOverLazy) {
   assertQuery(plan, "SELECT c0 < 10 AND c1 < 10, c1 FROM tmp");
 }
 
+TEST_F(FilterProjectTest, lazyLoadingAfterFilter) {
+  // Verify that a lazy column which is referenced by a projection and an
+  // identity projection, but not by the filter, is loaded only for the rows
+  // that pass the filter.
+  vector_size_t size = 20;
+  auto valueAt = [](auto row) -> int32_t { return row; };
+
+  vector_size_t numLoaded = 0;
+  auto lazyVectors = makeRowVector({
+      makeFlatVector<int32_t>(size, valueAt),
+      std::make_shared<LazyVector>(
+          pool_.get(),
+          INTEGER(),
+          size,
+          std::make_unique<test::SimpleVectorLoader>([&](RowSet rowSet) {
+            numLoaded += rowSet.size();
+            return makeFlatVector<int32_t>(rowSet.back() + 1, valueAt);
+          })),
+  });
+
+  auto vectors = makeRowVector({
+      makeFlatVector<int32_t>(size, valueAt),
+      makeFlatVector<int32_t>(size, valueAt),
+  });
+
+  createDuckDbTable({vectors});
+
+  auto plan = PlanBuilder()
+                  .values({lazyVectors})
+                  .filter("c0 % 2 = 0")
+                  .project({"c1 + 1", "c1"})
+                  .planNode();
+  assertQuery(plan, "SELECT c1 + 1, c1 FROM tmp WHERE c0 % 2 = 0");
+
+  ASSERT_EQ(numLoaded, size / 2);
+}
+
 // Verify that nulls on nested parent are propagated to child without copying
 // the child.  Note that null on top level columns are handled separately in
 // Expr::evalWithNulls; this happens only once per expression tree so we are not
@@ -3919,6 +3919,88 @@ TEST_F(HashJoinTest, lazyVectors) {
   }
 }
 
+TEST_F(HashJoinTest, lazyBuildSideColumns) {
+  // Build-side output columns are produced as LazyVectors loaded from the
+  // hash table on first use. Run them through selective post-join filters,
+  // projections that drop them without loading and aggregations that push
+  // value hooks into the load.
+  auto probeVectors = makeBatches(3, [&](int32_t /*unused*/) {
+    return makeRowVector(
+        {"t0", "t1"},
+        {
+            makeFlatVector<int32_t>(1'000, [](auto row) { return row % 300; }),
+            makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+        });
+  });
+
+  auto buildVectors = makeBatches(2, [&](int32_t /*unused*/) {
+    return makeRowVector(
+        {"u0", "u1", "u2"},
+        {
+            makeFlatVector<int32_t>(100, [](auto row) { return row; }),
+            makeFlatVector<int64_t>(100, [](auto row) { return row * 10; }),
+            makeFlatVector<StringView>(
+                100,
+                [](auto row) {
+                  return StringView::makeInline(fmt::format("s-{}", row));
+                }),
+        });
+  });
+
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  // A selective post-join filter followed by aggregates on the build-side
+  // payload loads only the surviving rows and exercises the value hook path.
+  {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .values(probeVectors)
+                    .hashJoin(
+                        {"t0"},
+                        {"u0"},
+                        PlanBuilder(planNodeIdGenerator)
+                            .values(buildVectors)
+                            .planNode(),
+                        "",
+                        {"t1", "u1", "u2"})
+                    .filter("t1 % 10 = 0")
+                    .singleAggregation({}, {"sum(u1)", "max(u2)"})
+                    .planNode();
+
+    HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+        .planNode(plan)
+        .referenceQuery(
+            "SELECT sum(u.u1), max(u.u2) FROM t, u "
+            "WHERE t.t0 = u.u0 AND t.t1 % 10 = 0")
+        .run();
+  }
+
+  // A projection that drops the build-side columns discards the unloaded
+  // LazyVectors without ever extracting them.
+  {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .values(probeVectors)
+                    .hashJoin(
+                        {"t0"},
+                        {"u0"},
+                        PlanBuilder(planNodeIdGenerator)
+                            .values(buildVectors)
+                            .planNode(),
+                        "",
+                        {"t1", "u1", "u2"},
+                        core::JoinType::kLeft)
+                    .project({"t1"})
+                    .planNode();
+
+    HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+        .planNode(plan)
+        .referenceQuery("SELECT t.t1 FROM t LEFT JOIN u ON t.t0 = u.u0")
+        .run();
+  }
+}
+
 TEST_F(HashJoinTest, dynamicFilters) {
   const int32_t numSplits = 10;
   const int32_t numRowsProbe = 333;
@@ -4759,6 +4841,64 @@ TEST_F(HashJoinTest, smallOutputBatchSize) {
       .run();
 }
 
+DEBUG_ONLY_TEST_F(HashJoinTest, yieldDuringProbeWithSelectiveFilter) {
+  // Every probe row matches build rows but the filter rejects all of them, so
+  // the probe loop walks the whole batch without producing output. Request
+  // yield before each probe getOutput() and verify that the loop gives up the
+  // thread instead of processing the whole batch in one call.
+  auto probeVectors = makeRowVector(
+      {"c0", "c1"},
+      {
+          makeFlatVector<int32_t>(1'000, [](auto row) { return row % 5; }),
+          makeFlatVector<int32_t>(1'000, [](auto row) { return row; }),
+      });
+  auto buildVectors = makeRowVector(
+      {"u_c0", "u_c1"},
+      {
+          makeFlatVector<int32_t>({0, 1, 2, 3, 4}),
+          makeFlatVector<int32_t>({0, 10, 20, 30, 40}),
+      });
+
+  createDuckDbTable("t", {probeVectors});
+  createDuckDbTable("u", {buildVectors});
+
+  SCOPED_TESTVALUE_SET(
+      "facebook::velox::exec::Driver::runInternal::getOutput",
+      std::function<void(Operator*)>([&](Operator* op) {
+        if (op->operatorType() == "HashProbe") {
+          op->testingOperatorCtx()->task()->requestYield();
+        }
+      }));
+  std::atomic<int32_t> numYields{0};
+  SCOPED_TESTVALUE_SET(
+      "facebook::velox::exec::HashProbe::getOutput::yield",
+      std::function<void(Operator*)>(
+          [&](Operator* /*unused*/) { ++numYields; }));
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .values({probeVectors})
+                  .hashJoin(
+                      {"c0"},
+                      {"u_c0"},
+                      PlanBuilder(planNodeIdGenerator)
+                          .values({buildVectors})
+                          .planNode(),
+                      "c1 + u_c1 < 0",
+                      {"c0", "u_c1"})
+                  .planNode();
+
+  HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+      .planNode(std::move(plan))
+      .config(core::QueryConfig::kPreferredOutputBatchRows, std::to_string(10))
+      .referenceQuery(
+          "SELECT c0, u_c1 FROM t, u WHERE c0 = u_c0 AND c1 + u_c1 < 0")
+      .injectSpill(false)
+      .run();
+
+  EXPECT_GT(numYields, 0);
+}
+
 TEST_F(HashJoinTest, spillFileSize) {
   const std::vector<uint64_t> maxSpillFileSizes({0, 1, 1'000'000'000});
   for (const auto spillFileSize : maxSpillFileSizes) {
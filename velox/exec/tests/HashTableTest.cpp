@@ -520,6 +520,14 @@ TEST_P(HashTableTest, int2DenseArray) {
   testCycle(BaseHashTable::HashMode::kArray, 500, 2, type, 2);
 }
 
+TEST_P(HashTableTest, int1DenseArray) {
+  // Single integer key over a dense range, like a fact to date dimension
+  // join key. The table must stay in direct-address kArray mode so probes
+  // do neither hashing nor tag compares.
+  auto type = ROW({"k1"}, {BIGINT()});
+  testCycle(BaseHashTable::HashMode::kArray, 100000, 9, type, 1);
+}
+
 TEST_P(HashTableTest, string1DenseArray) {
   auto type = ROW({"k1"}, {VARCHAR()});
   testCycle(BaseHashTable::HashMode::kArray, 500, 2, type, 1);
@@ -777,6 +785,96 @@ TEST_P(HashTableTest, checkSizeValidation) {
   ASSERT_EQ(table->capacity(), 512 << 10);
 }
 
+TEST_P(HashTableTest, incrementalResize) {
+  // Inserts batches of distinct keys so the table grows through several
+  // resizes, with the threshold lowered so the resizes run incrementally.
+  // Probes must keep finding the rows inserted earlier whether they have
+  // been migrated to the new table or still sit in the old one.
+  constexpr int32_t kBatchSize = 1024;
+  constexpr int32_t kNumBatches = 100;
+  auto type = ROW({"k1"}, {BIGINT()});
+  auto table = createHashTableForAggregation(type, 1);
+  table->testingSetHashMode(BaseHashTable::HashMode::kHash, kBatchSize);
+  table->testingSetMinIncrementalResizeEntries(4096);
+  auto lookup = std::make_unique<HashLookup>(table->hashers());
+  std::vector<RowVectorPtr> batches;
+  makeRows(kBatchSize, kNumBatches, 0, type, batches);
+  std::vector<char*> allInserted;
+  bool sawPendingResize = false;
+  for (const auto& batch : batches) {
+    insertGroups(*batch, *lookup, *table);
+    allInserted.insert(
+        allInserted.end(), lookup->hits.begin(), lookup->hits.end());
+    sawPendingResize |= table->testingHasPendingResize();
+  }
+  ASSERT_TRUE(sawPendingResize);
+  ASSERT_EQ(table->numDistinct(), kBatchSize * kNumBatches);
+
+  // Probe all the keys again. Every row must resolve to the group created at
+  // first insertion.
+  for (auto i = 0; i < batches.size(); ++i) {
+    insertGroups(*batches[i], *lookup, *table);
+    for (auto j = 0; j < kBatchSize; ++j) {
+      ASSERT_EQ(lookup->hits[j], allInserted[i * kBatchSize + j]);
+    }
+  }
+  ASSERT_EQ(table->numDistinct(), kBatchSize * kNumBatches);
+
+  // Erase finishes any in-progress resize so its probes can find every row.
+  table->erase(folly::Range<char**>(allInserted.data(), kBatchSize));
+  ASSERT_FALSE(table->testingHasPendingResize());
+  insertGroups(*batches[1], *lookup, *table);
+  for (auto j = 0; j < kBatchSize; ++j) {
+    ASSERT_EQ(lookup->hits[j], allInserted[kBatchSize + j]);
+  }
+  table->checkConsistency();
+}
+
+TEST_P(HashTableTest, compact) {
+  // Builds a group by table, erases most groups and compacts the payload
+  // rows. Probes after compaction must find the surviving groups at their new
+  // addresses and make fresh groups for the erased keys.
+  constexpr int32_t kBatchSize = 1024;
+  constexpr int32_t kNumBatches = 50;
+  constexpr int32_t kNumKeptBatches = 5;
+  auto type = ROW({"k1"}, {BIGINT()});
+  auto table = createHashTableForAggregation(type, 1);
+  auto lookup = std::make_unique<HashLookup>(table->hashers());
+  std::vector<RowVectorPtr> batches;
+  makeRows(kBatchSize, kNumBatches, 0, type, batches);
+  std::vector<char*> allInserted;
+  for (const auto& batch : batches) {
+    insertGroups(*batch, *lookup, *table);
+    allInserted.insert(
+        allInserted.end(), lookup->hits.begin(), lookup->hits.end());
+  }
+  ASSERT_EQ(table->numDistinct(), kBatchSize * kNumBatches);
+
+  // Erase all groups but the ones of the last 'kNumKeptBatches' batches.
+  constexpr int32_t kNumErased = kBatchSize * (kNumBatches - kNumKeptBatches);
+  table->erase(folly::Range<char**>(allInserted.data(), kNumErased));
+  ASSERT_EQ(table->numDistinct(), kBatchSize * kNumKeptBatches);
+  const auto allocatedBefore = table->allocatedBytes();
+  EXPECT_GT(table->compact(), 0);
+  EXPECT_LT(table->allocatedBytes(), allocatedBefore);
+  table->checkConsistency();
+  table->rows()->checkConsistency();
+
+  // Probing the surviving keys finds their groups without adding distincts.
+  for (auto i = kNumBatches - kNumKeptBatches; i < kNumBatches; ++i) {
+    insertGroups(*batches[i], *lookup, *table);
+  }
+  ASSERT_EQ(table->numDistinct(), kBatchSize * kNumKeptBatches);
+
+  // Erased keys make new groups.
+  insertGroups(*batches[0], *lookup, *table);
+  ASSERT_EQ(table->numDistinct(), kBatchSize * (kNumKeptBatches + 1));
+
+  // A table with no free rows is left as is.
+  EXPECT_EQ(table->compact(), 0);
+  ASSERT_EQ(table->numDistinct(), kBatchSize * (kNumKeptBatches + 1));
+}
+
 TEST_P(HashTableTest, listNullKeyRows) {
   VectorPtr keys = vectorMaker_->flatVector<int64_t>(500, folly::identity);
   testListNullKeyRows(keys, BaseHashTable::HashMode::kArray);
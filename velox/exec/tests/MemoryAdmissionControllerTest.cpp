@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/MemoryAdmissionController.h"
+
+#include <gtest/gtest.h>
+
+#include "velox/common/memory/Memory.h"
+#include "velox/vector/fuzzer/VectorFuzzer.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+
+namespace {
+constexpr uint64_t kMB = 1 << 20;
+}
+
+class MemoryAdmissionControllerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    pool_ = memory::addDefaultLeafMemoryPool();
+    auto rowType = ROW({"c0", "c1"}, {INTEGER(), VARCHAR()});
+    VectorFuzzer fuzzer{{}, pool_.get()};
+    std::vector<RowVectorPtr> values = {fuzzer.fuzzRow(rowType)};
+    valuesPlan_ = std::make_shared<core::ValuesNode>("values", values);
+    limitPlan_ =
+        std::make_shared<core::LimitNode>("limit", 0, 10, false, valuesPlan_);
+  }
+
+  std::shared_ptr<memory::MemoryPool> pool_;
+  core::PlanNodePtr valuesPlan_;
+  core::PlanNodePtr limitPlan_;
+};
+
+TEST_F(MemoryAdmissionControllerTest, admitWithinCapacity) {
+  MemoryAdmissionController controller(
+      {.capacity = 1'000 * kMB, .defaultTaskMemory = 400 * kMB});
+  EXPECT_EQ(400 * kMB, controller.forecast(*valuesPlan_));
+
+  ContinueFuture future = ContinueFuture::makeEmpty();
+  auto first = controller.admit(*valuesPlan_, 0, &future);
+  EXPECT_FALSE(future.valid());
+  auto second = controller.admit(*valuesPlan_, 0, &future);
+  EXPECT_FALSE(future.valid());
+  EXPECT_EQ(800 * kMB, controller.admittedBytes());
+  EXPECT_EQ(0, controller.numQueued());
+
+  // The third does not fit and has to wait for a release.
+  auto third = controller.admit(*valuesPlan_, 0, &future);
+  ASSERT_TRUE(future.valid());
+  EXPECT_FALSE(future.isReady());
+  EXPECT_EQ(1, controller.numQueued());
+
+  first->release(100 * kMB);
+  EXPECT_TRUE(future.isReady());
+  EXPECT_EQ(0, controller.numQueued());
+  EXPECT_EQ(800 * kMB, controller.admittedBytes());
+
+  second->release(100 * kMB);
+  third->release(100 * kMB);
+  EXPECT_EQ(0, controller.admittedBytes());
+}
+
+TEST_F(MemoryAdmissionControllerTest, priorityOrder) {
+  MemoryAdmissionController controller(
+      {.capacity = 500 * kMB, .defaultTaskMemory = 400 * kMB});
+  ContinueFuture future = ContinueFuture::makeEmpty();
+  auto running = controller.admit(*valuesPlan_, 0, &future);
+  EXPECT_FALSE(future.valid());
+
+  ContinueFuture lowFuture = ContinueFuture::makeEmpty();
+  auto low = controller.admit(*valuesPlan_, 1, &lowFuture);
+  ContinueFuture highFuture = ContinueFuture::makeEmpty();
+  auto high = controller.admit(*valuesPlan_, 10, &highFuture);
+  ASSERT_TRUE(lowFuture.valid());
+  ASSERT_TRUE(highFuture.valid());
+  EXPECT_EQ(2, controller.numQueued());
+
+  // The higher priority is admitted first even though it arrived later.
+  running->release(300 * kMB);
+  EXPECT_TRUE(highFuture.isReady());
+  EXPECT_FALSE(lowFuture.isReady());
+
+  high->release(300 * kMB);
+  EXPECT_TRUE(lowFuture.isReady());
+}
+
+TEST_F(MemoryAdmissionControllerTest, forecastLearnsFromPeaks) {
+  MemoryAdmissionController controller(
+      {.capacity = 1'000 * kMB, .defaultTaskMemory = 100 * kMB});
+  ContinueFuture future = ContinueFuture::makeEmpty();
+  auto admission = controller.admit(*valuesPlan_, 0, &future);
+  admission->release(250 * kMB);
+
+  // The observed peak replaces the default for the same plan shape only.
+  EXPECT_EQ(250 * kMB, controller.forecast(*valuesPlan_));
+  EXPECT_EQ(100 * kMB, controller.forecast(*limitPlan_));
+
+  // The forecast keeps the largest observed peak.
+  admission = controller.admit(*valuesPlan_, 0, &future);
+  admission->release(150 * kMB);
+  EXPECT_EQ(250 * kMB, controller.forecast(*valuesPlan_));
+}
+
+TEST_F(MemoryAdmissionControllerTest, oversizedPrediction) {
+  MemoryAdmissionController controller(
+      {.capacity = 100 * kMB, .defaultTaskMemory = 400 * kMB});
+  // A prediction above the whole capacity is admitted when nothing runs
+  // instead of waiting forever.
+  ContinueFuture future = ContinueFuture::makeEmpty();
+  auto first = controller.admit(*valuesPlan_, 0, &future);
+  EXPECT_FALSE(future.valid());
+
+  auto second = controller.admit(*valuesPlan_, 0, &future);
+  ASSERT_TRUE(future.valid());
+  EXPECT_FALSE(future.isReady());
+  first->release(400 * kMB);
+  EXPECT_TRUE(future.isReady());
+}
+
+TEST_F(MemoryAdmissionControllerTest, releaseOnDestruction) {
+  MemoryAdmissionController controller(
+      {.capacity = 500 * kMB, .defaultTaskMemory = 400 * kMB});
+  ContinueFuture future = ContinueFuture::makeEmpty();
+  {
+    auto admission = controller.admit(*valuesPlan_, 0, &future);
+    EXPECT_EQ(400 * kMB, controller.admittedBytes());
+  }
+  // Dropping an unreleased admission gives the capacity back without
+  // recording an observation.
+  EXPECT_EQ(0, controller.admittedBytes());
+  EXPECT_EQ(400 * kMB, controller.forecast(*valuesPlan_));
+}
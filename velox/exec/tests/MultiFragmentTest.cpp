@@ -531,6 +531,63 @@ TEST_F(MultiFragmentTest, partitionedOutput) {
   }
 }
 
+// Test dropping unused struct fields in PartitionedOutput operator.
+TEST_F(MultiFragmentTest, partitionedOutputStructPruning) {
+  constexpr vector_size_t kSize = 1'000;
+  auto a = makeFlatVector<int64_t>(kSize, folly::identity);
+  auto b = makeFlatVector<int64_t>(kSize, [](auto i) { return i * 2; });
+  auto c = makeFlatVector<int64_t>(kSize, [](auto i) { return i * 3; });
+  auto x = makeFlatVector<int64_t>(kSize, folly::identity);
+  auto y = makeFlatVector<int64_t>(kSize, [](auto i) { return i + 10; });
+  std::vector<vector_size_t> offsets(kSize);
+  for (vector_size_t i = 0; i < kSize; ++i) {
+    offsets[i] = i;
+  }
+  auto vector = makeRowVector({
+      makeFlatVector<int64_t>(kSize, folly::identity),
+      makeRowVector({"a", "b", "c"}, {a, b, c}),
+      makeArrayVector(offsets, makeRowVector({"x", "y"}, {x, y})),
+  });
+
+  // Shuffle only fields c1.c, c1.a and c2[*].y.
+  auto outputType = ROW(
+      {"c1", "c2"},
+      {ROW({"c", "a"}, {BIGINT(), BIGINT()}),
+       ARRAY(ROW({"y"}, {BIGINT()}))});
+
+  auto leafTaskId = makeTaskId("leaf", 0);
+  auto leafPlan =
+      PlanBuilder()
+          .values({vector})
+          .addNode([&](std::string nodeId,
+                       core::PlanNodePtr source) -> core::PlanNodePtr {
+            return std::make_shared<core::PartitionedOutputNode>(
+                nodeId,
+                core::PartitionedOutputNode::Kind::kPartitioned,
+                std::vector<core::TypedExprPtr>{},
+                1,
+                false,
+                std::make_shared<core::GatherPartitionFunctionSpec>(),
+                outputType,
+                source);
+          })
+          .planNode();
+  auto leafTask = makeTask(leafTaskId, leafPlan, 0);
+  leafTask->start(1);
+
+  auto op = PlanBuilder().exchange(outputType).planNode();
+  auto result =
+      AssertQueryBuilder(op).split(remoteSplit(leafTaskId)).copyResults(pool());
+
+  auto expected = makeRowVector(
+      {"c1", "c2"},
+      {makeRowVector({"c", "a"}, {c, a}),
+       makeArrayVector(offsets, makeRowVector({"y"}, {y}))});
+  assertEqualResults({expected}, {result});
+
+  ASSERT_TRUE(waitForTaskCompletion(leafTask.get())) << leafTask->taskId();
+}
+
 TEST_F(MultiFragmentTest, partitionedOutputWithLargeInput) {
   // Verify that partitionedOutput operator is able to split a single input
   // vector if it hits memory or row limits.
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <folly/ScopeGuard.h>
+
+#include "velox/common/base/Fs.h"
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
+#include "velox/vector/VectorSaver.h"
+
+DECLARE_int64(velox_experimental_operator_input_capture_bytes);
+DECLARE_string(velox_experimental_operator_input_capture_path);
+
+namespace facebook::velox::exec::test {
+
+class OperatorInputCaptureTest : public OperatorTestBase {};
+
+TEST_F(OperatorInputCaptureTest, dumpOnTaskFailure) {
+  auto captureDir = TempDirectoryPath::create();
+  FLAGS_velox_experimental_operator_input_capture_bytes = 1 << 20;
+  FLAGS_velox_experimental_operator_input_capture_path = captureDir->path;
+  auto guard = folly::makeGuard([]() {
+    FLAGS_velox_experimental_operator_input_capture_bytes = 0;
+    FLAGS_velox_experimental_operator_input_capture_path = "";
+  });
+
+  auto data = makeRowVector({makeFlatVector<int64_t>({1, 2, 0, 4})});
+  auto plan = PlanBuilder().values({data}).project({"10 / c0"}).planNode();
+  VELOX_ASSERT_THROW(
+      AssertQueryBuilder(plan).copyResults(pool()), "division by zero");
+
+  // The project operator received one batch before failing in getOutput.
+  // Expect that batch and the plan fragment to be dumped.
+  int32_t numBatches = 0;
+  int32_t numPlans = 0;
+  for (const auto& entry : fs::directory_iterator(captureDir->path)) {
+    const auto name = entry.path().filename().string();
+    if (name.find(".batch") != std::string::npos) {
+      ++numBatches;
+      auto restored = restoreVectorFromFile(entry.path().c_str(), pool());
+      assertEqualVectors(data, restored);
+    } else if (name.find(".plan") != std::string::npos) {
+      ++numPlans;
+    }
+  }
+  ASSERT_EQ(numBatches, 1);
+  ASSERT_EQ(numPlans, 1);
+}
+
+TEST_F(OperatorInputCaptureTest, disabledByDefault) {
+  auto captureDir = TempDirectoryPath::create();
+  FLAGS_velox_experimental_operator_input_capture_path = captureDir->path;
+  auto guard = folly::makeGuard(
+      []() { FLAGS_velox_experimental_operator_input_capture_path = ""; });
+
+  auto data = makeRowVector({makeFlatVector<int64_t>({1, 2, 0, 4})});
+  auto plan = PlanBuilder().values({data}).project({"10 / c0"}).planNode();
+  VELOX_ASSERT_THROW(
+      AssertQueryBuilder(plan).copyResults(pool()), "division by zero");
+
+  ASSERT_TRUE(fs::is_empty(captureDir->path));
+}
+
+} // namespace facebook::velox::exec::test
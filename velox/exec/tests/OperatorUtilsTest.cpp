@@ -130,6 +130,40 @@ class OperatorUtilsTest
   std::unique_ptr<DriverCtx> driverCtx_;
 };
 
+TEST_F(OperatorUtilsTest, processFilterResults) {
+  const vector_size_t size = 100;
+  SelectivityVector rows(size);
+  FilterEvalCtx filterEvalCtx;
+
+  // All rows pass: the row mapping is not built.
+  auto allPass = makeFlatVector<bool>(size, [](auto /*row*/) { return true; });
+  ASSERT_EQ(
+      processFilterResults(allPass, rows, filterEvalCtx, pool_.get()), size);
+  ASSERT_EQ(filterEvalCtx.selectedIndices, nullptr);
+
+  // No rows pass.
+  auto nonePass = makeFlatVector<bool>(size, [](auto /*row*/) { return false; });
+  ASSERT_EQ(processFilterResults(nonePass, rows, filterEvalCtx, pool_.get()), 0);
+  ASSERT_EQ(filterEvalCtx.selectedIndices, nullptr);
+
+  // Some rows pass: selectedIndices lists the passing rows.
+  auto somePass =
+      makeFlatVector<bool>(size, [](auto row) { return row % 3 == 0; });
+  auto numPassed =
+      processFilterResults(somePass, rows, filterEvalCtx, pool_.get());
+  ASSERT_EQ(numPassed, (size + 2) / 3);
+  auto* indices = filterEvalCtx.selectedIndices->as<vector_size_t>();
+  for (auto i = 0; i < numPassed; ++i) {
+    ASSERT_EQ(indices[i], i * 3);
+  }
+
+  // Null results fail the filter.
+  auto withNulls = makeFlatVector<bool>(
+      size, [](auto /*row*/) { return true; }, nullEvery(2));
+  numPassed = processFilterResults(withNulls, rows, filterEvalCtx, pool_.get());
+  ASSERT_EQ(numPassed, size - size / 2);
+}
+
 TEST_F(OperatorUtilsTest, wrapChildConstant) {
   auto constant = makeConstant(11, 1'000);
 
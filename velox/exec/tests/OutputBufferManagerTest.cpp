@@ -991,6 +991,50 @@ TEST_F(OutputBufferManagerTest, outOfOrderAcks) {
   bufferManager_->removeTask(taskId);
 }
 
+TEST_F(OutputBufferManagerTest, slowPartitionedDestination) {
+  const vector_size_t size = 100;
+  const std::string taskId = "t0";
+  auto task = initializeTask(
+      taskId,
+      rowType_,
+      PartitionedOutputNode::Kind::kPartitioned,
+      2,
+      1,
+      100'000);
+
+  // Fill destination 0 until the producer blocks on its per-destination
+  // window. The window is half of the buffer size, so the global limit is not
+  // reached.
+  int numPages = 0;
+  ContinueFuture startFuture;
+  bool blocked = false;
+  do {
+    ContinueFuture future;
+    blocked = bufferManager_->enqueue(
+        taskId, 0, makeSerializedPage(rowType_, size), &future);
+    ++numPages;
+    if (blocked) {
+      startFuture = std::move(future);
+    }
+  } while (!blocked);
+  ASSERT_FALSE(startFuture.isReady());
+
+  // A destination with a drained window does not block the producer.
+  enqueue(taskId, 1, rowType_, size);
+
+  // Draining the slow destination resumes the blocked producer.
+  for (int i = 0; i < numPages; ++i) {
+    fetchOneAndAck(taskId, 0, i);
+  }
+  ASSERT_TRUE(startFuture.isReady());
+
+  fetchOneAndAck(taskId, 1, 0);
+  noMoreData(taskId);
+  fetchEndMarker(taskId, 0, numPages);
+  fetchEndMarker(taskId, 1, 1);
+  bufferManager_->removeTask(taskId);
+}
+
 TEST_F(OutputBufferManagerTest, errorInQueue) {
   auto queue = std::make_shared<ExchangeQueue>();
   queue->setError("Forced failure");
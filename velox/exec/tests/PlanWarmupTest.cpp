@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/PlanWarmup.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/functions/prestosql/aggregates/RegisterAggregateFunctions.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+#include "velox/parse/TypeResolver.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+namespace facebook::velox::exec::test {
+
+class PlanWarmupTest : public testing::Test,
+                       public velox::test::VectorTestBase {
+ public:
+  PlanWarmupTest() {
+    functions::prestosql::registerAllScalarFunctions();
+    aggregate::prestosql::registerAllAggregateFunctions();
+    parse::registerTypeResolver();
+  }
+};
+
+TEST_F(PlanWarmupTest, warmUpPlanFragment) {
+  auto plan = PlanBuilder()
+                  .tableScan(ROW({"a", "b"}, {BIGINT(), BIGINT()}))
+                  .filter("a > 5")
+                  .project({"a + b"})
+                  .partialAggregation({}, {"sum(p0)"})
+                  .planNode();
+
+  auto queryCtx = std::make_shared<core::QueryCtx>();
+  core::PlanFragment fragment{plan};
+  warmUpPlanFragment(fragment, queryCtx);
+
+  // Warming up the same plan again is a no-op and warming it up with a
+  // different query context works.
+  warmUpPlanFragment(fragment, queryCtx);
+  warmUpPlanFragment(fragment, std::make_shared<core::QueryCtx>());
+
+  // A plan with a join filter.
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto joinPlan =
+      PlanBuilder(planNodeIdGenerator)
+          .tableScan(ROW({"t0", "t1"}, {BIGINT(), BIGINT()}))
+          .hashJoin(
+              {"t0"},
+              {"u0"},
+              PlanBuilder(planNodeIdGenerator)
+                  .tableScan(ROW({"u0"}, {BIGINT()}))
+                  .planNode(),
+              "t1 + u0 > 10",
+              {"t0", "t1"})
+          .planNode();
+  warmUpPlanFragment(core::PlanFragment{joinPlan}, queryCtx);
+}
+
+} // namespace facebook::velox::exec::test
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/ResultStream.h"
+#include "velox/exec/Task.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::exec::test;
+
+class ResultStreamTest : public OperatorTestBase {
+ protected:
+  std::vector<RowVectorPtr> makeBatches(int32_t numBatches) {
+    std::vector<RowVectorPtr> batches;
+    for (auto i = 0; i < numBatches; ++i) {
+      batches.push_back(makeRowVector({makeFlatVector<int64_t>(
+          1'000, [&](auto row) { return i * 1'000 + row; })}));
+    }
+    return batches;
+  }
+
+  std::shared_ptr<Task> makeTask(
+      const core::PlanNodePtr& plan,
+      Consumer consumer) {
+    return Task::create(
+        fmt::format("result.stream.{}", serial_++),
+        core::PlanFragment{plan},
+        0,
+        std::make_shared<core::QueryCtx>(driverExecutor_.get()),
+        std::move(consumer));
+  }
+
+  static std::atomic<int32_t> serial_;
+};
+
+std::atomic<int32_t> ResultStreamTest::serial_;
+
+TEST_F(ResultStreamTest, basic) {
+  auto batches = makeBatches(10);
+  auto plan = PlanBuilder().values(batches).planNode();
+
+  auto results = ResultStream::create();
+  auto task = makeTask(plan, results->consumer());
+  task->start(1);
+
+  int64_t numRows = 0;
+  while (auto batch = results->next()) {
+    for (auto row = 0; row < batch->size(); ++row) {
+      ASSERT_EQ(
+          batch->childAt(0)->asFlatVector<int64_t>()->valueAt(row), numRows++);
+    }
+  }
+  ASSERT_EQ(numRows, 10'000);
+  ASSERT_TRUE(waitForTaskCompletion(task.get()));
+}
+
+TEST_F(ResultStreamTest, backpressure) {
+  // A tiny cap makes the producer block after every batch; all batches must
+  // still come through as the consumer drains the queue.
+  auto batches = makeBatches(20);
+  auto plan = PlanBuilder().values(batches).planNode();
+
+  auto results = ResultStream::create(1);
+  auto task = makeTask(plan, results->consumer());
+  task->start(1);
+
+  int32_t numBatches = 0;
+  int64_t numRows = 0;
+  while (auto batch = results->next()) {
+    ++numBatches;
+    numRows += batch->size();
+  }
+  ASSERT_EQ(numBatches, 20);
+  ASSERT_EQ(numRows, 20'000);
+  ASSERT_TRUE(waitForTaskCompletion(task.get()));
+}
+
+TEST_F(ResultStreamTest, multipleProducers) {
+  constexpr int32_t kNumDrivers = 4;
+  auto batches = makeBatches(12);
+  auto plan = PlanBuilder().values(batches, true).planNode();
+
+  auto results = ResultStream::create();
+  results->setNumProducers(kNumDrivers);
+  auto task = makeTask(plan, results->consumer());
+  task->start(kNumDrivers);
+
+  int64_t numRows = 0;
+  while (auto batch = results->next()) {
+    numRows += batch->size();
+  }
+  ASSERT_EQ(numRows, 12'000 * kNumDrivers);
+  ASSERT_TRUE(waitForTaskCompletion(task.get()));
+}
+
+TEST_F(ResultStreamTest, closeEarly) {
+  auto batches = makeBatches(50);
+  auto plan = PlanBuilder().values(batches).planNode();
+
+  auto results = ResultStream::create(1);
+  auto task = makeTask(plan, results->consumer());
+  task->start(1);
+
+  // Take a couple of batches, then walk away. The producer must not stay
+  // blocked on the abandoned queue.
+  ASSERT_NE(results->next(), nullptr);
+  ASSERT_NE(results->next(), nullptr);
+  results->close();
+  ASSERT_EQ(results->next(), nullptr);
+  ASSERT_TRUE(waitForTaskCompletion(task.get()));
+}
+
+TEST_F(ResultStreamTest, arrow) {
+  auto batches = makeBatches(3);
+  auto plan = PlanBuilder().values(batches).planNode();
+
+  auto results = ResultStream::create();
+  auto task = makeTask(plan, results->consumer());
+  task->start(1);
+
+  int32_t numBatches = 0;
+  int64_t numRows = 0;
+  ArrowArray array;
+  ArrowSchema schema;
+  while (results->nextArrow(array, schema, pool())) {
+    ++numBatches;
+    numRows += array.length;
+    ASSERT_EQ(array.n_children, 1);
+    ASSERT_STREQ(schema.format, "+s");
+    array.release(&array);
+    schema.release(&schema);
+  }
+  ASSERT_EQ(numBatches, 3);
+  ASSERT_EQ(numRows, 3'000);
+  ASSERT_TRUE(waitForTaskCompletion(task.get()));
+}
@@ -882,6 +882,50 @@ TEST_F(RowContainerTest, extractNulls) {
   }
 }
 
+TEST_F(RowContainerTest, columnHasNulls) {
+  constexpr int32_t kNumRows = 100;
+  auto data = makeRowContainer({BIGINT()}, {BIGINT(), VARCHAR()}, false);
+
+  auto batch = makeRowVector({
+      makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; }),
+      makeFlatVector<int64_t>(
+          kNumRows, [](auto row) { return row * 2; }, nullEvery(7)),
+      makeFlatVector<StringView>(
+          kNumRows,
+          [](auto row) {
+            return StringView::makeInline(fmt::format("s-{}", row));
+          }),
+  });
+
+  std::vector<char*> rows(kNumRows);
+  SelectivityVector allRows(kNumRows);
+  for (int i = 0; i < kNumRows; ++i) {
+    rows[i] = data->newRow();
+  }
+  for (int i = 0; i < batch->childrenSize(); ++i) {
+    DecodedVector decoded(*batch->childAt(i), allRows);
+    for (auto j = 0; j < kNumRows; ++j) {
+      data->store(decoded, j, rows[j], i);
+    }
+  }
+
+  // Only the column that stored nulls reports them. Columns without nulls are
+  // extracted without per-row null checks.
+  EXPECT_FALSE(data->columnHasNulls(0));
+  EXPECT_TRUE(data->columnHasNulls(1));
+  EXPECT_FALSE(data->columnHasNulls(2));
+
+  for (int i = 0; i < batch->childrenSize(); ++i) {
+    auto result = BaseVector::create(batch->childAt(i)->type(), 0, pool());
+    data->extractColumn(rows.data(), kNumRows, i, result);
+    assertEqualVectors(batch->childAt(i), result);
+  }
+
+  // Clearing the container resets the null tracking.
+  data->clear();
+  EXPECT_FALSE(data->columnHasNulls(1));
+}
+
 TEST_F(RowContainerTest, erase) {
   constexpr int32_t kNumRows = 100;
   auto data = makeRowContainer({SMALLINT()}, {SMALLINT()});
@@ -935,6 +979,89 @@ TEST_F(RowContainerTest, erase) {
   data->checkConsistency();
 }
 
+TEST_F(RowContainerTest, compact) {
+  constexpr int32_t kNumRows = 50'000;
+  // Runs once with normalized keys active for all rows and once with
+  // normalized keys disabled partway, leaving a mix of slots with and without
+  // a normalized key below the row.
+  for (const bool disableNormalizedKeysHalfway : {false, true}) {
+    SCOPED_TRACE(fmt::format(
+        "disableNormalizedKeysHalfway {}", disableNormalizedKeysHalfway));
+    auto data = makeRowContainer({BIGINT()}, {BIGINT()}, false);
+    ASSERT_EQ(data->nextOffset(), 0);
+    auto keys = makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; });
+    auto values =
+        makeFlatVector<int64_t>(kNumRows, [](auto row) { return row * 2; });
+    DecodedVector decodedKeys(*keys);
+    DecodedVector decodedValues(*values);
+    std::vector<char*> rows(kNumRows);
+    for (auto i = 0; i < kNumRows; ++i) {
+      if (disableNormalizedKeysHalfway && i == kNumRows / 2) {
+        data->disableNormalizedKeys();
+      }
+      rows[i] = data->newRow();
+      data->store(decodedKeys, i, rows[i], 0);
+      data->store(decodedValues, i, rows[i], 1);
+    }
+    const auto allocatedBefore = data->allocatedBytes();
+
+    // Erase all rows except every 8th and compact. The survivors fit in a
+    // fraction of the ranges, so the tail ranges get freed.
+    std::vector<char*> erased;
+    for (auto i = 0; i < kNumRows; ++i) {
+      if (i % 8 != 0) {
+        erased.push_back(rows[i]);
+      }
+    }
+    data->eraseRows(folly::Range<char**>(erased.data(), erased.size()));
+    EXPECT_GT(data->compact(), 0);
+    EXPECT_LT(data->allocatedBytes(), allocatedBefore);
+    data->checkConsistency();
+
+    // The surviving rows keep their relative order and their values.
+    std::vector<char*> remaining(data->numRows());
+    RowContainerIterator iter;
+    ASSERT_EQ(
+        remaining.size(),
+        data->listRows(&iter, remaining.size(), remaining.data()));
+    auto result = BaseVector::create(BIGINT(), remaining.size(), pool_.get());
+    data->extractColumn(remaining.data(), remaining.size(), 0, result);
+    assertEqualVectors(
+        makeFlatVector<int64_t>(
+            remaining.size(), [](auto row) { return row * 8; }),
+        result);
+    data->extractColumn(remaining.data(), remaining.size(), 1, result);
+    assertEqualVectors(
+        makeFlatVector<int64_t>(
+            remaining.size(), [](auto row) { return row * 16; }),
+        result);
+
+    // New rows can be added after compaction.
+    std::vector<char*> newRows;
+    for (auto i = 0; i < 1000; ++i) {
+      newRows.push_back(data->newRow());
+    }
+    data->checkConsistency();
+
+    // Erasing recent rows and compacting reclaims their slots without freeing
+    // ranges.
+    data->eraseRows(folly::Range<char**>(newRows.data(), 500));
+    EXPECT_EQ(data->compact(), 0);
+    EXPECT_EQ(data->numRows(), remaining.size() + 500);
+    data->checkConsistency();
+
+    // Compacting after erasing all rows frees all row storage.
+    std::vector<char*> all(data->numRows());
+    iter.reset();
+    ASSERT_EQ(all.size(), data->listRows(&iter, all.size(), all.data()));
+    data->eraseRows(folly::Range<char**>(all.data(), all.size()));
+    EXPECT_GT(data->compact(), 0);
+    EXPECT_EQ(data->numRows(), 0);
+    EXPECT_EQ(data->freeSpace().first, 0);
+    data->checkConsistency();
+  }
+}
+
 TEST_F(RowContainerTest, initialNulls) {
   std::vector<TypePtr> keys{INTEGER()};
   std::vector<TypePtr> dependent{INTEGER()};
@@ -1159,6 +1286,182 @@ TEST_F(RowContainerTest, compareRowTypeDouble) {
   testCompareRowContainerTypeFloat<double>(ROW({colName}, {DOUBLE()}));
 }
 
+TEST_F(RowContainerTest, createComparator) {
+  // Exercises the fused comparators for the frequent sort key shapes as well
+  // as the generic fallback, verifying each matches a per-key compare() loop.
+  auto data = makeRowContainer(
+      {BIGINT(), VARCHAR(), TIMESTAMP(), REAL()}, {SMALLINT()}, false);
+
+  constexpr vector_size_t numRows = 20;
+  std::vector<std::optional<int64_t>> bigints;
+  std::vector<std::optional<std::string>> strings;
+  std::vector<std::optional<Timestamp>> timestamps;
+  std::vector<std::optional<float>> reals;
+  for (auto i = 0; i < numRows; ++i) {
+    if (i % 7 == 0) {
+      bigints.push_back(std::nullopt);
+      strings.push_back(std::nullopt);
+      timestamps.push_back(std::nullopt);
+      reals.push_back(std::nullopt);
+      continue;
+    }
+    bigints.push_back(i % 5 - 2);
+    // Strings longer than 12 characters are stored out of line.
+    strings.push_back(std::string(i % 3 * 13, 'x') + std::to_string(i % 4));
+    timestamps.push_back(Timestamp(i % 6, (i * 17) % 1000));
+    reals.push_back((i % 5) * 0.5f);
+  }
+  auto input = makeRowVector({
+      makeNullableFlatVector<int64_t>(bigints),
+      makeNullableFlatVector<std::string>(strings),
+      makeNullableFlatVector<Timestamp>(timestamps),
+      makeNullableFlatVector<float>(reals),
+      makeFlatVector<int16_t>(numRows, [](auto row) { return row; }),
+  });
+
+  std::vector<char*> rows(numRows);
+  for (auto i = 0; i < numRows; ++i) {
+    rows[i] = data->newRow();
+  }
+  for (auto col = 0; col < input->childrenSize(); ++col) {
+    DecodedVector decoded(*input->childAt(col));
+    for (auto i = 0; i < numRows; ++i) {
+      data->store(decoded, i, rows[i], col);
+    }
+  }
+
+  auto sign = [](int32_t value) { return value < 0 ? -1 : value > 0 ? 1 : 0; };
+  auto testComparator =
+      [&](const std::vector<std::pair<column_index_t, CompareFlags>>& keys) {
+        auto comparator = data->createComparator(keys);
+        for (auto i = 0; i < numRows; ++i) {
+          for (auto j = 0; j < numRows; ++j) {
+            int32_t expected = 0;
+            for (const auto& [column, flags] : keys) {
+              if (auto result = data->compare(rows[i], rows[j], column, flags)) {
+                expected = result;
+                break;
+              }
+            }
+            ASSERT_EQ(sign(comparator(rows[i], rows[j])), sign(expected))
+                << "rows " << i << " and " << j;
+          }
+        }
+      };
+
+  for (bool ascending : {true, false}) {
+    for (bool nullsFirst : {true, false}) {
+      const CompareFlags flags{nullsFirst, ascending, false};
+      // Fused single-key shapes.
+      testComparator({{0, flags}});
+      testComparator({{1, flags}});
+      testComparator({{2, flags}});
+      // Fused two-key shape with per-key orders.
+      testComparator({{1, flags}, {0, {!nullsFirst, !ascending, false}}});
+      // REAL keys and shapes with more than two keys use the generic
+      // fallback.
+      testComparator({{3, flags}});
+      testComparator({{0, flags}, {1, flags}, {2, flags}});
+    }
+  }
+}
+
+TEST_F(RowContainerTest, stringEquals) {
+  // Covers both sides of string key equality: inline (up to 12 characters)
+  // strings compare in the row, longer ones go through the
+  // HashStringAllocator storage, including strings large enough to be stored
+  // in multiple pieces.
+  std::vector<std::string> strings = {
+      "",
+      "abc",
+      "abd",
+      "12 chars max",
+      "longer than inline limit",
+      "longer than inline limiT",
+      std::string(20'000, 'x'),
+      std::string(20'000, 'x') + "y"};
+  auto values = makeFlatVector<std::string>(strings);
+  auto data = makeRowContainer({VARCHAR()}, {SMALLINT()});
+  DecodedVector decoded(*values);
+  std::vector<char*> rows;
+  for (auto i = 0; i < strings.size(); ++i) {
+    rows.push_back(data->newRow());
+    data->store(decoded, i, rows[i], 0);
+  }
+  auto column = data->columnAt(0);
+  for (auto i = 0; i < strings.size(); ++i) {
+    for (auto j = 0; j < strings.size(); ++j) {
+      EXPECT_EQ(
+          strings[i] == strings[j],
+          data->equals<false>(rows[i], column, decoded, j))
+          << fmt::format("row {} vs probe {}", i, j);
+      EXPECT_EQ(
+          strings[i] == strings[j],
+          data->equals<true>(rows[i], column, decoded, j))
+          << fmt::format("row {} vs probe {}", i, j);
+    }
+  }
+}
+
+TEST_F(RowContainerTest, extractColumnReferencingStrings) {
+  // Strings stored inline or in one piece are referenced in place, so the
+  // result needs no string buffers. Strings stored in multiple pieces are
+  // copied like in extractColumn(). Non-string columns delegate to
+  // extractColumn().
+  std::vector<std::optional<std::string>> strings = {
+      "abc",
+      std::nullopt,
+      "longer than inline limit",
+      "",
+      std::string(2'000, 'x')};
+  const auto numRows = strings.size();
+  auto input = makeRowVector({
+      makeFlatVector<int64_t>(numRows, [](auto row) { return row; }),
+      makeNullableFlatVector<std::string>(strings),
+  });
+  auto data = makeRowContainer({BIGINT(), VARCHAR()}, {SMALLINT()}, false);
+
+  std::vector<char*> rows(numRows);
+  for (auto i = 0; i < numRows; ++i) {
+    rows[i] = data->newRow();
+  }
+  for (auto col = 0; col < input->childrenSize(); ++col) {
+    DecodedVector decoded(*input->childAt(col));
+    for (auto i = 0; i < numRows; ++i) {
+      data->store(decoded, i, rows[i], col);
+    }
+  }
+
+  auto extract = [&](int32_t column) {
+    VectorPtr result =
+        BaseVector::create(input->childAt(column)->type(), numRows, pool_.get());
+    data->extractColumnReferencingStrings(
+        rows.data(), numRows, column, result);
+    assertEqualVectors(input->childAt(column), result);
+    return result;
+  };
+
+  extract(0);
+  auto result = extract(1);
+  // No value was copied, so the result holds no string buffers of its own.
+  EXPECT_TRUE(result->asFlatVector<StringView>()->stringBuffers().empty());
+
+  // A string large enough to be stored in multiple pieces is copied into the
+  // result's buffers.
+  auto multipart = makeRowVector({
+      makeFlatVector<int64_t>(1, [](auto row) { return row; }),
+      makeFlatVector<std::string>({std::string(20'000, 'x')}),
+  });
+  for (auto col = 0; col < multipart->childrenSize(); ++col) {
+    DecodedVector decoded(*multipart->childAt(col));
+    data->store(decoded, 0, rows[0], col);
+  }
+  input->childAt(1)->asFlatVector<StringView>()->set(
+      0, StringView(std::string(20'000, 'x')));
+  result = extract(1);
+  EXPECT_FALSE(result->asFlatVector<StringView>()->stringBuffers().empty());
+}
+
 TEST_F(RowContainerTest, partition) {
   // We assign an arbitrary partition number to each row and iterate over the
   // rows a partition at a time.
@@ -110,7 +110,6 @@ TEST_F(SortBufferTest, singleKey) {
         inputType_,
         sortColumnIndices_,
         testData.sortCompareFlags,
-        10000,
         pool_.get(),
         &nonReclaimableSection_,
         &numSpillRuns_);
@@ -126,7 +125,7 @@ TEST_F(SortBufferTest, singleKey) {
 
     sortBuffer->addInput(data);
     sortBuffer->noMoreInput();
-    auto output = sortBuffer->getOutput();
+    auto output = sortBuffer->getOutput(10000);
     ASSERT_EQ(output->size(), 5);
     int resultIndex = 0;
     for (int expectedValue : testData.expectedResult) {
@@ -142,7 +141,6 @@ TEST_F(SortBufferTest, multipleKeys) {
       inputType_,
       sortColumnIndices_,
       sortCompareFlags_,
-      10000,
       pool_.get(),
       &nonReclaimableSection_,
       &numSpillRuns_);
@@ -158,7 +156,7 @@ TEST_F(SortBufferTest, multipleKeys) {
 
   sortBuffer->addInput(data);
   sortBuffer->noMoreInput();
-  auto output = sortBuffer->getOutput();
+  auto output = sortBuffer->getOutput(10000);
   ASSERT_EQ(output->size(), 5);
   ASSERT_EQ(output->childAt(1)->asFlatVector<int32_t>()->valueAt(0), 5);
   ASSERT_EQ(output->childAt(1)->asFlatVector<int32_t>()->valueAt(1), 3);
@@ -167,6 +165,64 @@ TEST_F(SortBufferTest, multipleKeys) {
   ASSERT_EQ(output->childAt(1)->asFlatVector<int32_t>()->valueAt(4), 2);
 }
 
+TEST_F(SortBufferTest, sortedInput) {
+  // Input arriving sorted on the sort keys, e.g. compaction of already sorted
+  // partitions, skips the sort; nearly sorted input merges the sorted runs.
+  // Both must produce the same fully sorted output.
+  constexpr vector_size_t kBatchSize = 100;
+  const auto makeBatch = [&](int64_t start) {
+    return makeRowVector(
+        {makeFlatVector<int64_t>(
+             kBatchSize, [&](auto row) { return start + row; }),
+         makeFlatVector<int32_t>(
+             kBatchSize,
+             [&](auto row) { return static_cast<int32_t>(start + row); }),
+         makeFlatVector<int16_t>(kBatchSize, [](auto row) { return row; }),
+         makeFlatVector<float>(kBatchSize, [](auto row) { return row * 0.1; }),
+         makeFlatVector<double>(kBatchSize, [](auto row) { return row * 0.1; }),
+         makeFlatVector<std::string>(kBatchSize, [&](auto row) {
+           return fmt::format("row {}", start + row);
+         })});
+  };
+
+  struct {
+    std::vector<int64_t> batchStarts;
+
+    std::string debugString() const {
+      return fmt::format("batchStarts:{}", folly::join(",", batchStarts));
+    }
+  } testSettings[] = {
+      {{0, kBatchSize, 2 * kBatchSize}}, // Fully sorted.
+      {{kBatchSize, 0, 2 * kBatchSize}}, // Sorted runs out of order.
+  };
+
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.debugString());
+    auto sortBuffer = std::make_unique<SortBuffer>(
+        inputType_,
+        std::vector<column_index_t>{0},
+        std::vector<CompareFlags>{
+            {true, true, false, CompareFlags::NullHandlingMode::NoStop}},
+        pool_.get(),
+        &nonReclaimableSection_,
+        &numSpillRuns_);
+    for (const auto start : testData.batchStarts) {
+      sortBuffer->addInput(makeBatch(start));
+    }
+    sortBuffer->noMoreInput();
+
+    auto output = sortBuffer->getOutput(10'000);
+    ASSERT_EQ(output->size(), testData.batchStarts.size() * kBatchSize);
+    auto* keys = output->childAt(0)->asFlatVector<int64_t>();
+    auto* strings = output->childAt(5)->asFlatVector<StringView>();
+    for (auto i = 0; i < output->size(); ++i) {
+      ASSERT_EQ(keys->valueAt(i), i) << "at " << i;
+      ASSERT_EQ(strings->valueAt(i), fmt::format("row {}", i)) << "at " << i;
+    }
+    ASSERT_TRUE(sortBuffer->getOutput(10'000) == nullptr);
+  }
+}
+
 // TODO: enable it later with test utility to compare the sorted result.
 TEST_F(SortBufferTest, DISABLED_randomData) {
   struct {
@@ -224,7 +280,6 @@ TEST_F(SortBufferTest, DISABLED_randomData) {
         testData.inputType,
         testData.sortColumnIndices,
         testData.sortCompareFlags,
-        1000,
         pool_.get(),
         &nonReclaimableSection_,
         &numSpillRuns_);
@@ -296,7 +351,6 @@ TEST_F(SortBufferTest, batchOutput) {
         inputType_,
         sortColumnIndices_,
         sortCompareFlags_,
-        testData.outputBatchSize,
         pool_.get(),
         &nonReclaimableSection_,
         &numSpillRuns_,
@@ -321,12 +375,12 @@ TEST_F(SortBufferTest, batchOutput) {
     auto spillStats = sortBuffer->spilledStats();
 
     int expectedOutputBufferIndex = 0;
-    RowVectorPtr output = sortBuffer->getOutput();
+    RowVectorPtr output = sortBuffer->getOutput(testData.outputBatchSize);
     while (output != nullptr) {
       ASSERT_EQ(
           output->size(),
           testData.expectedOutputBufferSizes[expectedOutputBufferIndex++]);
-      output = sortBuffer->getOutput();
+      output = sortBuffer->getOutput(testData.outputBatchSize);
     }
 
     if (!testData.triggerSpill) {
@@ -391,7 +445,6 @@ TEST_F(SortBufferTest, spill) {
         inputType_,
         sortColumnIndices_,
         sortCompareFlags_,
-        1000,
         pool_.get(),
         &nonReclaimableSection_,
         &numSpillRuns_,
@@ -453,7 +506,6 @@ TEST_F(SortBufferTest, emptySpill) {
         inputType_,
         sortColumnIndices_,
         sortCompareFlags_,
-        1000,
         pool_.get(),
         &nonReclaimableSection_,
         &numSpillRuns_,
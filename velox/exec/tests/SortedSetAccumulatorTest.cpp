@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/SetAccumulator.h"
+#include <gtest/gtest.h>
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+namespace facebook::velox::aggregate::prestosql {
+
+namespace {
+
+class SortedSetAccumulatorTest : public testing::Test,
+                                 public test::VectorTestBase {
+ protected:
+  template <typename T>
+  void test(const VectorPtr& data, const VectorPtr& sortedUniqueData) {
+    detail::SortedSetAccumulator<T> accumulator(data->type(), allocator());
+
+    DecodedVector decodedVector(*data);
+    for (auto i = 0; i < data->size(); ++i) {
+      accumulator.addValue(decodedVector, i, allocator());
+    }
+
+    ASSERT_EQ(sortedUniqueData->size(), accumulator.size(allocator()));
+
+    auto copy =
+        BaseVector::create(data->type(), sortedUniqueData->size(), pool());
+    ASSERT_EQ(
+        sortedUniqueData->size(),
+        accumulator.extractValues(
+            *copy->template asFlatVector<T>(), 0, allocator()));
+    test::assertEqualVectors(sortedUniqueData, copy);
+
+    accumulator.free(*allocator());
+  }
+
+  HashStringAllocator* allocator() {
+    return allocator_.get();
+  }
+
+  std::unique_ptr<HashStringAllocator> allocator_{
+      std::make_unique<HashStringAllocator>(pool())};
+};
+
+TEST_F(SortedSetAccumulatorTest, integers) {
+  auto data = makeFlatVector<int64_t>({7, 2, 2, 5, 7, 1, 5, 5});
+  auto expected = makeFlatVector<int64_t>({1, 2, 5, 7});
+  test<int64_t>(data, expected);
+}
+
+TEST_F(SortedSetAccumulatorTest, nulls) {
+  auto data = makeNullableFlatVector<int32_t>(
+      {3, std::nullopt, 3, 1, std::nullopt, 2});
+  // Unique values in ascending order followed by a single null.
+  auto expected =
+      makeNullableFlatVector<int32_t>({1, 2, 3, std::nullopt});
+  test<int32_t>(data, expected);
+}
+
+TEST_F(SortedSetAccumulatorTest, appendAfterExtract) {
+  auto data = makeFlatVector<int64_t>({5, 3, 5});
+  detail::SortedSetAccumulator<int64_t> accumulator(data->type(), allocator());
+
+  DecodedVector decodedVector(*data);
+  for (auto i = 0; i < data->size(); ++i) {
+    accumulator.addValue(decodedVector, i, allocator());
+  }
+  ASSERT_EQ(2, accumulator.size(allocator()));
+
+  // Values appended after a deduplication are picked up by the next one.
+  auto moreData = makeFlatVector<int64_t>({4, 3, 6});
+  decodedVector.decode(*moreData);
+  for (auto i = 0; i < moreData->size(); ++i) {
+    accumulator.addValue(decodedVector, i, allocator());
+  }
+  ASSERT_EQ(4, accumulator.size(allocator()));
+
+  auto expected = makeFlatVector<int64_t>({3, 4, 5, 6});
+  auto copy = BaseVector::create(data->type(), 4, pool());
+  ASSERT_EQ(
+      4, accumulator.extractValues(*copy->asFlatVector<int64_t>(), 0, allocator()));
+  test::assertEqualVectors(expected, copy);
+
+  accumulator.free(*allocator());
+}
+
+TEST_F(SortedSetAccumulatorTest, manyValues) {
+  // Enough values to spread the run over multiple allocations.
+  std::vector<double> values;
+  for (auto i = 0; i < 10'000; ++i) {
+    values.push_back((i * 7919) % 1000);
+  }
+  auto data = makeFlatVector<double>(values);
+
+  std::vector<double> unique;
+  for (auto i = 0; i < 1000; ++i) {
+    unique.push_back(i);
+  }
+  auto expected = makeFlatVector<double>(unique);
+  test<double>(data, expected);
+}
+
+} // namespace
+} // namespace facebook::velox::aggregate::prestosql
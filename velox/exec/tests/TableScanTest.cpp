@@ -674,10 +674,15 @@ TEST_F(TableScanTest, subfieldPruningRemainingFilterMap) {
   auto rowType = asRowType(vector->type());
   auto filePath = TempFilePath::create();
   writeToFile(filePath->path, {vector});
-  enum { kNoOutput = 0, kWholeColumn = 1, kSubfieldOnly = 2 };
+  enum {
+    kNoOutput = 0,
+    kWholeColumn = 1,
+    kSubfieldOnly = 2,
+    kSubfieldElementAt = 3,
+  };
   for (int outputColumn = kNoOutput; outputColumn <= kSubfieldOnly;
        ++outputColumn) {
-    for (int filterColumn = kWholeColumn; filterColumn <= kSubfieldOnly;
+    for (int filterColumn = kWholeColumn; filterColumn <= kSubfieldElementAt;
          ++filterColumn) {
       SCOPED_TRACE(fmt::format("{} {}", outputColumn, filterColumn));
       std::unordered_map<std::string, std::shared_ptr<connector::ColumnHandle>>
@@ -700,8 +705,10 @@ TEST_F(TableScanTest, subfieldPruningRemainingFilterMap) {
       if (filterColumn == kWholeColumn) {
         remainingFilter = parseExpr(
             "coalesce(b, cast(null AS MAP(BIGINT, BIGINT)))[0] == 0", rowType);
-      } else {
+      } else if (filterColumn == kSubfieldOnly) {
         remainingFilter = parseExpr("b[0] == 0", rowType);
+      } else {
+        remainingFilter = parseExpr("element_at(b, 0) == 0", rowType);
       }
       auto op =
           PlanBuilder()
@@ -717,7 +724,7 @@ TEST_F(TableScanTest, subfieldPruningRemainingFilterMap) {
       if (outputColumn == kNoOutput) {
         expected = makeRowVector({"a"}, {a});
       } else if (
-          outputColumn == kSubfieldOnly && filterColumn == kSubfieldOnly) {
+          outputColumn == kSubfieldOnly && filterColumn >= kSubfieldOnly) {
         auto sizes = allocateIndices(10, pool());
         auto* rawSizes = sizes->asMutable<vector_size_t>();
         std::fill(rawSizes, rawSizes + 10, 2);
@@ -1246,6 +1253,39 @@ TEST_F(TableScanTest, multipleSplits) {
   }
 }
 
+TEST_F(TableScanTest, recordCompletedSplits) {
+  auto filePaths = makeFilePaths(10);
+  auto vectors = makeVectors(10, 100);
+  for (int32_t i = 0; i < vectors.size(); i++) {
+    writeToFile(filePaths[i]->path, vectors[i]);
+  }
+  createDuckDbTable(vectors);
+
+  // By default completed splits are not recorded.
+  auto task = assertQuery(tableScanNode(), filePaths, "SELECT * FROM tmp");
+  EXPECT_TRUE(task->taskStats().completedScanSplits.empty());
+
+  // With the config set, every fully processed split shows up under the scan
+  // node id, so a restarted task can be re-seeded with the missing ones.
+  task = AssertQueryBuilder(duckDbQueryRunner_)
+             .plan(tableScanNode())
+             .splits(makeHiveConnectorSplits(filePaths))
+             .config(QueryConfig::kTableScanRecordCompletedSplits, "true")
+             .assertResults("SELECT * FROM tmp");
+  const auto& completedSplits = task->taskStats().completedScanSplits;
+  ASSERT_EQ(completedSplits.size(), 1);
+  const auto& splits = completedSplits.begin()->second;
+  ASSERT_EQ(splits.size(), filePaths.size());
+  std::unordered_set<std::string> completedPaths;
+  for (const auto& split : splits) {
+    completedPaths.insert(
+        std::dynamic_pointer_cast<HiveConnectorSplit>(split)->filePath);
+  }
+  for (const auto& filePath : filePaths) {
+    EXPECT_EQ(completedPaths.count(filePath->path), 1) << filePath->path;
+  }
+}
+
 TEST_F(TableScanTest, waitForSplit) {
   auto filePaths = makeFilePaths(10);
   auto vectors = makeVectors(10, 1'000);
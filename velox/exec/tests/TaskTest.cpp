@@ -15,6 +15,8 @@
  */
 
 #include "velox/exec/Task.h"
+#include <folly/ScopeGuard.h>
+#include <folly/executors/ManualExecutor.h>
 #include "folly/experimental/EventCount.h"
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/future/VeloxPromise.h"
@@ -589,6 +591,64 @@ TEST_F(TaskTest, wrongPlanNodeForSplit) {
       errorMessage)
 }
 
+TEST_F(TaskTest, splitCacheAffinity) {
+  auto plan =
+      PlanBuilder().tableScan(ROW({"a"}, {BIGINT()})).planFragment();
+
+  auto task = Task::create(
+      "task-affinity",
+      std::move(plan),
+      0,
+      std::make_shared<core::QueryCtx>(driverExecutor_.get()));
+
+  // Find two file paths whose cache affinity keys map to different drivers
+  // out of 2.
+  std::string path0;
+  std::string path1;
+  for (auto i = 0; path0.empty() || path1.empty(); ++i) {
+    auto path = fmt::format("file:/tmp/affinity-{}", i);
+    if (std::hash<std::string>()(path) % 2 == 0) {
+      if (path0.empty()) {
+        path0 = path;
+      }
+    } else if (path1.empty()) {
+      path1 = path;
+    }
+  }
+
+  auto makeSplit = [](const std::string& path) {
+    return exec::Split(std::make_shared<connector::hive::HiveConnectorSplit>(
+        "test", path, dwio::common::FileFormat::DWRF));
+  };
+
+  // The split mapping to driver 0 arrives first.
+  task->addSplit("0", makeSplit(path0));
+  task->addSplit("0", makeSplit(path1));
+
+  auto filePathOf = [](const exec::Split& split) {
+    return std::dynamic_pointer_cast<connector::hive::HiveConnectorSplit>(
+               split.connectorSplit)
+        ->filePath;
+  };
+
+  // Driver 1 is offered the later-arriving split because its affinity key
+  // maps to that driver.
+  exec::Split split;
+  ContinueFuture future;
+  ASSERT_EQ(
+      BlockingReason::kNotBlocked,
+      task->getSplitOrFuture(
+          kUngroupedGroupId, "0", split, future, 0, nullptr, 1, 2));
+  ASSERT_EQ(path1, filePathOf(split));
+
+  // Driver 0 gets the remaining split.
+  ASSERT_EQ(
+      BlockingReason::kNotBlocked,
+      task->getSplitOrFuture(
+          kUngroupedGroupId, "0", split, future, 0, nullptr, 0, 2));
+  ASSERT_EQ(path0, filePathOf(split));
+}
+
 TEST_F(TaskTest, duplicatePlanNodeIds) {
   auto plan = PlanBuilder()
                   .tableScan(ROW({"a", "b"}, {INTEGER(), DOUBLE()}))
@@ -755,6 +815,47 @@ TEST_F(TaskTest, singleThreadedExecution) {
   VELOX_ASSERT_THROW(executeSingleThreaded(plan), "division by zero");
 }
 
+TEST_F(TaskTest, traceEvents) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(10'000, [](auto row) { return row; }),
+  });
+
+  auto plan = PlanBuilder()
+                  .values({data, data})
+                  .filter("c0 < 100")
+                  .project({"c0 + 5"})
+                  .planFragment();
+
+  auto queryCtx = std::make_shared<core::QueryCtx>();
+  queryCtx->testingOverrideConfigUnsafe(
+      {{core::QueryConfig::kDriverTraceEnabled, "true"}});
+
+  auto task =
+      Task::create("single.execution.task.trace", plan, 0, std::move(queryCtx));
+  while (task->next() != nullptr) {
+  }
+  ASSERT_TRUE(waitForTaskCompletion(task.get()));
+
+  auto trace = folly::parseJson(task->traceEventsJson());
+  const auto& events = trace["traceEvents"];
+  ASSERT_GT(events.size(), 0);
+  std::unordered_set<std::string> categories;
+  for (const auto& event : events) {
+    EXPECT_EQ(event["ph"].asString(), "X");
+    EXPECT_GE(event["dur"].asInt(), 0);
+    EXPECT_GT(event["ts"].asInt(), 0);
+    categories.insert(event["cat"].asString());
+  }
+  // The first getOutput call compiles the filter and project expressions, so
+  // at least one operator call takes long enough to be recorded.
+  EXPECT_EQ(1, categories.count("operator"));
+
+  // Tracing is off by default.
+  auto [defaultTask, results] = executeSingleThreaded(plan);
+  trace = folly::parseJson(defaultTask->traceEventsJson());
+  EXPECT_EQ(0, trace["traceEvents"].size());
+}
+
 TEST_F(TaskTest, singleThreadedHashJoin) {
   auto left = makeRowVector(
       {"t_c0", "t_c1"},
@@ -956,6 +1057,39 @@ TEST_F(TaskTest, updateBroadCastOutputBuffers) {
   }
 }
 
+TEST_F(TaskTest, driverCloseExecutor) {
+  // Verifies that when a driver close executor is set, a cancelled task's
+  // off-thread drivers are closed and freed on that executor instead of the
+  // thread that requested cancellation.
+  folly::ManualExecutor closeExecutor;
+  Task::setDriverCloseExecutor(&closeExecutor);
+  auto executorGuard =
+      folly::makeGuard([]() { Task::setDriverCloseExecutor(nullptr); });
+
+  auto plan = PlanBuilder().tableScan(ROW({"c0"}, {BIGINT()})).planFragment();
+  auto task = Task::create(
+      "driver-close-executor",
+      std::move(plan),
+      0,
+      std::make_shared<core::QueryCtx>(driverExecutor_.get()));
+  task->start(1, 1);
+
+  // Wait for the driver to block waiting for splits, i.e. go off thread.
+  while (task->taskStats().numBlockedDrivers[BlockingReason::kWaitForSplit] ==
+         0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1)); // NOLINT
+  }
+
+  auto future = task->requestCancel();
+
+  // The driver close was handed off to the executor, not run on this thread.
+  ASSERT_EQ(task->numFinishedDrivers(), 1);
+  ASSERT_EQ(closeExecutor.run(), 1);
+
+  std::move(future).wait();
+  ASSERT_EQ(task->state(), TaskState::kCanceled);
+}
+
 DEBUG_ONLY_TEST_F(TaskTest, outputDriverFinishEarly) {
   const int32_t numBatches = 10;
   std::vector<RowVectorPtr> dataBatches;
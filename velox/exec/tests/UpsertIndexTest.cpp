@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/UpsertIndex.h"
+#include <gtest/gtest.h>
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+namespace facebook::velox::exec {
+namespace {
+
+class UpsertIndexTest : public testing::Test,
+                        public velox::test::VectorTestBase {};
+
+TEST_F(UpsertIndexTest, basic) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>({1, 2, 3, 4}),
+      makeFlatVector<StringView>({"a", "b", "c", "d"}),
+  });
+
+  UpsertIndex index(asRowType(data->type()), {0}, pool());
+  index.addInput(data);
+  EXPECT_EQ(index.numRows(), 4);
+  EXPECT_EQ(index.numDeletes(), 0);
+
+  // Keys 2 and 3 reappear: rows at positions 1 and 2 are superseded.
+  auto updates = makeRowVector({
+      makeFlatVector<int64_t>({2, 3, 5}),
+      makeFlatVector<StringView>({"bb", "cc", "e"}),
+  });
+  index.addInput(updates);
+  EXPECT_EQ(index.numRows(), 7);
+  EXPECT_EQ(index.numDeletes(), 2);
+  EXPECT_EQ(index.takeDeletePositions(), (std::vector<int64_t>{1, 2}));
+  EXPECT_EQ(index.numDeletes(), 0);
+
+  // After clear() previously seen keys count as new again.
+  index.clear();
+  EXPECT_EQ(index.numRows(), 0);
+  index.addInput(updates);
+  EXPECT_EQ(index.numDeletes(), 0);
+}
+
+TEST_F(UpsertIndexTest, duplicatesWithinBatch) {
+  // The same key occurs 3 times in one batch: the last occurrence wins and
+  // the earlier two positions become deletes.
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>({7, 7, 8, 7}),
+      makeFlatVector<int64_t>({10, 20, 30, 40}),
+  });
+
+  UpsertIndex index(asRowType(data->type()), {0}, pool());
+  index.addInput(data);
+  EXPECT_EQ(index.numRows(), 4);
+  EXPECT_EQ(index.takeDeletePositions(), (std::vector<int64_t>{0, 1}));
+}
+
+TEST_F(UpsertIndexTest, multipleKeys) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>({1, 1, 2}),
+      makeFlatVector<StringView>({"x", "y", "x"}),
+      makeFlatVector<int64_t>({10, 20, 30}),
+  });
+
+  UpsertIndex index(asRowType(data->type()), {0, 1}, pool());
+  index.addInput(data);
+  EXPECT_EQ(index.numDeletes(), 0);
+
+  // Only (1, "y") is an update.
+  auto updates = makeRowVector({
+      makeFlatVector<int64_t>({1, 2}),
+      makeFlatVector<StringView>({"y", "y"}),
+      makeFlatVector<int64_t>({21, 40}),
+  });
+  index.addInput(updates);
+  EXPECT_EQ(index.takeDeletePositions(), (std::vector<int64_t>{1}));
+}
+
+TEST_F(UpsertIndexTest, deletePositionsOrder) {
+  // Deletes are returned in ascending position order regardless of the order
+  // in which the keys were updated.
+  auto data = makeRowVector({makeFlatVector<int64_t>({1, 2, 3, 4, 5})});
+  auto updates = makeRowVector({makeFlatVector<int64_t>({5, 1, 3})});
+
+  UpsertIndex index(asRowType(data->type()), {0}, pool());
+  index.addInput(data);
+  index.addInput(updates);
+  EXPECT_EQ(index.takeDeletePositions(), (std::vector<int64_t>{0, 2, 4}));
+}
+
+} // namespace
+} // namespace facebook::velox::exec
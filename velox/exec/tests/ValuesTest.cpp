@@ -100,6 +100,38 @@ TEST_F(ValuesTest, valuesWithRepeat) {
       .assertResults({input_, input2_, input_, input2_, input_, input2_});
 }
 
+TEST_F(ValuesTest, literalVectorCache) {
+  // Vectors with equal content but distinct objects, large enough for the
+  // process-wide literal cache, resolve to the same shared copy.
+  auto makeLarge = [&]() {
+    return makeRowVector({
+        makeFlatVector<int64_t>(200'000, [](auto row) { return row; }),
+        makeFlatVector<StringView>(
+            200'000,
+            [](auto row) { return StringView("abcdefghijklm"); },
+            [](auto row) { return row % 7 == 0; }),
+    });
+  };
+
+  auto first = LiteralVectorCache::instance().get(makeLarge());
+  auto second = LiteralVectorCache::instance().get(makeLarge());
+  EXPECT_EQ(first.get(), second.get());
+  velox::test::assertEqualVectors(makeLarge(), first);
+
+  // Different content gets a different copy.
+  auto other = LiteralVectorCache::instance().get(makeRowVector({
+      makeFlatVector<int64_t>(200'000, [](auto row) { return row + 1; }),
+  }));
+  EXPECT_NE(first.get(), other.get());
+
+  // Queries running over equal large literals produce unchanged results.
+  auto large = makeLarge();
+  AssertQueryBuilder(PlanBuilder().values({large}).planNode())
+      .assertResults({large});
+  AssertQueryBuilder(PlanBuilder().values({makeLarge()}).planNode())
+      .assertResults({large});
+}
+
 TEST_F(ValuesTest, valuesWithRepeatAndParallelism) {
   // Two threads repeating twice each buffer.
   AssertQueryBuilder(
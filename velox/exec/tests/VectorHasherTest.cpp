@@ -224,6 +224,66 @@ TEST_F(VectorHasherTest, flat) {
   }
 }
 
+TEST_F(VectorHasherTest, flatNoNulls) {
+  // Flat vector with no nulls and all rows selected takes the batched hashing
+  // path. Use a size that is not a multiple of the unroll factor to cover the
+  // remainder rows.
+  auto hasher = exec::VectorHasher::create(BIGINT(), 0);
+
+  auto vector = BaseVector::create(BIGINT(), 100, pool_.get());
+  auto flatVector = vector->asFlatVector<int64_t>();
+  for (int32_t i = 0; i < 100; i++) {
+    flatVector->set(i, i * 37);
+  }
+
+  raw_vector<uint64_t> hashes(100);
+  hasher->decode(*vector, allRows_);
+  hasher->hash(allRows_, false, hashes);
+  for (int32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(hashes[i], folly::hasher<int64_t>()(i * 37)) << "at " << i;
+  }
+
+  hasher->hash(allRows_, true, hashes);
+  for (int32_t i = 0; i < 100; i++) {
+    auto hash = folly::hasher<int64_t>()(i * 37);
+    EXPECT_EQ(hashes[i], bits::hashMix(hash, hash)) << "at " << i;
+  }
+}
+
+TEST_F(VectorHasherTest, valueIdsSelectedRuns) {
+  // Selections left by a filter often consist of long contiguous runs of
+  // selected rows. Verify that value ids computed over a run-structured
+  // selection match the row-by-row results and leave unselected rows
+  // untouched.
+  constexpr vector_size_t size = 2'048;
+  auto vector = vectorMaker_->flatVector<int64_t>(
+      size, [](vector_size_t row) { return row % 1'000; });
+
+  SelectivityVector runRows(size, false);
+  runRows.setValidRange(0, 70, true);
+  runRows.setValidRange(100, 800, true);
+  runRows.setValid(1'000, true);
+  runRows.setValidRange(1'500, size, true);
+  runRows.updateBounds();
+
+  auto hasher = exec::VectorHasher::create(vector->type(), 0);
+  raw_vector<uint64_t> result(size);
+  std::fill(result.begin(), result.end(), 0);
+  hasher->decode(*vector, runRows);
+  ASSERT_FALSE(hasher->computeValueIds(runRows, result));
+
+  hasher->enableValueRange(1, 0);
+  hasher->decode(*vector, runRows);
+  ASSERT_TRUE(hasher->computeValueIds(runRows, result));
+  for (vector_size_t i = 0; i < size; ++i) {
+    if (runRows.isValid(i)) {
+      ASSERT_EQ(i % 1'000 + 1, result[i]) << "at " << i;
+    } else {
+      ASSERT_EQ(0, result[i]) << "at " << i;
+    }
+  }
+}
+
 TEST_F(VectorHasherTest, nonNullConstant) {
   auto hasher = exec::VectorHasher::create(INTEGER(), 1);
   auto vector = BaseVector::createConstant(INTEGER(), 123, 100, pool_.get());
@@ -332,6 +392,59 @@ TEST_F(VectorHasherTest, dictionary) {
   }
 }
 
+// Verifies that value ids computed for a dictionary alphabet are reused across
+// batches wrapping the same alphabet and recomputed after the mapping changes.
+TEST_F(VectorHasherTest, dictionaryValueIdsReuse) {
+  auto hasher = exec::VectorHasher::create(BIGINT(), 1);
+
+  // Alphabet of 10 consecutive values: 3, 4, 5..12.
+  auto alphabet = BaseVector::create(BIGINT(), 10, pool_.get());
+  auto flatAlphabet = alphabet->asFlatVector<int64_t>();
+  for (int32_t i = 0; i < 10; i++) {
+    flatAlphabet->set(i, i + 3);
+  }
+
+  auto makeBatch = [&](int32_t offset) {
+    BufferPtr indices =
+        AlignedBuffer::allocate<vector_size_t>(100, pool_.get());
+    auto rawIndices = indices->asMutable<vector_size_t>();
+    for (int32_t i = 0; i < 100; i++) {
+      rawIndices[i] = (i + offset) % 10;
+    }
+    return BaseVector::wrapInDictionary(
+        BufferPtr(nullptr), indices, 100, alphabet);
+  };
+
+  raw_vector<uint64_t> hashes(100);
+  std::fill(hashes.begin(), hashes.end(), 0);
+
+  hasher->decode(*makeBatch(0), allRows_);
+  EXPECT_FALSE(hasher->computeValueIds(allRows_, hashes));
+  hasher->enableValueRange(1, 0);
+
+  hasher->decode(*makeBatch(0), allRows_);
+  EXPECT_TRUE(hasher->computeValueIds(allRows_, hashes));
+  for (int32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(hashes[i], i % 10 + 1) << "at " << i;
+  }
+
+  // A second batch over the same alphabet with different indices reuses the
+  // cached alphabet ids.
+  hasher->decode(*makeBatch(5), allRows_);
+  EXPECT_TRUE(hasher->computeValueIds(allRows_, hashes));
+  for (int32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(hashes[i], (i + 5) % 10 + 1) << "at " << i;
+  }
+
+  // Changing the mapping invalidates the cached ids.
+  hasher->enableValueRange(2, 0);
+  hasher->decode(*makeBatch(0), allRows_);
+  EXPECT_TRUE(hasher->computeValueIds(allRows_, hashes));
+  for (int32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(hashes[i], 2 * (i % 10 + 1)) << "at " << i;
+  }
+}
+
 // Tests how strings are mapped to uint64_t (if they fit) and to
 // consecutive ids of distinct values for the general case.
 TEST_F(VectorHasherTest, stringIds) {
@@ -518,6 +631,35 @@ TEST_F(VectorHasherTest, integerIds) {
   EXPECT_EQ(numDistinct, VectorHasher::kRangeTooLarge);
 }
 
+TEST_F(VectorHasherTest, rangeFilterAfterDistinctOverflow) {
+  // More distinct values than the hasher will enumerate, but within a known
+  // range: getFilter() returns a min/max filter instead of an IN list.
+  constexpr int32_t kNumValues = exec::VectorHasher::kMaxDistinct + 2;
+  auto hasher = exec::VectorHasher::create(BIGINT(), 1);
+
+  struct Row {
+    int64_t value;
+    char nullFlag{0};
+  };
+  std::vector<Row> data(kNumValues);
+  std::vector<char*> groups(kNumValues);
+  for (auto i = 0; i < kNumValues; ++i) {
+    data[i].value = 1'000 + i;
+    groups[i] = reinterpret_cast<char*>(&data[i]);
+  }
+  hasher->analyze(groups.data(), kNumValues, 0, offsetof(Row, nullFlag), 1);
+
+  auto filter = hasher->getFilter(false);
+  ASSERT_TRUE(filter != nullptr);
+  auto* range = dynamic_cast<common::BigintRange*>(filter.get());
+  ASSERT_TRUE(range != nullptr);
+  EXPECT_FALSE(range->testNull());
+  EXPECT_FALSE(range->testInt64(999));
+  EXPECT_TRUE(range->testInt64(1'000));
+  EXPECT_TRUE(range->testInt64(999 + kNumValues));
+  EXPECT_FALSE(range->testInt64(1'000 + kNumValues));
+}
+
 TEST_F(VectorHasherTest, dateIds) {
   auto vector = BaseVector::create(DATE(), 100, pool_.get());
   auto* dates = vector->as<FlatVector<int32_t>>();
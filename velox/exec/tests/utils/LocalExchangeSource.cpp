@@ -107,6 +107,11 @@ class LocalExchangeSource : public exec::ExchangeSource {
             return;
           }
 
+          // Count the wire pages before decoding: a decoder may expand one
+          // page into several and the sequence numbers track wire pages.
+          const auto numReceivedPages = pages.size();
+          pages = queue_->decodePages(std::move(pages));
+
           int64_t ackSequence;
           VeloxPromise<Response> requestPromise;
           {
@@ -122,7 +127,7 @@ class LocalExchangeSource : public exec::ExchangeSource {
                 queue_->enqueueLocked(nullptr, queuePromises);
                 atEnd_ = true;
               }
-              ackSequence = sequence_ = sequence + pages.size();
+              ackSequence = sequence_ = sequence + numReceivedPages;
             }
             for (auto& promise : queuePromises) {
               promise.setValue();
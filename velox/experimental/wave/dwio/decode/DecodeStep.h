@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "velox/experimental/wave/common/Type.h"
+
+/// Describes device side decode of encoded column data. The structs
+/// here are filled in by a host side reader from loaded pages and are
+/// interpreted by the decode kernel. A Parquet data page becomes one
+/// or more of these: a PLAIN page is one kTrivial, a RLE_DICTIONARY
+/// page is one op per run, kRle for repeated runs and
+/// kDictionaryOnBitpack for bit packed runs. The results go directly
+/// to WaveVector device memory.
+namespace facebook::velox::wave {
+
+/// Identifies the decode algorithm for one region of encoded values.
+enum class DecodeStep {
+  // PLAIN fixed width values, copied or scattered to the result.
+  kTrivial,
+  // A run of one repeated value.
+  kRle,
+  // Bit packed indices, optionally followed by lookup in a dictionary.
+  kDictionaryOnBitpack,
+};
+
+/// Parameters for DecodeStep::kTrivial.
+struct DecodeTrivial {
+  PhysicalType::Kind dataType;
+  // Index of the first element of 'input' to decode.
+  int32_t begin;
+  // Index of the first element after the last to decode.
+  int32_t end;
+  // Encoded values in device accessible memory.
+  const char* input;
+  // If non-null, the ith decoded value, counting from 'begin', goes to
+  // result[scatter[i]]. If null, it goes to result[i].
+  const int32_t* scatter;
+  void* result;
+};
+
+/// Parameters for DecodeStep::kRle.
+struct DecodeRle {
+  PhysicalType::Kind dataType;
+  int32_t begin;
+  int32_t end;
+  // Bit pattern of the repeated value in the low bytes. For a run of a
+  // RLE_DICTIONARY page the host resolves the run's index in the dictionary
+  // and puts the value here.
+  uint64_t value;
+  // Scatter for the produced values, as in DecodeTrivial.
+  const int32_t* scatter;
+  void* result;
+};
+
+/// Parameters for DecodeStep::kDictionaryOnBitpack.
+struct DecodeDictionaryOnBitpack {
+  PhysicalType::Kind dataType;
+  // Number of bits in each packed index.
+  int8_t bitWidth;
+  // Index of the first packed value to decode. The first value's bits start
+  // at bit 'begin' * 'bitWidth' from 'indices'.
+  int32_t begin;
+  int32_t end;
+  // The bit packed indices. The fields are loaded as 8 byte words, so the
+  // device side allocation must not end within 7 bytes of the last packed
+  // index.
+  const uint64_t* indices;
+  // Dictionary values. If nullptr, the decoded indices themselves are the
+  // result, e.g. for building a WaveVector with dictionary encoding.
+  const void* alphabet;
+  // Subtracted from each index before the lookup, e.g. when 'alphabet' is
+  // sliced to the range of indices in use.
+  int32_t baseline;
+  // Scatter for the produced values, as in DecodeTrivial.
+  const int32_t* scatter;
+  void* result;
+};
+
+/// A unit of device side decode work. One thread block interprets one
+/// GpuDecode. These are prepared in device accessible memory by the host side
+/// reader.
+struct GpuDecode {
+  DecodeStep step;
+  union {
+    DecodeTrivial trivial;
+    DecodeRle rle;
+    DecodeDictionaryOnBitpack dictionaryOnBitpack;
+  } data;
+};
+
+} // namespace facebook::velox::wave
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/experimental/wave/dwio/decode/GpuDecoder.h"
+
+#include "velox/experimental/wave/common/CudaUtil.cuh"
+#include "velox/experimental/wave/dwio/decode/GpuDecoder.cuh"
+
+namespace facebook::velox::wave {
+
+__global__ void decodeGlobal(GpuDecode* ops) {
+  decodeSwitch(ops[blockIdx.x]);
+}
+
+void GpuDecoderStream::decode(GpuDecode* ops, int32_t numOps) {
+  constexpr int32_t kBlockSize = 256;
+  decodeGlobal<<<numOps, kBlockSize, 0, stream_->stream>>>(ops);
+  CUDA_CHECK(cudaGetLastError());
+}
+
+} // namespace facebook::velox::wave
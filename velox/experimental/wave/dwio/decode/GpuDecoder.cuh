@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstring>
+
+#include "velox/experimental/wave/common/CudaUtil.cuh"
+#include "velox/experimental/wave/dwio/decode/DecodeStep.h"
+
+namespace facebook::velox::wave {
+namespace detail {
+
+template <typename T>
+__device__ inline T loadUnaligned(const void* ptr) {
+  T value;
+  memcpy(&value, ptr, sizeof(T));
+  return value;
+}
+
+/// Returns 'bitWidth' bits of 'bits' starting at 'bitOffset' as the
+/// low bits of the result. Reads the containing 8 bytes in one load,
+/// so the allocation must not end within 7 bytes of the last field.
+__device__ inline uint64_t
+bitsAt(const uint64_t* bits, int64_t bitOffset, int8_t bitWidth) {
+  auto word = loadUnaligned<uint64_t>(
+      reinterpret_cast<const char*>(bits) + (bitOffset >> 3));
+  return (word >> (bitOffset & 7)) & ((1UL << bitWidth) - 1);
+}
+
+template <typename T>
+__device__ void decodeTrivial(DecodeTrivial& op) {
+  auto* result = reinterpret_cast<T*>(op.result);
+  auto* scatter = op.scatter;
+  for (auto i = op.begin + threadIdx.x; i < op.end; i += blockDim.x) {
+    auto value = loadUnaligned<T>(op.input + i * sizeof(T));
+    result[scatter ? scatter[i - op.begin] : i - op.begin] = value;
+  }
+}
+
+template <typename T>
+__device__ void decodeRle(DecodeRle& op) {
+  T value;
+  memcpy(&value, &op.value, sizeof(T));
+  auto* result = reinterpret_cast<T*>(op.result);
+  auto* scatter = op.scatter;
+  for (auto i = op.begin + threadIdx.x; i < op.end; i += blockDim.x) {
+    result[scatter ? scatter[i - op.begin] : i - op.begin] = value;
+  }
+}
+
+template <typename T>
+__device__ void decodeDictionaryOnBitpack(DecodeDictionaryOnBitpack& op) {
+  auto* result = reinterpret_cast<T*>(op.result);
+  auto* alphabet = reinterpret_cast<const T*>(op.alphabet);
+  auto* scatter = op.scatter;
+  for (auto i = op.begin + threadIdx.x; i < op.end; i += blockDim.x) {
+    auto index = bitsAt(op.indices, static_cast<int64_t>(i) * op.bitWidth,
+                        op.bitWidth) -
+        op.baseline;
+    T value = alphabet ? alphabet[index] : static_cast<T>(index);
+    result[scatter ? scatter[i - op.begin] : i - op.begin] = value;
+  }
+}
+
+/// Runs 'decode' with the unsigned integer type matching the byte width of
+/// 'kind'. The decode steps move bits, so only the width matters.
+template <template <typename T> class Decode, typename Op>
+__device__ void decodeWithWidth(PhysicalType::Kind kind, Op& op) {
+  switch (kind) {
+    case PhysicalType::kInt8:
+      Decode<uint8_t>()(op);
+      break;
+    case PhysicalType::kInt16:
+      Decode<uint16_t>()(op);
+      break;
+    case PhysicalType::kInt32:
+    case PhysicalType::kFloat32:
+      Decode<uint32_t>()(op);
+      break;
+    case PhysicalType::kInt64:
+    case PhysicalType::kFloat64:
+      Decode<uint64_t>()(op);
+      break;
+    default:
+      // Strings and complex types have their own decode steps.
+      assert(false);
+  }
+}
+
+template <typename T>
+struct DecodeTrivialOp {
+  __device__ void operator()(DecodeTrivial& op) {
+    decodeTrivial<T>(op);
+  }
+};
+
+template <typename T>
+struct DecodeRleOp {
+  __device__ void operator()(DecodeRle& op) {
+    decodeRle<T>(op);
+  }
+};
+
+template <typename T>
+struct DecodeDictionaryOnBitpackOp {
+  __device__ void operator()(DecodeDictionaryOnBitpack& op) {
+    decodeDictionaryOnBitpack<T>(op);
+  }
+};
+
+} // namespace detail
+
+/// Interprets one GpuDecode with all threads of the block.
+__device__ inline void decodeSwitch(GpuDecode& op) {
+  switch (op.step) {
+    case DecodeStep::kTrivial:
+      detail::decodeWithWidth<detail::DecodeTrivialOp>(
+          op.data.trivial.dataType, op.data.trivial);
+      break;
+    case DecodeStep::kRle:
+      detail::decodeWithWidth<detail::DecodeRleOp>(
+          op.data.rle.dataType, op.data.rle);
+      break;
+    case DecodeStep::kDictionaryOnBitpack:
+      detail::decodeWithWidth<detail::DecodeDictionaryOnBitpackOp>(
+          op.data.dictionaryOnBitpack.dataType, op.data.dictionaryOnBitpack);
+      break;
+  }
+}
+
+} // namespace facebook::velox::wave
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "velox/experimental/wave/common/Cuda.h"
+#include "velox/experimental/wave/dwio/decode/DecodeStep.h"
+
+namespace facebook::velox::wave {
+
+/// Runs decode programs on device. One thread block interprets one GpuDecode,
+/// so independent pages and runs of a query's splits decode in parallel on
+/// one kernel launch.
+class GpuDecoderStream : public Stream {
+ public:
+  /// Enqueues decode of 'ops[0]' to 'ops[numOps - 1]'. 'ops' and everything
+  /// they reference must be device accessible and stay live until the work
+  /// completes, e.g. via wait() or an Event.
+  void decode(GpuDecode* ops, int32_t numOps);
+};
+
+} // namespace facebook::velox::wave
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "velox/experimental/wave/dwio/decode/GpuDecoder.h"
+
+namespace facebook::velox::wave {
+namespace {
+
+class GpuDecoderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    device_ = getDevice();
+    setDevice(device_);
+    allocator_ = getAllocator(device_);
+  }
+
+  // Packs 'indices' with 'bitWidth' bits per value into 'out'. 'out' must
+  // have room for the packed bits plus a full trailing word.
+  static void packBits(
+      const std::vector<int32_t>& indices,
+      int8_t bitWidth,
+      uint64_t* out) {
+    for (auto i = 0; i < indices.size(); ++i) {
+      int64_t bitOffset = static_cast<int64_t>(i) * bitWidth;
+      auto* byte = reinterpret_cast<uint8_t*>(out) + (bitOffset >> 3);
+      uint64_t word;
+      memcpy(&word, byte, sizeof(word));
+      word |= static_cast<uint64_t>(indices[i]) << (bitOffset & 7);
+      memcpy(byte, &word, sizeof(word));
+    }
+  }
+
+  Device* device_;
+  GpuAllocator* allocator_;
+};
+
+TEST_F(GpuDecoderTest, trivial) {
+  constexpr int32_t kNumValues = 10'001;
+  auto values = allocator_->allocate<int64_t>(kNumValues);
+  auto result = allocator_->allocate<int64_t>(kNumValues);
+  auto scatter = allocator_->allocate<int32_t>(kNumValues);
+  auto scattered = allocator_->allocate<int64_t>(2 * kNumValues);
+  auto ops = allocator_->allocate<GpuDecode>(2);
+  for (auto i = 0; i < kNumValues; ++i) {
+    values.get()[i] = i * 11;
+    scatter.get()[i] = 2 * i;
+  }
+  {
+    auto& op = ops.get()[0];
+    op.step = DecodeStep::kTrivial;
+    op.data.trivial.dataType = PhysicalType::kInt64;
+    op.data.trivial.begin = 0;
+    op.data.trivial.end = kNumValues;
+    op.data.trivial.input = reinterpret_cast<const char*>(values.get());
+    op.data.trivial.scatter = nullptr;
+    op.data.trivial.result = result.get();
+  }
+  {
+    auto& op = ops.get()[1];
+    op.step = DecodeStep::kTrivial;
+    op.data.trivial.dataType = PhysicalType::kInt64;
+    op.data.trivial.begin = 0;
+    op.data.trivial.end = kNumValues;
+    op.data.trivial.input = reinterpret_cast<const char*>(values.get());
+    op.data.trivial.scatter = scatter.get();
+    op.data.trivial.result = scattered.get();
+  }
+  GpuDecoderStream stream;
+  stream.decode(ops.get(), 2);
+  stream.wait();
+  for (auto i = 0; i < kNumValues; ++i) {
+    ASSERT_EQ(result.get()[i], i * 11);
+    ASSERT_EQ(scattered.get()[2 * i], i * 11);
+  }
+}
+
+TEST_F(GpuDecoderTest, rle) {
+  constexpr int32_t kNumValues = 5'000;
+  auto result = allocator_->allocate<int32_t>(kNumValues);
+  auto ops = allocator_->allocate<GpuDecode>(1);
+  auto& op = ops.get()[0];
+  op.step = DecodeStep::kRle;
+  op.data.rle.dataType = PhysicalType::kInt32;
+  op.data.rle.begin = 0;
+  op.data.rle.end = kNumValues;
+  op.data.rle.value = 123'456;
+  op.data.rle.scatter = nullptr;
+  op.data.rle.result = result.get();
+  GpuDecoderStream stream;
+  stream.decode(ops.get(), 1);
+  stream.wait();
+  for (auto i = 0; i < kNumValues; ++i) {
+    ASSERT_EQ(result.get()[i], 123'456);
+  }
+}
+
+TEST_F(GpuDecoderTest, dictionaryOnBitpack) {
+  constexpr int32_t kNumValues = 10'000;
+  constexpr int32_t kAlphabetSize = 1'024;
+  auto alphabet = allocator_->allocate<int64_t>(kAlphabetSize);
+  for (auto i = 0; i < kAlphabetSize; ++i) {
+    alphabet.get()[i] = i * 7;
+  }
+  std::vector<int32_t> indices(kNumValues);
+  for (auto i = 0; i < kNumValues; ++i) {
+    indices[i] = (i * 31) % kAlphabetSize;
+  }
+  for (int8_t bitWidth : {10, 13, 16, 22}) {
+    auto numWords = (kNumValues * bitWidth + 63) / 64 + 1;
+    auto bits = allocator_->allocate<uint64_t>(numWords);
+    memset(bits.get(), 0, numWords * sizeof(uint64_t));
+    packBits(indices, bitWidth, bits.get());
+    auto result = allocator_->allocate<int64_t>(kNumValues);
+    auto ops = allocator_->allocate<GpuDecode>(1);
+    auto& op = ops.get()[0];
+    op.step = DecodeStep::kDictionaryOnBitpack;
+    op.data.dictionaryOnBitpack.dataType = PhysicalType::kInt64;
+    op.data.dictionaryOnBitpack.bitWidth = bitWidth;
+    op.data.dictionaryOnBitpack.begin = 0;
+    op.data.dictionaryOnBitpack.end = kNumValues;
+    op.data.dictionaryOnBitpack.indices = bits.get();
+    op.data.dictionaryOnBitpack.alphabet = alphabet.get();
+    op.data.dictionaryOnBitpack.baseline = 0;
+    op.data.dictionaryOnBitpack.scatter = nullptr;
+    op.data.dictionaryOnBitpack.result = result.get();
+    GpuDecoderStream stream;
+    stream.decode(ops.get(), 1);
+    stream.wait();
+    for (auto i = 0; i < kNumValues; ++i) {
+      ASSERT_EQ(result.get()[i], alphabet.get()[indices[i]])
+          << "bitWidth " << bitWidth << " at " << i;
+    }
+  }
+}
+
+TEST_F(GpuDecoderTest, dictionaryIndicesOnly) {
+  // With no alphabet, the decoded indices are the result, e.g. for a
+  // dictionary encoded WaveVector.
+  constexpr int32_t kNumValues = 2'000;
+  constexpr int8_t kBitWidth = 9;
+  std::vector<int32_t> indices(kNumValues);
+  for (auto i = 0; i < kNumValues; ++i) {
+    indices[i] = (i * 17) % 512;
+  }
+  auto numWords = (kNumValues * kBitWidth + 63) / 64 + 1;
+  auto bits = allocator_->allocate<uint64_t>(numWords);
+  memset(bits.get(), 0, numWords * sizeof(uint64_t));
+  packBits(indices, kBitWidth, bits.get());
+  auto result = allocator_->allocate<int32_t>(kNumValues);
+  auto ops = allocator_->allocate<GpuDecode>(1);
+  auto& op = ops.get()[0];
+  op.step = DecodeStep::kDictionaryOnBitpack;
+  op.data.dictionaryOnBitpack.dataType = PhysicalType::kInt32;
+  op.data.dictionaryOnBitpack.bitWidth = kBitWidth;
+  op.data.dictionaryOnBitpack.begin = 0;
+  op.data.dictionaryOnBitpack.end = kNumValues;
+  op.data.dictionaryOnBitpack.indices = bits.get();
+  op.data.dictionaryOnBitpack.alphabet = nullptr;
+  op.data.dictionaryOnBitpack.baseline = 0;
+  op.data.dictionaryOnBitpack.scatter = nullptr;
+  op.data.dictionaryOnBitpack.result = result.get();
+  GpuDecoderStream stream;
+  stream.decode(ops.get(), 1);
+  stream.wait();
+  for (auto i = 0; i < kNumValues; ++i) {
+    ASSERT_EQ(result.get()[i], indices[i]);
+  }
+}
+
+} // namespace
+} // namespace facebook::velox::wave
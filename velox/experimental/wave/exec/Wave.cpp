@@ -104,13 +104,25 @@ void WaveStream::releaseEvent(std::unique_ptr<Event>&& event) {
   eventsForReuse_.push_back(std::move(event));
 }
 
+// static
+GpuArena& WaveStream::hostArena() {
+  // Unit of allocation for pinned host memory for staging data transfers.
+  constexpr uint64_t kHostArenaQuantum = 64UL << 20;
+  static GpuArena arena(kHostArenaQuantum, getHostAllocator(getDevice()));
+  return arena;
+}
+
 namespace {
-// Copies from pageable host to unified address. Multithreaded memcpy is
-// probably best.
-void copyData(std::vector<Transfer>& transfers) {
+// Copies the sources of 'transfers' into 'staging' and retargets the
+// transfers to read from the staged copy. The sources are only guaranteed to
+// stay live for the duration of startTransfer() while the device side copy
+// completes after return.
+void stageTransfers(std::vector<Transfer>& transfers, char* staging) {
   // TODO: Put memcpys or ppieces of them on AsyncSource if large enough.
   for (auto& transfer : transfers) {
-    ::memcpy(transfer.to, transfer.from, transfer.size);
+    ::memcpy(staging, transfer.from, transfer.size);
+    transfer.from = staging;
+    staging += transfer.size;
   }
 }
 } // namespace
@@ -128,13 +140,19 @@ void Executable::startTransfer(
   exe->deviceData.push_back(operands);
   exe->operands = operands->as<Operand>();
   exe->outputOperands = outputOperands;
-  copyData(exe->transfers);
-  auto* device = waveStream.device();
+  int64_t totalBytes = 0;
+  for (auto& transfer : exe->transfers) {
+    totalBytes += transfer.size;
+  }
+  if (totalBytes > 0) {
+    exe->hostData = WaveStream::hostArena().allocateBytes(totalBytes);
+    stageTransfers(exe->transfers, exe->hostData->as<char>());
+  }
   waveStream.installExecutables(
       folly::Range(&exe, 1),
       [&](Stream* stream, folly::Range<Executable**> executables) {
         for (auto& transfer : executables[0]->transfers) {
-          stream->prefetch(device, transfer.to, transfer.size);
+          stream->hostToDeviceAsync(transfer.to, transfer.from, transfer.size);
         }
         waveStream.markLaunch(*stream, *executables[0]);
       });
@@ -131,6 +131,11 @@ struct Executable {
   // If this represents data transfer, the ranges to transfer.
   std::vector<Transfer> transfers;
 
+  // Pinned host memory staging the sources of 'transfers'. The copy to device
+  // reads from this, so the sources themselves need not stay live after
+  // startTransfer() returns. Returned to the host arena when 'this' is freed.
+  WaveBufferPtr hostData;
+
   // The stream on which this is enqueued. Set by
   // WaveStream::installExecutables(). Cleared after the kernel containing this
   // is seen to realize dependent event.
@@ -307,6 +312,11 @@ class WaveStream {
   static std::unique_ptr<Stream> streamFromReserve();
   static void releaseStream(std::unique_ptr<Stream>&& stream);
 
+  /// Returns the process-wide arena for pinned host memory. Data transfers
+  /// stage their sources here so that the device side copy is asynchronous
+  /// and overlaps compute enqueued on other streams.
+  static GpuArena& hostArena();
+
   /// Takes ownership of 'buffer' and keeps it until return of all kernels. Used
   /// for keeping working memory passed to kernels live for the duration.
   void addExtraData(int32_t key, WaveBufferPtr buffer) {
@@ -164,7 +164,20 @@ void WaveDriver::startMore() {
 }
 
 void WaveDriver::prefetchReturn(WaveStream& stream) {
-  // Schedule return buffers from last op to be on host side.
+  // Schedule return buffers from last op to be on host side. The copy is
+  // ordered after the compute on the producing stream and overlaps the
+  // compute of other in-flight WaveStreams.
+  auto& op = *pipelines_.back().operators.back();
+  op.syncSet().forEach([&](int32_t id) {
+    auto* exe = stream.operandExecutable(id);
+    if (exe == nullptr || exe->stream == nullptr) {
+      return;
+    }
+    auto ordinal = exe->outputOperands.ordinal(id);
+    if (auto& vector = exe->output[ordinal]) {
+      vector->prefetch(nullptr, *exe->stream);
+    }
+  });
 }
 
 LaunchControl* WaveDriver::inputControl(
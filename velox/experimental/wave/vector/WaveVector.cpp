@@ -87,6 +87,22 @@ void WaveVector::toOperand(Operand* operand) const {
   }
 }
 
+void WaveVector::prefetch(Device* device, Stream& stream) {
+  for (auto* buffer :
+       {values_.get(),
+        nulls_.get(),
+        indices_.get(),
+        lengths_.get(),
+        offsets_.get()}) {
+    if (buffer) {
+      stream.prefetch(device, buffer->as<char>(), buffer->capacity());
+    }
+  }
+  for (auto& child : children_) {
+    child->prefetch(device, stream);
+  }
+}
+
 void toBits(uint64_t* words, int32_t numBytes) {
   auto data = reinterpret_cast<uint8_t*>(words);
   auto zero = xsimd::broadcast<uint8_t>(0);
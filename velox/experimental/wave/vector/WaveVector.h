@@ -108,6 +108,10 @@ class WaveVector {
   /// Sets 'operand' to point to the buffers of 'this'.
   void toOperand(Operand* operand) const;
 
+  /// Enqueues on 'stream' a prefetch of the backing buffers to 'device'.
+  /// Prefetches to host if 'device' is nullptr.
+  void prefetch(Device* device, Stream& stream);
+
   std::string toString() const;
 
  private:
@@ -138,10 +138,14 @@ void CastExpr::castTimestampToDate(
   auto* resultFlatVector = result->as<FlatVector<int32_t>>();
   static const int32_t kSecsPerDay{86'400};
   auto inputVector = input.as<SimpleVector<Timestamp>>();
+  std::optional<TimezoneConverter> converter;
+  if constexpr (adjustForTimeZone) {
+    converter.emplace(*timeZone);
+  }
   applyToSelectedNoThrowLocal(context, rows, result, [&](int row) {
     auto input = inputVector->valueAt(row);
     if constexpr (adjustForTimeZone) {
-      input.toTimezone(*timeZone);
+      converter->toTimezone(input);
     }
     auto seconds = input.getSeconds();
     if (seconds >= 0 || seconds % kSecsPerDay == 0) {
@@ -220,6 +224,27 @@ void CastExpr::applyCastKernel(
     }
   }
 
+  if constexpr (
+      (ToKind == TypeKind::VARCHAR || ToKind == TypeKind::VARBINARY) &&
+      (FromKind == TypeKind::TINYINT || FromKind == TypeKind::SMALLINT ||
+       FromKind == TypeKind::INTEGER || FromKind == TypeKind::BIGINT)) {
+    // Fast path for integer to string casts: write the digits into a stack
+    // buffer with std::to_chars instead of materializing a std::string per
+    // row, then copy them straight into the string buffer of 'result'.
+    char buffer[20]; // Up to 19 digits plus the sign for int64.
+    auto [position, errorCode] =
+        std::to_chars(buffer, buffer + sizeof(buffer), inputRowValue);
+    VELOX_DCHECK_EQ(
+        errorCode,
+        std::errc(),
+        "Failed to cast integer to varchar: {}",
+        std::make_error_code(errorCode).message());
+    auto writer = exec::StringWriter<>(result, row);
+    writer.copy_from(std::string_view(buffer, position - buffer));
+    writer.finalize();
+    return;
+  }
+
   auto output = util::Converter<ToKind, void, Truncate>::cast(inputRowValue);
 
   if constexpr (ToKind == TypeKind::VARCHAR || ToKind == TypeKind::VARBINARY) {
@@ -550,9 +575,10 @@ void CastExpr::applyCastPrimitives(
         auto* timeZone = date::locate_zone(sessionTzName);
         auto rawTimestamps = resultFlatVector->mutableRawValues();
 
+        TimezoneConverter converter(*timeZone);
         applyToSelectedNoThrowLocal(
             context, *remainingRows, result, [&](int row) {
-              rawTimestamps[row].toGMT(*timeZone);
+              converter.toGMT(rawTimestamps[row]);
             });
       }
     }
@@ -74,11 +74,15 @@ VectorPtr CastExpr::castFromDate(
           ? date::locate_zone(sessionTzName)
           : nullptr;
       auto* resultFlatVector = castResult->as<FlatVector<Timestamp>>();
+      std::optional<TimezoneConverter> converter;
+      if (timeZone) {
+        converter.emplace(*timeZone);
+      }
       applyToSelectedNoThrowLocal(context, rows, castResult, [&](int row) {
         auto timestamp = Timestamp::fromMillis(
             inputFlatVector->valueAt(row) * kMillisPerDay);
         if (timeZone) {
-          timestamp.toGMT(*timeZone);
+          converter->toGMT(timestamp);
         }
         resultFlatVector->set(row, timestamp);
       });
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #include "velox/expression/ConjunctExpr.h"
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
 #include "velox/expression/BooleanMix.h"
 #include "velox/expression/ScopedVarSetter.h"
 
@@ -21,6 +23,48 @@ namespace facebook::velox::exec {
 
 namespace {
 
+// Process-wide cache of learned conjunct input orders keyed by the string
+// form of the conjunct. Lets a new ConjunctExpr for a recurring filter start
+// with the order learned by previous queries instead of relearning it from
+// its first batches. Orders are published when an expression that has
+// observed selectivity is destroyed. Bounded to keep ad-hoc queries from
+// growing it without limit.
+class ConjunctOrderCache {
+ public:
+  static ConjunctOrderCache& instance() {
+    static ConjunctOrderCache cache;
+    return cache;
+  }
+
+  std::optional<std::vector<int32_t>> find(const std::string& key) const {
+    auto map = map_.rlock();
+    auto it = map->find(key);
+    if (it == map->end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  void insert(const std::string& key, const std::vector<int32_t>& order) {
+    auto map = map_.wlock();
+    auto it = map->find(key);
+    if (it != map->end()) {
+      it->second = order;
+      return;
+    }
+    if (map->size() >= kMaxEntries) {
+      return;
+    }
+    map->emplace(key, order);
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 1'000;
+
+  folly::Synchronized<folly::F14FastMap<std::string, std::vector<int32_t>>>
+      map_;
+};
+
 uint64_t* rowsWithError(
     const SelectivityVector& rows,
     const SelectivityVector& activeRows,
@@ -93,12 +137,53 @@ void finalizeErrors(
 }
 } // namespace
 
+ConjunctExpr::~ConjunctExpr() {
+  if (reorderEnabledChecked_ && reorderEnabled_) {
+    publishInputOrderToCache();
+  }
+}
+
+void ConjunctExpr::seedInputOrderFromCache() {
+  auto order = ConjunctOrderCache::instance().find(toString());
+  if (!order.has_value() || order->size() != inputOrder_.size()) {
+    return;
+  }
+  // Apply only if the cached order is a permutation of the input indices.
+  std::vector<bool> seen(inputOrder_.size(), false);
+  for (auto index : *order) {
+    if (index < 0 || index >= static_cast<int32_t>(seen.size()) ||
+        seen[index]) {
+      return;
+    }
+    seen[index] = true;
+  }
+  inputOrder_ = std::move(*order);
+}
+
+void ConjunctExpr::publishInputOrderToCache() {
+  if (selectivity_[inputOrder_[0]].numIn() == 0) {
+    // Nothing was evaluated, there is nothing learned to publish.
+    return;
+  }
+  ConjunctOrderCache::instance().insert(toString(), inputOrder_);
+}
+
 void ConjunctExpr::evalSpecialForm(
     const SelectivityVector& rows,
     EvalCtx& context,
     VectorPtr& result) {
   // TODO Revisit error handling
   bool throwOnError = *context.mutableThrowOnError();
+  if (!reorderEnabledChecked_) {
+    reorderEnabled_ = context.execCtx()
+                          ->queryCtx()
+                          ->queryConfig()
+                          .adaptiveFilterReorderingEnabled();
+    reorderEnabledChecked_ = true;
+    if (reorderEnabled_) {
+      seedInputOrderFromCache();
+    }
+  }
   ScopedVarSetter saveError(context.mutableThrowOnError(), false);
   context.ensureWritable(rows, type(), result);
   auto flatResult = result->asFlatVector<bool>();
@@ -161,13 +246,6 @@ void ConjunctExpr::evalSpecialForm(
   }
   // Clear errors for 'rows' that are not in 'activeRows'.
   finalizeErrors(rows, *activeRows, throwOnError, context);
-  if (!reorderEnabledChecked_) {
-    reorderEnabled_ = context.execCtx()
-                          ->queryCtx()
-                          ->queryConfig()
-                          .adaptiveFilterReorderingEnabled();
-    reorderEnabledChecked_ = true;
-  }
   if (reorderEnabled_) {
     maybeReorderInputs();
   }
@@ -51,6 +51,8 @@ class ConjunctExpr : public SpecialForm {
     resolveType(inputTypes);
   }
 
+  ~ConjunctExpr() override;
+
   void evalSpecialForm(
       const SelectivityVector& rows,
       EvalCtx& context,
@@ -64,6 +66,12 @@ class ConjunctExpr : public SpecialForm {
     return selectivity_[inputOrder_[index]];
   }
 
+  /// Returns the current evaluation order of the inputs. The i-th evaluated
+  /// input is inputs()[testingInputOrder()[i]].
+  const std::vector<int32_t>& testingInputOrder() const {
+    return inputOrder_;
+  }
+
   std::string toSql(
       std::vector<VectorPtr>* complexConstants = nullptr) const override;
 
@@ -76,6 +84,15 @@ class ConjunctExpr : public SpecialForm {
 
   void maybeReorderInputs();
 
+  // Seeds 'inputOrder_' with the order learned by previous instances of the
+  // same conjunct, if any. Called once before the first evaluation so that
+  // recurring filters do not pay for relearning on their first batches.
+  void seedInputOrderFromCache();
+
+  // Publishes 'inputOrder_' for reuse by future instances of the same
+  // conjunct. Called from the destructor if selectivity was observed.
+  void publishInputOrderToCache();
+
   void updateResult(
       BaseVector* inputResult,
       EvalCtx& context,
@@ -29,6 +29,7 @@
 #include "velox/expression/Expr.h"
 #include "velox/expression/ExprCompiler.h"
 #include "velox/expression/FieldReference.h"
+#include "velox/expression/LambdaExpr.h"
 #include "velox/expression/PeeledEncoding.h"
 #include "velox/expression/ScopedVarSetter.h"
 #include "velox/expression/VectorFunction.h"
@@ -889,6 +890,7 @@ void Expr::evaluateSharedSubexpr(
 
   if (rows.isSubset(*sharedSubexprRows)) {
     // We have results for all requested rows. No need to compute anything.
+    ++stats_.numSharedSubexprReuses;
     context.moveOrCopyResult(sharedSubexprValues, rows, result);
     return;
   }
@@ -922,6 +924,8 @@ void Expr::evaluateSharedSubexpr(
   context.deselectErrors(*missingRows);
 
   sharedSubexprRows->select(*missingRows);
+  // Some of the requested rows were served from the cache.
+  ++stats_.numSharedSubexprReuses;
   context.moveOrCopyResult(sharedSubexprValues, rows, result);
 }
 
@@ -1000,7 +1004,7 @@ Expr::PeelEncodingsResult Expr::peelEncodings(
   // If the expression depends on one dictionary, results are cacheable.
   bool mayCache = false;
   if (context.cacheEnabled()) {
-    mayCache = distinctFields_.size() == 1 &&
+    mayCache = distinctFields_.size() == 1 && !memoUnproductive_ &&
         VectorEncoding::isDictionary(context.wrapEncoding()) &&
         !peeledVectors[0]->memoDisabled();
   }
@@ -1078,8 +1082,16 @@ bool Expr::removeSureNulls(
     }
 
     if (values->mayHaveNulls()) {
-      LocalDecodedVector decoded(context, *values, rows);
-      if (auto* rawNulls = decoded->nulls()) {
+      const uint64_t* rawNulls;
+      LocalDecodedVector decoded(context);
+      if (values->encoding() == VectorEncoding::Simple::FLAT) {
+        // Flat vectors expose their null mask directly; no need to decode.
+        rawNulls = values->rawNulls();
+      } else {
+        decoded.get()->decode(*values, rows);
+        rawNulls = decoded->nulls();
+      }
+      if (rawNulls) {
         if (!result) {
           result = nullHolder.get(rows);
         }
@@ -1147,7 +1159,21 @@ void Expr::evalWithNulls(
 // this hold onto a reference to the base vector and the cached results, it can
 // be memory intensive. Therefore in order to reduce this consumption and ensure
 // it is only employed for cases where it can be useful, it only starts caching
-// result after it encounters the same base at least twice.
+// result after it encounters the same base at least twice. Results are kept
+// for up to kMaxMemoEntries recently seen bases so that inputs alternating
+// between a few stable bases, e.g. a stripe dictionary and a combined stride
+// dictionary, stay cached. If bases turn out not to repeat, memoization is
+// switched off for the expression once the hit rate over the first
+// kMemoHitRateCheckThreshold lookups proves too low.
+//
+// Note: this per-Expr cache and the subexpression deduplication done at
+// compile time are the only forms of cross-expression reuse. A shared decode
+// cache in EvalCtx keyed by (vector, rows) has been considered and rejected:
+// intermediate vectors are recycled through the per-driver VectorPool during
+// evaluation, so a raw vector pointer can be reused with new contents within
+// one ExprSet::eval, and the row set varies per conditional branch so lookups
+// would need subset checks that cost about as much as re-decoding flat or
+// single-level dictionary inputs.
 void Expr::evalWithMemo(
     const SelectivityVector& rows,
     EvalCtx& context,
@@ -1155,46 +1181,88 @@ void Expr::evalWithMemo(
   VectorPtr base;
   distinctFields_[0]->evalSpecialForm(rows, context, base);
 
-  if (base.get() != baseOfDictionaryRawPtr_ ||
-      baseOfDictionaryWeakPtr_.expired()) {
-    baseOfDictionaryRepeats_ = 0;
-    baseOfDictionaryWeakPtr_ = base;
-    baseOfDictionaryRawPtr_ = base.get();
-    context.releaseVector(baseOfDictionary_);
-    context.releaseVector(dictionaryCache_);
+  ++memoLookups_;
+  // Find the entry for 'base'. An entry whose base has been destroyed is
+  // dropped since its address may have been reused by another vector.
+  int32_t found = -1;
+  for (auto i = 0; i < memoEntries_.size(); ++i) {
+    if (memoEntries_[i].baseRawPtr == base.get()) {
+      if (memoEntries_[i].baseWeakPtr.expired()) {
+        context.releaseVector(memoEntries_[i].base);
+        context.releaseVector(memoEntries_[i].values);
+        memoEntries_.erase(memoEntries_.begin() + i);
+      } else {
+        found = i;
+      }
+      break;
+    }
+  }
+
+  if (found < 0) {
+    if (memoLookups_ >= kMemoHitRateCheckThreshold &&
+        memoHits_ * kMemoMinHitRate < memoLookups_) {
+      // Bases do not repeat for this expression, so tracking them is pure
+      // overhead. Stop memoizing.
+      memoUnproductive_ = true;
+      for (auto& entry : memoEntries_) {
+        context.releaseVector(entry.base);
+        context.releaseVector(entry.values);
+      }
+      memoEntries_.clear();
+      evalWithNulls(rows, context, result);
+      return;
+    }
+    // Start tracking 'base', evicting the least recently used entry if full.
+    if (memoEntries_.size() >= kMaxMemoEntries) {
+      context.releaseVector(memoEntries_.back().base);
+      context.releaseVector(memoEntries_.back().values);
+      memoEntries_.pop_back();
+    }
+    memoEntries_.emplace(memoEntries_.begin());
+    auto& entry = memoEntries_.front();
+    entry.baseWeakPtr = base;
+    entry.baseRawPtr = base.get();
     evalWithNulls(rows, context, result);
     return;
   }
-  ++baseOfDictionaryRepeats_;
+  ++memoHits_;
+  // Move the entry to the front of the LRU order.
+  if (found > 0) {
+    std::rotate(
+        memoEntries_.begin(),
+        memoEntries_.begin() + found,
+        memoEntries_.begin() + found + 1);
+  }
+  auto& entry = memoEntries_.front();
+  ++entry.repeats;
 
-  if (baseOfDictionaryRepeats_ == 1) {
+  if (entry.repeats == 1) {
     evalWithNulls(rows, context, result);
-    baseOfDictionary_ = base;
-    dictionaryCache_ = result;
-    if (!cachedDictionaryIndices_) {
-      cachedDictionaryIndices_ =
-          context.execCtx()->getSelectivityVector(rows.end());
-    }
-    *cachedDictionaryIndices_ = rows;
-    context.deselectErrors(*cachedDictionaryIndices_);
+    entry.base = base;
+    entry.values = result;
+    if (!entry.rows) {
+      entry.rows = context.execCtx()->getSelectivityVector(rows.end());
+    }
+    *entry.rows = rows;
+    context.deselectErrors(*entry.rows);
     return;
   }
 
-  if (cachedDictionaryIndices_) {
+  if (entry.rows) {
     LocalSelectivityVector cachedHolder(context, rows);
     auto cached = cachedHolder.get();
     VELOX_DCHECK(cached != nullptr);
-    cached->intersect(*cachedDictionaryIndices_);
+    cached->intersect(*entry.rows);
     if (cached->hasSelections()) {
       context.ensureWritable(rows, type(), result);
-      result->copy(dictionaryCache_.get(), *cached, nullptr);
+      result->copy(entry.values.get(), *cached, nullptr);
     }
   }
   LocalSelectivityVector uncachedHolder(context, rows);
   auto uncached = uncachedHolder.get();
   VELOX_DCHECK(uncached != nullptr);
-  if (cachedDictionaryIndices_) {
-    uncached->deselect(*cachedDictionaryIndices_);
+  if (entry.rows) {
+    uncached->deselect(*entry.rows);
   }
   if (uncached->hasSelections()) {
     // Fix finalSelection at "rows" if uncached rows is a strict subset to
@@ -1208,28 +1276,27 @@ void Expr::evalWithMemo(
     context.exprSet()->addToMemo(this);
     auto newCacheSize = uncached->end();
 
-    // dictionaryCache_ is valid only for cachedDictionaryIndices_. Hence, a
-    // safe call to BaseVector::ensureWritable must include all the rows not
-    // covered by cachedDictionaryIndices_. If BaseVector::ensureWritable is
-    // called only for a subset of rows not covered by
-    // cachedDictionaryIndices_, it will attempt to copy rows that are not
-    // valid leading to a crash.
-    LocalSelectivityVector allUncached(context, dictionaryCache_->size());
+    // 'entry.values' is valid only for 'entry.rows'. Hence, a safe call to
+    // BaseVector::ensureWritable must include all the rows not covered by
+    // 'entry.rows'. If BaseVector::ensureWritable is called only for a subset
+    // of rows not covered by 'entry.rows', it will attempt to copy rows that
+    // are not valid leading to a crash.
+    LocalSelectivityVector allUncached(context, entry.values->size());
     allUncached.get()->setAll();
-    allUncached.get()->deselect(*cachedDictionaryIndices_);
-    context.ensureWritable(*allUncached.get(), type(), dictionaryCache_);
+    allUncached.get()->deselect(*entry.rows);
+    context.ensureWritable(*allUncached.get(), type(), entry.values);
 
-    if (cachedDictionaryIndices_->size() < newCacheSize) {
-      cachedDictionaryIndices_->resize(newCacheSize, false);
+    if (entry.rows->size() < newCacheSize) {
+      entry.rows->resize(newCacheSize, false);
     }
 
-    cachedDictionaryIndices_->select(*uncached);
+    entry.rows->select(*uncached);
 
-    // Resize the dictionaryCache_ to accommodate all the necessary rows.
-    if (dictionaryCache_->size() < uncached->end()) {
-      dictionaryCache_->resize(uncached->end());
+    // Resize the cached values to accommodate all the necessary rows.
+    if (entry.values->size() < uncached->end()) {
+      entry.values->resize(uncached->end());
     }
-    dictionaryCache_->copy(result.get(), *uncached, nullptr);
+    entry.values->copy(result.get(), *uncached, nullptr);
   }
   context.releaseVector(base);
 }
@@ -1682,6 +1749,188 @@ common::Subfield extractSubfield(
   }
 }
 
+// Returns the map subscript for a non-null constant of a type usable as a map
+// key, or nullptr if 'expr' is not such a constant.
+std::unique_ptr<common::Subfield::PathElement> toSubscriptElement(
+    const Expr* expr) {
+  auto* constant = expr->as<ConstantExpr>();
+  if (!constant || constant->value()->isNullAt(0)) {
+    return nullptr;
+  }
+  auto& value = constant->value();
+  switch (value->typeKind()) {
+    case TypeKind::TINYINT:
+      return std::make_unique<common::Subfield::LongSubscript>(
+          value->as<ConstantVector<int8_t>>()->value());
+    case TypeKind::SMALLINT:
+      return std::make_unique<common::Subfield::LongSubscript>(
+          value->as<ConstantVector<int16_t>>()->value());
+    case TypeKind::INTEGER:
+      return std::make_unique<common::Subfield::LongSubscript>(
+          value->as<ConstantVector<int32_t>>()->value());
+    case TypeKind::BIGINT:
+      return std::make_unique<common::Subfield::LongSubscript>(
+          value->as<ConstantVector<int64_t>>()->value());
+    case TypeKind::VARCHAR:
+      return std::make_unique<common::Subfield::StringSubscript>(
+          value->as<ConstantVector<StringView>>()->value().str());
+    default:
+      return nullptr;
+  }
+}
+
+template <typename T>
+void appendLongSubscripts(
+    const VectorPtr& elements,
+    vector_size_t offset,
+    vector_size_t size,
+    std::vector<std::unique_ptr<common::Subfield::PathElement>>& keys) {
+  auto* vector = elements->as<SimpleVector<T>>();
+  if (!vector) {
+    return;
+  }
+  for (vector_size_t i = 0; i < size; ++i) {
+    if (!vector->isNullAt(offset + i)) {
+      keys.push_back(std::make_unique<common::Subfield::LongSubscript>(
+          vector->valueAt(offset + i)));
+    }
+  }
+}
+
+// Appends to 'keys' the constant map keys that 'expr' restricts the lambda
+// key parameter 'keyName' to.  Returns false if 'expr' may pass keys outside
+// the appended set.
+bool extractMapKeyRestriction(
+    const Expr* expr,
+    const std::string& keyName,
+    std::vector<std::unique_ptr<common::Subfield::PathElement>>& keys) {
+  auto isKeyReference = [&](const Expr* e) {
+    auto* ref = e->as<FieldReference>();
+    return ref != nullptr && ref->name() == keyName && ref->inputs().empty();
+  };
+  if (expr->name() == "eq" && expr->inputs().size() == 2) {
+    for (int i = 0; i < 2; ++i) {
+      if (isKeyReference(expr->inputs()[i].get())) {
+        if (auto key = toSubscriptElement(expr->inputs()[1 - i].get())) {
+          keys.push_back(std::move(key));
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+  if (expr->name() == "in" && expr->inputs().size() == 2 &&
+      isKeyReference(expr->inputs()[0].get())) {
+    auto* constant = expr->inputs()[1]->as<ConstantExpr>();
+    if (!constant || !constant->value()->type()->isArray()) {
+      return false;
+    }
+    auto* constVector = constant->value()->as<ConstantVector<ComplexType>>();
+    if (!constVector || constVector->isNullAt(0)) {
+      return false;
+    }
+    auto* arrayVector = constVector->valueVector()->as<ArrayVector>();
+    if (!arrayVector) {
+      return false;
+    }
+    auto index = constVector->index();
+    auto offset = arrayVector->offsetAt(index);
+    auto size = arrayVector->sizeAt(index);
+    auto& elements = arrayVector->elements();
+    switch (elements->typeKind()) {
+      case TypeKind::TINYINT:
+        appendLongSubscripts<int8_t>(elements, offset, size, keys);
+        break;
+      case TypeKind::SMALLINT:
+        appendLongSubscripts<int16_t>(elements, offset, size, keys);
+        break;
+      case TypeKind::INTEGER:
+        appendLongSubscripts<int32_t>(elements, offset, size, keys);
+        break;
+      case TypeKind::BIGINT:
+        appendLongSubscripts<int64_t>(elements, offset, size, keys);
+        break;
+      case TypeKind::VARCHAR: {
+        auto* strings = elements->as<SimpleVector<StringView>>();
+        if (!strings) {
+          return false;
+        }
+        for (vector_size_t i = 0; i < size; ++i) {
+          if (!strings->isNullAt(offset + i)) {
+            keys.push_back(std::make_unique<common::Subfield::StringSubscript>(
+                strings->valueAt(offset + i).str()));
+          }
+        }
+        break;
+      }
+      default:
+        return false;
+    }
+    return !keys.empty();
+  }
+  if (expr->name() == "or") {
+    // Keys passing a disjunction come from one of the branches, so all
+    // branches must be restricted.
+    for (auto& input : expr->inputs()) {
+      if (!extractMapKeyRestriction(input.get(), keyName, keys)) {
+        return false;
+      }
+    }
+    return !expr->inputs().empty();
+  }
+  if (expr->name() == "and") {
+    // Keys passing a conjunction pass every conjunct, so any restricted
+    // conjunct bounds the whole conjunction.
+    for (auto& input : expr->inputs()) {
+      std::vector<std::unique_ptr<common::Subfield::PathElement>> conjunctKeys;
+      if (extractMapKeyRestriction(input.get(), keyName, conjunctKeys)) {
+        for (auto& key : conjunctKeys) {
+          keys.push_back(std::move(key));
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+  return false;
+}
+
+// If 'expr' is a map_filter call whose lambda passes only a fixed set of
+// constant keys, adds one subfield per key for the map argument, so that a
+// scan needs to read just the keys the result can contain.  Subfields of the
+// lambda captures are added as well.  Returns false if 'expr' is not such a
+// call.
+bool extractMapFilterSubfields(
+    const Expr* expr,
+    folly::F14FastMap<std::string, int32_t>& shadowedNames,
+    std::vector<common::Subfield>& subfields) {
+  if (expr->name() != "map_filter" || expr->inputs().size() != 2) {
+    return false;
+  }
+  auto* lambda = expr->inputs()[1]->as<LambdaExpr>();
+  if (!lambda || lambda->signature()->size() != 2) {
+    return false;
+  }
+  auto mapSubfield = extractSubfield(expr->inputs()[0].get(), shadowedNames);
+  if (!mapSubfield.valid()) {
+    return false;
+  }
+  std::vector<std::unique_ptr<common::Subfield::PathElement>> keys;
+  if (!extractMapKeyRestriction(
+          lambda->body().get(), lambda->signature()->nameOf(0), keys)) {
+    return false;
+  }
+  for (auto& key : keys) {
+    auto subfield = mapSubfield.clone();
+    subfield.path().push_back(std::move(key));
+    subfields.push_back(std::move(subfield));
+  }
+  // Collect subfields of the columns captured by the lambda; the parameters
+  // are shadowed inside the body.
+  expr->inputs()[1]->extractSubfieldsImpl(&shadowedNames, &subfields);
+  return true;
+}
+
 } // namespace
 
 void Expr::extractSubfieldsImpl(
@@ -1692,6 +1941,9 @@ void Expr::extractSubfieldsImpl(
     subfields->push_back(std::move(subfield));
     return;
   }
+  if (extractMapFilterSubfields(this, *shadowedNames, *subfields)) {
+    return;
+  }
   for (auto& input : inputs_) {
     input->extractSubfieldsImpl(shadowedNames, subfields);
   }
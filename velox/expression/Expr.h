@@ -59,18 +59,25 @@ struct ExprStats {
   /// size.
   uint64_t numProcessedVectors{0};
 
+  /// Number of times a result computed for this expression was served from the
+  /// shared subexpression cache instead of being re-computed. Non-zero only
+  /// for expressions that appear multiple times within an ExprSet.
+  uint64_t numSharedSubexprReuses{0};
+
   void add(const ExprStats& other) {
     timing.add(other.timing);
     numProcessedRows += other.numProcessedRows;
     numProcessedVectors += other.numProcessedVectors;
+    numSharedSubexprReuses += other.numSharedSubexprReuses;
   }
 
   std::string toString() const {
     return fmt::format(
-        "timing: {}, numProcessedRows: {}, numProcessedVectors: {}",
+        "timing: {}, numProcessedRows: {}, numProcessedVectors: {}, numSharedSubexprReuses: {}",
         timing.toString(),
         numProcessedRows,
-        numProcessedVectors);
+        numProcessedVectors,
+        numSharedSubexprReuses);
   }
 };
 
@@ -251,12 +258,7 @@ class Expr {
   }
 
   void clearMemo() {
-    baseOfDictionaryRepeats_ = 0;
-    baseOfDictionary_.reset();
-    baseOfDictionaryWeakPtr_.reset();
-    baseOfDictionaryRawPtr_ = nullptr;
-    dictionaryCache_ = nullptr;
-    cachedDictionaryIndices_ = nullptr;
+    memoEntries_.clear();
   }
 
   const TypePtr& type() const {
@@ -600,28 +602,50 @@ class Expr {
   // evaluateSharedSubexpr() is called to the cached shared results.
   std::map<std::vector<const BaseVector*>, SharedResults> sharedSubexprResults_;
 
-  // Pointers to the last base vector of cachable dictionary input. Used to
-  // check if the current input's base vector is the same as the last. If it's
-  // the same, then results can be cached.
-  std::weak_ptr<BaseVector> baseOfDictionaryWeakPtr_;
-  BaseVector* baseOfDictionaryRawPtr_ = nullptr;
+  // Results cached for one dictionary base vector. See evalWithMemo().
+  struct MemoEntry {
+    // Pointers to the base vector the entry is for. The raw pointer is the
+    // lookup key; the weak pointer detects the base being destroyed and its
+    // address reused for another vector.
+    std::weak_ptr<BaseVector> baseWeakPtr;
+    BaseVector* baseRawPtr = nullptr;
+
+    // Strong reference to the base vector, only set once 'repeats' > 1 so
+    // that the vector is not modified and re-used in place.
+    VectorPtr base;
+
+    // Number of times the base was seen after the first. Results are cached
+    // only from the second sighting on, so that bases that never repeat cost
+    // no memory.
+    int repeats = 0;
+
+    // Values computed for the base, 1:1 to the positions in 'baseRawPtr'.
+    VectorPtr values;
+
+    // The indices that are valid in 'values'.
+    std::unique_ptr<SelectivityVector> rows;
+  };
+
+  // Maximum number of dictionary bases with cached results.
+  static constexpr int32_t kMaxMemoEntries = 4;
 
-  // This is a strong reference to the base vector and is only set if
-  // `baseOfDictionaryRepeats_` > 1. This is to ensure that the vector held is
-  // not modified and re-used in-place.
-  VectorPtr baseOfDictionary_;
+  // Number of evalWithMemo() calls after which memoization is disabled if
+  // fewer than one in kMemoMinHitRate of them found a cached base.
+  static constexpr int32_t kMemoHitRateCheckThreshold = 64;
+  static constexpr int32_t kMemoMinHitRate = 4;
 
-  // Number of times currently held cacheable vector is seen for a non-first
-  // time. Is reset everytime 'baseOfDictionaryRawPtr_' is different from the
-  // current input's base.
-  int baseOfDictionaryRepeats_ = 0;
+  // Cached results for recently seen dictionary bases, most recently used
+  // first. At most kMaxMemoEntries entries.
+  std::vector<MemoEntry> memoEntries_;
 
-  // Values computed for the base dictionary, 1:1 to the positions in
-  // 'baseOfDictionaryRawPtr_'.
-  VectorPtr dictionaryCache_;
+  // Number of evalWithMemo() calls and how many of them found the base in
+  // 'memoEntries_'. Used to turn memoization off for expressions whose bases
+  // do not repeat.
+  int32_t memoLookups_ = 0;
+  int32_t memoHits_ = 0;
 
-  // The indices that are valid in 'dictionaryCache_'.
-  std::unique_ptr<SelectivityVector> cachedDictionaryIndices_;
+  // True once the memo hit rate proved too low. Stops further memoization.
+  bool memoUnproductive_ = false;
 
   /// Runtime statistics. CPU time, wall time and number of processed rows.
   ExprStats stats_;
@@ -48,6 +48,15 @@ class LambdaExpr : public SpecialForm {
     return false;
   }
 
+  /// Names and types of the lambda parameters.
+  const RowTypePtr& signature() const {
+    return signature_;
+  }
+
+  const ExprPtr& body() const {
+    return body_;
+  }
+
   std::string toString(bool recursive = true) const override;
 
   std::string toSql(
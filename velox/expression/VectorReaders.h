@@ -352,6 +352,13 @@ struct VectorReader<Map<K, V>> {
 
     keysMayHaveNulls_ = keyReader_.mayHaveNullsRecursive();
     valuesMayHaveNulls_ = valReader_.mayHaveNullsRecursive();
+    if ((*keysMayHaveNulls_ || *valuesMayHaveNulls_) &&
+        !vector_.mayHaveNullsRecursive()) {
+      // The keys and values rows referenced by 'vector_' are null-free even
+      // though the child vectors carry null buffers, e.g. after slicing.
+      keysMayHaveNulls_ = false;
+      valuesMayHaveNulls_ = false;
+    }
   }
 
   const BaseVector* baseVector() const {
@@ -441,6 +448,11 @@ struct VectorReader<Array<V>> {
     childReader_.setChildrenMayHaveNulls();
 
     valuesMayHaveNulls_ = childReader_.mayHaveNullsRecursive();
+    if (*valuesMayHaveNulls_ && !vector_.mayHaveNullsRecursive()) {
+      // The element rows referenced by 'vector_' are null-free even though
+      // the elements vector carries a null buffer, e.g. after slicing.
+      valuesMayHaveNulls_ = false;
+    }
   }
 
   const BaseVector* baseVector() const {
@@ -509,6 +509,21 @@ TEST_F(CastExprTest, basics) {
       {"1.888", "2.5", "3.6", "100.44", "-100.101", "1", "-2"});
 }
 
+TEST_F(CastExprTest, integerToString) {
+  // Boundary values exercise the widest outputs of the integer-to-string fast
+  // path.
+  testCast<int8_t, std::string>(
+      "string", {0, 127, -128}, {"0", "127", "-128"});
+  testCast<int16_t, std::string>(
+      "string", {32767, -32768}, {"32767", "-32768"});
+  testCast<int32_t, std::string>(
+      "string", {2147483647, -2147483648}, {"2147483647", "-2147483648"});
+  testCast<int64_t, std::string>(
+      "string",
+      {9223372036854775807LL, std::numeric_limits<int64_t>::min()},
+      {"9223372036854775807", "-9223372036854775808"});
+}
+
 TEST_F(CastExprTest, stringToTimestamp) {
   std::vector<std::optional<std::string>> input{
       "1970-01-01",
@@ -444,6 +444,45 @@ TEST_P(ParameterizedExprTest, reorder) {
   }
 }
 
+TEST_P(ParameterizedExprTest, reorderCachedAcrossExprSets) {
+  constexpr int32_t kTestSize = 20'000;
+
+  auto data = makeRowVector(
+      {makeFlatVector<int64_t>(kTestSize, [](auto row) { return row; })});
+  // Use constants not used by other tests so that this conjunct gets its own
+  // entry in the process-wide learned order cache.
+  const std::string expression = "if (c0 % 411 < 300 and c0 % 107 < 30, 1, 2)";
+  auto exprSet = compileExpression(expression, asRowType(data->type()));
+  evaluate(exprSet.get(), data);
+
+  auto condition = std::dynamic_pointer_cast<exec::ConjunctExpr>(
+      exprSet->expr(0)->inputs()[0]);
+  ASSERT_TRUE(condition != nullptr);
+  // The more selective second input is evaluated first after adaptation.
+  ASSERT_EQ(condition->testingInputOrder()[0], 1);
+
+  // Destroying the ExprSet publishes the learned order.
+  condition.reset();
+  exprSet.reset();
+
+  // A new ExprSet for the same expression starts with the learned order: on
+  // a batch where every row fails the second input, the first input never
+  // sees a row.
+  auto failSecond = makeRowVector({makeFlatVector<int64_t>(
+      1'000, [](auto /*row*/) { return 40; })}); // 40 % 107 >= 30.
+  exprSet = compileExpression(expression, asRowType(data->type()));
+  evaluate(exprSet.get(), failSecond);
+
+  condition = std::dynamic_pointer_cast<exec::ConjunctExpr>(
+      exprSet->expr(0)->inputs()[0]);
+  ASSERT_TRUE(condition != nullptr);
+  const auto& order = condition->testingInputOrder();
+  for (auto i = 0; i < condition->inputs().size(); ++i) {
+    EXPECT_EQ(
+        condition->selectivityAt(i).numIn(), order[i] == 1 ? 1'000 : 0);
+  }
+}
+
 TEST_P(ParameterizedExprTest, constant) {
   auto exprSet = compileExpression("1 + 2 + 3 + 4", ROW({}));
   auto constExpr = dynamic_cast<exec::ConstantExpr*>(exprSet->expr(0).get());
@@ -2132,11 +2171,46 @@ TEST_F(ExprTest, memo) {
   VELOX_CHECK(base.unique());
 }
 
+TEST_F(ExprTest, memoMultipleBases) {
+  // Results are cached for several recently seen bases, so input batches
+  // alternating between stable bases stay memoized.
+  auto makeBase = [&](int64_t offset) {
+    return makeArrayVector<int64_t>(
+        1'000,
+        [](auto row) { return row % 5 + 1; },
+        [offset](auto row, auto index) { return (row % 3) + index + offset; });
+  };
+  auto base1 = makeBase(0);
+  auto base2 = makeBase(1);
+
+  auto indices = makeIndices(100, [](auto row) { return row * 2; });
+
+  auto rowType = ROW({"c0"}, {base1->type()});
+  auto exprSet = compileExpression("c0[1] = 1", rowType);
+
+  // Each base evaluates all rows on its first two sightings (results are
+  // cached from the second one) and none afterwards.
+  std::vector<int64_t> expectedProcessed = {100, 200, 300, 400, 400, 400};
+  int32_t evalIndex = 0;
+  for (auto repeat = 0; repeat < 3; ++repeat) {
+    for (auto offset : {0, 1}) {
+      const auto& base = offset == 0 ? base1 : base2;
+      auto [result, stats] = evaluateWithStats(
+          exprSet.get(), makeRowVector({wrapInDictionary(indices, 100, base)}));
+      auto expectedResult = makeFlatVector<bool>(
+          100, [&](auto row) { return (row * 2) % 3 + offset == 1; });
+      assertEqualVectors(expectedResult, result);
+      VELOX_CHECK_EQ(
+          stats["eq"].numProcessedRows, expectedProcessed[evalIndex++]);
+    }
+  }
+}
+
 // This test triggers the situation when peelEncodings() produces an empty
 // selectivity vector, which if passed to evalWithMemo() causes the latter to
-// produce null Expr::dictionaryCache_, which leads to a crash in evaluation
-// of subsequent rows. We have fixed that issue with condition and this test
-// is for that.
+// produce a memo entry with null cached values, which leads to a crash in
+// evaluation of subsequent rows. We have fixed that issue with condition and
+// this test is for that.
 TEST_P(ParameterizedExprTest, memoNulls) {
   // Generate 5 rows with null string and 5 with a string.
   auto base = makeFlatVector<StringView>(
@@ -4254,6 +4328,21 @@ TEST_P(ParameterizedExprTest, extractSubfields) {
   validate("c0[1].c0c1['foo'] > 0", {"c0[1].c0c1[\"foo\"]"});
   validate("c0[1].c0c0[c1[1]] > 0", {"c0[1].c0c0", "c1[1]"});
   validate("element_at(c1, -1)", {"c1"});
+  validate("element_at(c0[1].c0c0, 42)", {"c0[1].c0c0[42]"});
+  validate("element_at(c0[1].c0c1, 'foo')", {"c0[1].c0c1[\"foo\"]"});
+  validate("element_at(c0[1].c0c0, c3)", {"c0[1].c0c0", "c3"});
+  validate(
+      "map_filter(c0[1].c0c1, (k, v) -> k = 'foo')", {"c0[1].c0c1[\"foo\"]"});
+  validate(
+      "map_filter(c0[1].c0c0, (k, v) -> k = 1 or k = 2)",
+      {"c0[1].c0c0[1]", "c0[1].c0c0[2]"});
+  validate(
+      "map_filter(c0[1].c0c1, (k, v) -> k in ('bar', 'foo') and v > 0)",
+      {"c0[1].c0c1[\"bar\"]", "c0[1].c0c1[\"foo\"]"});
+  validate(
+      "map_filter(c0[1].c0c0, (k, v) -> k = 1 and v > c3)",
+      {"c0[1].c0c0[1]", "c3"});
+  validate("map_filter(c0[1].c0c0, (k, v) -> v > 0)", {"c0[1].c0c0"});
   validate("transform(c0, x -> x.c0c0[0] + c1[1])", {"c0", "c1[1]"});
   validate("transform(c0, c1 -> c1.c0c0[0])", {"c0"});
   validate("reduce(c1, 0, (c0, c3) -> c0 + c3, c2 -> c2)", {"c1"});
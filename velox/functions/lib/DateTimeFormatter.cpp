@@ -925,11 +925,103 @@ void parseFromPattern(
   }
 }
 
+// Appends 'value' to 'position' in decimal, padded with '0's in front up to
+// 'minWidth' digits (not counting the sign). Returns the position right after
+// the written bytes. Mirrors padContent() without making a temporary string.
+char* appendPaddedInteger(int64_t value, size_t minWidth, char* position) {
+  if (value < 0) {
+    *position++ = '-';
+    value = -value;
+  }
+  char digits[20];
+  size_t numDigits = 0;
+  do {
+    digits[numDigits++] = '0' + value % 10;
+    value /= 10;
+  } while (value != 0);
+  for (auto i = numDigits; i < minWidth; ++i) {
+    *position++ = '0';
+  }
+  while (numDigits > 0) {
+    *position++ = digits[--numDigits];
+  }
+  return position;
+}
+
+char* appendString(const std::string_view& piece, char* position) {
+  std::memcpy(position, piece.data(), piece.size());
+  return position + piece.size();
+}
+
 } // namespace
 
-std::string DateTimeFormatter::format(
-    const Timestamp& timestamp,
+uint32_t DateTimeFormatter::maxResultSize(
     const date::time_zone* timezone) const {
+  uint32_t size = 0;
+  for (const auto& token : tokens_) {
+    if (token.type == DateTimeToken::Type::kLiteral) {
+      size += token.literal.size();
+      continue;
+    }
+    const auto minDigits = token.pattern.minRepresentDigits;
+    switch (token.pattern.specifier) {
+      case DateTimeFormatSpecifier::ERA:
+      case DateTimeFormatSpecifier::HALFDAY_OF_DAY:
+        size += 2;
+        break;
+      case DateTimeFormatSpecifier::CENTURY_OF_ERA:
+        // Century of the maximum representable year has 7 digits.
+        size += std::max<uint32_t>(minDigits, 7);
+        break;
+      case DateTimeFormatSpecifier::YEAR_OF_ERA:
+      case DateTimeFormatSpecifier::YEAR:
+        // The year can take up to 9 digits plus a sign.
+        size += minDigits == 2 ? 2 : std::max<uint32_t>(minDigits, 9) + 1;
+        break;
+      case DateTimeFormatSpecifier::DAY_OF_WEEK_0_BASED:
+      case DateTimeFormatSpecifier::DAY_OF_WEEK_1_BASED:
+        size += std::max<uint32_t>(minDigits, 1);
+        break;
+      case DateTimeFormatSpecifier::DAY_OF_WEEK_TEXT:
+      case DateTimeFormatSpecifier::MONTH_OF_YEAR_TEXT:
+        // Longest are "Wednesday" and "September".
+        size += 9;
+        break;
+      case DateTimeFormatSpecifier::DAY_OF_YEAR:
+        size += std::max<uint32_t>(minDigits, 3);
+        break;
+      case DateTimeFormatSpecifier::MONTH_OF_YEAR:
+      case DateTimeFormatSpecifier::DAY_OF_MONTH:
+      case DateTimeFormatSpecifier::HOUR_OF_HALFDAY:
+      case DateTimeFormatSpecifier::CLOCK_HOUR_OF_HALFDAY:
+      case DateTimeFormatSpecifier::HOUR_OF_DAY:
+      case DateTimeFormatSpecifier::CLOCK_HOUR_OF_DAY:
+      case DateTimeFormatSpecifier::MINUTE_OF_HOUR:
+      case DateTimeFormatSpecifier::SECOND_OF_MINUTE:
+        size += std::max<uint32_t>(minDigits, 2);
+        break;
+      case DateTimeFormatSpecifier::FRACTION_OF_SECOND:
+        size += std::max<uint32_t>(minDigits, 3);
+        break;
+      case DateTimeFormatSpecifier::TIMEZONE:
+        if (timezone != nullptr) {
+          size += timezone->name().size();
+        }
+        break;
+      default:
+        VELOX_UNSUPPORTED(
+            "format is not supported for specifier {}",
+            token.pattern.specifier);
+    }
+  }
+  return size;
+}
+
+int32_t DateTimeFormatter::format(
+    const Timestamp& timestamp,
+    const date::time_zone* timezone,
+    const uint32_t maxResultSize,
+    char* result) const {
   Timestamp t = timestamp;
   if (timezone != nullptr) {
     t.toTimezone(*timezone);
@@ -941,30 +1033,33 @@ std::string DateTimeFormatter::format(
   const date::year_month_day calDate(daysTimePoint);
   const date::weekday weekday(daysTimePoint);
 
-  std::string result;
+  const char* resultStart = result;
   for (auto& token : tokens_) {
     if (token.type == DateTimeToken::Type::kLiteral) {
-      result += token.literal;
+      result = appendString(token.literal, result);
     } else {
       switch (token.pattern.specifier) {
         case DateTimeFormatSpecifier::ERA:
-          result += static_cast<signed>(calDate.year()) > 0 ? "AD" : "BC";
+          result = appendString(
+              static_cast<signed>(calDate.year()) > 0 ? "AD" : "BC", result);
           break;
 
         case DateTimeFormatSpecifier::CENTURY_OF_ERA: {
           auto year = static_cast<signed>(calDate.year());
           year = (year < 0 ? -year : year);
           auto century = year / 100;
-          result += padContent(century, '0', token.pattern.minRepresentDigits);
+          result = appendPaddedInteger(
+              century, token.pattern.minRepresentDigits, result);
         } break;
 
         case DateTimeFormatSpecifier::YEAR_OF_ERA: {
           auto year = static_cast<signed>(calDate.year());
           if (token.pattern.minRepresentDigits == 2) {
-            result += padContent(std::abs(year) % 100, '0', 2);
+            result = appendPaddedInteger(std::abs(year) % 100, 2, result);
           } else {
             year = year <= 0 ? std::abs(year - 1) : year;
-            result += padContent(year, '0', token.pattern.minRepresentDigits);
+            result = appendPaddedInteger(
+                year, token.pattern.minRepresentDigits, result);
           }
         } break;
 
@@ -976,31 +1071,27 @@ std::string DateTimeFormatter::format(
                   DateTimeFormatSpecifier::DAY_OF_WEEK_1_BASED) {
             weekdayNum = 7;
           }
-          result +=
-              padContent(weekdayNum, '0', token.pattern.minRepresentDigits);
+          result = appendPaddedInteger(
+              weekdayNum, token.pattern.minRepresentDigits, result);
         } break;
 
         case DateTimeFormatSpecifier::DAY_OF_WEEK_TEXT: {
           auto weekdayNum = weekday.c_encoding();
-          if (token.pattern.minRepresentDigits <= 3) {
-            result += weekdaysShort[weekdayNum];
-          } else {
-            result += weekdaysFull[weekdayNum];
-          }
+          result = appendString(
+              token.pattern.minRepresentDigits <= 3 ? weekdaysShort[weekdayNum]
+                                                    : weekdaysFull[weekdayNum],
+              result);
         } break;
 
         case DateTimeFormatSpecifier::YEAR: {
           auto year = static_cast<signed>(calDate.year());
           if (token.pattern.minRepresentDigits == 2) {
             year = std::abs(year);
-            auto twoDigitYear = year % 100;
-            result +=
-                padContent(twoDigitYear, '0', token.pattern.minRepresentDigits);
+            result = appendPaddedInteger(
+                year % 100, token.pattern.minRepresentDigits, result);
           } else {
-            result += padContent(
-                static_cast<signed>(calDate.year()),
-                '0',
-                token.pattern.minRepresentDigits);
+            result = appendPaddedInteger(
+                year, token.pattern.minRepresentDigits, result);
           }
         } break;
 
@@ -1011,33 +1102,35 @@ std::string DateTimeFormatter::format(
               (date::sys_days{calDate} - date::sys_days{firstDayOfTheYear})
                   .count();
           delta += 1;
-          result += padContent(delta, '0', token.pattern.minRepresentDigits);
+          result = appendPaddedInteger(
+              delta, token.pattern.minRepresentDigits, result);
         } break;
 
         case DateTimeFormatSpecifier::MONTH_OF_YEAR:
-          result += padContent(
+          result = appendPaddedInteger(
               static_cast<unsigned>(calDate.month()),
-              '0',
-              token.pattern.minRepresentDigits);
+              token.pattern.minRepresentDigits,
+              result);
           break;
 
-        case DateTimeFormatSpecifier::MONTH_OF_YEAR_TEXT:
-          if (token.pattern.minRepresentDigits <= 3) {
-            result += monthsShort[static_cast<unsigned>(calDate.month()) - 1];
-          } else {
-            result += monthsFull[static_cast<unsigned>(calDate.month()) - 1];
-          }
-          break;
+        case DateTimeFormatSpecifier::MONTH_OF_YEAR_TEXT: {
+          auto month = static_cast<unsigned>(calDate.month()) - 1;
+          result = appendString(
+              token.pattern.minRepresentDigits <= 3 ? monthsShort[month]
+                                                    : monthsFull[month],
+              result);
+        } break;
 
         case DateTimeFormatSpecifier::DAY_OF_MONTH:
-          result += padContent(
+          result = appendPaddedInteger(
               static_cast<unsigned>(calDate.day()),
-              '0',
-              token.pattern.minRepresentDigits);
+              token.pattern.minRepresentDigits,
+              result);
           break;
 
         case DateTimeFormatSpecifier::HALFDAY_OF_DAY:
-          result += durationInTheDay.hours().count() < 12 ? "AM" : "PM";
+          result = appendString(
+              durationInTheDay.hours().count() < 12 ? "AM" : "PM", result);
           break;
 
         case DateTimeFormatSpecifier::HOUR_OF_HALFDAY:
@@ -1057,29 +1150,31 @@ std::string DateTimeFormatter::format(
               DateTimeFormatSpecifier::CLOCK_HOUR_OF_DAY) {
             hourNum = (hourNum + 23) % 24 + 1;
           }
-          result += padContent(hourNum, '0', token.pattern.minRepresentDigits);
+          result = appendPaddedInteger(
+              hourNum, token.pattern.minRepresentDigits, result);
         } break;
 
         case DateTimeFormatSpecifier::MINUTE_OF_HOUR:
-          result += padContent(
+          result = appendPaddedInteger(
               durationInTheDay.minutes().count() % 60,
-              '0',
-              token.pattern.minRepresentDigits);
+              token.pattern.minRepresentDigits,
+              result);
           break;
 
         case DateTimeFormatSpecifier::SECOND_OF_MINUTE:
-          result += padContent(
+          result = appendPaddedInteger(
               durationInTheDay.seconds().count() % 60,
-              '0',
-              token.pattern.minRepresentDigits);
+              token.pattern.minRepresentDigits,
+              result);
           break;
 
-        case DateTimeFormatSpecifier::FRACTION_OF_SECOND: {
-          result += formatFractionOfSecond(
-              durationInTheDay.subseconds().count(),
-              token.pattern.minRepresentDigits);
+        case DateTimeFormatSpecifier::FRACTION_OF_SECOND:
+          result = appendString(
+              formatFractionOfSecond(
+                  durationInTheDay.subseconds().count(),
+                  token.pattern.minRepresentDigits),
+              result);
           break;
-        }
 
         case DateTimeFormatSpecifier::TIMEZONE:
           // TODO: implement short name time zone, need a map from full name to
@@ -1090,7 +1185,7 @@ std::string DateTimeFormatter::format(
           if (timezone == nullptr) {
             VELOX_USER_FAIL("Timezone unknown")
           }
-          result += timezone->name();
+          result = appendString(timezone->name(), result);
           break;
 
         case DateTimeFormatSpecifier::TIMEZONE_OFFSET_ID:
@@ -1105,6 +1200,19 @@ std::string DateTimeFormatter::format(
       }
     }
   }
+  const auto resultSize = result - resultStart;
+  VELOX_CHECK_LE(
+      resultSize, maxResultSize, "Bad allocation size for formatted result.");
+  return resultSize;
+}
+
+std::string DateTimeFormatter::format(
+    const Timestamp& timestamp,
+    const date::time_zone* timezone) const {
+  const auto maxSize = maxResultSize(timezone);
+  std::string result(maxSize, '\0');
+  const auto size = format(timestamp, timezone, maxSize, result.data());
+  result.resize(size);
   return result;
 }
 
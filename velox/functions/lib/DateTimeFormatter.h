@@ -175,6 +175,19 @@ class DateTimeFormatter {
 
   DateTimeResult parse(const std::string_view& input) const;
 
+  /// Returns an upper bound on the number of bytes format() can produce for
+  /// this formatter, so the caller can size the result buffer once per batch
+  /// and format in place.
+  uint32_t maxResultSize(const date::time_zone* timezone) const;
+
+  /// Formats 'timestamp' into 'result', which must provide at least
+  /// 'maxResultSize' writable bytes. Returns the number of bytes written.
+  int32_t format(
+      const Timestamp& timestamp,
+      const date::time_zone* timezone,
+      const uint32_t maxResultSize,
+      char* result) const;
+
   std::string format(
       const Timestamp& timestamp,
       const date::time_zone* timezone) const;
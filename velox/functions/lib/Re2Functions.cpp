@@ -16,9 +16,11 @@
 #include "velox/functions/lib/Re2Functions.h"
 
 #include <re2/re2.h>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include "velox/expression/VectorWriters.h"
 #include "velox/type/StringView.h"
@@ -181,11 +183,121 @@ std::string likePatternToRe2(
   return regex;
 }
 
+// Extracts a literal substring that any string matching 'pattern' must
+// contain. Used to cheaply skip rows before running RE2: most rows of, say,
+// log data do not contain the literal at all and memchr-style search is much
+// faster than the regex engine. Returns the longest required literal run, or
+// an empty string when none can be determined. Conservative by design: bails
+// out on alternation, groups and \Q quoting, where a literal may turn out to
+// be optional, and never includes a quantified atom in the returned literal.
+std::string extractRequiredLiteral(StringView pattern) {
+  std::string current;
+  std::string best;
+  auto commit = [&]() {
+    if (current.size() > best.size()) {
+      best = current;
+    }
+    current.clear();
+  };
+  const char* p = pattern.data();
+  const char* const end = p + pattern.size();
+  while (p < end) {
+    switch (*p) {
+      case '|':
+      case '(':
+      case ')':
+        // Alternation can match without any literal; a group may be
+        // quantified as a whole, making its contents optional.
+        return "";
+      case '\\':
+        if (++p == end) {
+          return "";
+        }
+        if (*p == 'Q') {
+          // \Q...\E quoting switches the syntax. Too rare to bother.
+          return "";
+        }
+        if (std::strchr("\\|^$.*+?()[]{}-", *p) != nullptr) {
+          // An escaped metacharacter is a literal.
+          current.push_back(*p++);
+        } else {
+          // A class shorthand or an assertion, e.g. \d or \b.
+          commit();
+          ++p;
+        }
+        break;
+      case '[':
+        // Skip the character class.
+        commit();
+        ++p;
+        if (p < end && *p == '^') {
+          ++p;
+        }
+        if (p < end && *p == ']') {
+          ++p;
+        }
+        while (p < end && *p != ']') {
+          if (*p == '\\') {
+            ++p;
+          }
+          ++p;
+        }
+        if (p == end) {
+          return "";
+        }
+        ++p;
+        break;
+      case '*':
+      case '?':
+        // The previous atom is optional.
+        if (!current.empty()) {
+          current.pop_back();
+        }
+        commit();
+        ++p;
+        break;
+      case '{':
+        // Treat any counted repetition like '*'. A lower bound of one would
+        // keep the atom required but could not extend the literal run.
+        if (!current.empty()) {
+          current.pop_back();
+        }
+        commit();
+        while (p < end && *p != '}') {
+          ++p;
+        }
+        if (p == end) {
+          return "";
+        }
+        ++p;
+        break;
+      case '+':
+        // At least one occurrence is required but the repetition breaks the
+        // literal run after the atom.
+        commit();
+        ++p;
+        break;
+      case '.':
+      case '^':
+      case '$':
+        commit();
+        ++p;
+        break;
+      default:
+        current.push_back(*p++);
+    }
+  }
+  commit();
+  return best;
+}
+
 template <bool (*Fn)(StringView, const RE2&)>
 class Re2MatchConstantPattern final : public VectorFunction {
  public:
   explicit Re2MatchConstantPattern(StringView pattern)
-      : re_(toStringPiece(pattern), RE2::Quiet) {}
+      : re_(toStringPiece(pattern), RE2::Quiet),
+        requiredLiteral_(
+            re_.ok() ? extractRequiredLiteral(pattern) : std::string()) {}
 
   void apply(
       const SelectivityVector& rows,
@@ -204,12 +316,22 @@ class Re2MatchConstantPattern final : public VectorFunction {
     }
 
     context.applyToSelectedNoThrow(rows, [&](vector_size_t i) {
-      result.set(i, Fn(toSearch->valueAt<StringView>(i), re_));
+      const auto str = toSearch->valueAt<StringView>(i);
+      // A string that does not contain the required literal cannot match;
+      // skip the regex engine for it.
+      if (!requiredLiteral_.empty() &&
+          std::string_view(str.data(), str.size()).find(requiredLiteral_) ==
+              std::string_view::npos) {
+        result.set(i, false);
+        return;
+      }
+      result.set(i, Fn(str, re_));
     });
   }
 
  private:
   RE2 re_;
+  const std::string requiredLiteral_;
 };
 
 template <bool (*Fn)(StringView, const RE2&)>
@@ -416,6 +538,23 @@ bool matchSuffixPattern(
           length) == 0;
 }
 
+// Match string 'input' if it contains the fixed pattern of 'length'
+// characters which starts after the leading '%' run of 'pattern'. Byte-level
+// search is exact for valid UTF-8 since the fixed pattern starts with a lead
+// byte which cannot occur in the middle of another character.
+bool matchSubstringPattern(
+    StringView input,
+    StringView pattern,
+    vector_size_t length) {
+  vector_size_t start = 0;
+  while (pattern.data()[start] == '%') {
+    ++start;
+  }
+  return input.size() >= length &&
+      memmem(input.data(), input.size(), pattern.data() + start, length) !=
+      nullptr;
+}
+
 template <PatternKind P>
 class OptimizedLikeWithMemcmp final : public VectorFunction {
  public:
@@ -439,6 +578,8 @@ class OptimizedLikeWithMemcmp final : public VectorFunction {
         return matchPrefixPattern(input, pattern, reducedPatternLength);
       case PatternKind::kSuffix:
         return matchSuffixPattern(input, pattern, reducedPatternLength);
+      case PatternKind::kSubstring:
+        return matchSubstringPattern(input, pattern, reducedPatternLength);
     }
   }
 
@@ -605,6 +746,9 @@ class LikeGeneric final : public VectorFunction {
           case PatternKind::kSuffix:
             return OptimizedLikeWithMemcmp<PatternKind::kSuffix>::match(
                 input, pattern, reducedLength);
+          case PatternKind::kSubstring:
+            return OptimizedLikeWithMemcmp<PatternKind::kSubstring>::match(
+                input, pattern, reducedLength);
           default:
             return applyWithRegex(input, pattern, escapeChar);
         }
@@ -965,6 +1109,9 @@ std::pair<PatternKind, vector_size_t> determinePatternKind(StringView pattern) {
   vector_size_t i = 0;
   // Index of the first % or _ character.
   vector_size_t wildcardStart = -1;
+  // Index of the first character of a second wildcard stream following the
+  // fixed pattern, if any.
+  vector_size_t secondWildcardStart = -1;
   // Index of the first character that is not % and not _.
   vector_size_t fixedPatternStart = -1;
   // Total number of % characters.
@@ -975,14 +1122,18 @@ std::pair<PatternKind, vector_size_t> determinePatternKind(StringView pattern) {
 
   while (i < patternLength) {
     if (patternStr[i] == '%' || patternStr[i] == '_') {
-      // Ensures that pattern has a single contiguous stream of wildcard
-      // characters.
+      // Ensures that pattern has at most two contiguous streams of wildcard
+      // characters, the second one only directly following the fixed pattern.
       if (wildcardStart != -1) {
-        return std::make_pair(PatternKind::kGeneric, 0);
+        if (fixedPatternStart == -1 || secondWildcardStart != -1) {
+          return std::make_pair(PatternKind::kGeneric, 0);
+        }
+        secondWildcardStart = i;
+      } else {
+        wildcardStart = i;
       }
       // Look till the last contiguous wildcard character, starting from this
       // index, is found, or the end of pattern is reached.
-      wildcardStart = i;
       while (i < patternLength &&
              (patternStr[i] == '%' || patternStr[i] == '_')) {
         singleCharacterWildcardCount += (patternStr[i] == '_');
@@ -1019,6 +1170,11 @@ std::pair<PatternKind, vector_size_t> determinePatternKind(StringView pattern) {
   if (singleCharacterWildcardCount) {
     return {PatternKind::kGeneric, 0};
   }
+  // Fixed pattern preceded and followed by '%' wildcard streams, such as
+  // '%foo%'.
+  if (secondWildcardStart != -1) {
+    return {PatternKind::kSubstring, secondWildcardStart - fixedPatternStart};
+  }
   // Classify pattern as prefix pattern or suffix pattern based on the
   // positions of the fixed pattern and contiguous wildcard character stream.
   if (fixedPatternStart < wildcardStart) {
@@ -1090,6 +1246,10 @@ std::shared_ptr<exec::VectorFunction> makeLike(
       case PatternKind::kSuffix:
         return std::make_shared<OptimizedLikeWithMemcmp<PatternKind::kSuffix>>(
             pattern, reducedLength);
+      case PatternKind::kSubstring:
+        return std::make_shared<
+            OptimizedLikeWithMemcmp<PatternKind::kSubstring>>(
+            pattern, reducedLength);
       default:
 
         return std::make_shared<LikeWithRe2>(pattern, escapeChar);
@@ -39,6 +39,9 @@ enum class PatternKind {
   kPrefix,
   /// Fixed pattern preceded by one or more '%', such as '%foo', '%%%hello'.
   kSuffix,
+  /// Fixed pattern preceded and followed by one or more '%', such as '%foo%',
+  /// '%%hello%'.
+  kSubstring,
   /// Patterns which do not fit any of the above types, such as 'hello_world',
   /// '_presto%'.
   kGeneric,
@@ -99,9 +102,9 @@ std::shared_ptr<exec::VectorFunction> makeRe2Extract(
 std::vector<std::shared_ptr<exec::FunctionSignature>> re2ExtractSignatures();
 
 /// Return the pair {pattern kind, length of the fixed pattern} for fixed,
-/// prefix, and suffix patterns. Return the pair {pattern kind, number of '_'
-/// characters} for patterns with wildcard characters only. Return
-/// {kGenericPattern, 0} for generic patterns).
+/// prefix, suffix, and substring patterns. Return the pair {pattern kind,
+/// number of '_' characters} for patterns with wildcard characters only.
+/// Return {kGenericPattern, 0} for generic patterns).
 std::pair<PatternKind, vector_size_t> determinePatternKind(StringView pattern);
 
 std::shared_ptr<exec::VectorFunction> makeLike(
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/functions/lib/ZeroCopyArrayBuilder.h"
+
+namespace facebook::velox::functions {
+
+ZeroCopyArrayBuilder::ZeroCopyArrayBuilder(
+    const ArrayVector& input,
+    vector_size_t numRows,
+    vector_size_t maxElements,
+    memory::MemoryPool* pool)
+    : input_(input),
+      numRows_(numRows),
+      pool_(pool),
+      indices_(allocateIndices(maxElements, pool)),
+      sizes_(allocateSizes(numRows, pool)),
+      offsets_(allocateOffsets(numRows, pool)),
+      rawIndices_(indices_->asMutable<vector_size_t>()),
+      rawSizes_(sizes_->asMutable<vector_size_t>()),
+      rawOffsets_(offsets_->asMutable<vector_size_t>()) {}
+
+ArrayVectorPtr ZeroCopyArrayBuilder::build() {
+  indices_->setSize(cursor_ * sizeof(vector_size_t));
+  VectorPtr elements = input_.elements();
+  auto newElements =
+      BaseVector::transpose(std::move(indices_), std::move(elements));
+  return std::make_shared<ArrayVector>(
+      pool_,
+      input_.type(),
+      nullptr,
+      numRows_,
+      std::move(offsets_),
+      std::move(sizes_),
+      std::move(newElements));
+}
+
+} // namespace facebook::velox::functions
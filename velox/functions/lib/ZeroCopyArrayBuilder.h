@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Range.h>
+
+#include "velox/vector/ComplexVector.h"
+
+namespace facebook::velox::functions {
+
+/// Builds an ARRAY vector whose arrays hold a per row subset of the elements
+/// of an input ARRAY vector without copying the elements. Element indices
+/// appended for each row become dictionary indices into the input's elements
+/// vector, so the result shares the element data with the input. Used by
+/// functions like array_distinct() that return some of each input array's
+/// elements:
+///
+///   ZeroCopyArrayBuilder builder(
+///       *arrayVector, numRows, elementsCount, context.pool());
+///   rows.applyToSelected([&](vector_size_t row) {
+///     builder.startRow(row);
+///     for (...) {
+///       builder.addElement(i);
+///     }
+///     builder.finishRow(row);
+///   });
+///   return builder.build();
+class ZeroCopyArrayBuilder {
+ public:
+  /// 'maxElements' is an upper bound on the total number of elements added
+  /// over all rows, typically the size of the input's elements vector.
+  ZeroCopyArrayBuilder(
+      const ArrayVector& input,
+      vector_size_t numRows,
+      vector_size_t maxElements,
+      memory::MemoryPool* pool);
+
+  /// Starts the array at 'row'. Rows must be started in increasing order.
+  void startRow(vector_size_t row) {
+    rawOffsets_[row] = cursor_;
+  }
+
+  /// Appends the element at 'index' in the input's elements vector to the
+  /// last started row.
+  void addElement(vector_size_t index) {
+    rawIndices_[cursor_++] = index;
+  }
+
+  /// Ends the array at the previously started 'row'.
+  void finishRow(vector_size_t row) {
+    rawSizes_[row] = cursor_ - rawOffsets_[row];
+  }
+
+  /// Mutable view of the indices added to the last started 'row' so far.
+  /// Allows e.g. sorting a row's elements by value.
+  folly::Range<vector_size_t*> rowIndices(vector_size_t row) {
+    return folly::Range<vector_size_t*>(
+        rawIndices_ + rawOffsets_[row], rawIndices_ + cursor_);
+  }
+
+  /// Returns the result. No more rows may be added afterwards.
+  ArrayVectorPtr build();
+
+ private:
+  const ArrayVector& input_;
+  const vector_size_t numRows_;
+  memory::MemoryPool* const pool_;
+
+  BufferPtr indices_;
+  BufferPtr sizes_;
+  BufferPtr offsets_;
+  vector_size_t* rawIndices_;
+  vector_size_t* rawSizes_;
+  vector_size_t* rawOffsets_;
+
+  // Number of indices added over all rows.
+  vector_size_t cursor_{0};
+};
+
+} // namespace facebook::velox::functions
@@ -20,6 +20,8 @@
 #include <string_view>
 #include "folly/CPortability.h"
 #include "velox/common/base/Exceptions.h"
+#include "velox/common/base/SimdUtil.h"
+#include "velox/common/base/Utf8Util.h"
 #include "velox/external/utf8proc/utf8procImpl.h"
 
 #if (ENABLE_VECTORIZATION > 0) && !defined(_DEBUG) && !defined(DEBUG)
@@ -48,7 +50,26 @@ namespace stringCore {
 static bool isAscii(const char* str, size_t length);
 
 FOLLY_ALWAYS_INLINE bool isAscii(const char* str, size_t length) {
-  for (auto i = 0; i < length; i++) {
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  constexpr size_t kBatchBytes = xsimd::batch<int8_t>::size;
+  size_t i = 0;
+  // Check a SIMD batch at a time; a non-ASCII byte has its high bit set.
+  for (; i + kBatchBytes <= length; i += kBatchBytes) {
+    auto batch = xsimd::batch<int8_t>::load_unaligned(
+        reinterpret_cast<const int8_t*>(str + i));
+    if (simd::toBitMask(batch < xsimd::broadcast<int8_t>(0)) != 0) {
+      return false;
+    }
+  }
+  // Check the tail a word at a time.
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, str + i, 8);
+    if (word & kHighBits) {
+      return false;
+    }
+  }
+  for (; i < length; i++) {
     if (str[i] & 0x80) {
       return false;
     }
@@ -217,6 +238,14 @@ applyAppendersRecursive(TOutStr& output, Func appenderFunc, Funcs... funcs) {
  */
 FOLLY_ALWAYS_INLINE int64_t
 lengthUnicode(const char* inputBuffer, size_t bufferLength) {
+  // Validate and count in one vectorized pass. This covers the common case;
+  // the scalar loop below is only reached for invalid UTF-8 and preserves
+  // the historical skip-a-bad-byte counting.
+  auto count = tryGetUtf8CharLength(inputBuffer, bufferLength);
+  if (LIKELY(count >= 0)) {
+    return count;
+  }
+
   // First address after the last byte in the buffer
   auto buffEndAddress = inputBuffer + bufferLength;
   auto currentChar = inputBuffer;
@@ -394,6 +423,37 @@ inline static size_t replace(
   return writePosition;
 }
 
+/// Advances over 'numChars' utf8 characters starting at 'str + byteOffset'
+/// and returns the byte offset right after them. A bad unicode byte is
+/// skipped and counted as one character, like in lengthUnicode(). Runs of
+/// ASCII characters are skipped a SIMD batch of bytes at a time. Loading a
+/// batch cannot read past the characters the caller promised: a batch is
+/// only loaded when at least a batch worth of characters, hence at least as
+/// many bytes, remain to be skipped.
+FOLLY_ALWAYS_INLINE size_t
+advanceUtf8Chars(const char* str, size_t byteOffset, size_t numChars) {
+  constexpr size_t kBatchBytes = xsimd::batch<int8_t>::size;
+  size_t skipped = 0;
+  while (skipped < numChars) {
+    while (numChars - skipped >= kBatchBytes) {
+      auto batch = xsimd::batch<int8_t>::load_unaligned(
+          reinterpret_cast<const int8_t*>(str + byteOffset));
+      if (simd::toBitMask(batch < xsimd::broadcast<int8_t>(0)) != 0) {
+        break;
+      }
+      byteOffset += kBatchBytes;
+      skipped += kBatchBytes;
+    }
+    if (skipped == numChars) {
+      break;
+    }
+    auto increment = utf8proc_char_length(&str[byteOffset]);
+    byteOffset += UNLIKELY(increment < 0) ? 1 : increment;
+    ++skipped;
+  }
+  return byteOffset;
+}
+
 /// Given a utf8 string, a starting position and length returns the
 /// corresponding underlying byte range [startByteIndex, endByteIndex).
 /// Byte indicies starts from 0, UTF8 character positions starts from 1.
@@ -410,24 +470,9 @@ getByteRange(const char* str, size_t startCharPosition, size_t length) {
     return std::make_pair(
         startCharPosition - 1, startCharPosition + length - 1);
   } else {
-    size_t startByteIndex = 0;
-    size_t nextCharOffset = 0;
-
-    // Find startByteIndex
-    for (auto i = 0; i < startCharPosition - 1; i++) {
-      auto increment = utf8proc_char_length(&str[nextCharOffset]);
-      nextCharOffset += UNLIKELY(increment < 0) ? 1 : increment;
-    }
-
-    startByteIndex = nextCharOffset;
-
-    // Find endByteIndex
-    for (auto i = 0; i < length; i++) {
-      auto increment = utf8proc_char_length(&str[nextCharOffset]);
-      nextCharOffset += UNLIKELY(increment < 0) ? 1 : increment;
-    }
-
-    return std::make_pair(startByteIndex, nextCharOffset);
+    auto startByteIndex = advanceUtf8Chars(str, 0, startCharPosition - 1);
+    auto endByteIndex = advanceUtf8Chars(str, startByteIndex, length);
+    return std::make_pair(startByteIndex, endByteIndex);
   }
 }
 } // namespace stringCore
@@ -1431,6 +1431,21 @@ TEST_F(MysqlDateTimeTest, invalidBuild) {
   EXPECT_THROW(buildMysqlDateTimeFormatter(""), VeloxUserError);
 }
 
+TEST_F(MysqlDateTimeTest, maxResultSize) {
+  auto* timezone = date::locate_zone("GMT");
+  auto formatter = buildMysqlDateTimeFormatter("%Y-%m-%d %H:%i:%s %W");
+  auto maxSize = formatter->maxResultSize(timezone);
+  auto formatted = formatter->format(
+      util::fromTimestampString("2022-09-07 12:30:45"), timezone);
+  EXPECT_EQ("2022-09-07 12:30:45 Wednesday", formatted);
+  EXPECT_LE(formatted.size(), maxSize);
+
+  // Negative year takes the extra sign byte into account.
+  formatted = formatter->format(
+      util::fromTimestampString("-2022-09-07 12:30:45"), timezone);
+  EXPECT_LE(formatted.size(), maxSize);
+}
+
 TEST_F(MysqlDateTimeTest, formatYear) {
   auto* timezone = date::locate_zone("GMT");
   EXPECT_EQ(
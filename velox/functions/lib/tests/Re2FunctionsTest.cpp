@@ -291,6 +291,45 @@ TEST_F(Re2FunctionsTest, regexMatchBatch) {
   re2Match.testBatchAll();
 }
 
+TEST_F(Re2FunctionsTest, regexSearchRequiredLiteral) {
+  // Patterns with a required literal take a prefilter fast path that skips
+  // the regex engine for strings not containing the literal. Verify results
+  // across the extraction edge cases.
+  auto search = [&](std::optional<std::string> str,
+                    const std::string& pattern) {
+    return evaluateOnce<bool>("re2_search(c0, '" + pattern + "')", str);
+  };
+
+  EXPECT_EQ(search("2024 ERROR disk full", "ERROR.*full"), true);
+  EXPECT_EQ(search("2024 INFO all good", "ERROR.*full"), false);
+
+  // Quantified atoms are not required.
+  EXPECT_EQ(search("abbb", "ab*c?"), true);
+  EXPECT_EQ(search("xaz", "ab*c?"), true);
+  EXPECT_EQ(search("xyz", "ab*c?"), false);
+  EXPECT_EQ(search("acc", "ab?c"), true);
+
+  // Character classes and escapes.
+  EXPECT_EQ(search("error 42", "error [0-9]+"), true);
+  EXPECT_EQ(search("error x", "error [0-9]+"), false);
+  EXPECT_EQ(search("a.c", "a\\.c"), true);
+  EXPECT_EQ(search("abc", "a\\.c"), false);
+  EXPECT_EQ(search("a7b", "a\\db"), true);
+
+  // Counted repetition.
+  EXPECT_EQ(search("xxabc", "x{2}abc"), true);
+  EXPECT_EQ(search("yyabc", "x{2}abc"), false);
+
+  // Alternation disables the prefilter.
+  EXPECT_EQ(search("cat", "cat|dog"), true);
+  EXPECT_EQ(search("dog", "cat|dog"), true);
+  EXPECT_EQ(search("cow", "cat|dog"), false);
+
+  // Anchors.
+  EXPECT_EQ(search("abc", "^abc$"), true);
+  EXPECT_EQ(search("xabc", "^abc$"), false);
+}
+
 template <typename F>
 void testRe2Search(F&& regexSearch) {
   // Empty string cases.
@@ -496,6 +535,12 @@ TEST_F(Re2FunctionsTest, likeDeterminePatternKind) {
   testPattern("%%_%aBcD", PatternKind::kGeneric, 0);
   testPattern("%%a%%BcD", PatternKind::kGeneric, 0);
   testPattern("foo%bar", PatternKind::kGeneric, 0);
+
+  testPattern("%presto%", PatternKind::kSubstring, 6);
+  testPattern("%%hello%%%", PatternKind::kSubstring, 5);
+  testPattern("%a%", PatternKind::kSubstring, 1);
+  testPattern("%a_b%", PatternKind::kGeneric, 0);
+  testPattern("_ab%", PatternKind::kGeneric, 0);
 }
 
 TEST_F(Re2FunctionsTest, likePatternWildcard) {
@@ -624,6 +669,37 @@ TEST_F(Re2FunctionsTest, likePatternSuffix) {
   testLike(input, generateString(kAnyWildcardCharacter) + input, true);
 }
 
+TEST_F(Re2FunctionsTest, likePatternSubstring) {
+  testLike("", "%%", true);
+  testLike("abcde", "%bcd%", true);
+  testLike("ABCDE", "%BCD%", true);
+  testLike("abcde", "%%cd%%", true);
+  testLike("abcde", "%abcde%", true);
+  testLike("abcde", "%a%", true);
+  testLike("abcde", "%e%", true);
+  testLike("abcde", "%bd%", false);
+  testLike("abcde", "%abcdef%", false);
+  testLike("ABCDE", "%bcd%", false);
+  testLike("", "%a%", false);
+  testLike("\nabc\nde\n", "%c\nd%", true);
+  testLike("\nabcde\t", "%cde\t%", true);
+  testLike("\nabcde\n", "%de\b%", false);
+  // Multi-byte characters.
+  testLike(
+      "\u4FE1\u5FF5 \u7231 \u5E0C\u671B", "%\u7231%", true);
+  testLike(
+      "\u4FE1\u5FF5 \u7231 \u5E0C\u671B", "%\u5E0C\u671B%", true);
+  testLike(
+      "\u4FE1\u5FF5 \u7231 \u5E0C\u671B", "%\u671B\u5E0C%", false);
+
+  std::string input = generateString(kLikePatternCharacterSet, 65);
+  testLike(
+      input,
+      generateString(kAnyWildcardCharacter) + input +
+          generateString(kAnyWildcardCharacter),
+      true);
+}
+
 TEST_F(Re2FunctionsTest, nullConstantPatternOrEscape) {
   // Test null pattern.
   ASSERT_TRUE(
@@ -20,6 +20,7 @@
 #include "velox/expression/Expr.h"
 #include "velox/expression/VectorFunction.h"
 #include "velox/functions/lib/RowsTranslationUtil.h"
+#include "velox/functions/lib/ZeroCopyArrayBuilder.h"
 
 namespace facebook::velox::functions {
 namespace {
@@ -84,17 +85,8 @@ class ArrayDistinctFunction : public exec::VectorFunction {
     vector_size_t elementsCount = elementsRows.end();
     vector_size_t rowCount = rows.end();
 
-    // Allocate new vectors for indices, length and offsets.
-    memory::MemoryPool* pool = context.pool();
-    BufferPtr newIndices = allocateIndices(elementsCount, pool);
-    BufferPtr newLengths = allocateSizes(rowCount, pool);
-    BufferPtr newOffsets = allocateOffsets(rowCount, pool);
-
-    // Pointers and cursors to the raw data.
-    vector_size_t indicesCursor = 0;
-    auto* rawNewIndices = newIndices->asMutable<vector_size_t>();
-    auto* rawSizes = newLengths->asMutable<vector_size_t>();
-    auto* rawOffsets = newOffsets->asMutable<vector_size_t>();
+    ZeroCopyArrayBuilder builder(
+        *arrayVector, rowCount, elementsCount, context.pool());
 
     // Process the rows: store unique values in the hash table.
     folly::F14FastSet<T> uniqueSet;
@@ -103,40 +95,28 @@ class ArrayDistinctFunction : public exec::VectorFunction {
       auto size = arrayVector->sizeAt(row);
       auto offset = arrayVector->offsetAt(row);
 
-      rawOffsets[row] = indicesCursor;
+      builder.startRow(row);
       bool hasNulls = false;
       for (vector_size_t i = offset; i < offset + size; ++i) {
         if (elements->isNullAt(i)) {
           if (!hasNulls) {
             hasNulls = true;
-            rawNewIndices[indicesCursor++] = i;
+            builder.addElement(i);
           }
         } else {
           auto value = elements->valueAt<T>(i);
 
           if (uniqueSet.insert(value).second) {
-            rawNewIndices[indicesCursor++] = i;
+            builder.addElement(i);
           }
         }
       }
 
       uniqueSet.clear();
-      rawSizes[row] = indicesCursor - rawOffsets[row];
+      builder.finishRow(row);
     });
 
-    newIndices->setSize(indicesCursor * sizeof(vector_size_t));
-    auto newElements =
-        BaseVector::transpose(newIndices, std::move(elementsVector));
-
-    return std::make_shared<ArrayVector>(
-        pool,
-        arrayVector->type(),
-        nullptr,
-        rowCount,
-        std::move(newOffsets),
-        std::move(newLengths),
-        std::move(newElements),
-        0);
+    return builder.build();
   }
 };
 
@@ -21,6 +21,7 @@
 #include "velox/expression/VectorFunction.h"
 #include "velox/functions/lib/ComparatorUtil.h"
 #include "velox/functions/lib/RowsTranslationUtil.h"
+#include "velox/functions/lib/ZeroCopyArrayBuilder.h"
 
 namespace facebook::velox::functions {
 namespace {
@@ -87,17 +88,8 @@ class ArrayDuplicatesFunction : public exec::VectorFunction {
     vector_size_t numElements = elementsRows.end();
     vector_size_t numRows = rows.end();
 
-    // Allocate new vectors for indices, length and offsets.
-    memory::MemoryPool* pool = context.pool();
-    BufferPtr newIndices = allocateIndices(numElements, pool);
-    BufferPtr newSizes = allocateSizes(numRows, pool);
-    BufferPtr newOffsets = allocateOffsets(numRows, pool);
-
-    // Pointers and cursor to the raw data.
-    vector_size_t indexCursor = 0;
-    auto* rawIndices = newIndices->asMutable<vector_size_t>();
-    auto* rawSizes = newSizes->asMutable<vector_size_t>();
-    auto* rawOffsets = newOffsets->asMutable<vector_size_t>();
+    ZeroCopyArrayBuilder builder(
+        *arrayVector, numRows, numElements, context.pool());
 
     // Process the rows: use a hashmap to store unique values and
     // whether it occurred once or more than once.
@@ -107,15 +99,14 @@ class ArrayDuplicatesFunction : public exec::VectorFunction {
       auto size = arrayVector->sizeAt(row);
       auto offset = arrayVector->offsetAt(row);
 
-      rawOffsets[row] = indexCursor;
+      builder.startRow(row);
       vector_size_t numNulls = 0;
 
       for (vector_size_t i = offset; i < offset + size; ++i) {
         if (elements->isNullAt(i)) {
           numNulls++;
           if (numNulls == 2) {
-            rawIndices[indexCursor] = i;
-            indexCursor++;
+            builder.addElement(i);
           }
         } else {
           T value = elements->valueAt<T>(i);
@@ -124,33 +115,22 @@ class ArrayDuplicatesFunction : public exec::VectorFunction {
             uniqueMap[value] = true;
           } else if (it->second) {
             it->second = false;
-            rawIndices[indexCursor] = i;
-            indexCursor++;
+            builder.addElement(i);
           }
         }
       }
 
       uniqueMap.clear();
-      rawSizes[row] = indexCursor - rawOffsets[row];
+      builder.finishRow(row);
 
+      auto rowIndices = builder.rowIndices(row);
       std::sort(
-          rawIndices + rawOffsets[row],
-          rawIndices + indexCursor,
+          rowIndices.begin(),
+          rowIndices.end(),
           lib::Index2ValueNullableLess<T>(elements));
     });
 
-    newIndices->setSize(indexCursor * sizeof(vector_size_t));
-    auto newElements =
-        BaseVector::transpose(newIndices, std::move(elementsVector));
-
-    return std::make_shared<ArrayVector>(
-        pool,
-        arrayVector->type(),
-        nullptr,
-        numRows,
-        std::move(newOffsets),
-        std::move(newSizes),
-        std::move(newElements));
+    return builder.build();
   }
 };
 
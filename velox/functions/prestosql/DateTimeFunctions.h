@@ -1078,12 +1078,14 @@ struct DateFormatFunction : public TimestampWithTimezoneSupport<T> {
 
   const date::time_zone* sessionTimeZone_ = nullptr;
   std::shared_ptr<DateTimeFormatter> mysqlDateTime_;
+  uint32_t maxResultSize_;
   bool isConstFormat_ = false;
 
   FOLLY_ALWAYS_INLINE void setFormatter(const arg_type<Varchar>* formatString) {
     if (formatString != nullptr) {
       mysqlDateTime_ = buildMysqlDateTimeFormatter(
           std::string_view(formatString->data(), formatString->size()));
+      maxResultSize_ = mysqlDateTime_->maxResultSize(sessionTimeZone_);
       isConstFormat_ = true;
     }
   }
@@ -1110,14 +1112,13 @@ struct DateFormatFunction : public TimestampWithTimezoneSupport<T> {
     if (!isConstFormat_) {
       mysqlDateTime_ = buildMysqlDateTimeFormatter(
           std::string_view(formatString.data(), formatString.size()));
+      maxResultSize_ = mysqlDateTime_->maxResultSize(sessionTimeZone_);
     }
 
-    auto formattedResult = mysqlDateTime_->format(timestamp, sessionTimeZone_);
-    auto resultSize = formattedResult.size();
+    result.reserve(maxResultSize_);
+    const auto resultSize = mysqlDateTime_->format(
+        timestamp, sessionTimeZone_, maxResultSize_, result.data());
     result.resize(resultSize);
-    if (resultSize != 0) {
-      std::memcpy(result.data(), formattedResult.data(), resultSize);
-    }
     return true;
   }
 
@@ -1181,6 +1182,7 @@ struct FormatDateTimeFunction {
 
   const date::time_zone* sessionTimeZone_ = nullptr;
   std::shared_ptr<DateTimeFormatter> jodaDateTime_;
+  uint32_t maxResultSize_;
   bool isConstFormat_ = false;
 
   FOLLY_ALWAYS_INLINE void initialize(
@@ -1191,6 +1193,7 @@ struct FormatDateTimeFunction {
     if (formatString != nullptr) {
       jodaDateTime_ = buildJodaDateTimeFormatter(
           std::string_view(formatString->data(), formatString->size()));
+      maxResultSize_ = jodaDateTime_->maxResultSize(sessionTimeZone_);
       isConstFormat_ = true;
     }
   }
@@ -1202,14 +1205,13 @@ struct FormatDateTimeFunction {
     if (!isConstFormat_) {
       jodaDateTime_ = buildJodaDateTimeFormatter(
           std::string_view(formatString.data(), formatString.size()));
+      maxResultSize_ = jodaDateTime_->maxResultSize(sessionTimeZone_);
     }
 
-    auto formattedResult = jodaDateTime_->format(timestamp, sessionTimeZone_);
-    auto resultSize = formattedResult.size();
+    result.reserve(maxResultSize_);
+    const auto resultSize = jodaDateTime_->format(
+        timestamp, sessionTimeZone_, maxResultSize_, result.data());
     result.resize(resultSize);
-    if (resultSize != 0) {
-      std::memcpy(result.data(), formattedResult.data(), resultSize);
-    }
     return true;
   }
 };
@@ -30,6 +30,25 @@ struct ExtraParams {
   } params;
 };
 
+// Detects whether 'Operation' provides a batch kernel, see
+// Addition::applyBatch().
+template <typename Operation, typename R, typename A, typename B, typename = void>
+struct HasApplyBatch : std::false_type {};
+
+template <typename Operation, typename R, typename A, typename B>
+struct HasApplyBatch<
+    Operation,
+    R,
+    A,
+    B,
+    std::void_t<decltype(Operation::template applyBatch<R, A, B>(
+        std::declval<R*>(),
+        std::declval<const A*>(),
+        std::declval<const B*>(),
+        uint8_t{},
+        uint8_t{},
+        vector_size_t{}))>> : std::true_type {};
+
 template <
     typename R /* Result Type */,
     typename A /* Argument1 */,
@@ -71,6 +90,16 @@ class DecimalBaseFunction : public exec::VectorFunction {
       auto rawA = flatA->mutableRawValues();
       auto flatB = args[1]->asUnchecked<FlatVector<B>>();
       auto rawB = flatB->mutableRawValues();
+      if constexpr (HasApplyBatch<Operation, R, A, B>::value) {
+        // Compute the whole batch without per row overflow branches. If any
+        // row overflows, fall through to the checked per row path so that the
+        // error is raised on the right row.
+        if (rows.isAllSelected() &&
+            Operation::template applyBatch<R, A, B>(
+                rawResults, rawA, rawB, aRescale_, bRescale_, rows.end())) {
+          return;
+        }
+      }
       context.applyToSelectedNoThrow(rows, [&](auto row) {
         Operation::template apply<R, A, B>(
             rawResults[row], rawA[row], rawB[row], aRescale_, bRescale_);
@@ -269,6 +298,80 @@ class DecimalBetweenFunction : public exec::VectorFunction {
   }
 };
 
+// Computes a batch of additions or subtractions without per row overflow
+// branches, accumulating an overflow indicator over the batch instead.
+// Returns false if any row overflowed or left the valid decimal range; the
+// caller then reruns the batch on the checked per row path so that the error
+// is raised on the right row. 'rescaleA' and 'rescaleB' are compile time so
+// that the common no-op rescale (the operand already at the result scale)
+// costs nothing.
+template <
+    typename R,
+    typename A,
+    typename B,
+    bool rescaleA,
+    bool rescaleB,
+    bool subtract>
+inline bool applyAddSubtractBatch(
+    R* result,
+    const A* a,
+    const B* b,
+    uint8_t aRescale,
+    uint8_t bRescale,
+    vector_size_t size) {
+  bool overflow = false;
+  [[maybe_unused]] const R aFactor = R(DecimalUtil::kPowersOfTen[aRescale]);
+  [[maybe_unused]] const R bFactor = R(DecimalUtil::kPowersOfTen[bRescale]);
+  for (vector_size_t i = 0; i < size; ++i) {
+    R aRescaled = R(a[i]);
+    R bRescaled = R(b[i]);
+    if constexpr (rescaleA) {
+      overflow |= __builtin_mul_overflow(aRescaled, aFactor, &aRescaled);
+    }
+    if constexpr (rescaleB) {
+      overflow |= __builtin_mul_overflow(bRescaled, bFactor, &bRescaled);
+    }
+    R r;
+    if constexpr (subtract) {
+      overflow |= __builtin_sub_overflow(aRescaled, bRescaled, &r);
+    } else {
+      overflow |= __builtin_add_overflow(aRescaled, bRescaled, &r);
+    }
+    if constexpr (sizeof(R) == sizeof(int128_t)) {
+      overflow |= (r < DecimalUtil::kLongDecimalMin) |
+          (r > DecimalUtil::kLongDecimalMax);
+    }
+    result[i] = r;
+  }
+  return !overflow;
+}
+
+// Dispatches the rescale factors of an addition or subtraction batch to
+// compile time, see applyAddSubtractBatch().
+template <typename R, typename A, typename B, bool subtract>
+inline bool dispatchAddSubtractBatch(
+    R* result,
+    const A* a,
+    const B* b,
+    uint8_t aRescale,
+    uint8_t bRescale,
+    vector_size_t size) {
+  if (aRescale == 0 && bRescale == 0) {
+    return applyAddSubtractBatch<R, A, B, false, false, subtract>(
+        result, a, b, aRescale, bRescale, size);
+  }
+  if (bRescale == 0) {
+    return applyAddSubtractBatch<R, A, B, true, false, subtract>(
+        result, a, b, aRescale, bRescale, size);
+  }
+  if (aRescale == 0) {
+    return applyAddSubtractBatch<R, A, B, false, true, subtract>(
+        result, a, b, aRescale, bRescale, size);
+  }
+  return applyAddSubtractBatch<R, A, B, true, true, subtract>(
+      result, a, b, aRescale, bRescale, size);
+}
+
 class Addition {
  public:
   template <typename R, typename A, typename B>
@@ -292,6 +395,20 @@ class Addition {
     DecimalUtil::valueInRange(r);
   }
 
+  // Batch kernel without per row overflow branches, see
+  // applyAddSubtractBatch().
+  template <typename R, typename A, typename B>
+  inline static bool applyBatch(
+      R* result,
+      const A* a,
+      const B* b,
+      uint8_t aRescale,
+      uint8_t bRescale,
+      vector_size_t size) {
+    return dispatchAddSubtractBatch<R, A, B, false /*subtract*/>(
+        result, a, b, aRescale, bRescale, size);
+  }
+
   inline static uint8_t
   computeRescaleFactor(uint8_t fromScale, uint8_t toScale, uint8_t rScale = 0) {
     return std::max(0, toScale - fromScale);
@@ -334,6 +451,20 @@ class Subtraction {
     DecimalUtil::valueInRange(r);
   }
 
+  // Batch kernel without per row overflow branches, see
+  // applyAddSubtractBatch().
+  template <typename R, typename A, typename B>
+  inline static bool applyBatch(
+      R* result,
+      const A* a,
+      const B* b,
+      uint8_t aRescale,
+      uint8_t bRescale,
+      vector_size_t size) {
+    return dispatchAddSubtractBatch<R, A, B, true /*subtract*/>(
+        result, a, b, aRescale, bRescale, size);
+  }
+
   inline static uint8_t
   computeRescaleFactor(uint8_t fromScale, uint8_t toScale, uint8_t rScale = 0) {
     return std::max(0, toScale - fromScale);
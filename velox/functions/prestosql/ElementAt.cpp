@@ -35,7 +35,19 @@ class ElementAtFunction : public SubscriptImpl<
                               /* allowOutOfBound */ true,
                               /* indexStartsAtOne */ true> {
  public:
-  explicit ElementAtFunction(bool allowcaching) : SubscriptImpl(allowcaching) {}
+  ElementAtFunction(bool allowCaching, bool isMapSubscript)
+      : SubscriptImpl(allowCaching), isMapSubscript_(isMapSubscript) {}
+
+  /// element_at over a map accesses a single key, so constant keys can be
+  /// pushed down to prune the map to just the keys used.  Array accesses
+  /// cannot be pushed down because negative indices address elements from
+  /// the end of the array.
+  bool canPushdown() const override {
+    return isMapSubscript_;
+  }
+
+ private:
+  const bool isMapSubscript_;
 };
 } // namespace
 
@@ -50,12 +62,13 @@ void registerElementAtFunction(
           const std::vector<exec::VectorFunctionArg>& inputArgs,
           const velox::core::QueryConfig& config) {
         static const auto kSubscriptStateLess =
-            std::make_shared<ElementAtFunction>(false);
+            std::make_shared<ElementAtFunction>(false, false);
         if (inputArgs[0].type->isArray()) {
           return kSubscriptStateLess;
         } else {
           return std::make_shared<ElementAtFunction>(
-              enableCaching && config.isExpressionEvaluationCacheEnabled());
+              enableCaching && config.isExpressionEvaluationCacheEnabled(),
+              true);
         }
       });
 }
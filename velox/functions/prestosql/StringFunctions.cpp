@@ -35,26 +35,46 @@ namespace {
 template <bool isLower /*instantiate for upper or lower*/>
 class UpperLowerTemplateFunction : public exec::VectorFunction {
  private:
-  /// String encoding wrappable function
-  template <bool isAscii>
-  struct ApplyInternal {
-    static void apply(
-        const SelectivityVector& rows,
-        const DecodedVector* decodedInput,
-        FlatVector<StringView>* results) {
-      rows.applyToSelected([&](int row) {
-        auto proxy = exec::StringWriter<>(results, row);
-        if constexpr (isLower) {
-          stringImpl::lower<isAscii>(
-              proxy, decodedInput->valueAt<StringView>(row));
-        } else {
-          stringImpl::upper<isAscii>(
-              proxy, decodedInput->valueAt<StringView>(row));
-        }
-        proxy.finalize();
-      });
-    }
-  };
+  void applyUnicode(
+      const SelectivityVector& rows,
+      const DecodedVector* decodedInput,
+      FlatVector<StringView>* results) const {
+    rows.applyToSelected([&](int row) {
+      auto proxy = exec::StringWriter<>(results, row);
+      if constexpr (isLower) {
+        stringImpl::lower<false>(proxy, decodedInput->valueAt<StringView>(row));
+      } else {
+        stringImpl::upper<false>(proxy, decodedInput->valueAt<StringView>(row));
+      }
+      proxy.finalize();
+    });
+  }
+
+  // An ASCII result is exactly as large as its input, so the output bytes of
+  // all selected rows are reserved in one string buffer up front and each
+  // result is written at a bump pointer, instead of growing the buffer row by
+  // row through StringWriter.
+  void applyAsciiBatch(
+      const SelectivityVector& rows,
+      const DecodedVector* decodedInput,
+      FlatVector<StringView>* results) const {
+    size_t totalResultBytes = 0;
+    rows.applyToSelected([&](int row) {
+      totalResultBytes += decodedInput->valueAt<StringView>(row).size();
+    });
+
+    char* rawBuffer = results->getRawStringBufferWithSpace(totalResultBytes);
+    rows.applyToSelected([&](int row) {
+      auto value = decodedInput->valueAt<StringView>(row);
+      if constexpr (isLower) {
+        stringCore::lowerAscii(rawBuffer, value.data(), value.size());
+      } else {
+        stringCore::upperAscii(rawBuffer, value.data(), value.size());
+      }
+      results->setNoCopy(row, StringView(rawBuffer, value.size()));
+      rawBuffer += value.size();
+    });
+  }
 
   void applyInternalInPlace(
       const SelectivityVector& rows,
@@ -114,8 +134,11 @@ class UpperLowerTemplateFunction : public exec::VectorFunction {
     prepareFlatResultsVector(result, rows, context, emptyVectorPtr);
     auto* resultFlatVector = result->as<FlatVector<StringView>>();
 
-    StringEncodingTemplateWrapper<ApplyInternal>::apply(
-        ascii, rows, decodedInput, resultFlatVector);
+    if (ascii) {
+      applyAsciiBatch(rows, decodedInput, resultFlatVector);
+    } else {
+      applyUnicode(rows, decodedInput, resultFlatVector);
+    }
   }
 
   static std::vector<std::shared_ptr<exec::FunctionSignature>> signatures() {
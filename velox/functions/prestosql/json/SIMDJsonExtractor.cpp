@@ -43,7 +43,7 @@ namespace facebook::velox::functions::detail {
 }
 
 simdjson::simdjson_result<simdjson::ondemand::document>
-SIMDJsonExtractor::parse(const simdjson::padded_string& json) {
+SIMDJsonExtractor::parse(simdjson::padded_string_view json) {
   thread_local static simdjson::ondemand::parser parser;
   return parser.iterate(json);
 }
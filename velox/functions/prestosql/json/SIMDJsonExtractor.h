@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <string>
 
 #include "folly/Range.h"
@@ -62,7 +63,7 @@ class SIMDJsonExtractor {
   }
 
   simdjson::simdjson_result<simdjson::ondemand::document> parse(
-      const simdjson::padded_string& json);
+      simdjson::padded_string_view json);
 
  private:
   // Use this method to get an instance of SIMDJsonExtractor given a JSON path.
@@ -181,8 +182,16 @@ bool simdJsonExtract(
   // If extractor fails to parse the path, this will throw a VeloxUserError, and
   // we want to let this exception bubble up to the client.
   auto& extractor = detail::SIMDJsonExtractor::getInstance(path);
-  simdjson::padded_string paddedJson(json.data(), json.size());
-  SIMDJSON_ASSIGN_OR_RAISE(auto jsonDoc, extractor.parse(paddedJson));
+  // Copy the input into a reusable padded buffer. This avoids an allocation
+  // per row; extractions over the same column hit a warm buffer.
+  thread_local static std::string paddedJson;
+  if (paddedJson.size() < json.size() + simdjson::SIMDJSON_PADDING) {
+    paddedJson.resize(json.size() + simdjson::SIMDJSON_PADDING);
+  }
+  std::memcpy(paddedJson.data(), json.data(), json.size());
+  simdjson::padded_string_view paddedView(
+      paddedJson.data(), json.size(), paddedJson.size());
+  SIMDJSON_ASSIGN_OR_RAISE(auto jsonDoc, extractor.parse(paddedView));
 
   if (extractor.isRootOnlyPath()) {
     // If the path is just to return the original object, call consumer on the
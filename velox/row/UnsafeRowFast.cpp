@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/row/UnsafeRowFast.h"
+#include "velox/row/UnsafeRowDeserializers.h"
 
 namespace facebook::velox::row {
 
@@ -408,4 +409,208 @@ int32_t UnsafeRowFast::serializeRow(vector_size_t index, char* buffer) {
 
   return variableWidthOffset;
 }
+
+namespace {
+
+// Reads the field word of a variable-width value. Returns the size and the
+// offset of the value within the row.
+std::pair<int32_t, int32_t> readSizeAndOffset(const char* fieldData) {
+  const auto sizeAndOffset = *reinterpret_cast<const uint64_t*>(fieldData);
+  return {
+      static_cast<int32_t>(sizeAndOffset),
+      static_cast<int32_t>(sizeAndOffset >> 32)};
+}
+
+// Returns true if the 'childIdx' field of the row is null. Top-level null
+// rows are represented by std::nullopt entries in 'data'.
+bool isNullField(
+    const std::optional<std::string_view>& row,
+    int32_t childIdx) {
+  return !row.has_value() || bits::isBitSet(row->data(), childIdx);
+}
+
+// Deserializes one fixed-width value from each row in 'data'. Values are read
+// from the field word at 'fieldOffset' within each row.
+template <TypeKind Kind>
+VectorPtr deserializeFixedWidthColumn(
+    const TypePtr& type,
+    const std::vector<std::optional<std::string_view>>& data,
+    int32_t childIdx,
+    int32_t fieldOffset,
+    memory::MemoryPool* pool) {
+  using T = typename TypeTraits<Kind>::NativeType;
+
+  const auto numRows = data.size();
+  auto flatVector = BaseVector::create<FlatVector<T>>(type, numRows, pool);
+
+  for (auto i = 0; i < numRows; ++i) {
+    if (isNullField(data[i], childIdx)) {
+      flatVector->setNull(i, true);
+      continue;
+    }
+
+    const char* fieldData = data[i]->data() + fieldOffset;
+    if constexpr (std::is_same_v<T, Timestamp>) {
+      int64_t micros;
+      memcpy(&micros, fieldData, sizeof(int64_t));
+      flatVector->set(i, Timestamp::fromMicros(micros));
+    } else {
+      T value;
+      memcpy(&value, fieldData, sizeof(T));
+      flatVector->set(i, value);
+    }
+  }
+
+  return flatVector;
+}
+
+// Deserializes one long decimal from each row in 'data'. The values are
+// variable-width big-endian byte arrays referenced by the field word at
+// 'fieldOffset'.
+VectorPtr deserializeLongDecimalColumn(
+    const TypePtr& type,
+    const std::vector<std::optional<std::string_view>>& data,
+    int32_t childIdx,
+    int32_t fieldOffset,
+    memory::MemoryPool* pool) {
+  const auto numRows = data.size();
+  auto flatVector =
+      BaseVector::create<FlatVector<int128_t>>(type, numRows, pool);
+
+  for (auto i = 0; i < numRows; ++i) {
+    if (isNullField(data[i], childIdx)) {
+      flatVector->setNull(i, true);
+      continue;
+    }
+
+    auto [size, offset] = readSizeAndOffset(data[i]->data() + fieldOffset);
+    flatVector->set(
+        i,
+        UnsafeRowPrimitiveBatchDeserializer::deserializeLongDecimal(
+            std::string_view(data[i]->data() + offset, size)));
+  }
+
+  return flatVector;
+}
+
+// Deserializes one string from each row in 'data'. Copies the strings into a
+// single string buffer in one pass.
+VectorPtr deserializeStringColumn(
+    const TypePtr& type,
+    const std::vector<std::optional<std::string_view>>& data,
+    int32_t childIdx,
+    int32_t fieldOffset,
+    memory::MemoryPool* pool) {
+  const auto numRows = data.size();
+  auto flatVector =
+      BaseVector::create<FlatVector<StringView>>(type, numRows, pool);
+
+  int64_t totalBytes = 0;
+  for (auto i = 0; i < numRows; ++i) {
+    if (!isNullField(data[i], childIdx)) {
+      auto [size, offset] = readSizeAndOffset(data[i]->data() + fieldOffset);
+      totalBytes += size;
+    }
+  }
+
+  char* rawBuffer = totalBytes > 0
+      ? flatVector->getRawStringBufferWithSpace(totalBytes, true /*exactSize*/)
+      : nullptr;
+
+  for (auto i = 0; i < numRows; ++i) {
+    if (isNullField(data[i], childIdx)) {
+      flatVector->setNull(i, true);
+      continue;
+    }
+
+    auto [size, offset] = readSizeAndOffset(data[i]->data() + fieldOffset);
+    memcpy(rawBuffer, data[i]->data() + offset, size);
+    flatVector->setNoCopy(i, StringView(rawBuffer, size));
+    rawBuffer += size;
+  }
+
+  return flatVector;
+}
+
+// Extracts the serialized values of the 'childIdx' column from each row so
+// that they can be deserialized with UnsafeRowDeserializer.
+std::vector<std::optional<std::string_view>> extractColumn(
+    const std::vector<std::optional<std::string_view>>& data,
+    int32_t childIdx,
+    int32_t fieldOffset) {
+  std::vector<std::optional<std::string_view>> columnData(data.size());
+  for (auto i = 0; i < data.size(); ++i) {
+    if (isNullField(data[i], childIdx)) {
+      continue;
+    }
+
+    auto [size, offset] = readSizeAndOffset(data[i]->data() + fieldOffset);
+    columnData[i] = std::string_view(data[i]->data() + offset, size);
+  }
+  return columnData;
+}
+
+} // namespace
+
+// static
+RowVectorPtr UnsafeRowFast::deserialize(
+    const std::vector<std::optional<std::string_view>>& data,
+    const RowTypePtr& rowType,
+    memory::MemoryPool* pool) {
+  const auto numRows = data.size();
+  const size_t numFields = rowType->size();
+  const int32_t nullLength = alignBits(numFields);
+
+  BufferPtr nulls = allocateNulls(numRows, pool);
+  auto* rawNulls = nulls->asMutable<uint64_t>();
+  size_t nullCount = 0;
+  for (auto i = 0; i < numRows; ++i) {
+    const bool isNull = !data[i].has_value();
+    bits::setNull(rawNulls, i, isNull);
+    nullCount += isNull;
+  }
+  if (nullCount == 0) {
+    nulls = nullptr;
+  }
+
+  std::vector<VectorPtr> fields;
+  fields.reserve(numFields);
+  for (auto i = 0; i < numFields; ++i) {
+    const auto& child = rowType->childAt(i);
+    const int32_t fieldOffset = nullLength + i * kFieldWidth;
+
+    VectorPtr field;
+    if (child->isUnKnown()) {
+      field = BaseVector::createNullConstant(UNKNOWN(), numRows, pool);
+    } else if (isFixedWidth(child)) {
+      field = VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+          deserializeFixedWidthColumn,
+          child->kind(),
+          child,
+          data,
+          i,
+          fieldOffset,
+          pool);
+    } else {
+      switch (child->kind()) {
+        case TypeKind::HUGEINT:
+          field =
+              deserializeLongDecimalColumn(child, data, i, fieldOffset, pool);
+          break;
+        case TypeKind::VARCHAR:
+        case TypeKind::VARBINARY:
+          field = deserializeStringColumn(child, data, i, fieldOffset, pool);
+          break;
+        default:
+          field = UnsafeRowDeserializer::deserialize(
+              extractColumn(data, i, fieldOffset), child, pool);
+      }
+    }
+
+    fields.emplace_back(std::move(field));
+  }
+
+  return std::make_shared<RowVector>(
+      pool, rowType, nulls, numRows, std::move(fields));
+}
 } // namespace facebook::velox::row
@@ -36,6 +36,14 @@ class UnsafeRowFast {
   /// 'buffer' must have sufficient capacity and set to all zeros.
   int32_t serialize(vector_size_t index, char* buffer);
 
+  /// Deserializes multiple rows into a RowVector of specified type. The type
+  /// must match the contents of the serialized rows. Null entries in 'data'
+  /// become null rows. Processes the rows one column at a time.
+  static RowVectorPtr deserialize(
+      const std::vector<std::optional<std::string_view>>& data,
+      const RowTypePtr& rowType,
+      memory::MemoryPool* pool);
+
  protected:
   explicit UnsafeRowFast(const VectorPtr& vector);
 
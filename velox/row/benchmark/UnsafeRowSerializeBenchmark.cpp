@@ -53,6 +53,19 @@ class SerializeBenchmark {
     VELOX_CHECK_EQ(copy->size(), data->size());
   }
 
+  void deserializeUnsafeFast(const RowTypePtr& rowType) {
+    folly::BenchmarkSuspender suspender;
+    auto data = makeData(rowType);
+    UnsafeRowFast fast(data);
+    auto totalSize = computeTotalSize(fast, rowType, data->size());
+    auto buffer = AlignedBuffer::allocate<char>(totalSize, pool());
+    auto serialized = serialize(fast, data->size(), buffer);
+    suspender.dismiss();
+
+    auto copy = UnsafeRowFast::deserialize(serialized, rowType, pool());
+    VELOX_CHECK_EQ(copy->size(), data->size());
+  }
+
   void serializeCompact(const RowTypePtr& rowType) {
     folly::BenchmarkSuspender suspender;
     auto data = makeData(rowType);
@@ -225,6 +238,11 @@ class SerializeBenchmark {
     benchmark.deserializeUnsafe(rowType);    \
   }                                          \
                                              \
+  BENCHMARK(unsafe_fast_deserialize_##name) {  \
+    SerializeBenchmark benchmark;              \
+    benchmark.deserializeUnsafeFast(rowType);  \
+  }                                            \
+                                               \
   BENCHMARK(compact_deserialize_##name) {    \
     SerializeBenchmark benchmark;            \
     benchmark.deserializeCompact(rowType);   \
@@ -272,6 +290,12 @@ BENCHMARK(decimalsDeserialize) {
   benchmark.deserializeUnsafe(ROW({BIGINT(), DECIMAL(12, 2), DECIMAL(38, 18)}));
 }
 
+BENCHMARK(decimalsDeserializeFast) {
+  SerializeBenchmark benchmark;
+  benchmark.deserializeUnsafeFast(
+      ROW({BIGINT(), DECIMAL(12, 2), DECIMAL(38, 18)}));
+}
+
 SERDE_BENCHMARKS(strings1, ROW({BIGINT(), VARCHAR()}));
 
 SERDE_BENCHMARKS(
@@ -82,6 +82,12 @@ class UnsafeRowFuzzTests : public ::testing::Test {
           UnsafeRowDeserializer::deserialize(serialized, rowType, pool_.get());
 
       assertEqualVectors(inputVector, outputVector);
+
+      // Deserialize with the column-at-a-time batch deserializer.
+      VectorPtr batchOutputVector =
+          UnsafeRowFast::deserialize(serialized, rowType, pool_.get());
+
+      assertEqualVectors(inputVector, batchOutputVector);
     }
   }
 
@@ -19,13 +19,6 @@
 
 namespace facebook::velox::serializer {
 
-void CompactRowVectorSerde::estimateSerializedSize(
-    VectorPtr /* vector */,
-    const folly::Range<const IndexRange*>& /* ranges */,
-    vector_size_t** /* sizes */) {
-  VELOX_UNSUPPORTED();
-}
-
 namespace {
 class CompactRowVectorSerializer : public VectorSerializer {
  public:
@@ -95,6 +88,34 @@ class CompactRowVectorSerializer : public VectorSerializer {
 };
 } // namespace
 
+void CompactRowVectorSerde::estimateSerializedSize(
+    VectorPtr vector,
+    const folly::Range<const IndexRange*>& ranges,
+    vector_size_t** sizes) {
+  using TRowSize = CompactRowVectorSerializer::TRowSize;
+
+  auto rowVector = std::dynamic_pointer_cast<RowVector>(vector);
+  VELOX_CHECK_NOT_NULL(
+      rowVector, "CompactRow serde estimates whole rows, expected a RowVector");
+  row::CompactRow row(rowVector);
+  if (auto fixedRowSize =
+          row::CompactRow::fixedRowSize(asRowType(rowVector->type()))) {
+    const vector_size_t rowSize = fixedRowSize.value() + sizeof(TRowSize);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      *sizes[i] += ranges[i].size * rowSize;
+    }
+    return;
+  }
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const auto& range = ranges[i];
+    vector_size_t bytes = 0;
+    for (auto j = range.begin; j < range.begin + range.size; ++j) {
+      bytes += row.rowSize(j) + sizeof(TRowSize);
+    }
+    *sizes[i] += bytes;
+  }
+}
+
 std::unique_ptr<VectorSerializer> CompactRowVectorSerde::createSerializer(
     RowTypePtr /* type */,
     int32_t /* numRows */,
@@ -132,4 +153,10 @@ void CompactRowVectorSerde::registerVectorSerde() {
   velox::registerVectorSerde(std::make_unique<CompactRowVectorSerde>());
 }
 
+// static
+void CompactRowVectorSerde::registerNamedVectorSerde() {
+  velox::registerNamedVectorSerde(
+      "CompactRow", std::make_unique<CompactRowVectorSerde>());
+}
+
 } // namespace facebook::velox::serializer
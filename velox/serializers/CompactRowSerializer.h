@@ -23,14 +23,18 @@ namespace facebook::velox::serializer {
 class CompactRowVectorSerde : public VectorSerde {
  public:
   CompactRowVectorSerde() = default;
-  // We do not implement this method since it is not used in production code.
+
+  // This is a row-oriented serde: sizes are estimated for whole rows, so
+  // 'vector' must be the full row vector.
+  bool estimatesSerializedSizeByColumn() const override {
+    return false;
+  }
+
   void estimateSerializedSize(
       VectorPtr vector,
       const folly::Range<const IndexRange*>& ranges,
       vector_size_t** sizes) override;
 
-  // This method is not used in production code. It is only used to
-  // support round-trip tests for deserialization.
   std::unique_ptr<VectorSerializer> createSerializer(
       RowTypePtr type,
       int32_t numRows,
@@ -46,6 +50,11 @@ class CompactRowVectorSerde : public VectorSerde {
       const Options* options) override;
 
   static void registerVectorSerde();
+
+  /// Registers this serde under the name "CompactRow" so it can be selected
+  /// per query, e.g. as the exchange wire format via the
+  /// exchange_vector_serde query config.
+  static void registerNamedVectorSerde();
 };
 
 } // namespace facebook::velox::serializer
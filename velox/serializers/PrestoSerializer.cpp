@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/serializers/PrestoSerializer.h"
+#include <folly/container/F14Map.h>
 #include "velox/common/base/Crc.h"
 #include "velox/common/base/RawVector.h"
 #include "velox/common/memory/ByteStream.h"
@@ -148,6 +149,10 @@ FOLLY_ALWAYS_INLINE bool needCompression(const folly::io::Codec& codec) {
   return codec.type() != folly::io::CodecType::NO_COMPRESSION;
 }
 
+// A page is written compressed only if it shrinks to at most this fraction of
+// its uncompressed size.
+constexpr float kMinCompressionRatio = 0.8;
+
 template <typename T>
 void readValues(
     ByteStream* source,
@@ -1059,6 +1064,14 @@ class VectorStream {
     append(folly::Range(&value, 1));
   }
 
+  // Returns a writable window over the next 'count' values of the
+  // values stream. The caller fills all of it. Only for fixed-width
+  // wire representations.
+  template <typename T>
+  T* appendWindow(int32_t count) {
+    return reinterpret_cast<T*>(values_.appendWindow(sizeof(T) * count));
+  }
+
   VectorStream* childAt(int32_t index) {
     return children_[index].get();
   }
@@ -1191,13 +1204,15 @@ inline void VectorStream::append(folly::Range<const StringView*> values) {
 template <>
 void VectorStream::append(folly::Range<const Timestamp*> values) {
   if (useLosslessTimestamp_) {
+    auto* output = appendWindow<int64_t>(2 * values.size());
     for (auto& value : values) {
-      appendOne(value.getSeconds());
-      appendOne(value.getNanos());
+      *output++ = value.getSeconds();
+      *output++ = value.getNanos();
     }
   } else {
+    auto* output = appendWindow<int64_t>(values.size());
     for (auto& value : values) {
-      appendOne(value.toMillis());
+      *output++ = value.toMillis();
     }
   }
 }
@@ -1290,9 +1305,10 @@ void serializeFlatVector<TypeKind::BOOLEAN>(
   if (!vector->mayHaveNulls()) {
     for (int32_t i = 0; i < ranges.size(); ++i) {
       stream->appendNonNull(ranges[i].size);
+      auto* output = stream->appendWindow<uint8_t>(ranges[i].size);
       int32_t end = ranges[i].begin + ranges[i].size;
       for (int32_t offset = ranges[i].begin; offset < end; ++offset) {
-        stream->appendOne<uint8_t>(flatVector->valueAtFast(offset) ? 1 : 0);
+        *output++ = flatVector->valueAtFast(offset) ? 1 : 0;
       }
     }
   } else {
@@ -1481,8 +1497,8 @@ void serializeConstantVector(
   }
 
   T value = constVector->valueAtFast(0);
+  stream->appendNonNull(count);
   for (int32_t i = 0; i < count; ++i) {
-    stream->appendNonNull();
     stream->appendOne(value);
   }
 }
@@ -1496,9 +1512,10 @@ void serializeBiasVector(
   if (!vector->mayHaveNulls()) {
     for (int32_t i = 0; i < ranges.size(); ++i) {
       stream->appendNonNull(ranges[i].size);
+      auto* output = stream->appendWindow<T>(ranges[i].size);
       int32_t end = ranges[i].begin + ranges[i].size;
       for (int32_t offset = ranges[i].begin; offset < end; ++offset) {
-        stream->appendOne(biasVector->valueAtFast(offset));
+        *output++ = biasVector->valueAtFast(offset);
       }
     }
   } else {
@@ -1600,6 +1617,55 @@ void serializeDictionaryColumn(
   }
 }
 
+// Minimum number of rows for dictionary detection on flat string columns.
+// Below this, the alphabet and index overhead is not worth the scan.
+constexpr vector_size_t kMinRowsForStringDictionary = 64;
+
+// Returns a dictionary-encoded version of a flat string 'vector' if it has no
+// nulls and at most half as many distinct values as rows, nullptr otherwise.
+// Repeated strings then ship one alphabet entry plus a 4-byte index per row
+// on the wire.
+VectorPtr tryDictionaryEncodeStrings(const VectorPtr& vector) {
+  if (vector->encoding() != VectorEncoding::Simple::FLAT ||
+      (vector->typeKind() != TypeKind::VARCHAR &&
+       vector->typeKind() != TypeKind::VARBINARY)) {
+    return nullptr;
+  }
+
+  const auto size = vector->size();
+  if (size < kMinRowsForStringDictionary || vector->mayHaveNulls()) {
+    return nullptr;
+  }
+
+  auto* flat = vector->asUnchecked<FlatVector<StringView>>();
+  auto* pool = vector->pool();
+
+  const vector_size_t maxDistinct = size / 2;
+  auto indices = allocateIndices(size, pool);
+  auto* rawIndices = indices->asMutable<vector_size_t>();
+  auto alphabetIndices = allocateIndices(maxDistinct, pool);
+  auto* rawAlphabetIndices = alphabetIndices->asMutable<vector_size_t>();
+
+  folly::F14FastMap<StringView, vector_size_t> distinct;
+  distinct.reserve(maxDistinct);
+  for (vector_size_t i = 0; i < size; ++i) {
+    auto [it, inserted] = distinct.emplace(
+        flat->valueAt(i), static_cast<vector_size_t>(distinct.size()));
+    if (inserted) {
+      if (static_cast<vector_size_t>(distinct.size()) > maxDistinct) {
+        // Too many distinct values to pay off.
+        return nullptr;
+      }
+      rawAlphabetIndices[it->second] = i;
+    }
+    rawIndices[i] = it->second;
+  }
+
+  auto alphabet = BaseVector::wrapInDictionary(
+      nullptr, alphabetIndices, distinct.size(), vector);
+  return BaseVector::wrapInDictionary(nullptr, indices, size, alphabet);
+}
+
 void serializeEncodedColumn(
     const BaseVector* vector,
     const folly::Range<const IndexRange*>& ranges,
@@ -2022,19 +2088,12 @@ class PrestoVectorSerializer : public VectorSerializer {
       int32_t numRows,
       OutputStream* output,
       PrestoOutputStreamListener* listener) {
-    const int32_t offset = output->tellp();
-    char codec = kCompressedBitMask;
-    if (listener) {
-      codec |= kCheckSumBitMask;
-    }
-
     // Pause CRC computation
     if (listener) {
       listener->pause();
     }
 
     writeInt32(output, numRows);
-    output->write(&codec, 1);
 
     IOBufOutputStream out(
         *(streamArena_->pool()), nullptr, streamArena_->size());
@@ -2049,19 +2108,40 @@ class PrestoVectorSerializer : public VectorSerializer {
         uncompressedSize,
         codec_->maxUncompressedLength(),
         "UncompressedSize exceeds limit");
-    auto compressed = codec_->compress(out.getIOBuf().get());
+    auto uncompressed = out.getIOBuf();
+    auto compressed = codec_->compress(uncompressed.get());
     const int32_t compressedSize = compressed->length();
+
+    // Write the page uncompressed if compression doesn't pay off. The
+    // consumer decides per page based on the codec marker.
+    const bool useCompression =
+        compressedSize <= uncompressedSize * kMinCompressionRatio;
+
+    char codec = useCompression ? kCompressedBitMask : 0;
+    if (listener) {
+      codec |= kCheckSumBitMask;
+    }
+    output->write(&codec, 1);
     writeInt32(output, uncompressedSize);
-    writeInt32(output, compressedSize);
+    const int32_t payloadSize =
+        useCompression ? compressedSize : uncompressedSize;
+    writeInt32(output, payloadSize);
     const int32_t crcOffset = output->tellp();
     writeInt64(output, 0); // Write zero checksum
     // Number of columns and stream content. Unpause CRC.
     if (listener) {
       listener->resume();
     }
-    output->write(
-        reinterpret_cast<const char*>(compressed->writableData()),
-        compressed->length());
+    if (useCompression) {
+      output->write(
+          reinterpret_cast<const char*>(compressed->writableData()),
+          compressed->length());
+    } else {
+      for (auto range : *uncompressed) {
+        output->write(
+            reinterpret_cast<const char*>(range.data()), range.size());
+      }
+    }
     // Pause CRC computation
     if (listener) {
       listener->pause();
@@ -2070,7 +2150,7 @@ class PrestoVectorSerializer : public VectorSerializer {
     // Fill in crc
     int64_t crc = 0;
     if (listener) {
-      crc = computeChecksum(listener, codec, numRows, compressedSize);
+      crc = computeChecksum(listener, codec, numRows, payloadSize);
     }
     output->seekp(crcOffset);
     writeInt64(output, crc);
@@ -2129,11 +2209,36 @@ void PrestoVectorSerde::serializeEncoded(
     StreamArena* streamArena,
     const Options* options,
     OutputStream* out) {
+  auto prestoOptions = toPrestoOptions(options);
+  auto data = vector;
+
+  // Ship low-cardinality flat string columns dictionary-encoded. The column's
+  // wire encoding must be fixed before the serializer is created, so the
+  // substitution happens here and updates 'encodings' in step.
+  const auto numChildren = std::min<size_t>(
+      vector->childrenSize(), prestoOptions.encodings.size());
+  for (size_t i = 0; i < numChildren; ++i) {
+    auto encoded = tryDictionaryEncodeStrings(vector->childAt(i));
+    if (encoded == nullptr) {
+      continue;
+    }
+    if (data == vector) {
+      data = std::make_shared<RowVector>(
+          vector->pool(),
+          vector->type(),
+          vector->nulls(),
+          vector->size(),
+          vector->children());
+    }
+    data->children()[i] = std::move(encoded);
+    prestoOptions.encodings[i] = VectorEncoding::Simple::DICTIONARY;
+  }
+
   auto serializer = createSerializer(
-      asRowType(vector->type()), vector->size(), streamArena, options);
+      asRowType(data->type()), data->size(), streamArena, &prestoOptions);
 
   static_cast<PrestoVectorSerializer*>(serializer.get())
-      ->flushEncoded(vector, out);
+      ->flushEncoded(data, out);
 }
 
 void PrestoVectorSerde::deserialize(
@@ -2174,16 +2279,18 @@ void PrestoVectorSerde::deserialize(
   VELOX_CHECK_EQ(
       checksum, actualCheckSum, "Received corrupted serialized page.");
 
-  VELOX_CHECK_EQ(
-      needCompression(*codec),
-      isCompressedBitSet(pageCodecMarker),
-      "Compression kind {} should align with codec marker.",
+  // The producer may skip compression for pages that do not compress well
+  // even when a compression kind is configured, so the codec marker decides
+  // per page.
+  VELOX_CHECK(
+      !isCompressedBitSet(pageCodecMarker) || needCompression(*codec),
+      "Received a compressed page but compression kind {} has no codec.",
       common::compressionKindToString(
           common::codecTypeToCompressionKind(codec->type())));
 
   auto& children = (*result)->children();
   const auto& childTypes = type->asRow().children();
-  if (!needCompression(*codec)) {
+  if (!isCompressedBitSet(pageCodecMarker)) {
     auto numColumns = source->read<int32_t>();
     readColumns(source, pool, childTypes, children, useLosslessTimestamp);
   } else {
@@ -2217,4 +2324,10 @@ void PrestoVectorSerde::registerVectorSerde() {
   velox::registerVectorSerde(std::make_unique<PrestoVectorSerde>());
 }
 
+// static
+void PrestoVectorSerde::registerNamedVectorSerde() {
+  velox::registerNamedVectorSerde(
+      "Presto", std::make_unique<PrestoVectorSerde>());
+}
+
 } // namespace facebook::velox::serializer::presto
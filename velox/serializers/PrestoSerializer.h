@@ -70,6 +70,11 @@ class PrestoVectorSerde : public VectorSerde {
       std::shared_ptr<RowVector>* result,
       const Options* options) override;
   static void registerVectorSerde();
+
+  /// Registers this serde under the name "Presto" so it can be selected per
+  /// query, e.g. as the exchange wire format via the exchange_vector_serde
+  /// query config.
+  static void registerNamedVectorSerde();
 };
 
 // Testing function for nested encodings. See comments in scatterStructNulls().
@@ -15,7 +15,6 @@
  */
 #include "velox/serializers/UnsafeRowSerializer.h"
 #include <folly/lang/Bits.h>
-#include "velox/row/UnsafeRowDeserializers.h"
 #include "velox/row/UnsafeRowFast.h"
 
 namespace facebook::velox::serializer::spark {
@@ -126,9 +125,7 @@ void UnsafeRowVectorSerde::deserialize(
     return;
   }
 
-  *result = std::dynamic_pointer_cast<RowVector>(
-      velox::row::UnsafeRowDeserializer::deserialize(
-          serializedRows, type, pool));
+  *result = velox::row::UnsafeRowFast::deserialize(serializedRows, type, pool);
 }
 
 // static
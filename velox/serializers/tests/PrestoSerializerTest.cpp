@@ -332,6 +332,33 @@ TEST_P(PrestoSerializerTest, multiPage) {
   }
 }
 
+TEST_P(PrestoSerializerTest, streamGroupReuse) {
+  // Serializes several pages through one VectorStreamGroup, clearing it
+  // between pages as PartitionedOutput does, and verifies each page
+  // round-trips.
+  auto paramOptions = getParamSerdeOptions(nullptr);
+  VectorStreamGroup group(pool_.get(), serde_.get());
+
+  for (int size : {1234, 538, 2408}) {
+    auto vec = makeTestVector(size);
+    auto rowType = asRowType(vec->type());
+
+    ASSERT_FALSE(group.hasStreamTree());
+    group.createStreamTree(rowType, size, &paramOptions);
+    ASSERT_TRUE(group.hasStreamTree());
+    group.append(vec);
+
+    std::ostringstream out;
+    facebook::velox::serializer::presto::PrestoOutputStreamListener listener;
+    OStreamOutputStream outStream(&out, &listener);
+    group.flush(&outStream);
+    group.clear();
+
+    auto deserialized = deserialize(rowType, out.str(), nullptr);
+    assertEqualVectors(deserialized, vec);
+  }
+}
+
 TEST_P(PrestoSerializerTest, timestampWithNanosecondPrecision) {
   // Verify that nanosecond precision is preserved when the right options are
   // passed to the serde.
@@ -404,6 +431,28 @@ TEST_P(PrestoSerializerTest, encodings) {
   testEncodedRoundTrip(data);
 }
 
+TEST_P(PrestoSerializerTest, lowCardinalityStrings) {
+  // Flat string columns with few distinct values are shipped
+  // dictionary-encoded.
+  auto data = vectorMaker_->rowVector({
+      vectorMaker_->flatVector<StringView>(
+          128,
+          [](auto row) {
+            return StringView(row % 3 == 0 ? "apple" : "banana");
+          }),
+  });
+
+  std::ostringstream out;
+  serializeEncoded(data, &out, nullptr);
+
+  auto rowType = asRowType(data->type());
+  auto deserialized = deserialize(rowType, out.str(), nullptr);
+
+  assertEqualVectors(data, deserialized);
+  ASSERT_EQ(
+      deserialized->childAt(0)->encoding(), VectorEncoding::Simple::DICTIONARY);
+}
+
 TEST_P(PrestoSerializerTest, scatterEncoded) {
   // Makes a struct with nulls and constant/dictionary encoded children. The
   // children need to get gaps where the parent struct has a null.
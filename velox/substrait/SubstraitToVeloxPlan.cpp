@@ -555,6 +555,19 @@ core::PlanNodePtr SubstraitVeloxPlanConverter::toVeloxPlan(
 
 core::PlanNodePtr SubstraitVeloxPlanConverter::toVeloxPlan(
     const ::substrait::Plan& substraitPlan) {
+  std::string fingerprint;
+  if (planCache_ != nullptr) {
+    fingerprint = SubstraitVeloxPlanCache::planFingerprint(substraitPlan);
+    if (auto cached = planCache_->find(fingerprint)) {
+      // Adopt the maps produced by the original conversion so that callers of
+      // getFunctionMap() and splitInfos() see the same state as after a fresh
+      // conversion.
+      functionMap_ = cached->functionMap;
+      splitInfoMap_ = cached->splitInfoMap;
+      return cached->plan;
+    }
+  }
+
   VELOX_CHECK(
       checkTypeExtension(substraitPlan),
       "The type extension only have unknown type.")
@@ -568,14 +581,23 @@ core::PlanNodePtr SubstraitVeloxPlanConverter::toVeloxPlan(
   // In fact, only one RelRoot or Rel is expected here.
   VELOX_CHECK_EQ(substraitPlan.relations_size(), 1);
   const auto& rel = substraitPlan.relations(0);
+  core::PlanNodePtr veloxPlan;
   if (rel.has_root()) {
-    return toVeloxPlan(rel.root());
-  }
-  if (rel.has_rel()) {
-    return toVeloxPlan(rel.rel());
+    veloxPlan = toVeloxPlan(rel.root());
+  } else if (rel.has_rel()) {
+    veloxPlan = toVeloxPlan(rel.rel());
+  } else {
+    VELOX_FAIL("RelRoot or Rel is expected in Plan.");
   }
 
-  VELOX_FAIL("RelRoot or Rel is expected in Plan.");
+  if (planCache_ != nullptr) {
+    planCache_->insert(
+        fingerprint,
+        std::make_shared<SubstraitVeloxPlanCache::CachedPlan>(
+            SubstraitVeloxPlanCache::CachedPlan{
+                veloxPlan, functionMap_, splitInfoMap_}));
+  }
+  return veloxPlan;
 }
 
 std::string SubstraitVeloxPlanConverter::nextPlanNodeId() {
@@ -787,4 +809,27 @@ const std::string& SubstraitVeloxPlanConverter::findFunction(
   return substraitParser_->findFunctionSpec(functionMap_, id);
 }
 
+// static
+std::string SubstraitVeloxPlanCache::planFingerprint(
+    const ::substrait::Plan& substraitPlan) {
+  return substraitPlan.SerializeAsString();
+}
+
+std::shared_ptr<const SubstraitVeloxPlanCache::CachedPlan>
+SubstraitVeloxPlanCache::find(const std::string& fingerprint) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = plans_.find(fingerprint);
+  return it == plans_.end() ? nullptr : it->second;
+}
+
+void SubstraitVeloxPlanCache::insert(
+    const std::string& fingerprint,
+    std::shared_ptr<const CachedPlan> cachedPlan) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (plans_.size() >= maxEntries_) {
+    return;
+  }
+  plans_.emplace(fingerprint, std::move(cachedPlan));
+}
+
 } // namespace facebook::velox::substrait
@@ -27,11 +27,17 @@
 
 namespace facebook::velox::substrait {
 
+class SubstraitVeloxPlanCache;
+
 /// This class is used to convert the Substrait plan into Velox plan.
 class SubstraitVeloxPlanConverter {
  public:
-  explicit SubstraitVeloxPlanConverter(memory::MemoryPool* pool)
-      : pool_(pool) {}
+  /// An optional 'planCache' may be shared across converters to reuse the
+  /// Velox plans of Substrait plans that were converted before.
+  explicit SubstraitVeloxPlanConverter(
+      memory::MemoryPool* pool,
+      std::shared_ptr<SubstraitVeloxPlanCache> planCache = nullptr)
+      : pool_(pool), planCache_(std::move(planCache)) {}
   struct SplitInfo {
     /// The Partition index.
     u_int32_t partitionIndex;
@@ -174,6 +180,10 @@ class SubstraitVeloxPlanConverter {
   /// Memory pool.
   memory::MemoryPool* pool_;
 
+  /// Optional cache of converted plans shared across converters. No caching
+  /// takes place if null.
+  std::shared_ptr<SubstraitVeloxPlanCache> planCache_;
+
   /// Helper function to convert the input of Substrait Rel to Velox Node.
   template <typename T>
   core::PlanNodePtr convertSingleInput(T rel) {
@@ -182,4 +192,53 @@ class SubstraitVeloxPlanConverter {
   }
 };
 
+/// Caches converted Velox plans keyed by a fingerprint of the Substrait plan,
+/// so that frontends sending many identical plans pay the conversion and
+/// validation cost only once. The cached plan trees are immutable and can be
+/// shared across queries. Thread-safe; share a single instance across
+/// converters to reuse plans between them.
+class SubstraitVeloxPlanCache {
+ public:
+  /// The result of converting one Substrait plan.
+  struct CachedPlan {
+    /// Root node of the converted Velox plan.
+    core::PlanNodePtr plan;
+
+    /// The map between the function id and the function name constructed for
+    /// the plan.
+    std::unordered_map<uint64_t, std::string> functionMap;
+
+    /// Mapping from leaf plan node ID to splits.
+    std::unordered_map<
+        core::PlanNodeId,
+        std::shared_ptr<SubstraitVeloxPlanConverter::SplitInfo>>
+        splitInfoMap;
+  };
+
+  explicit SubstraitVeloxPlanCache(uint32_t maxEntries = 1'000)
+      : maxEntries_(maxEntries) {}
+
+  /// Returns the fingerprint identifying 'substraitPlan': its serialized
+  /// bytes. Keying the cache by the full bytes rather than a hash of them
+  /// rules out collisions between different plans.
+  static std::string planFingerprint(const ::substrait::Plan& substraitPlan);
+
+  /// Returns the cached conversion of the plan with 'fingerprint', or nullptr
+  /// if that plan has not been converted yet.
+  std::shared_ptr<const CachedPlan> find(const std::string& fingerprint) const;
+
+  /// Associates 'cachedPlan' with 'fingerprint'. No-op if an entry already
+  /// exists or the cache is full.
+  void insert(
+      const std::string& fingerprint,
+      std::shared_ptr<const CachedPlan> cachedPlan);
+
+ private:
+  const uint32_t maxEntries_;
+
+  mutable std::mutex mutex_;
+
+  std::unordered_map<std::string, std::shared_ptr<const CachedPlan>> plans_;
+};
+
 } // namespace facebook::velox::substrait
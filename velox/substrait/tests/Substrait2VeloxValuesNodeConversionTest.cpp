@@ -60,3 +60,37 @@ TEST_F(Substrait2VeloxValuesNodeConversionTest, valuesNode) {
   createDuckDbTable({expectedData});
   assertQuery(veloxPlan, "SELECT * FROM tmp");
 }
+
+TEST_F(Substrait2VeloxValuesNodeConversionTest, planCache) {
+  auto planPath = getDataFilePath(
+      "velox/substrait/tests", "data/substrait_virtualTable.json");
+
+  ::substrait::Plan substraitPlan;
+  JsonToProtoConverter::readFromFile(planPath, substraitPlan);
+
+  auto planCache = std::make_shared<SubstraitVeloxPlanCache>();
+  SubstraitVeloxPlanConverter converter1(pool_.get(), planCache);
+  auto veloxPlan = converter1.toVeloxPlan(substraitPlan);
+
+  // A converter sharing the cache reuses the converted plan tree instead of
+  // rebuilding it, and reports the same function map as a fresh conversion.
+  SubstraitVeloxPlanConverter converter2(pool_.get(), planCache);
+  auto cachedPlan = converter2.toVeloxPlan(substraitPlan);
+  EXPECT_EQ(veloxPlan.get(), cachedPlan.get());
+  EXPECT_EQ(converter1.getFunctionMap(), converter2.getFunctionMap());
+
+  // The cached plan stays runnable.
+  createDuckDbTable({makeRowVector(
+      {makeFlatVector<int64_t>(
+           {2499109626526694126, 2342493223442167775, 4077358421272316858}),
+       makeFlatVector<int32_t>({581869302, -708632711, -133711905}),
+       makeFlatVector<double>(
+           {0.90579193414549275, 0.96886777112423139, 0.63235925003444637}),
+       makeFlatVector<bool>({true, false, false}),
+       makeFlatVector<int32_t>(3, nullptr, nullEvery(1))})});
+  assertQuery(cachedPlan, "SELECT * FROM tmp");
+
+  // A converter without a cache rebuilds the plan.
+  SubstraitVeloxPlanConverter converter3(pool_.get());
+  EXPECT_NE(veloxPlan.get(), converter3.toVeloxPlan(substraitPlan).get());
+}
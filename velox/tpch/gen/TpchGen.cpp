@@ -15,6 +15,7 @@
  */
 
 #include "velox/tpch/gen/TpchGen.h"
+#include <folly/futures/Future.h>
 #include <velox/tpch/gen/dbgen/include/tpch_constants.hpp>
 #include "velox/tpch/gen/DBGenIterator.h"
 #include "velox/vector/FlatVector.h"
@@ -749,6 +750,73 @@ RowVectorPtr genTpchRegion(
       pool, regionRowType, BufferPtr(nullptr), vectorSize, std::move(children));
 }
 
+RowVectorPtr genTpchData(
+    Table table,
+    memory::MemoryPool* pool,
+    size_t maxRows,
+    size_t offset,
+    double scaleFactor) {
+  switch (table) {
+    case Table::TBL_PART:
+      return genTpchPart(pool, maxRows, offset, scaleFactor);
+    case Table::TBL_SUPPLIER:
+      return genTpchSupplier(pool, maxRows, offset, scaleFactor);
+    case Table::TBL_PARTSUPP:
+      return genTpchPartSupp(pool, maxRows, offset, scaleFactor);
+    case Table::TBL_CUSTOMER:
+      return genTpchCustomer(pool, maxRows, offset, scaleFactor);
+    case Table::TBL_ORDERS:
+      return genTpchOrders(pool, maxRows, offset, scaleFactor);
+    case Table::TBL_LINEITEM:
+      return genTpchLineItem(pool, maxRows, offset, scaleFactor);
+    case Table::TBL_NATION:
+      return genTpchNation(pool, maxRows, offset, scaleFactor);
+    case Table::TBL_REGION:
+      return genTpchRegion(pool, maxRows, offset, scaleFactor);
+  }
+  return nullptr; // make gcc happy.
+}
+
+std::vector<RowVectorPtr> genTpchDataInParallel(
+    Table table,
+    memory::MemoryPool* pool,
+    size_t maxRows,
+    size_t offset,
+    double scaleFactor,
+    folly::Executor* executor,
+    size_t maxRowsPerBatch) {
+  VELOX_CHECK_NOT_NULL(executor);
+  VELOX_CHECK_GT(maxRowsPerBatch, 0);
+
+  // Each batch gets its own dbgen context (created inside genTpchData), so
+  // batches can be generated independently and in any order.
+  std::vector<folly::SemiFuture<RowVectorPtr>> futures;
+  futures.reserve((maxRows + maxRowsPerBatch - 1) / maxRowsPerBatch);
+
+  for (size_t batchOffset = offset; batchOffset < offset + maxRows;
+       batchOffset += maxRowsPerBatch) {
+    const size_t batchRows =
+        std::min(maxRowsPerBatch, offset + maxRows - batchOffset);
+    futures.push_back(folly::via(executor, [=] {
+                        return genTpchData(
+                            table, pool, batchRows, batchOffset, scaleFactor);
+                      }).semi());
+  }
+
+  auto results = folly::collectAll(std::move(futures)).get();
+
+  std::vector<RowVectorPtr> batches;
+  batches.reserve(results.size());
+  for (auto& result : results) {
+    // Re-throws if any batch generation failed.
+    auto batch = std::move(result).value();
+    if (batch != nullptr && batch->size() > 0) {
+      batches.push_back(std::move(batch));
+    }
+  }
+  return batches;
+}
+
 std::string getQuery(int query) {
   if (query <= 0 || query > TPCH_QUERIES_COUNT) {
     VELOX_FAIL("Out of range TPC-H query number {}", query);
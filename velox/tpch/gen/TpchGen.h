@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <folly/Executor.h>
+
 #include "velox/common/memory/Memory.h"
 #include "velox/vector/ComplexVector.h"
 
@@ -235,6 +237,37 @@ RowVectorPtr genTpchRegion(
     size_t offset = 0,
     double scaleFactor = 1);
 
+/// Returns a row vector containing at most `maxRows` rows of `table`, starting
+/// at `offset`, and given the scale factor. Dispatches to the table-specific
+/// functions above. For lineitem, `maxRows` and `offset` follow the orders
+/// based semantic described in genTpchLineItem().
+RowVectorPtr genTpchData(
+    Table table,
+    memory::MemoryPool* pool,
+    size_t maxRows = 10000,
+    size_t offset = 0,
+    double scaleFactor = 1);
+
+/// Generates rows [offset, offset + maxRows) of `table` as a sequence of
+/// batches of up to `maxRowsPerBatch` rows each, generating the batches in
+/// parallel on `executor`. Each batch is produced by an independent dbgen
+/// context writing directly into its own flat vectors, so the returned
+/// batches, in order, contain exactly the rows that sequential genTpchData()
+/// calls with the same batch boundaries would produce. Blocks until all
+/// batches are generated; batches that fall past the end of the table are
+/// omitted.
+///
+/// For lineitem, `maxRows`, `offset` and `maxRowsPerBatch` are in terms of
+/// orders, following the semantic described in genTpchLineItem().
+std::vector<RowVectorPtr> genTpchDataInParallel(
+    Table table,
+    memory::MemoryPool* pool,
+    size_t maxRows,
+    size_t offset,
+    double scaleFactor,
+    folly::Executor* executor,
+    size_t maxRowsPerBatch = 10'000);
+
 /// Gets the specified TPC-H query number as a string.
 std::string getQuery(int query);
 
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/init/Init.h>
 #include "gtest/gtest.h"
 
@@ -818,6 +819,52 @@ TEST_F(TpchGenTestCustomerTest, reproducible) {
   }
 }
 
+// Parallel generation.
+class TpchGenTestParallelTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    pool_ =
+        memory::defaultMemoryManager().addLeafPool("TpchGenTestParallelTest");
+  }
+
+  std::shared_ptr<memory::MemoryPool> pool_;
+};
+
+TEST_F(TpchGenTestParallelTest, ordersMatchSequential) {
+  folly::CPUThreadPoolExecutor executor(4);
+  auto batches = genTpchDataInParallel(
+      Table::TBL_ORDERS, pool_.get(), 10'000, 0, 1, &executor, 1'000);
+  ASSERT_EQ(10, batches.size());
+
+  // Concatenating the batches in order must yield the same rows as a single
+  // sequential call.
+  auto expected = genTpchOrders(pool_.get(), 10'000);
+  size_t row = 0;
+  for (const auto& batch : batches) {
+    EXPECT_EQ(9, batch->childrenSize());
+    for (size_t i = 0; i < batch->size(); ++i, ++row) {
+      ASSERT_TRUE(batch->equalValueAt(expected.get(), i, row));
+    }
+  }
+  EXPECT_EQ(10'000, row);
+}
+
+TEST_F(TpchGenTestParallelTest, lastBatch) {
+  folly::CPUThreadPoolExecutor executor(4);
+
+  // Only 5 of the last 10 customers exist; batches past the end are omitted.
+  auto batches = genTpchDataInParallel(
+      Table::TBL_CUSTOMER, pool_.get(), 10, 149'995, 1, &executor, 4);
+  ASSERT_EQ(2, batches.size());
+  EXPECT_EQ(4, batches[0]->size());
+  EXPECT_EQ(1, batches[1]->size());
+
+  // Zero batches if we go beyond the end.
+  batches = genTpchDataInParallel(
+      Table::TBL_CUSTOMER, pool_.get(), 1'000, 200'000, 1, &executor, 100);
+  EXPECT_EQ(0, batches.size());
+}
+
 } // namespace
 
 int main(int argc, char** argv) {
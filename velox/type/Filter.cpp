@@ -20,7 +20,10 @@
 #include <set>
 #include <string>
 
+#include <folly/Hash.h>
+
 #include "velox/common/base/Exceptions.h"
+#include "velox/common/encode/Base64.h"
 #include "velox/type/Filter.h"
 
 namespace facebook::velox::common {
@@ -94,6 +97,9 @@ std::string Filter::toString() const {
     case FilterKind::kHugeintValuesUsingHashTable:
       strKind = "HugeintValuesUsingHashTable";
       break;
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      strKind = "BigintValuesUsingBloomFilter";
+      break;
   };
 
   return fmt::format(
@@ -131,6 +137,8 @@ std::unordered_map<FilterKind, std::string> filterKindNames() {
       {FilterKind::kTimestampRange, "kTimestampRange"},
       {FilterKind::kHugeintValuesUsingHashTable,
        "kHugeintValuesUsingHashTable"},
+      {FilterKind::kBigintValuesUsingBloomFilter,
+       "kBigintValuesUsingBloomFilter"},
   };
 }
 
@@ -190,6 +198,8 @@ void Filter::registerSerDe() {
       NegatedBigintValuesUsingBitmask::create);
   registry.Register(
       "HugeintValuesUsingHashTable", HugeintValuesUsingHashTable::create);
+  registry.Register(
+      "BigintValuesUsingBloomFilter", BigintValuesUsingBloomFilter::create);
   registry.Register("FloatRange", AbstractRange::create);
   registry.Register("DoubleRange", AbstractRange::create);
   registry.Register("BytesRange", BytesRange::create);
@@ -395,8 +405,8 @@ folly::dynamic BigintValuesUsingBitmask::serialize() const {
   obj["max"] = max_;
 
   folly::dynamic values = folly::dynamic::array;
-  for (size_t i = 0; i < bitmask_.size(); ++i) {
-    if (bitmask_[i]) {
+  for (int64_t i = 0; i <= max_ - min_; ++i) {
+    if (bits::isBitSet(bitmask_.data(), i)) {
       values.push_back(i + min_);
     }
   }
@@ -768,10 +778,10 @@ BigintValuesUsingBitmask::BigintValuesUsingBitmask(
   VELOX_CHECK(min < max, "min must be less than max");
   VELOX_CHECK(values.size() > 1, "values must contain at least 2 entries");
 
-  bitmask_.resize(max - min + 1);
+  bitmask_.resize(bits::nwords(max - min + 1));
 
   for (int64_t value : values) {
-    bitmask_[value - min] = true;
+    bits::setBit(bitmask_.data(), value - min);
   }
 }
 
@@ -779,13 +789,42 @@ bool BigintValuesUsingBitmask::testInt64(int64_t value) const {
   if (value < min_ || value > max_) {
     return false;
   }
-  return bitmask_[value - min_];
+  return bits::isBitSet(bitmask_.data(), value - min_);
+}
+
+xsimd::batch_bool<int64_t> BigintValuesUsingBitmask::testValues(
+    xsimd::batch<int64_t> x) const {
+  auto outOfRange = (x < xsimd::broadcast<int64_t>(min_)) |
+      (x > xsimd::broadcast<int64_t>(max_));
+  if (simd::toBitMask(outOfRange) == simd::allSetBitMask<int64_t>()) {
+    return xsimd::batch_bool<int64_t>(false);
+  }
+  auto bit = x - xsimd::broadcast<int64_t>(min_);
+  // Gather the word holding the bit for each in range lane. Out of range
+  // lanes get an all zeros word, so their bit tests false.
+  auto words = simd::maskGather(
+      xsimd::broadcast<int64_t>(0),
+      ~outOfRange,
+      reinterpret_cast<const int64_t*>(bitmask_.data()),
+      bit >> 6);
+  return ((words >> (bit & xsimd::broadcast<int64_t>(63))) &
+          xsimd::broadcast<int64_t>(1)) != xsimd::broadcast<int64_t>(0);
+}
+
+xsimd::batch_bool<int32_t> BigintValuesUsingBitmask::testValues(
+    xsimd::batch<int32_t> x) const {
+  // The bitmap is probed with 64 bit lanes since 'min_' and 'max_' may not
+  // fit in 32 bits.
+  auto first = simd::toBitMask(testValues(simd::getHalf<int64_t, 0>(x)));
+  auto second = simd::toBitMask(testValues(simd::getHalf<int64_t, 1>(x)));
+  return simd::fromBitMask<int32_t>(
+      first | (second << xsimd::batch<int64_t>::size));
 }
 
 std::vector<int64_t> BigintValuesUsingBitmask::values() const {
   std::vector<int64_t> values;
-  for (int i = 0; i < bitmask_.size(); i++) {
-    if (bitmask_[i]) {
+  for (int64_t i = 0; i <= max_ - min_; i++) {
+    if (bits::isBitSet(bitmask_.data(), i)) {
       values.push_back(min_ + i);
     }
   }
@@ -874,13 +913,16 @@ xsimd::batch_bool<int64_t> BigintValuesUsingHashTable::testValues(
     xsimd::batch<int64_t> x) const {
   auto outOfRange = (x < xsimd::broadcast<int64_t>(min_)) |
       (x > xsimd::broadcast<int64_t>(max_));
-  if (simd::toBitMask(outOfRange) == simd::allSetBitMask<int64_t>()) {
-    return xsimd::batch_bool<int64_t>(false);
-  }
+  auto allEmpty = xsimd::broadcast<int64_t>(kEmptyMarker);
+  uint16_t emptyHits = 0;
   if (containsEmptyMarker_) {
-    return Filter::testValues(x);
+    // kEmptyMarker is never stored in the table, so lanes equal to it pass
+    // here and read as misses in the probe below.
+    emptyHits = simd::toBitMask(x == allEmpty);
+  }
+  if (simd::toBitMask(outOfRange) == simd::allSetBitMask<int64_t>()) {
+    return simd::fromBitMask<int64_t>(emptyHits);
   }
-  auto allEmpty = xsimd::broadcast<int64_t>(kEmptyMarker);
   // Temporarily casted to unsigned to suppress overflow error.
   auto indices = simd::reinterpretBatch<int64_t>(
       simd::reinterpretBatch<uint64_t>(x) * M & sizeMask_);
@@ -890,12 +932,12 @@ xsimd::batch_bool<int64_t> BigintValuesUsingHashTable::testValues(
   // lanes must check next positions.
 
   auto result = x == data;
-  auto resultBits = simd::toBitMask(result);
+  auto resultBits = simd::toBitMask(result) | emptyHits;
   auto missed = simd::toBitMask(data == allEmpty);
   static_assert(decltype(result)::size <= 16);
   uint16_t unresolved = simd::allSetBitMask<int64_t>() ^ (resultBits | missed);
   if (!unresolved) {
-    return result;
+    return simd::fromBitMask<int64_t>(resultBits);
   }
   constexpr int kAlign = xsimd::default_arch::alignment();
   constexpr int kArraySize = xsimd::batch<int64_t>::size;
@@ -1877,6 +1919,8 @@ std::unique_ptr<Filter> BigintRange::mergeWith(const Filter* other) const {
           std::make_unique<common::BigintRange>(lower_, upper_, false));
       return combineRangesAndNegatedValues(rangeList, vals, bothNullAllowed);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -1996,6 +2040,8 @@ std::unique_ptr<Filter> NegatedBigintRange::mergeWith(
           negatedValuesToRanges(rejectedValues),
           bothNullAllowed);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2054,6 +2100,8 @@ std::unique_ptr<Filter> BigintValuesUsingHashTable::mergeWith(
     case FilterKind::kNegatedBigintValuesUsingHashTable: {
       return mergeWith(min_, max_, other);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2133,7 +2181,8 @@ std::unique_ptr<Filter> BigintValuesUsingBitmask::mergeWith(
         auto min = std::max(min_, range->lower());
         auto max = std::min(max_, range->upper());
         for (auto i = min; i <= max; ++i) {
-          if (bitmask_[i - min_] && range->testInt64(i)) {
+          if (bits::isBitSet(bitmask_.data(), i - min_) &&
+              range->testInt64(i)) {
             valuesToKeep.push_back(i);
           }
         }
@@ -2147,6 +2196,8 @@ std::unique_ptr<Filter> BigintValuesUsingBitmask::mergeWith(
     case FilterKind::kNegatedBigintValuesUsingHashTable: {
       return mergeWith(min_, max_, other);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2160,13 +2211,96 @@ std::unique_ptr<Filter> BigintValuesUsingBitmask::mergeWith(
 
   std::vector<int64_t> valuesToKeep;
   for (auto i = min; i <= max; ++i) {
-    if (bitmask_[i - min_] && other->testInt64(i)) {
+    if (bits::isBitSet(bitmask_.data(), i - min_) && other->testInt64(i)) {
       valuesToKeep.push_back(i);
     }
   }
   return createBigintValues(valuesToKeep, bothNullAllowed);
 }
 
+BigintValuesUsingBloomFilter::BigintValuesUsingBloomFilter(
+    int64_t min,
+    int64_t max,
+    const BloomFilter<>& bloomFilter,
+    bool nullAllowed)
+    : Filter(true, nullAllowed, FilterKind::kBigintValuesUsingBloomFilter),
+      min_(min),
+      max_(max),
+      bloomFilter_(bloomFilter) {
+  VELOX_CHECK_LE(min, max, "min must be no greater than max");
+  VELOX_CHECK(bloomFilter_.isSet(), "bloomFilter must not be empty");
+}
+
+bool BigintValuesUsingBloomFilter::testInt64(int64_t value) const {
+  if (value < min_ || value > max_) {
+    return false;
+  }
+  return bloomFilter_.mayContain(folly::hasher<int64_t>()(value));
+}
+
+bool BigintValuesUsingBloomFilter::testInt64Range(
+    int64_t min,
+    int64_t max,
+    bool hasNull) const {
+  if (hasNull && nullAllowed_) {
+    return true;
+  }
+  if (min == max) {
+    return testInt64(min);
+  }
+  // The Bloom filter cannot prove a range empty, so only the value range can
+  // reject.
+  return !(min > max_ || max < min_);
+}
+
+folly::dynamic BigintValuesUsingBloomFilter::serialize() const {
+  auto obj = Filter::serializeBase("BigintValuesUsingBloomFilter");
+  obj["min"] = min_;
+  obj["max"] = max_;
+  std::string bits;
+  bits.resize(bloomFilter_.serializedSize());
+  bloomFilter_.serialize(bits.data());
+  obj["bloomFilter"] = encoding::Base64::encode(bits.data(), bits.size());
+  return obj;
+}
+
+FilterPtr BigintValuesUsingBloomFilter::create(const folly::dynamic& obj) {
+  auto min = obj["min"].asInt();
+  auto max = obj["max"].asInt();
+  auto nullAllowed = deserializeNullAllowed(obj);
+  auto bits = encoding::Base64::decode(obj["bloomFilter"].asString());
+  BloomFilter<> bloomFilter;
+  bloomFilter.merge(bits.data());
+  return std::make_unique<BigintValuesUsingBloomFilter>(
+      min, max, bloomFilter, nullAllowed);
+}
+
+std::unique_ptr<Filter> BigintValuesUsingBloomFilter::mergeWith(
+    const Filter* other) const {
+  switch (other->kind()) {
+    case FilterKind::kAlwaysTrue:
+    case FilterKind::kAlwaysFalse:
+    case FilterKind::kIsNull:
+      return other->mergeWith(this);
+    case FilterKind::kIsNotNull:
+      return std::make_unique<BigintValuesUsingBloomFilter>(*this, false);
+    default: {
+      // The Bloom filter part of 'this' is conservative: every value it
+      // rejects is also rejected by the hash join that produced it, so it can
+      // be dropped from a conjunction. Keep 'other' exact and restrict it to
+      // this filter's value range.
+      BigintRange range(min_, max_, nullAllowed_);
+      return other->mergeWith(&range);
+    }
+  }
+}
+
+bool BigintValuesUsingBloomFilter::testingEquals(const Filter& other) const {
+  auto otherBloom = dynamic_cast<const BigintValuesUsingBloomFilter*>(&other);
+  return otherBloom != nullptr && Filter::testingBaseEquals(other) &&
+      min_ == otherBloom->min_ && max_ == otherBloom->max_;
+}
+
 std::unique_ptr<Filter> NegatedBigintValuesUsingHashTable::mergeWith(
     const Filter* other) const {
   // Rules of NegatedBigintValuesUsingHashTable with IsNull/IsNotNull
@@ -2201,6 +2335,8 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingHashTable::mergeWith(
     case FilterKind::kNegatedBigintValuesUsingBitmask: {
       return other->mergeWith(this);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2245,6 +2381,8 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingBitmask::mergeWith(
       return combineNegatedBigintLists(
           values(), otherBitmask->values(), bothNullAllowed);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2318,6 +2456,8 @@ std::unique_ptr<Filter> BigintMultiRange::mergeWith(const Filter* other) const {
       bool bothNullAllowed = nullAllowed_ && other->testNull();
       return combineRangesAndNegatedValues(ranges_, rejects, bothNullAllowed);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -27,6 +27,7 @@
 
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/SimdUtil.h"
+#include "velox/common/base/BloomFilter.h"
 #include "velox/common/serialization/Serializable.h"
 #include "velox/type/StringView.h"
 #include "velox/type/Type.h"
@@ -56,6 +57,7 @@ enum class FilterKind {
   kHugeintRange,
   kTimestampRange,
   kHugeintValuesUsingHashTable,
+  kBigintValuesUsingBloomFilter,
 };
 
 class Filter;
@@ -1060,6 +1062,10 @@ class BigintValuesUsingBitmask final : public Filter {
 
   bool testInt64(int64_t value) const final;
 
+  xsimd::batch_bool<int64_t> testValues(xsimd::batch<int64_t>) const final;
+
+  xsimd::batch_bool<int32_t> testValues(xsimd::batch<int32_t>) const final;
+
   bool testInt64Range(int64_t min, int64_t max, bool hasNull) const final;
 
   std::unique_ptr<Filter> mergeWith(const Filter* other) const final;
@@ -1070,9 +1076,82 @@ class BigintValuesUsingBitmask final : public Filter {
   std::unique_ptr<Filter>
   mergeWith(int64_t min, int64_t max, const Filter* other) const;
 
-  std::vector<bool> bitmask_;
+  // Bit for each value in [min_, max_]. Stored as words so that testValues()
+  // can gather the word for each lane of a batch.
+  std::vector<uint64_t> bitmask_;
+  const int64_t min_;
+  const int64_t max_;
+};
+
+/// Approximate IN-list filter for integral data types backed by a Bloom
+/// filter over the hashes of the values. Passes all values that are probably
+/// in the set; may produce false positives but no false negatives, so it must
+/// only be used where a downstream operator re-verifies matches, e.g. as a
+/// dynamic filter pushed from a hash join to a scan. Good for large numbers
+/// of distinct values where an exact IN-list would be too big to build.
+class BigintValuesUsingBloomFilter final : public Filter {
+ public:
+  /// @param min Minimum value in the Bloom filter.
+  /// @param max Maximum value in the Bloom filter.
+  /// @param bloomFilter Bloom filter over folly::hasher<int64_t> hashes of
+  /// the values.
+  /// @param nullAllowed Null values are passing the filter if true.
+  BigintValuesUsingBloomFilter(
+      int64_t min,
+      int64_t max,
+      const BloomFilter<>& bloomFilter,
+      bool nullAllowed);
+
+  BigintValuesUsingBloomFilter(
+      const BigintValuesUsingBloomFilter& other,
+      bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintValuesUsingBloomFilter),
+        min_(other.min_),
+        max_(other.max_),
+        bloomFilter_(other.bloomFilter_) {}
+
+  folly::dynamic serialize() const override;
+
+  static FilterPtr create(const folly::dynamic& obj);
+
+  std::unique_ptr<Filter> clone(
+      std::optional<bool> nullAllowed = std::nullopt) const final {
+    if (nullAllowed) {
+      return std::make_unique<BigintValuesUsingBloomFilter>(
+          *this, nullAllowed.value());
+    } else {
+      return std::make_unique<BigintValuesUsingBloomFilter>(*this);
+    }
+  }
+
+  bool testInt64(int64_t value) const final;
+
+  bool testInt64Range(int64_t min, int64_t max, bool hasNull) const final;
+
+  std::unique_ptr<Filter> mergeWith(const Filter* other) const final;
+
+  int64_t min() const {
+    return min_;
+  }
+
+  int64_t max() const {
+    return max_;
+  }
+
+  std::string toString() const final {
+    return fmt::format(
+        "BigintValuesUsingBloomFilter: [{}, {}] {}",
+        min_,
+        max_,
+        nullAllowed_ ? "with nulls" : "no nulls");
+  }
+
+  bool testingEquals(const Filter& other) const final;
+
+ private:
   const int64_t min_;
   const int64_t max_;
+  BloomFilter<> bloomFilter_;
 };
 
 // NOT IN-list filter for integral data types. Implemented as a hash table. Good
@@ -134,6 +134,99 @@ void Timestamp::toTimezone(int16_t tzID) {
   }
 }
 
+void TimezoneConverter::toGMT(Timestamp& timestamp) {
+  auto seconds = timestamp.getSeconds();
+  if ((seconds < localBegin_ || seconds >= localEnd_) &&
+      !updateLocalWindow(seconds)) {
+    timestamp.toGMT(*zone_);
+    return;
+  }
+  timestamp = Timestamp(seconds - localOffset_, timestamp.getNanos());
+}
+
+bool TimezoneConverter::updateLocalWindow(int64_t seconds) {
+  // The bounds the per value path accepts, see Timestamp::toGMT(). The lower
+  // bound is exclusive.
+  constexpr int64_t kMinLocal = -1096193779200l + 86400l;
+  if (seconds <= kMinLocal || seconds > Timestamp::kMaxSeconds) {
+    return false;
+  }
+  auto info = zone_->get_info(
+      date::local_seconds(std::chrono::seconds(seconds)));
+  if (info.result != date::local_info::unique) {
+    return false;
+  }
+  localOffset_ = info.first.offset.count();
+  // The window bounds are UTC instants. Local times just after the window
+  // begins are ambiguous with the previous window when the offset decreased
+  // across the transition; such times resolve to the earlier instant, i.e.
+  // with the previous window's offset, so exclude them from the cached range.
+  localBegin_ = kMinLocal + 1;
+  if (info.first.begin > date::sys_seconds::min()) {
+    auto prevOffset = zone_->get_info(info.first.begin - std::chrono::seconds(1))
+                          .offset.count();
+    localBegin_ = std::max(
+        localBegin_,
+        info.first.begin.time_since_epoch().count() +
+            std::max(localOffset_, prevOffset));
+  }
+  // Local times just before the window ends are either ambiguous with the
+  // next window and resolve to the earlier instant, i.e. with this window's
+  // offset, or are past the last existing local time of the window and miss
+  // the cache. Cap the range so that the converted seconds stay within
+  // Timestamp's range.
+  localEnd_ = Timestamp::kMaxSeconds + 1 + std::min<int64_t>(localOffset_, 0);
+  if (info.first.end < date::sys_seconds::max()) {
+    localEnd_ = std::min(
+        localEnd_, info.first.end.time_since_epoch().count() + localOffset_);
+  }
+  return true;
+}
+
+void TimezoneConverter::toTimezone(Timestamp& timestamp) {
+  auto seconds = timestamp.getSeconds();
+  if ((seconds < sysBegin_ || seconds >= sysEnd_) &&
+      !updateSysWindow(seconds)) {
+    timestamp.toTimezone(*zone_);
+    return;
+  }
+  timestamp = Timestamp(seconds + sysOffset_, timestamp.getNanos());
+}
+
+bool TimezoneConverter::updateSysWindow(int64_t seconds) {
+  // The bounds the per value path accepts, see validateTimePoint(). The upper
+  // bound is exclusive so that a fractional second cannot push the value past
+  // the last representable time point.
+  static const int64_t kMinSys =
+      std::chrono::duration_cast<std::chrono::seconds>(
+          date::sys_days{
+              date::year_month_day(
+                  date::year::min(), date::month(1), date::day(1))}
+              .time_since_epoch())
+          .count();
+  static const int64_t kMaxSys =
+      std::chrono::duration_cast<std::chrono::seconds>(
+          date::sys_days{
+              date::year_month_day(
+                  date::year::max(), date::month(12), date::day(31))}
+              .time_since_epoch())
+          .count();
+  if (seconds < kMinSys || seconds >= kMaxSys) {
+    return false;
+  }
+  auto info = zone_->get_info(date::sys_seconds(std::chrono::seconds(seconds)));
+  sysOffset_ = info.offset.count();
+  sysBegin_ = kMinSys;
+  if (info.begin > date::sys_seconds::min()) {
+    sysBegin_ = std::max(sysBegin_, info.begin.time_since_epoch().count());
+  }
+  sysEnd_ = kMaxSys;
+  if (info.end < date::sys_seconds::max()) {
+    sysEnd_ = std::min(sysEnd_, info.end.time_since_epoch().count());
+  }
+  return true;
+}
+
 namespace {
 
 constexpr int kTmYearBase = 1900;
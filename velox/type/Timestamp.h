@@ -314,6 +314,54 @@ struct Timestamp {
   uint64_t nanos_;
 };
 
+/// Converts Timestamps to or from a fixed time zone, caching the UTC offset
+/// transition window of the last converted value. A value falling inside the
+/// cached window is converted by adding a constant offset without consulting
+/// the time zone database. Event time columns are typically in or close to
+/// time order, so batches of them cross a transition window (months to years
+/// wide) at most a few times and nearly all rows take the cached path. Values
+/// outside the cached window fall back to the per value conversion, so
+/// results are the same as Timestamp::toGMT()/toTimezone() in any order of
+/// inputs. Not thread safe.
+class TimezoneConverter {
+ public:
+  explicit TimezoneConverter(const date::time_zone& zone) : zone_(&zone) {}
+
+  /// Same as Timestamp::toGMT(zone) for the zone given to the constructor.
+  void toGMT(Timestamp& timestamp);
+
+  /// Same as Timestamp::toTimezone(zone) for the zone given to the
+  /// constructor.
+  void toTimezone(Timestamp& timestamp);
+
+ private:
+  // Loads the offset window containing the local time 'seconds' into
+  // localBegin_/localEnd_/localOffset_. Returns false if 'seconds' does not
+  // denote a unique local time or is outside the supported range, in which
+  // case the caller falls back to the per value conversion.
+  bool updateLocalWindow(int64_t seconds);
+
+  // Loads the offset window containing the UTC time 'seconds' into
+  // sysBegin_/sysEnd_/sysOffset_. Returns false if 'seconds' is outside the
+  // supported range.
+  bool updateSysWindow(int64_t seconds);
+
+  const date::time_zone* zone_;
+
+  // Local time seconds in [localBegin_, localEnd_) convert to UTC by
+  // subtracting 'localOffset_'. Empty ranges, so the first conversion misses
+  // and loads the window.
+  int64_t localBegin_ = 0;
+  int64_t localEnd_ = 0;
+  int64_t localOffset_ = 0;
+
+  // UTC seconds in [sysBegin_, sysEnd_) convert to local time by adding
+  // 'sysOffset_'.
+  int64_t sysBegin_ = 0;
+  int64_t sysEnd_ = 0;
+  int64_t sysOffset_ = 0;
+};
+
 void parseTo(folly::StringPiece in, ::facebook::velox::Timestamp& out);
 
 template <typename T>
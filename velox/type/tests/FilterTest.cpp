@@ -394,6 +394,27 @@ TEST(FilterTest, bigintValuesUsingHashTableSimd) {
   ASSERT_TRUE(dynamic_cast<BigintValuesUsingHashTable*>(filter.get()));
   int64_t values[] = {3, 3, 3, 3};
   checkSimd(filter.get(), values, verify);
+
+  // Make a filter containing the empty marker of the hash table and verify
+  // that lanes equal to it hit while others still probe the table.
+  numbers.clear();
+  numbers.push_back(0xdeadbeefbadefeedL); // kEmptyMarker.
+  for (auto i = 0; i < 1000; ++i) {
+    numbers.push_back(i * 1209);
+  }
+  filter = createBigintValues(numbers, false);
+  ASSERT_TRUE(dynamic_cast<BigintValuesUsingHashTable*>(filter.get()));
+  applySimdTestToVector(numbers, *filter, verify);
+  int64_t markers[] = {
+      0xdeadbeefbadefeedL,
+      0xdeadbeefbadefeecL,
+      0,
+      1209,
+      0xdeadbeefbadefeedL,
+      -1,
+      1,
+      1210};
+  checkSimd(filter.get(), markers, verify);
 }
 
 TEST(FilterTest, negatedBigintValuesUsingHashTableSimd) {
@@ -454,6 +475,23 @@ TEST(FilterTest, bigintValuesUsingBitmask) {
   EXPECT_FALSE(filter->testInt64Range(1234, 2000, false));
 }
 
+TEST(FilterTest, bigintValuesUsingBitmaskSimd) {
+  std::vector<int64_t> numbers;
+  for (auto i = 0; i < 1000; ++i) {
+    numbers.push_back(1'000'000 + i * 3);
+  }
+  auto filter = createBigintValues(numbers, false);
+  ASSERT_TRUE(dynamic_cast<BigintValuesUsingBitmask*>(filter.get()));
+  auto verify = [&](int64_t x) { return filter->testInt64(x); };
+  int64_t outOfRange[] = {
+      -100, 0, 999'999, 1'003'000, -1, 1, 1'004'000, 1 << 30};
+  checkSimd(filter.get(), outOfRange, verify);
+  applySimdTestToVector(numbers, *filter, verify);
+
+  std::vector<int32_t> numbers32(numbers.begin(), numbers.end());
+  applySimdTestToVector(numbers32, *filter, verify);
+}
+
 TEST(FilterTest, negatedBigintValuesUsingBitmask) {
   auto filter = createNegatedBigintValues({1, 6, 1000, 8, 9, 100, 10}, false);
   auto castedFilter =
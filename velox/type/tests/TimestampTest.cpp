@@ -299,6 +299,57 @@ TEST(TimestampTest, outOfRange) {
       t.toTimezone(*timezone), "Timestamp is outside of supported range");
 }
 
+TEST(TimestampTest, timezoneConverter) {
+  auto* timezone = date::locate_zone("America/Los_Angeles");
+
+  // Sweep the year 2021 in 20 minute steps, crossing the DST transitions
+  // (2021-03-14 spring forward, 2021-11-07 fall back), in time order and
+  // backwards. The cached window must give the same results as the per value
+  // conversions, including the ambiguous hour after the fall back, which
+  // resolves to the earlier instant both ways.
+  std::vector<int64_t> seconds;
+  for (int64_t second = 1'609'459'200 /*2021-01-01 00:00:00 UTC*/;
+       second < 1'640'995'200 /*2022-01-01 00:00:00 UTC*/;
+       second += 1'200) {
+    seconds.push_back(second);
+  }
+  for (auto reverse : {false, true}) {
+    if (reverse) {
+      std::reverse(seconds.begin(), seconds.end());
+    }
+    TimezoneConverter converter(*timezone);
+    for (auto second : seconds) {
+      SCOPED_TRACE(fmt::format("second={} reverse={}", second, reverse));
+      Timestamp expected(second, 123);
+      Timestamp actual = expected;
+      expected.toTimezone(*timezone);
+      converter.toTimezone(actual);
+      ASSERT_EQ(expected, actual);
+
+      expected = Timestamp(second, 123);
+      actual = expected;
+      expected.toGMT(*timezone);
+      converter.toGMT(actual);
+      ASSERT_EQ(expected, actual);
+    }
+  }
+
+  // The nonexistent local hour of the spring forward fails the same way as
+  // the per value conversion.
+  TimezoneConverter converter(*timezone);
+  Timestamp nonexistent(1'615'689'000 /*2021-03-14 02:30:00 local*/, 0);
+  VELOX_ASSERT_THROW(converter.toGMT(nonexistent), "is in a gap between");
+
+  // Out of range values take the per value path and its errors.
+  Timestamp outOfRange(-3217830796800, 0);
+  VELOX_ASSERT_THROW(
+      converter.toTimezone(outOfRange),
+      "Timestamp is outside of supported range");
+  VELOX_ASSERT_THROW(
+      converter.toGMT(outOfRange),
+      "Timestamp seconds out of range for time zone adjustment");
+}
+
 TEST(TimestampTest, epochToUtc) {
   std::tm tm;
   ASSERT_FALSE(epochToUtc(-(1ll << 60), tm));
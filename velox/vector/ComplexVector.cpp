@@ -761,6 +761,30 @@ std::optional<int32_t> compareArrays(
   int result = leftRange.size() - rightRange.size();
   return flags.ascending ? result : result * -1;
 }
+
+// Returns true if any row in [offset, offset + size) of 'vector' is null or
+// contains a null in a nested vector.
+bool rangeContainsNulls(
+    const BaseVector& vector,
+    vector_size_t offset,
+    vector_size_t size) {
+  if (size == 0) {
+    return false;
+  }
+  // Fast path for flat scalar vectors: nested nulls are not possible, so a
+  // word-at-a-time scan of the null bits is enough.
+  if (vector.isFlatEncoding() && vector.type()->isPrimitiveType()) {
+    const auto* rawNulls = vector.rawNulls();
+    return rawNulls != nullptr &&
+        !bits::isAllSet(rawNulls, offset, offset + size, bits::kNotNull);
+  }
+  for (vector_size_t i = 0; i < size; ++i) {
+    if (vector.containsNullAt(offset + i)) {
+      return true;
+    }
+  }
+  return false;
+}
 } // namespace
 
 bool ArrayVector::containsNullAt(vector_size_t idx) const {
@@ -779,6 +803,28 @@ bool ArrayVector::containsNullAt(vector_size_t idx) const {
   return false;
 }
 
+bool ArrayVector::mayHaveNullsRecursive() const {
+  if (BaseVector::mayHaveNullsRecursive()) {
+    return true;
+  }
+  if (!elements_->mayHaveNullsRecursive()) {
+    return false;
+  }
+  // 'elements_' may hold nulls, but only the rows referenced by 'offsets_' and
+  // 'sizes_' matter. A null buffer may be left behind by slicing or by rows
+  // that were overwritten in place.
+  if (!referencedElementsMayHaveNulls_.has_value()) {
+    referencedElementsMayHaveNulls_ = false;
+    for (vector_size_t i = 0; i < size(); ++i) {
+      if (rangeContainsNulls(*elements_, rawOffsets_[i], rawSizes_[i])) {
+        referencedElementsMayHaveNulls_ = true;
+        break;
+      }
+    }
+  }
+  return referencedElementsMayHaveNulls_.value();
+}
+
 std::optional<int32_t> ArrayVector::compare(
     const BaseVector* other,
     vector_size_t index,
@@ -966,6 +1012,7 @@ void ArrayVector::validate(const VectorValidateOptions& options) const {
 void ArrayVector::copyRanges(
     const BaseVector* source,
     const folly::Range<const CopyRange*>& ranges) {
+  referencedElementsMayHaveNulls_.reset();
   copyRangesImpl(source, ranges, &elements_, nullptr);
 }
 
@@ -989,6 +1036,29 @@ bool MapVector::containsNullAt(vector_size_t idx) const {
   return false;
 }
 
+bool MapVector::mayHaveNullsRecursive() const {
+  if (BaseVector::mayHaveNullsRecursive()) {
+    return true;
+  }
+  if (!keys_->mayHaveNullsRecursive() && !values_->mayHaveNullsRecursive()) {
+    return false;
+  }
+  // 'keys_' or 'values_' may hold nulls, but only the rows referenced by
+  // 'offsets_' and 'sizes_' matter. A null buffer may be left behind by
+  // slicing or by rows that were overwritten in place.
+  if (!referencedEntriesMayHaveNulls_.has_value()) {
+    referencedEntriesMayHaveNulls_ = false;
+    for (vector_size_t i = 0; i < size(); ++i) {
+      if (rangeContainsNulls(*keys_, rawOffsets_[i], rawSizes_[i]) ||
+          rangeContainsNulls(*values_, rawOffsets_[i], rawSizes_[i])) {
+        referencedEntriesMayHaveNulls_ = true;
+        break;
+      }
+    }
+  }
+  return referencedEntriesMayHaveNulls_.value();
+}
+
 std::optional<int32_t> MapVector::compare(
     const BaseVector* other,
     vector_size_t index,
@@ -1261,6 +1331,7 @@ void MapVector::validate(const VectorValidateOptions& options) const {
 void MapVector::copyRanges(
     const BaseVector* source,
     const folly::Range<const CopyRange*>& ranges) {
+  referencedEntriesMayHaveNulls_.reset();
   copyRangesImpl(source, ranges, &values_, &keys_);
 }
 
@@ -418,6 +418,7 @@ class ArrayVector : public ArrayVectorBase {
   void setElements(VectorPtr elements) {
     elements_ = BaseVector::getOrCreateEmpty(
         std::move(elements), type()->childAt(0), pool_);
+    referencedElementsMayHaveNulls_.reset();
   }
 
   void copyRanges(
@@ -445,17 +446,28 @@ class ArrayVector : public ArrayVectorBase {
   /// elements vector.
   void prepareForReuse() override;
 
-  bool mayHaveNullsRecursive() const override {
-    return BaseVector::mayHaveNullsRecursive() ||
-        elements_->mayHaveNullsRecursive();
-  }
+  /// Returns true if this vector may hold nulls at the top level or in the
+  /// ranges of 'elements_' referenced by 'offsets_' and 'sizes_'. Nulls in
+  /// unreferenced element rows, e.g. left behind by slicing, do not count.
+  /// The answer is memoized and reset when the vector is mutated.
+  bool mayHaveNullsRecursive() const override;
 
   VectorPtr slice(vector_size_t offset, vector_size_t length) const override;
 
   void validate(const VectorValidateOptions& options) const override;
 
+ protected:
+  virtual void resetDataDependentFlags(const SelectivityVector* rows) override {
+    BaseVector::resetDataDependentFlags(rows);
+    referencedElementsMayHaveNulls_.reset();
+  }
+
  private:
   VectorPtr elements_;
+
+  // Memoized result of scanning the referenced ranges of 'elements_' for
+  // nulls. Unset if the scan hasn't run since the last mutation.
+  mutable std::optional<bool> referencedElementsMayHaveNulls_;
 };
 
 class MapVector : public ArrayVectorBase {
@@ -545,6 +557,7 @@ class MapVector : public ArrayVectorBase {
         std::move(keys), type()->childAt(0), pool_);
     values_ = BaseVector::getOrCreateEmpty(
         std::move(values), type()->childAt(1), pool_);
+    referencedEntriesMayHaveNulls_.reset();
   }
 
   void copyRanges(
@@ -585,10 +598,11 @@ class MapVector : public ArrayVectorBase {
   /// the keys and values vectors.
   void prepareForReuse() override;
 
-  bool mayHaveNullsRecursive() const override {
-    return BaseVector::mayHaveNullsRecursive() ||
-        keys_->mayHaveNullsRecursive() || values_->mayHaveNullsRecursive();
-  }
+  /// Returns true if this vector may hold nulls at the top level or in the
+  /// ranges of 'keys_' or 'values_' referenced by 'offsets_' and 'sizes_'.
+  /// Nulls in unreferenced entry rows, e.g. left behind by slicing, do not
+  /// count. The answer is memoized and reset when the vector is mutated.
+  bool mayHaveNullsRecursive() const override;
 
   VectorPtr slice(vector_size_t offset, vector_size_t length) const override;
 
@@ -598,6 +612,7 @@ class MapVector : public ArrayVectorBase {
   virtual void resetDataDependentFlags(const SelectivityVector* rows) override {
     BaseVector::resetDataDependentFlags(rows);
     sortedKeys_ = false;
+    referencedEntriesMayHaveNulls_.reset();
   }
 
  private:
@@ -612,6 +627,10 @@ class MapVector : public ArrayVectorBase {
   VectorPtr keys_;
   VectorPtr values_;
   bool sortedKeys_;
+
+  // Memoized result of scanning the referenced ranges of 'keys_' and 'values_'
+  // for nulls. Unset if the scan hasn't run since the last mutation.
+  mutable std::optional<bool> referencedEntriesMayHaveNulls_;
 };
 
 using RowVectorPtr = std::shared_ptr<RowVector>;
@@ -543,7 +543,7 @@ inline void FlatVector<bool>::resizeValues(
   // https://github.com/facebookincubator/velox/issues/6562.
   if (values_ && !values_->isView()) {
     const uint64_t newByteSize = BaseVector::byteSize<bool>(newSize);
-    if (values_->size() < newByteSize) {
+    if (values_->capacity() < newByteSize) {
       AlignedBuffer::reallocate<bool>(&values_, newSize, initialValue);
     } else {
       values_->setSize(newByteSize);
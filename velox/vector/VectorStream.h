@@ -70,6 +70,14 @@ class VectorSerde {
     virtual ~Options() {}
   };
 
+  /// Returns true if estimateSerializedSize() estimates each column
+  /// independently and can be invoked column by column. Row-oriented serdes
+  /// return false; they estimate whole rows and must be given the full row
+  /// vector.
+  virtual bool estimatesSerializedSizeByColumn() const {
+    return true;
+  }
+
   virtual void estimateSerializedSize(
       VectorPtr vector,
       const folly::Range<const IndexRange*>& ranges,
@@ -141,6 +149,21 @@ class VectorStreamGroup : public StreamArena {
   // Writes the contents to 'stream' in wire format.
   void flush(OutputStream* stream);
 
+  /// True if createStreamTree() has been called since construction or the
+  /// last clear().
+  bool hasStreamTree() const {
+    return serializer_ != nullptr;
+  }
+
+  /// Resets the group for reuse after flush(). Drops the serializer and keeps
+  /// most of the arena memory, so serializing the next page does not pay the
+  /// allocation cost again. Call createStreamTree() before appending more
+  /// data.
+  void clear() override {
+    serializer_.reset();
+    StreamArena::clear();
+  }
+
   // Reads data in wire format. Returns the RowVector in 'result'.
   static void read(
       ByteStream* source,
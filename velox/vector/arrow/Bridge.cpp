@@ -520,6 +520,50 @@ void exportValues(
   holder.setBuffer(1, values);
 }
 
+// Returns the address of the first payload byte if the strings of 'vec'
+// selected by 'rows' can be exported without copying, nullptr otherwise.
+// Arrow derives the extent of value i from offsets i and i + 1, so every
+// value must be stored out of line in the vector's single string buffer, laid
+// out back to back in row order. Inlined (short) values have no backing bytes
+// in the buffer and force the copying path.
+const char* contiguousStringPayload(
+    const FlatVector<StringView>& vec,
+    const Selection& rows) {
+  const auto& buffers = vec.stringBuffers();
+  if (buffers.size() != 1) {
+    return nullptr;
+  }
+  const char* start = nullptr;
+  const char* expected = nullptr;
+  bool contiguous = true;
+  rows.apply([&](vector_size_t i) {
+    if (!contiguous || vec.isNullAt(i)) {
+      return;
+    }
+    const auto view = vec.valueAtFast(i);
+    if (view.size() == 0) {
+      return;
+    }
+    if (view.isInline() || (expected != nullptr && view.data() != expected)) {
+      contiguous = false;
+      return;
+    }
+    if (start == nullptr) {
+      start = view.data();
+    }
+    expected = view.data() + view.size();
+  });
+  if (!contiguous || start == nullptr) {
+    return nullptr;
+  }
+  const char* bufferStart = buffers.front()->as<char>();
+  if (start < bufferStart ||
+      expected - bufferStart > std::numeric_limits<int32_t>::max()) {
+    return nullptr;
+  }
+  return start;
+}
+
 void exportStrings(
     const FlatVector<StringView>& vec,
     const Selection& rows,
@@ -527,6 +571,26 @@ void exportStrings(
     memory::MemoryPool* pool,
     VeloxToArrowBridgeHolder& holder) {
   out.n_buffers = 3;
+  if (const char* payloadStart = contiguousStringPayload(vec, rows)) {
+    // Zero-copy: reference the vector's string buffer and only materialize the
+    // offsets, relative to the start of the buffer. The holder keeps the
+    // BufferPtr alive until the consumer calls the array's release callback.
+    const auto& payload = vec.stringBuffers().front();
+    holder.setBuffer(2, payload);
+    auto offsetLen = checkedPlus<size_t>(out.length, 1);
+    holder.setBuffer(1, AlignedBuffer::allocate<int32_t>(offsetLen, pool));
+    auto* rawOffsets = holder.getBufferAs<int32_t>(1);
+    *rawOffsets = payloadStart - payload->as<char>();
+    rows.apply([&](vector_size_t i) {
+      auto newOffset = *rawOffsets;
+      if (!vec.isNullAt(i)) {
+        newOffset += vec.valueAtFast(i).size();
+      }
+      *++rawOffsets = newOffset;
+    });
+    return;
+  }
+
   size_t bufSize = 0;
   rows.apply([&](vector_size_t i) {
     if (!vec.isNullAt(i)) {
@@ -488,6 +488,38 @@ TEST_F(ArrowBridgeArrayExportTest, flatString) {
   testFlatVector<std::string>({});
 }
 
+TEST_F(ArrowBridgeArrayExportTest, flatStringZeroCopy) {
+  // All values are stored out of line, back to back in the vector's single
+  // string buffer, so the export must reference the buffer instead of copying
+  // the payload.
+  std::vector<std::optional<std::string>> inputData = {
+      "the first string, long enough not to be inlined",
+      std::nullopt,
+      "the second string, also long enough not to be inlined",
+      "the third string, likewise too long to be stored inline",
+  };
+  auto flatVector = vectorMaker_.flatVectorNullable(inputData);
+  ArrowArray arrowArray;
+  velox::exportToArrow(flatVector, arrowArray, pool_.get());
+
+  validateArray(inputData, arrowArray);
+  ASSERT_EQ(1, flatVector->stringBuffers().size());
+  EXPECT_EQ(
+      flatVector->stringBuffers().front()->as<char>(), arrowArray.buffers[2]);
+  arrowArray.release(&arrowArray);
+
+  // A short value is stored inline in its StringView and has no bytes in the
+  // string buffer, so the payload gets copied.
+  inputData[1] = "tiny";
+  auto copiedVector = vectorMaker_.flatVectorNullable(inputData);
+  velox::exportToArrow(copiedVector, arrowArray, pool_.get());
+
+  validateArray(inputData, arrowArray);
+  EXPECT_NE(
+      copiedVector->stringBuffers().front()->as<char>(), arrowArray.buffers[2]);
+  arrowArray.release(&arrowArray);
+}
+
 TEST_F(ArrowBridgeArrayExportTest, rowVector) {
   std::vector<std::optional<int64_t>> col1 = {1, 2, 3, 4};
   std::vector<std::optional<double>> col2 = {99.9, 88.8, 77.7, std::nullopt};
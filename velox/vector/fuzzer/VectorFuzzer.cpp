@@ -18,6 +18,8 @@
 
 #include <boost/random/uniform_int_distribution.hpp>
 #include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
 #include <codecvt>
 #include <locale>
 
@@ -299,6 +301,176 @@ void fuzzFlatPrimitiveImpl(
   }
 }
 
+// SplitMix64. Block RNG used by the bulk generation path: one 64-bit value
+// per multiply-xor round and a single word of state, so bulk fills are close
+// to memory-bandwidth bound. Streams created from nearby seeds are
+// independent, which makes it suitable for deriving per-column seeds.
+class BulkRng {
+ public:
+  explicit BulkRng(uint64_t seed) : state_(seed) {}
+
+  uint64_t next() {
+    uint64_t z = (state_ += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+  }
+
+  // Returns a uniform double in [0, 1).
+  double nextDouble01() {
+    return (next() >> 11) * (1.0 / (uint64_t(1) << 53));
+  }
+
+ private:
+  uint64_t state_;
+};
+
+// Fills 'values' with integers following 'opts.distribution'.
+template <typename T>
+void fillBulkIntegers(
+    T* values,
+    vector_size_t size,
+    BulkRng& rng,
+    const VectorFuzzer::Options& opts) {
+  using Distribution = VectorFuzzer::Options::Distribution;
+  const auto cardinality = std::max<int64_t>(1, opts.distributionCardinality);
+  switch (opts.distribution) {
+    case Distribution::kUniform:
+      for (vector_size_t i = 0; i < size; ++i) {
+        values[i] = static_cast<T>(rng.next());
+      }
+      break;
+    case Distribution::kZipfian: {
+      // Invert the approximate zipf CDF P(X <= x) = 1 - x^(1 - s), so low
+      // ranks come out heavily over-represented.
+      const double inverseSkew = -1.0 / (opts.zipfExponent - 1);
+      for (vector_size_t i = 0; i < size; ++i) {
+        const double rank =
+            std::pow(1.0 - rng.nextDouble01(), inverseSkew) - 1;
+        values[i] = static_cast<T>(
+            rank >= cardinality ? cardinality - 1
+                                : static_cast<int64_t>(rank));
+      }
+      break;
+    }
+    case Distribution::kSorted:
+      for (vector_size_t i = 0; i < size; ++i) {
+        values[i] = static_cast<T>(rng.next());
+      }
+      std::sort(values, values + size);
+      break;
+    case Distribution::kClustered:
+      for (vector_size_t i = 0; i < size;) {
+        const auto value = static_cast<T>(rng.next() % cardinality);
+        for (auto run = 1 + (rng.next() & 15); run > 0 && i < size; --run) {
+          values[i++] = value;
+        }
+      }
+      break;
+  }
+}
+
+Timestamp bulkTimestamp(BulkRng& rng, const VectorFuzzer::Options& opts) {
+  switch (opts.timestampPrecision) {
+    case VectorFuzzer::Options::TimestampPrecision::kNanoSeconds:
+      return Timestamp(
+          static_cast<int32_t>(rng.next()), rng.next() % MAX_NANOS);
+    case VectorFuzzer::Options::TimestampPrecision::kMicroSeconds:
+      return Timestamp::fromMicros(static_cast<int64_t>(rng.next()));
+    case VectorFuzzer::Options::TimestampPrecision::kMilliSeconds:
+      return Timestamp::fromMillis(static_cast<int64_t>(rng.next()));
+    case VectorFuzzer::Options::TimestampPrecision::kSeconds:
+      return Timestamp(static_cast<int32_t>(rng.next()), 0);
+  }
+  return {}; // no-op.
+}
+
+template <TypeKind kind>
+VectorPtr fuzzFlatBulkPrimitive(
+    memory::MemoryPool* pool,
+    const TypePtr& type,
+    vector_size_t size,
+    BulkRng& rng,
+    const VectorFuzzer::Options& opts) {
+  using TFlat = typename KindToFlatVector<kind>::type;
+  using TCpp = typename TypeTraits<kind>::NativeType;
+
+  auto vector = BaseVector::create(type, size, pool);
+  auto* flatVector = vector->as<TFlat>();
+
+  if constexpr (std::is_same_v<TCpp, bool>) {
+    auto* rawBits = flatVector->template mutableRawValues<uint64_t>();
+    for (size_t i = 0; i < bits::nwords(size); ++i) {
+      rawBits[i] = rng.next();
+    }
+  } else if constexpr (std::is_same_v<TCpp, StringView>) {
+    // Draw the lengths first, then fill all string bytes into one contiguous
+    // buffer, 8 random printable ASCII characters per RNG call.
+    const size_t maxLength = std::max<size_t>(1, opts.stringLength);
+    std::vector<int32_t> lengths(size);
+    size_t totalBytes = 0;
+    for (vector_size_t i = 0; i < size; ++i) {
+      lengths[i] = opts.stringVariableLength ? rng.next() % maxLength
+                                             : opts.stringLength;
+      totalBytes += lengths[i];
+    }
+    auto buffer = AlignedBuffer::allocate<char>(totalBytes, pool);
+    auto* rawBytes = buffer->asMutable<char>();
+    uint64_t word = 0;
+    for (size_t i = 0; i < totalBytes; ++i) {
+      if (i % 8 == 0) {
+        word = rng.next();
+      }
+      rawBytes[i] = '!' + (word & 0xff) % 94;
+      word >>= 8;
+    }
+    flatVector->setStringBuffers({buffer});
+    auto* rawValues = flatVector->mutableRawValues();
+    size_t offset = 0;
+    for (vector_size_t i = 0; i < size; ++i) {
+      rawValues[i] = StringView(rawBytes + offset, lengths[i]);
+      offset += lengths[i];
+    }
+  } else if constexpr (std::is_same_v<TCpp, Timestamp>) {
+    auto* rawValues = flatVector->mutableRawValues();
+    for (vector_size_t i = 0; i < size; ++i) {
+      rawValues[i] = bulkTimestamp(rng, opts);
+    }
+  } else if constexpr (std::is_same_v<TCpp, int128_t>) {
+    auto* rawValues = flatVector->mutableRawValues();
+    for (vector_size_t i = 0; i < size; ++i) {
+      rawValues[i] =
+          HugeInt::build(static_cast<int64_t>(rng.next()), rng.next());
+    }
+    if (type->isLongDecimal()) {
+      const auto precision = type->asLongDecimal().precision();
+      for (vector_size_t i = 0; i < size; ++i) {
+        rawValues[i] %= DecimalUtil::kPowersOfTen[precision];
+      }
+    }
+  } else if constexpr (std::is_floating_point_v<TCpp>) {
+    auto* rawValues = flatVector->mutableRawValues();
+    for (vector_size_t i = 0; i < size; ++i) {
+      rawValues[i] = static_cast<TCpp>(rng.nextDouble01());
+    }
+  } else {
+    auto* rawValues = flatVector->mutableRawValues();
+    fillBulkIntegers(rawValues, size, rng, opts);
+    if (type->isShortDecimal()) {
+      const auto precision = type->asShortDecimal().precision();
+      for (vector_size_t i = 0; i < size; ++i) {
+        rawValues[i] %= DecimalUtil::kPowersOfTen[precision];
+      }
+      if (opts.distribution ==
+          VectorFuzzer::Options::Distribution::kSorted) {
+        // Bounding by precision breaks the sorted order.
+        std::sort(rawValues, rawValues + size);
+      }
+    }
+  }
+  return vector;
+}
+
 // Servers as a wrapper around a vector that will be used to load a lazyVector.
 // Ensures that the loaded vector will only contain valid rows for the row set
 // that it was loaded for. NOTE: If the vector is a multi-level dictionary, the
@@ -701,6 +873,56 @@ RowVectorPtr VectorFuzzer::fuzzInputFlatRow(const RowTypePtr& rowType) {
       pool_, rowType, nullptr, size, std::move(children));
 }
 
+VectorPtr VectorFuzzer::fuzzFlatBulk(
+    const TypePtr& type,
+    vector_size_t size,
+    size_t seed) {
+  if (!type->isPrimitiveType()) {
+    // There is no bulk path for complex types; delegate to the regular flat
+    // fuzzer seeded with 'seed' so the result is still reproducible.
+    VectorFuzzer fuzzer(opts_, pool_, seed);
+    return fuzzer.fuzzFlat(type, size);
+  }
+  if (type->isUnKnown()) {
+    // All nulls; does not consume random values.
+    return fuzzFlatPrimitive(type, size);
+  }
+  if (opts_.distribution == Options::Distribution::kZipfian) {
+    VELOX_USER_CHECK_GT(
+        opts_.zipfExponent,
+        1.0,
+        "The zipfian bulk distribution requires zipfExponent > 1");
+  }
+
+  BulkRng rng(seed);
+  auto vector = VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+      fuzzFlatBulkPrimitive, type->kind(), pool_, type, size, rng, opts_);
+  if (opts_.nullRatio > 0) {
+    for (vector_size_t i = 0; i < size; ++i) {
+      if (rng.nextDouble01() < opts_.nullRatio) {
+        vector->setNull(i, true);
+      }
+    }
+  }
+  return vector;
+}
+
+RowVectorPtr VectorFuzzer::fuzzInputFlatRowBulk(
+    const RowTypePtr& rowType,
+    vector_size_t size,
+    size_t seed) {
+  std::vector<VectorPtr> children;
+  children.reserve(rowType->size());
+  for (auto i = 0; i < rowType->size(); ++i) {
+    // SplitMix64 streams of consecutive seeds are independent, so each column
+    // gets its own reproducible stream regardless of its siblings.
+    children.emplace_back(fuzzFlatBulk(rowType->childAt(i), size, seed + i));
+  }
+
+  return std::make_shared<RowVector>(
+      pool_, rowType, nullptr, size, std::move(children));
+}
+
 RowVectorPtr VectorFuzzer::fuzzRow(
     std::vector<VectorPtr>&& children,
     std::vector<std::string> childrenNames,
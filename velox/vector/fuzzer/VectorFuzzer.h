@@ -140,6 +140,31 @@ class VectorFuzzer {
     /// vectors. The generated lazy vectors can also have any number of
     /// dictionary layers on top of them.
     bool allowLazyVector{false};
+
+    /// Distribution of the integer values produced by the bulk generation
+    /// methods (fuzzFlatBulk() and fuzzInputFlatRowBulk()). Non-integer types
+    /// always get uniform values.
+    enum class Distribution : int8_t {
+      /// Independent uniformly distributed values.
+      kUniform = 0,
+      /// Zipf-like skew: low values are heavily over-represented. The number
+      /// of distinct values is bounded by `distributionCardinality`.
+      kZipfian = 1,
+      /// Values sorted in ascending order.
+      kSorted = 2,
+      /// Short runs of repeated values drawn from `distributionCardinality`
+      /// distinct values, mimicking clustered and RLE-friendly data.
+      kClustered = 3,
+    };
+    Distribution distribution{Distribution::kUniform};
+
+    /// Number of distinct values produced by the kZipfian and kClustered bulk
+    /// distributions.
+    int64_t distributionCardinality{1'000};
+
+    /// Skew of the kZipfian bulk distribution. Must be greater than 1; larger
+    /// values skew harder towards the low end.
+    double zipfExponent{1.5};
   };
 
   VectorFuzzer(
@@ -242,6 +267,26 @@ class VectorFuzzer {
   /// constant or dictionary-encoded vectors at any level.
   RowVectorPtr fuzzInputFlatRow(const RowTypePtr& rowType);
 
+  /// Fast path for generating large flat vectors. Values are filled in bulk
+  /// from a cheap block RNG seeded with 'seed' alone, without going through
+  /// per-value distribution objects and FlatVector::set(), so generation is
+  /// close to memory-bandwidth bound. The result is reproducible given 'seed'
+  /// and does not consume from (or depend on) the fuzzer's main RNG stream.
+  ///
+  /// Integer values follow `opts_.distribution`; strings are ASCII with
+  /// lengths controlled by the regular string options; nulls follow
+  /// `opts_.nullRatio`. Complex types have no bulk path and are delegated to
+  /// fuzzFlat() of a fuzzer seeded with 'seed'.
+  VectorPtr fuzzFlatBulk(const TypePtr& type, vector_size_t size, size_t seed);
+
+  /// Same as fuzzInputFlatRow(), but generates each child via fuzzFlatBulk()
+  /// with a seed derived from 'seed' and the child's position, so the content
+  /// of a column is reproducible regardless of the columns around it.
+  RowVectorPtr fuzzInputFlatRowBulk(
+      const RowTypePtr& rowType,
+      vector_size_t size,
+      size_t seed);
+
   // Generates a random type, including maps, vectors, and arrays. maxDepth
   // limits the maximum level of nesting for complex types. maxDepth <= 1 means
   // no complex types are allowed.
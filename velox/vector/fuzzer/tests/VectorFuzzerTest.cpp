@@ -713,6 +713,114 @@ TEST_F(VectorFuzzerTest, flatInputRow) {
   ASSERT_EQ(VectorEncoding::Simple::FLAT, mapValues->encoding());
 }
 
+TEST_F(VectorFuzzerTest, flatBulk) {
+  VectorFuzzer::Options opts;
+  opts.nullRatio = 0.2;
+  opts.stringVariableLength = true;
+  VectorFuzzer fuzzer(opts, pool());
+
+  std::vector<TypePtr> types = {
+      BOOLEAN(),
+      TINYINT(),
+      SMALLINT(),
+      INTEGER(),
+      BIGINT(),
+      REAL(),
+      DOUBLE(),
+      VARCHAR(),
+      VARBINARY(),
+      TIMESTAMP(),
+      DECIMAL(10, 2),
+      DECIMAL(30, 5)};
+
+  for (const auto& type : types) {
+    auto vector = fuzzer.fuzzFlatBulk(type, 10'000, 42);
+    ASSERT_TRUE(vector->type()->equivalent(*type)) << type->toString();
+    ASSERT_EQ(VectorEncoding::Simple::FLAT, vector->encoding());
+    ASSERT_EQ(10'000, vector->size());
+
+    // The result depends on the seed alone, not on the fuzzer's main RNG
+    // stream (consumed in between by fuzzFlat()).
+    fuzzer.fuzzFlat(type);
+    auto copy = fuzzer.fuzzFlatBulk(type, 10'000, 42);
+    for (vector_size_t i = 0; i < vector->size(); ++i) {
+      ASSERT_TRUE(vector->equalValueAt(copy.get(), i, i))
+          << type->toString() << " at " << i;
+    }
+  }
+}
+
+TEST_F(VectorFuzzerTest, flatBulkDistributions) {
+  VectorFuzzer::Options opts;
+  opts.distributionCardinality = 100;
+  VectorFuzzer fuzzer(opts, pool());
+
+  // Sorted: values are non-decreasing.
+  opts.distribution = VectorFuzzer::Options::Distribution::kSorted;
+  fuzzer.setOptions(opts);
+  auto sortedVector = fuzzer.fuzzFlatBulk(BIGINT(), 10'000, 42);
+  auto* sorted = sortedVector->asFlatVector<int64_t>();
+  for (vector_size_t i = 1; i < sorted->size(); ++i) {
+    ASSERT_LE(sorted->valueAt(i - 1), sorted->valueAt(i));
+  }
+
+  // Zipfian and clustered: bounded number of distinct values. Zipfian skews
+  // towards the low end, so the most frequent value must be 0.
+  for (auto distribution :
+       {VectorFuzzer::Options::Distribution::kZipfian,
+        VectorFuzzer::Options::Distribution::kClustered}) {
+    opts.distribution = distribution;
+    fuzzer.setOptions(opts);
+    auto vectorPtr = fuzzer.fuzzFlatBulk(BIGINT(), 10'000, 42);
+    auto* vector = vectorPtr->asFlatVector<int64_t>();
+    std::unordered_map<int64_t, int64_t> counts;
+    for (vector_size_t i = 0; i < vector->size(); ++i) {
+      auto value = vector->valueAt(i);
+      ASSERT_GE(value, 0);
+      ASSERT_LT(value, opts.distributionCardinality);
+      ++counts[value];
+    }
+    ASSERT_LE(counts.size(), opts.distributionCardinality);
+    if (distribution == VectorFuzzer::Options::Distribution::kZipfian) {
+      auto mostFrequent = std::max_element(
+          counts.begin(), counts.end(), [](const auto& a, const auto& b) {
+            return a.second < b.second;
+          });
+      ASSERT_EQ(0, mostFrequent->first);
+    }
+  }
+}
+
+TEST_F(VectorFuzzerTest, flatInputRowBulk) {
+  VectorFuzzer fuzzer({}, pool());
+  auto rowType = ROW({BIGINT(), VARCHAR(), ARRAY(BIGINT())});
+
+  auto vector = fuzzer.fuzzInputFlatRowBulk(rowType, 1'000, 42);
+  ASSERT_TRUE(vector->type()->kindEquals(rowType));
+  ASSERT_EQ(1'000, vector->size());
+  ASSERT_EQ(VectorEncoding::Simple::FLAT, vector->childAt(0)->encoding());
+  ASSERT_EQ(VectorEncoding::Simple::FLAT, vector->childAt(1)->encoding());
+  ASSERT_EQ(VectorEncoding::Simple::ARRAY, vector->childAt(2)->encoding());
+
+  // A column's content depends only on the seed and its position, so it can
+  // be regenerated standalone.
+  for (auto i = 0; i < rowType->size(); ++i) {
+    auto column = fuzzer.fuzzFlatBulk(rowType->childAt(i), 1'000, 42 + i);
+    for (vector_size_t row = 0; row < vector->size(); ++row) {
+      ASSERT_TRUE(vector->childAt(i)->equalValueAt(column.get(), row, row))
+          << "column " << i << " at " << row;
+    }
+  }
+
+  // Different seeds produce different data.
+  auto other = fuzzer.fuzzInputFlatRowBulk(rowType, 1'000, 43);
+  bool allEqual = true;
+  for (vector_size_t row = 0; row < vector->size() && allEqual; ++row) {
+    allEqual = vector->equalValueAt(other.get(), row, row);
+  }
+  ASSERT_FALSE(allEqual);
+}
+
 void VectorFuzzerTest::validateMaxSizes(VectorPtr vector, size_t maxSize) {
   if (vector->typeKind() == TypeKind::ARRAY) {
     validateMaxSizes(vector->template as<ArrayVector>()->elements(), maxSize);
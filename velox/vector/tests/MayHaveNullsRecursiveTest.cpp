@@ -117,6 +117,24 @@ TEST_F(MayHaveNullsRecursiveTest, arrayNullFree) {
   ASSERT_FALSE(arrayVector->mayHaveNullsRecursive());
 }
 
+TEST_F(MayHaveNullsRecursiveTest, arraySlicedNullFree) {
+  // All null elements belong to the first array. Slicing it away leaves an
+  // elements vector that carries a null buffer but holds no nulls in the
+  // referenced rows.
+  auto arrayVector = vectorMaker_.arrayVectorNullable<int32_t>(
+      {{{std::nullopt, 1}}, {{2, 3}}, {{4, 5, 6}}});
+
+  ASSERT_TRUE(arrayVector->mayHaveNullsRecursive());
+
+  auto sliced = arrayVector->slice(1, 2);
+  ASSERT_TRUE(sliced->as<ArrayVector>()->elements()->mayHaveNulls());
+  ASSERT_FALSE(sliced->mayHaveNullsRecursive());
+
+  // Nulls in referenced element rows are still reported.
+  sliced = arrayVector->slice(0, 2);
+  ASSERT_TRUE(sliced->mayHaveNullsRecursive());
+}
+
 TEST_F(MayHaveNullsRecursiveTest, mapHasNulls) {
   auto mapVector = generateMapVector({TestOptions::WITH_NULL_CONTAINERS});
 
@@ -135,6 +153,24 @@ TEST_F(MayHaveNullsRecursiveTest, mapNullFree) {
   ASSERT_FALSE(mapVector->mayHaveNullsRecursive());
 }
 
+TEST_F(MayHaveNullsRecursiveTest, mapSlicedNullFree) {
+  // All null values belong to the first map. Slicing it away leaves a values
+  // vector that carries a null buffer but holds no nulls in the referenced
+  // rows.
+  auto mapVector = vectorMaker_.mapVector<int32_t, int32_t>(
+      {{{1, std::nullopt}}, {{2, 20}}, {{3, 30}, {4, 40}}});
+
+  ASSERT_TRUE(mapVector->mayHaveNullsRecursive());
+
+  auto sliced = mapVector->slice(1, 2);
+  ASSERT_TRUE(sliced->as<MapVector>()->mapValues()->mayHaveNulls());
+  ASSERT_FALSE(sliced->mayHaveNullsRecursive());
+
+  // Nulls in referenced value rows are still reported.
+  sliced = mapVector->slice(0, 2);
+  ASSERT_TRUE(sliced->mayHaveNullsRecursive());
+}
+
 TEST_F(MayHaveNullsRecursiveTest, rowHasNulls) {
   auto rowVector = vectorMaker_.rowVector(
       {vectorMaker_.flatVectorNullable(generateIntInput()),
@@ -360,6 +360,64 @@ TEST(SelectivityVectorTest, iterator) {
   EXPECT_EQ(count, bits::countBits(&contiguous[0], 0, 240));
 }
 
+TEST(SelectivityVectorTest, applyToSelectedRuns) {
+  auto collectRuns = [](const SelectivityVector& rows) {
+    std::vector<std::pair<vector_size_t, vector_size_t>> runs;
+    rows.applyToSelectedRuns([&](vector_size_t begin, vector_size_t end) {
+      runs.emplace_back(begin, end);
+    });
+    return runs;
+  };
+
+  // Builds the expected runs row by row.
+  auto expectedRuns = [](const SelectivityVector& rows) {
+    std::vector<std::pair<vector_size_t, vector_size_t>> runs;
+    for (vector_size_t i = 0; i < rows.size(); ++i) {
+      if (!rows.isValid(i)) {
+        continue;
+      }
+      if (!runs.empty() && runs.back().second == i) {
+        ++runs.back().second;
+      } else {
+        runs.emplace_back(i, i + 1);
+      }
+    }
+    return runs;
+  };
+
+  using Runs = std::vector<std::pair<vector_size_t, vector_size_t>>;
+
+  SelectivityVector empty(100, false);
+  EXPECT_TRUE(collectRuns(empty).empty());
+
+  SelectivityVector all(1'000);
+  EXPECT_EQ(Runs({{0, 1'000}}), collectRuns(all));
+
+  SelectivityVector rows(1'000, false);
+  rows.setValidRange(3, 9, true); // Within one word.
+  rows.setValidRange(60, 70, true); // Crosses a word boundary.
+  rows.setValidRange(128, 320, true); // Covers whole words.
+  rows.setValid(500, true); // Single row.
+  rows.setValid(999, true); // Last row.
+  rows.updateBounds();
+  EXPECT_EQ(expectedRuns(rows), collectRuns(rows));
+
+  // Runs meeting exactly at a word boundary coalesce.
+  SelectivityVector adjacent(256, false);
+  adjacent.setValidRange(10, 64, true);
+  adjacent.setValidRange(64, 130, true);
+  adjacent.updateBounds();
+  EXPECT_EQ(Runs({{10, 130}}), collectRuns(adjacent));
+
+  // Every other row selected: all runs are single rows.
+  SelectivityVector sparse(130, false);
+  for (vector_size_t i = 1; i < 130; i += 2) {
+    sparse.setValid(i, true);
+  }
+  sparse.updateBounds();
+  EXPECT_EQ(expectedRuns(sparse), collectRuns(sparse));
+}
+
 TEST(SelectivityVectorTest, resize) {
   SelectivityVector vector(64, false);
   vector.resize(128, /* value */ true);